@@ -0,0 +1,859 @@
+/**
+**************************************************
+* @file kernel.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for host kernel functionality
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Mirrors the stm kernel to run the portable kernel
+      in host tests. Tasks are executed as user contexts,
+      interrupts are emulated by a mask and a pending
+      PendSV flag, which is served as soon as interrupts
+      are enabled outside of an interrupt.
+  (#) BASEPRI is emulated by an interrupt mask. The tick and
+      PendSV have the lowest priority, interrupts raised by
+      'kernel_host_raise_interrupt' above the mask are served
+      at once, the others on unmasking.
+  (#) Time only advances by calling 'kernel_host_tick',
+      'kernel_delay_blocking' or while the kernel is idle.
+      That keeps every test run deterministic.
+
+  (#) Call 'kernel_update' to update certain kernel components
+  (#) Call 'kernel_schedule_task' to switch to the next runnable task
+  (#) Call 'kernel_start_task' to specify the next runnable task
+  (#) Call 'kernel_swap_task' to choose the next runnable task if
+      the current running task is blocked
+
+  (#) Call 'kernel_set_status' to set the kernels status
+  (#) Call 'kernel_set_stack_pointer' to set the stack pointer
+  (#) Call 'kernel_delay_blocking' to busy the running task without
+      context switch, every millisecond raises a tick
+  (#) Call 'kernel_get_tick' to get the host tick count
+  (#) Call 'kernel_get_cycles' to get the monotonic nanoseconds,
+      which are the cycles of the cpu accounting on the host
+  (#) Call 'kernel_get_skipped_ticks' to get the amount of ticks
+      suppressed by tickless idle
+  (#) Call 'kernel_host_tick' to raise a single tick interrupt
+  (#) Call 'kernel_host_raise_interrupt' to raise an interrupt
+      with a priority
+  (#) Call 'kernel_host_set_expiry_hook' to call a function after
+      every task released by a tick
+
+  (#) Call 'kernel_enter_idle' to enter Idle mode
+  (#) Call 'kernel_exit_idle' to exit Idle mode
+  (#) Call 'kernel_disable_interrupts' to disable interrupts
+  (#) Call 'kernel_enable_interrupts' to enable interrupts
+  (#) Call 'kernel_mask_interrupts' to mask interrupts up to
+      KERNEL_MAX_SYSCALL_PRIORITY
+  (#) Call 'kernel_unmask_interrupts' to unmask interrupts
+  (#) Call 'kernel_validate_interrupt_priority' to abort an interrupt,
+      which calls the kernel above KERNEL_MAX_SYSCALL_PRIORITY
+
+  (#) Call 'kernel_task_terminate' as return function from a task
+  (#) Call 'kernel_reset_task_context' to forget the context of
+      a reaped task, so its id can be used by a new task
+  (#) Call 'kernel_shutdown' to return from 'kernel_start'
+==================================================
+@endverbatim
+**************************************************
+*/
+
+
+#include "kernel/kernel.h"
+#include "kernel/semaphore.h"
+#include "kernel/tickless.h"
+#include "utils/dictionary.h"
+#include "utils/bitmap.h"
+#include "utils/support.h"
+#include <ucontext.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+// host contexts need far more stack than the tasks stack on the target
+#define KERNEL_HOST_STACK_SIZE              (64u * 1024u)
+// the tick and PendSV have the lowest priority as on the target
+#define KERNEL_HOST_INTERRUPT_PRIORITY      UINT8_MAX
+#define KERNEL_HOST_MAX_PENDING_INTERRUPTS  8
+
+size_t kernel_start_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task);
+size_t kernel_swap_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task);
+size_t kernel_set_status(Kernel_Status_e status);
+size_t kernel_set_stack_pointer(void);
+
+
+task_t                  *g_running_task_current             = NULL;
+task_t                  *g_running_task_next                = NULL;
+task_t                  *g_running_task_previous            = NULL;
+Kernel_Status_e         g_kernel_status                     = EN_KERNEL_NOT_INITIALIZED;
+uint32_t                g_task_start_time                   = 0;
+
+size_t                  g_dictionary_priority               = 0;
+size_t                  g_dictionary_priority_next          = 1;
+
+linked_list_element_t   *g_linked_list_task_iterator        = NULL;
+linked_list_element_t   *g_linked_list_task_iterator_next   = NULL;
+
+dictionary_t            *g_prioritized_tasks                = NULL;
+
+linked_list_t           *g_priority_group_current           = NULL;
+linked_list_t           *g_priority_group_next              = NULL;
+
+extern  linked_list_t   *g_terminated_tasks_list;
+extern  bitmap_t        *g_ready_priorities;
+
+
+extern  size_t          g_kernel_critical_nesting;
+extern  linked_list_t   *g_delayed_tasks;
+extern  timer_wheel_t   *g_timer_wheel;
+
+
+extern size_t g_available_tasks;
+extern size_t kernel_reinsert_task(linked_list_t **source, linked_list_element_t **element, task_t **task);
+extern size_t kernel_update_ready_priority(size_t priority);
+extern size_t kernel_reap_terminated_tasks(void);
+extern void kernel_cpu_switch(task_t *task);
+extern void kernel_cpu_enter_idle(void);
+extern void kernel_cpu_tick(void);
+void kernel_task_terminate(void);
+void kernel_reset_task_context(uint8_t task_id);
+
+static void kernel_host_task_entry(void);
+static void kernel_host_exit_interrupt(void);
+static bool kernel_host_is_masked(uint8_t priority);
+static void kernel_host_serve_pending(void);
+static void kernel_host_run_interrupt(uint8_t priority, void (*handler)(void));
+
+typedef struct kernel_host_interrupt {
+    uint8_t priority;                   ///< priority of the interrupt, a lower number means a higher priority
+    void (*handler)(void);              ///< interrupt service routine
+} kernel_host_interrupt_t;
+
+// every task id owns a context, which is prepared on its first schedule
+static ucontext_t       g_host_contexts[KERNEL_MAX_TASK];
+static bool             g_host_context_prepared[KERNEL_MAX_TASK];
+static uint8_t          g_host_stacks[KERNEL_MAX_TASK][KERNEL_HOST_STACK_SIZE];
+// context of the caller of kernel_start, which is resumed by kernel_shutdown
+static ucontext_t       g_host_main_context;
+// task, whose context is currently executed, NULL for the caller of kernel_start
+static task_t           *g_host_running_task                = NULL;
+
+static size_t           g_host_tick                         = 0;
+static bool             g_host_interrupts_disabled          = false;
+// emulated BASEPRI, 0 masks nothing
+static uint8_t          g_host_interrupt_mask               = 0;
+static bool             g_host_in_interrupt                 = false;
+// priority of the raised interrupt, which is served right now
+static uint8_t          g_host_interrupt_priority           = KERNEL_HOST_INTERRUPT_PRIORITY;
+// ticks raised while interrupts were disabled, they are served later to keep the time exact
+static size_t           g_host_pending_ticks                = 0;
+static bool             g_host_pendsv_pending               = false;
+static bool             g_host_stopped                      = false;
+// interrupts raised while they were masked
+static kernel_host_interrupt_t g_host_pending_interrupts[KERNEL_HOST_MAX_PENDING_INTERRUPTS];
+static size_t           g_host_pending_interrupt_count      = 0;
+// called after every task released by a tick, e.g. to raise an interrupt in the middle of the expiry
+static void             (*g_host_expiry_hook)(void)         = NULL;
+
+/**
+ * @brief Update the kernel and its components.
+ * @param None
+ * */
+void kernel_update(void) {
+
+    // update system components
+    g_host_tick++;
+    // exit immediately, if kernel is not running yet
+    if (g_running_task_current == NULL
+            || g_kernel_status == EN_KERNEL_NOT_INITIALIZED
+            || g_kernel_status == EN_KERNEL_ERROR) {
+        return;
+    }
+
+    g_host_in_interrupt = true;
+    // idle advances the time by ticks, which are part of idle on the host instead of interrupts
+    bool accounted = g_kernel_status != EN_KERNEL_IDLE;
+    if (accounted) {
+        kernel_cpu_isr_enter();
+    }
+
+    // the running task is only preempted on its time quantum, if it is outside of a critical section
+    bool preemptible = g_kernel_critical_nesting == 0;
+
+    // ------------------- critical section start -------------------------
+    // the tick has the lowest priority, so '_from_isr' calls of other interrupts must not change
+    // the timing wheel, the priority groups or the waiting lists in the middle of the expiry
+    kernel_enter_critical();
+
+    // release every delayed task, whose timeout expired on this tick, in one pass
+    size_t status = -1;
+    size_t ready_priority = 0;
+    timer_wheel_node_t *expired = NULL;
+    timer_wheel_tick(&g_timer_wheel, &expired);
+    while (expired != NULL) {
+        // expired nodes are chained by next, which has to be read before the task is reinserted
+        timer_wheel_node_t *next = expired->next;
+        task_t *task = (task_t *) expired->data;
+        linked_list_element_t *element = &task->list_element;
+
+        // reinsert task from the delay list or from the waiting list of an object to its priority group
+        linked_list_t *source = task->blocked_timeout_list != NULL ? task->blocked_timeout_list : g_delayed_tasks;
+        status = kernel_reinsert_task(&source, &element, &task);
+        expired = next;
+
+        if (g_host_expiry_hook != NULL) {
+            g_host_expiry_hook();
+        }
+    }
+
+
+    // check if time quantum has elapsed and update kernel state,
+    // the owner of a ceiling mutex is only preempted by a higher priority
+    if (g_running_task_current->time_quantum_remaining == 0
+            && preemptible
+            && g_kernel_status != EN_KERNEL_IDLE
+            && (g_running_task_current->ceiling_locks == 0
+                || g_running_task_next->task_data->u8TaskPrio < g_running_task_current->task_data->u8TaskPrio)) {
+        // starting the next task ends the critical section
+        kernel_start_task(&g_priority_group_next, &g_linked_list_task_iterator_next, &g_running_task_next);
+    }
+    else if (g_kernel_status == EN_KERNEL_IDLE
+            && (status == KERNEL_SUCCESS || bitmap_get_first(&g_ready_priorities, &ready_priority) == BITMAP_SUCCESS)) {
+        // exit idle, a delayed task was released or an interrupt made a task ready
+        kernel_exit_idle();
+    }
+    else if (g_running_task_current->time_quantum_remaining > 0) {
+        // decrement time quantum
+        g_running_task_current->time_quantum_remaining--;
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    kernel_cpu_tick();
+    if (accounted) {
+        kernel_cpu_isr_exit();
+    }
+    g_host_in_interrupt = false;
+}
+
+/**
+ * @brief Executes the task context switch.
+ * @param None
+ * @return None
+ * */
+void kernel_schedule_task(void) {
+
+    // PendSV is served once and masks interrupts while switching
+    g_host_pendsv_pending = false;
+    g_host_in_interrupt = true;
+    g_host_interrupts_disabled = true;
+
+    task_reset_time_quantum_remaining(&g_running_task_current);
+    task_set_state(&g_running_task_current, TaskState_Running);
+
+    // a task always resumes outside of a critical section
+    g_kernel_critical_nesting = 0;
+
+    task_t *previous_task = g_host_running_task;
+    task_t *next_task = g_running_task_current;
+    kernel_cpu_switch(next_task);
+
+    // leave the PendSV routine
+    g_host_in_interrupt = false;
+    g_host_interrupts_disabled = false;
+
+    if (previous_task == next_task) {
+        return;
+    }
+
+    ucontext_t *previous_context = &g_host_main_context;
+    if (previous_task != NULL) {
+        previous_context = &g_host_contexts[previous_task->task_data->u8TaskId];
+    }
+
+    // prepare the context on the first schedule, the task returns into kernel_task_terminate
+    uint8_t next_id = next_task->task_data->u8TaskId;
+    if (!g_host_context_prepared[next_id]) {
+        getcontext(&g_host_contexts[next_id]);
+        g_host_contexts[next_id].uc_stack.ss_sp = g_host_stacks[next_id];
+        g_host_contexts[next_id].uc_stack.ss_size = KERNEL_HOST_STACK_SIZE;
+        g_host_contexts[next_id].uc_link = NULL;
+        makecontext(&g_host_contexts[next_id], kernel_host_task_entry, 0);
+        g_host_context_prepared[next_id] = true;
+    }
+
+    g_host_running_task = next_task;
+    swapcontext(previous_context, &g_host_contexts[next_id]);
+}
+
+/**
+ * @brief It is called by the current running task, which shall be blocked.
+ *        Before it is blocked it might need to determine the next task.
+ *        If no task was found, the kernel will be set to idle.
+ * @param priority_group is a linked_list_t pointer of pointer to the task which shall be blocked.
+ * @param linked_list_element is a linked_list_element_t pointer of pointer to the task which shall be blocked.
+ * @param task is a task_t pointer of pointer to the task which shall be blocked.
+ */
+size_t kernel_swap_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task) {
+
+    // set task to blocked and check for errors, a terminated task stays deleted
+    task_t *task_blocked = (*task);
+    size_t status = TASK_SUCCESS;
+    if (task_blocked->task_data->eTaskState != TaskState_Deleted) {
+        status = task_set_state(task, TaskState_Blocked);
+    }
+    if (status != TASK_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
+    }
+
+    // check if next task was set
+    if ((*priority_group)->size == 0
+            || g_linked_list_task_iterator == NULL
+            || g_running_task_next == NULL) {
+
+        // determine next task by the highest ready priority group
+        linked_list_t *next_priority_group = NULL;
+        size_t next_priority = 0;
+        status = bitmap_get_first(&g_ready_priorities, &next_priority);
+        if (status == BITMAP_SUCCESS) {
+            status = dictionary_get(&g_prioritized_tasks, next_priority, (void **) &next_priority_group);
+        }
+
+        if (status != BITMAP_SUCCESS) {
+            // unable to find executable task in any priority, enter idle mode
+            kernel_enter_idle();
+            // assume next task was set by reinsert
+        }
+        else {
+            // Make sure we are in a critical section
+            if (g_kernel_critical_nesting == 0) {
+                kernel_enter_critical();
+            }
+
+            // update next task information
+            g_dictionary_priority = next_priority;
+            g_dictionary_priority_next = next_priority + 1;
+            g_priority_group_next = next_priority_group;
+            g_linked_list_task_iterator_next = g_priority_group_next->tail;
+            g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
+        }
+    }
+
+    // start next task and check for errors
+    status = kernel_start_task(&g_priority_group_next, &g_linked_list_task_iterator_next, &g_running_task_next);
+    if (status != KERNEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SWAP);
+    }
+
+    // the switch was already served, a blocked task only continues once it was released
+    if (task_blocked->task_data->eTaskState == TaskState_Blocked && !g_host_stopped) {
+        kernel_set_status(EN_KERNEL_ERROR);
+        return KERNEL_UNABLE_TO_SWAP;
+    }
+    return KERNEL_SUCCESS;
+}
+
+
+/**
+ * @brief Start the provided task and updates global information to the task by pending kernel_schedule_task.
+ *        A following task will be determined or the same task is selected if its priority group just contains 1 task.
+ * @param priority_group is a linked_list_t pointer of pointer to the task which shall be executed next.
+ * @param linked_list_element is a linked_list_element_t pointer of pointer to the task which shall be executed next.
+ * @param task is a task_t pointer of pointer to the task which shall be executed next.
+ * */
+size_t kernel_start_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task) {
+
+    // kernel_start continues on the host after the shutdown and must not start anything
+    if (g_host_stopped) {
+        return KERNEL_SUCCESS;
+    }
+
+    // update task state and check for errors
+    size_t status = task_set_state(task, TaskState_Ready);
+    if (status != TASK_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
+    }
+
+    // set time quantum
+    status = task_reset_time_quantum_remaining(task);
+    if (status != TASK_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
+    }
+
+
+    // set previous task and set it to ready if neither blocked nor terminated
+    g_running_task_previous = g_running_task_current;
+    if (g_running_task_previous != NULL
+            && g_running_task_previous->task_data->eTaskState != TaskState_Blocked
+            && g_running_task_previous->task_data->eTaskState != TaskState_Deleted) {
+        status = task_set_state(&g_running_task_previous, TaskState_Ready);
+        if (status != TASK_SUCCESS && status != TASK_NO_MEMORY) {
+            kernel_set_status(EN_KERNEL_ERROR);
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
+        }
+    }
+
+
+    // set current task information and preset next task
+    g_running_task_current = *task;
+    g_linked_list_task_iterator = *linked_list_element;
+    g_priority_group_current = *priority_group;
+    g_priority_group_next = *priority_group;
+
+    if (g_linked_list_task_iterator != NULL) {
+        // set next task
+        g_linked_list_task_iterator_next = g_linked_list_task_iterator->next;
+        if (g_linked_list_task_iterator_next == NULL) {
+            // end of priority group and restart with first element
+            g_linked_list_task_iterator_next = g_priority_group_current->tail;
+        }
+        g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
+        g_dictionary_priority_next = g_dictionary_priority + 1;
+    }
+    else if (g_priority_group_current->size == 0) {
+        // jump to the highest ready priority group
+        size_t next_priority = g_dictionary_priority_next;
+        bitmap_get_first(&g_ready_priorities, &next_priority);
+        dictionary_get(&g_prioritized_tasks, next_priority, (void **) &g_priority_group_current);
+        g_priority_group_next = g_priority_group_current;
+        g_linked_list_task_iterator = g_priority_group_current->tail;
+        g_running_task_current = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator);
+        g_dictionary_priority = next_priority;
+    }
+    else {
+        // end of priority group and restart with first element
+        g_linked_list_task_iterator = g_priority_group_current->tail;
+        g_running_task_current = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator);
+        g_linked_list_task_iterator_next = g_linked_list_task_iterator->next;
+        g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
+        g_dictionary_priority_next = g_dictionary_priority + 1;
+    }
+
+    // ------------------- critical section end ----------------------------
+    g_host_pendsv_pending = true; // set PendSV-Flag
+
+    // PendSV is served once unmasked, a blocked task leaves all its critical sections
+    g_kernel_critical_nesting = 0;
+    kernel_unmask_interrupts();
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Set the kernel status depending on the kernel state.
+ * It sets the error state on a wrong transition instead of blocking the host.
+ * @return 0 on success or greater 0 on error
+ * */
+size_t kernel_set_status(Kernel_Status_e status) {
+
+    // kernel_start continues on the host after the shutdown
+    if (g_host_stopped) {
+        return KERNEL_SUCCESS;
+    }
+
+    // finite state machine for kernel states
+    bool allowed = false;
+    switch (status) {
+        case EN_KERNEL_STARTING:
+            allowed = g_kernel_status == EN_KERNEL_NOT_INITIALIZED;
+            break;
+        case EN_KERNEL_RUNNING:
+            allowed = g_kernel_status == EN_KERNEL_STARTING || g_kernel_status == EN_KERNEL_IDLE;
+            break;
+        case EN_KERNEL_IDLE:
+            allowed = g_kernel_status == EN_KERNEL_RUNNING;
+            break;
+        default :
+            allowed = false;
+    }
+
+    if (!allowed) {
+        g_kernel_status = EN_KERNEL_ERROR;
+        kernel_shutdown();
+        return KERNEL_UNABLE_TO_SCHEDULE_TASK;
+    }
+
+    g_kernel_status = status;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief The caller of kernel_start keeps its own stack on the host.
+ * @return None
+ * */
+size_t kernel_set_stack_pointer(void) {
+    return KERNEL_SUCCESS;
+}
+
+
+/**
+ * @brief Resets the emulated system, so the kernel can be initialized again in the same process.
+ * @return None
+ * */
+void kernel_set_system_functions(void) {
+
+    memset(g_host_context_prepared, 0, sizeof(g_host_context_prepared));
+    g_host_running_task = NULL;
+    g_host_tick = 0;
+    g_host_interrupts_disabled = false;
+    g_host_interrupt_mask = 0;
+    g_host_in_interrupt = false;
+    g_host_pending_ticks = 0;
+    g_host_pendsv_pending = false;
+    g_host_stopped = false;
+    g_host_pending_interrupt_count = 0;
+    g_kernel_critical_nesting = 0;
+
+    g_running_task_current = NULL;
+    g_running_task_next = NULL;
+    g_running_task_previous = NULL;
+    g_kernel_status = EN_KERNEL_NOT_INITIALIZED;
+    g_dictionary_priority = 0;
+    g_dictionary_priority_next = 1;
+    g_linked_list_task_iterator = NULL;
+    g_linked_list_task_iterator_next = NULL;
+    g_priority_group_current = NULL;
+    g_priority_group_next = NULL;
+}
+
+/**
+ * @brief Busies the running task by the amount in milliseconds without context switch.
+ *        Every millisecond raises a tick, which might preempt the task.
+ * @param delay_millisecods is size_t, which is the amount to delay the current running task.
+ * @return None
+ * */
+void kernel_delay_blocking(size_t delay_millisecods) {
+
+    for (size_t tick = 0; tick < delay_millisecods; tick++) {
+        kernel_host_tick();
+    }
+}
+
+/**
+ * @brief Returns current Tick amount.
+ * @return None
+ * */
+size_t kernel_get_tick(void) {
+    return g_host_tick;
+}
+
+/**
+ * @brief Returns the monotonic nanoseconds of the host as cycles, which unlike the time stamp counter
+ *        keep their rate on every core and under frequency scaling.
+ *        It is only used for measurements and never influences the scheduling.
+ * @return current cycle count
+ * */
+size_t kernel_get_cycles(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (size_t) now.tv_sec * 1000000000u + (size_t) now.tv_nsec;
+}
+
+/**
+ * @brief Ticks are never suppressed on the host, idle advances time tick by tick.
+ * @return 0
+ * */
+size_t kernel_get_skipped_ticks(void) {
+    return 0;
+}
+
+/**
+ * @brief Raises a tick interrupt, which is delayed while interrupts are disabled.
+ * @return None
+ * */
+void kernel_host_tick(void) {
+
+    if (kernel_host_is_masked(KERNEL_HOST_INTERRUPT_PRIORITY) || g_host_in_interrupt) {
+        g_host_pending_ticks++;
+        return;
+    }
+
+    kernel_update();
+    kernel_host_exit_interrupt();
+}
+
+/**
+ * @brief Sets a function, which is called after every task released by a tick, NULL removes it.
+ *        It emulates an interrupt, which arrives in the middle of a batch expiry.
+ * @param hook is a function pointer, which is called inside the tick interrupt.
+ * @return None
+ * */
+void kernel_host_set_expiry_hook(void (*hook)(void)) {
+    g_host_expiry_hook = hook;
+}
+
+/**
+ * @brief Raises an interrupt, which is delayed while its priority is masked.
+ *        Interrupts above KERNEL_MAX_SYSCALL_PRIORITY are only delayed by disabled interrupts.
+ * @param priority is uint8_t, which is the priority of the interrupt, a lower number means a higher priority.
+ * @param handler is a function pointer, which is executed as interrupt service routine.
+ * @return None
+ * */
+void kernel_host_raise_interrupt(uint8_t priority, void (*handler)(void)) {
+
+    if (kernel_host_is_masked(priority)) {
+        // further interrupts are lost like a pending bit, which is already set
+        if (g_host_pending_interrupt_count < KERNEL_HOST_MAX_PENDING_INTERRUPTS) {
+            g_host_pending_interrupts[g_host_pending_interrupt_count].priority = priority;
+            g_host_pending_interrupts[g_host_pending_interrupt_count].handler = handler;
+            g_host_pending_interrupt_count++;
+        }
+        return;
+    }
+
+    kernel_host_run_interrupt(priority, handler);
+    kernel_host_exit_interrupt();
+}
+
+/**
+ * @brief Enters idle state.
+ * @return None
+ * */
+void kernel_enter_idle(void) {
+
+    // set kernel to idle state to active block in debug session
+    kernel_set_status(EN_KERNEL_IDLE);
+    kernel_cpu_enter_idle();
+
+    // critical section cannot be active when idle
+    g_kernel_critical_nesting = 0;
+    g_host_interrupt_mask = 0;
+
+    // Make sure interrupts are enabled to be able to recover from idle
+    kernel_enable_interrupts();
+
+    // no task is ready, so terminated tasks are freed now
+    if (kernel_reap_terminated_tasks() != KERNEL_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+    }
+
+    // the tick is the only interrupt on the host, without timeouts no task can become ready again
+    while (g_kernel_status == EN_KERNEL_IDLE) {
+        if (g_timer_wheel->size == 0) {
+            kernel_shutdown();
+            return;
+        }
+        kernel_host_tick();
+    }
+}
+
+/**
+ * @brief Exits idle state.
+ * @return None
+ * */
+void kernel_exit_idle(void) {
+    kernel_set_status(EN_KERNEL_RUNNING);
+}
+
+
+/**
+ * @brief Disables interrupts.
+ * @return None
+ * */
+void kernel_disable_interrupts(void) {
+    g_host_interrupts_disabled = true;
+}
+
+/**
+ * @brief Enables interrupts and serves pending interrupts.
+ * @return None
+ * */
+void kernel_enable_interrupts(void) {
+    g_host_interrupts_disabled = false;
+    kernel_host_serve_pending();
+}
+
+/**
+ * @brief Masks every interrupt with a priority at or below KERNEL_MAX_SYSCALL_PRIORITY.
+ * @return None
+ * */
+void kernel_mask_interrupts(void) {
+    g_host_interrupt_mask = KERNEL_MAX_SYSCALL_PRIORITY;
+}
+
+/**
+ * @brief Unmasks all interrupts masked by kernel_mask_interrupts and serves pending interrupts.
+ * @return None
+ * */
+void kernel_unmask_interrupts(void) {
+    g_host_interrupt_mask = 0;
+    kernel_host_serve_pending();
+}
+
+/**
+ * @brief Aborts an interrupt, whose priority is never masked by the kernel, so it must not call the kernel.
+ *        Tasks and the tick run at the lowest priority.
+ * @return None
+ * */
+void kernel_validate_interrupt_priority(void) {
+    assert(g_host_interrupt_priority >= KERNEL_MAX_SYSCALL_PRIORITY);
+}
+
+/**
+ * @brief Terminates tasks by moving the task to a terminated task list.
+ * @return None
+ * */
+void kernel_task_terminate(void) {
+
+    // the terminated task leaves the critical section on the switch
+    kernel_enter_critical();
+
+    size_t status = linked_list_transfer(&g_terminated_tasks_list, &g_priority_group_current, &g_linked_list_task_iterator);
+    if (status != LINKED_LIST_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+    }
+    // the idle loop frees the task, once it was switched out
+    task_set_state(&g_running_task_current, TaskState_Deleted);
+
+    // the priority group might not be runnable anymore
+    status = kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+    if (status != KERNEL_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+    }
+
+    // check if all tasks terminated
+    if (g_available_tasks==g_terminated_tasks_list->size) {
+        kernel_shutdown();
+    }
+
+    // switch to next task
+    status = kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+    if (status != KERNEL_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+    }
+    // a terminated task is never resumed
+    kernel_shutdown();
+}
+
+/**
+ * @brief Forgets the context of a reaped task, a new task with its id gets a new context on its first schedule.
+ * @param task_id is uint8_t of the reaped task
+ * @return None
+ * */
+void kernel_reset_task_context(uint8_t task_id) {
+    g_host_context_prepared[task_id] = false;
+}
+
+/**
+ * @briefs Stops all tasks and returns from kernel_start.
+ * @return None
+ */
+void kernel_shutdown(void) {
+
+    g_host_stopped = true;
+    g_host_pendsv_pending = false;
+    g_host_interrupts_disabled = false;
+    g_host_interrupt_mask = 0;
+    g_host_in_interrupt = false;
+    g_kernel_critical_nesting = 0;
+
+    if (g_host_running_task == NULL) {
+        return;
+    }
+
+    ucontext_t *running_context = &g_host_contexts[g_host_running_task->task_data->u8TaskId];
+    g_host_running_task = NULL;
+    swapcontext(running_context, &g_host_main_context);
+}
+
+/**
+ * @brief Executes the task and terminates it on return, as the link register does on the target.
+ * @return None
+ * */
+static void kernel_host_task_entry(void) {
+    g_running_task_current->return_value = g_running_task_current->task_main();
+    kernel_task_terminate();
+}
+
+/**
+ * @brief Serves a pending PendSV on leaving an interrupt or the masked section.
+ * @return None
+ * */
+static void kernel_host_exit_interrupt(void) {
+    if (g_host_pendsv_pending && !kernel_host_is_masked(KERNEL_HOST_INTERRUPT_PRIORITY) && !g_host_in_interrupt && !g_host_stopped) {
+        kernel_schedule_task();
+    }
+}
+
+/**
+ * @brief Checks, if an interrupt of the given priority is delayed by the emulated PRIMASK or BASEPRI.
+ * @param priority is uint8_t, which is the priority of the interrupt.
+ * @return true, if the interrupt has to be delayed
+ * */
+static bool kernel_host_is_masked(uint8_t priority) {
+    return g_host_interrupts_disabled || (g_host_interrupt_mask != 0 && priority >= g_host_interrupt_mask);
+}
+
+/**
+ * @brief Serves the interrupts, which are no longer masked, by their priority.
+ * @return None
+ * */
+static void kernel_host_serve_pending(void) {
+
+    // raised interrupts have a higher priority than the tick and PendSV,
+    // each is removed before it runs, because a critical section in its routine serves the pending interrupts again
+    size_t index = 0;
+    while (index < g_host_pending_interrupt_count) {
+        kernel_host_interrupt_t interrupt = g_host_pending_interrupts[index];
+        if (kernel_host_is_masked(interrupt.priority)) {
+            index++;
+            continue;
+        }
+
+        g_host_pending_interrupt_count--;
+        for (size_t i = index; i < g_host_pending_interrupt_count; i++) {
+            g_host_pending_interrupts[i] = g_host_pending_interrupts[i + 1];
+        }
+        kernel_host_run_interrupt(interrupt.priority, interrupt.handler);
+        // the routine might have served or raised interrupts
+        index = 0;
+    }
+
+    if (g_host_in_interrupt) {
+        return;
+    }
+
+    while (g_host_pending_ticks > 0 && !kernel_host_is_masked(KERNEL_HOST_INTERRUPT_PRIORITY)) {
+        g_host_pending_ticks--;
+        kernel_update();
+        kernel_host_exit_interrupt();
+    }
+    kernel_host_exit_interrupt();
+}
+
+/**
+ * @brief Executes an interrupt service routine, the tick and PendSV are delayed until it returned.
+ *        The cycles of an interrupt, which is masked by the kernel, are accounted to interrupts.
+ * @param priority is uint8_t, which is the priority of the interrupt.
+ * @param handler is a function pointer, which is executed as interrupt service routine.
+ * @return None
+ * */
+static void kernel_host_run_interrupt(uint8_t priority, void (*handler)(void)) {
+    // the tick and PendSV have a lower priority and wait for the routine
+    bool in_interrupt = g_host_in_interrupt;
+    g_host_in_interrupt = true;
+    uint8_t interrupted_priority = g_host_interrupt_priority;
+    g_host_interrupt_priority = priority;
+    // interrupts above the kernel must not call it, so they stay accounted to the interrupted task
+    bool accounted = priority >= KERNEL_MAX_SYSCALL_PRIORITY;
+    if (accounted) {
+        kernel_cpu_isr_enter();
+    }
+    handler();
+    if (accounted) {
+        kernel_cpu_isr_exit();
+    }
+    g_host_interrupt_priority = interrupted_priority;
+    g_host_in_interrupt = in_interrupt;
+}
@@ -0,0 +1,87 @@
+/**
+**************************************************
+* @file event_group.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for event bits shared by several tasks
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'event_group_create' to create an event group
+  (#) Call 'event_group_create_static' to create an event
+      group in caller supplied storage
+  (#) Call 'event_group_delete' to delete an event group
+  (#) Call 'event_group_set' to set event bits
+  (#) Call 'event_group_clear' to clear event bits
+  (#) Call 'event_group_try' to satisfy the wait condition
+      of the running task
+  (#) Call 'event_group_release' to satisfy the wait
+      condition of a waiting task on behalf of a setter
+  (#) Call 'event_group_wait' to block a task until its
+      wait condition is satisfied
+  (#) All functions call 'event_group_checking' to validate
+      proper event group structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_EVENT_GROUP_H_
+#define KERNEL_EVENT_GROUP_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/linked_list.h"
+#include "kernel/task.h"
+
+/* Public Preprocessor defines */
+#define EVENT_GROUP_SUCCESS             0
+#define EVENT_GROUP_NO_MEMORY           1
+#define EVENT_GROUP_IS_NULL             2
+#define EVENT_GROUP_NO_WAITING_LIST     3
+#define EVENT_GROUP_NO_WANTED_EVENTS    4
+#define EVENT_GROUP_NOT_SATISFIED       5
+#define EVENT_GROUP_UNABLE_TO_WAIT      6
+
+#define EVENT_GROUP_LENGTH              3
+
+#define EVENT_GROUP_LINKED_LIST_ERROR_REGISTER EVENT_GROUP_LENGTH
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// Control information for an event group
+typedef struct {
+    size_t id;                          ///< event groups id
+    size_t events;                      ///< currently set event bits
+    linked_list_t *waiting_task_list;   ///< linked list for storing tasks waiting for event bits
+    bool allocated;                     ///< storage is released on delete, false for caller supplied storage
+} event_group_t;
+
+/// Storage for an event group including its waiting list
+typedef struct {
+    event_group_t event_group;          ///< event group, has to stay the first member
+    linked_list_t waiting_task_list;    ///< storage of the waiting list
+} event_group_static_t;
+
+/* Public functions (prototypes) */
+size_t event_group_create(event_group_t **event_group, size_t id);
+size_t event_group_create_static(event_group_t **event_group, event_group_static_t *storage, size_t id);
+size_t event_group_delete(event_group_t **event_group);
+size_t event_group_set(event_group_t **event_group, size_t events);
+size_t event_group_clear(event_group_t **event_group, size_t events);
+size_t event_group_try(event_group_t **event_group, event_group_wait_t *wait);
+size_t event_group_release(event_group_t **event_group, event_group_wait_t *wait, size_t *clear_events);
+size_t event_group_wait(event_group_t **event_group, linked_list_t **running_task_list, linked_list_element_t **running_task_element);
+
+size_t event_group_checking(event_group_t **event_group);
+
+#endif /* KERNEL_EVENT_GROUP_H_ */
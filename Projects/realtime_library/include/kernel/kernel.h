@@ -14,43 +14,193 @@
   (#) Call 'kernel_init' to initialize the kernel
   (#) Call 'kernel_deinit' to deinitialize the kernel
   (#) Call 'kernel_add_task' to add a task to be executed
+  (#) Call 'kernel_add_task_with_stack' to add a task with
+      an individual stack size or a provided stack buffer
+  (#) Call 'kernel_task_create' to create a task, which
+      also works while the kernel is running
+  (#) Call 'kernel_task_delete' to delete a task, its stack
+      is freed by the idle loop
   (#) Call 'kernel_start' to start the kernel
   (#) Call 'kernel_delay' to delay the running task
 
   (#) Call 'kernel_message_queue_create' to create
       a message queue
+  (#) Call 'kernel_message_queue_create_static' to create
+      a message queue in caller supplied storage
+  (#) Call 'kernel_message_queue_create_loan' to create
+      a message queue, which loans blocks instead of copying
+  (#) Call 'kernel_message_queue_create_loan_static' to create
+      a loaning message queue in caller supplied storage
   (#) Call 'kernel_message_queue_delete' to delete
       a message queue
   (#) Call 'kernel_message_queue_send' to send a message
       to a task
+  (#) Call 'kernel_message_queue_send_from_isr' to send a
+      message from an interrupt
   (#) Call 'kernel_message_queue_send_blocking' to send a
       blocking message to a task
+  (#) Call 'kernel_message_queue_send_timeout' to send a
+      message, which waits for a full queue up to a timeout
   (#) Call 'kernel_message_queue_receive' to receive a message
+  (#) Call 'kernel_message_queue_receive_timeout' to receive a
+      message, which waits up to a timeout
+  (#) Call 'kernel_message_queue_alloc' to loan a block, which
+      is filled in place and passed to the send functions
+  (#) Call 'kernel_message_queue_release' to return a block
+      after it was received
+
+  (#) Call 'kernel_topic_create' to create a topic, which
+      shares every published sample with all subscribers
+  (#) Call 'kernel_topic_create_static' to create a topic
+      in caller supplied storage
+  (#) Call 'kernel_topic_delete' to delete a topic
+  (#) Call 'kernel_topic_subscribe' to add a subscriber with
+      its own read position
+  (#) Call 'kernel_topic_publish' to write a sample once and
+      wake all waiting subscribers
+  (#) Call 'kernel_topic_publish_from_isr' to publish a
+      sample from an interrupt
+  (#) Call 'kernel_topic_receive' to read the next sample of
+      a subscriber or to wait for it
+  (#) Call 'kernel_topic_get_overruns' to get the samples a
+      slow subscriber missed
 
   (#) Call 'kernel_semaphore_create' to create a semaphore
   (#) Call 'kernel_semaphore_delete' to delete a semaphore
   (#) Call 'kernel_semaphore_acquire' to acquire semaphore
+  (#) Call 'kernel_semaphore_acquire_timeout' to acquire a
+      semaphore, which waits up to a timeout
   (#) Call 'kernel_semaphore_release' to release an
       acquired semaphore
+  (#) Call 'kernel_semaphore_release_from_isr' to release a
+      semaphore from an interrupt
   (#) Call 'kernel_semaphore_is_available' to check if an
       existing semaphore is available
 
   (#) Call 'kernel_mutex_create' to create a mutex
+  (#) Call 'kernel_mutex_create_ceiling' to create a mutex,
+      which raises its owner to a ceiling priority
   (#) Call 'kernel_mutex_delete' to delete a mutex
   (#) Call 'kernel_mutex_acquire' to acquire a mutex
+  (#) Call 'kernel_mutex_acquire_timeout' to acquire a mutex,
+      which waits up to a timeout
   (#) Call 'kernel_mutex_release' to release an
       acquired mutex
 
+  (#) Call 'kernel_queue_set_create' to create a queue set,
+      which lets a task wait on several objects at once
+  (#) Call 'kernel_queue_set_create_static' to create a queue
+      set in caller supplied storage
+  (#) Call 'kernel_queue_set_delete' to delete a queue set
+  (#) Call 'kernel_queue_set_add_message_queue' to add a
+      message queue to a queue set once
+  (#) Call 'kernel_queue_set_add_semaphore' to add a semaphore
+      to a queue set once
+  (#) Call 'kernel_queue_set_select' to wait for the next ready
+      member, whose message or token is taken afterwards by a
+      receive or acquire with a timeout of 0
+
+  (#) Call 'kernel_event_group_create' to create an event group,
+      whose event bits are shared by several tasks
+  (#) Call 'kernel_event_group_delete' to delete an event group
+  (#) Call 'kernel_event_group_set' to set event bits and to
+      wake every satisfied waiter at once
+  (#) Call 'kernel_event_group_set_from_isr' to set event bits
+      from an interrupt
+  (#) Call 'kernel_event_group_clear' to clear event bits
+  (#) Call 'kernel_event_group_get' to get the set event bits
+  (#) Call 'kernel_event_group_wait' to wait for any or all
+      wanted event bits, which waits up to a timeout
+
+  (#) Call 'kernel_stream_buffer_create' to create a stream
+      buffer for bytes or a message buffer for messages of
+      variable size
+  (#) Call 'kernel_stream_buffer_create_static' to create a
+      stream buffer in caller supplied storage
+  (#) Call 'kernel_stream_buffer_delete' to delete a stream
+      buffer
+  (#) Call 'kernel_stream_buffer_write' to write bytes or a
+      message, which waits up to a timeout for free space
+  (#) Call 'kernel_stream_buffer_write_from_isr' to write
+      bytes or a message from an interrupt
+  (#) Call 'kernel_stream_buffer_read' to read bytes or a
+      message, which waits up to a timeout for the trigger
+      level
+
+  (#) Call 'kernel_mempool_create' to create a memory pool of
+      fixed-size blocks over caller supplied storage
+  (#) Call 'kernel_mempool_delete' to delete a memory pool
+  (#) Call 'kernel_mempool_alloc' to take a block in constant
+      time, which waits up to a timeout for a returned block
+  (#) Call 'kernel_mempool_alloc_from_isr' to take a block
+      from an interrupt without waiting
+  (#) Call 'kernel_mempool_free' to return a block and to wake
+      the task, which waits longest for it
+  (#) Call 'kernel_mempool_free_from_isr' to return a block
+      from an interrupt
+  (#) Call 'kernel_mempool_get_statistics' to get the high
+      water mark and the failed allocations of a memory pool
+
+  (#) Call 'kernel_heap_create' before kernel_init to take
+      every dynamically created object from a TLSF heap with
+      constant time allocation instead of malloc
+  (#) Call 'kernel_heap_delete' to restore malloc and free
+      after every block was returned
+  (#) Call 'kernel_heap_get_statistics' to get the free
+      space and the fragmentation of the heap
+
   (#) Call 'kernel_event_receive_timeout' to receive events
       for a set timeout period
   (#) Call 'kernel_event_receive_blocking' to receive events
       until they arrive
   (#) Call 'kernel_event_send' to send an event to a task
+  (#) Call 'kernel_event_send_from_isr' to send an event
+      from an interrupt
+
+  (#) Call 'kernel_task_get_handle' to get the handle of a
+      task once, notifications address it without a lookup
+  (#) Call 'kernel_notify' to update the notification value
+      of a task by an action and to wake it up
+  (#) Call 'kernel_notify_from_isr' to notify a task from
+      an interrupt
+  (#) Call 'kernel_notify_give' to increment the notification
+      value of a task like releasing a semaphore
+  (#) Call 'kernel_notify_take' to wait for a notification
+      value greater 0 like acquiring a semaphore
+  (#) Call 'kernel_notify_wait' to wait for any notification
+
+  (#) Call 'kernel_timer_create' to create a one shot or
+      auto reload software timer, the first timer adds
+      the timer daemon task
+  (#) Call 'kernel_timer_start' to start a software timer
+  (#) Call 'kernel_timer_stop' to stop a software timer
+  (#) Call 'kernel_timer_reset' to restart the period of
+      a software timer
+
+  (#) Call 'kernel_work_queue_create' to add the work daemon
+      task, which executes work deferred by interrupts
+  (#) Call 'kernel_work_post_from_isr' to defer a function
+      call from an interrupt without a critical section
+  (#) Call 'kernel_work_get_statistics' to get the overflows
+      and latencies of the deferred work
+
+  (#) Call 'kernel_task_get_statistics' to get the cycles a
+      task ran and its share of the CPU
+  (#) Call 'kernel_cpu_get_statistics' to get the cycles of
+      the tasks, interrupts and idle and the CPU load over a
+      sliding window
+  (#) Call 'kernel_cpu_isr_enter' and 'kernel_cpu_isr_exit' at
+      the start and the end of an interrupt, whose cycles are
+      accounted to interrupts instead of the interrupted task
 
   (#) Call 'kernel_exit_to_scheduler' to force another task
       to run
-  (#) Call 'kernel_toggle_critical_section' to toggle the
-      current critical section status
+  (#) Call 'kernel_enter_critical' to enter a critical section,
+      which masks the interrupts up to KERNEL_MAX_SYSCALL_PRIORITY
+  (#) Call 'kernel_exit_critical' to exit a critical section,
+      only the outermost exit unmasks the interrupts
+  (#) Call 'kernel_yield_from_isr' at the end of an interrupt,
+      which woke a higher priority task by a '_from_isr' call
   (#) Call 'kernel_reinsert_task' to move a task from blocked
       to running task list
 
@@ -62,19 +212,62 @@
 #ifndef KERNEL_KERNEL_H_
 #define KERNEL_KERNEL_H_
 /* Includes */
+#include "kernel/kernel_config.h"
 #include "kernel/task.h"
 #include "kernel/message_queue.h"
 #include "utils/dictionary.h"
+#include "utils/handle_table.h"
+#include "utils/bitmap.h"
+#include "utils/timer_wheel.h"
 #include "kernel/semaphore.h"
 #include "kernel/mutex.h"
+#include "kernel/software_timer.h"
+#include "kernel/topic.h"
+#include "kernel/queue_set.h"
+#include "kernel/event_group.h"
+#include "kernel/stream_buffer.h"
+#include "kernel/mempool.h"
+#include "utils/allocator.h"
+#include "utils/tlsf.h"
+#include "utils/work_queue.h"
 
 #include <stddef.h>
 /* Public Preprocessor defines */
-#define KERNEL_MAX_TASK                     (256 / 4)
-#define KERNEL_MAX_MESSAGE_QUEUE            8
-#define KERNEL_DEFAULT_QUEUE_SIZE           8
-#define KERNEL_MAX_SEMAPHORE                8
-#define KERNEL_MAX_MUTEX                    8
+// software timer daemon, which executes all timer callbacks with a single stack
+#ifndef KERNEL_TIMER_DAEMON_PRIORITY
+#define KERNEL_TIMER_DAEMON_PRIORITY        0
+#endif
+#define KERNEL_TIMER_DAEMON_ID              (KERNEL_MAX_TASK - 2)
+#define KERNEL_TIMER_DAEMON_TIME_QUANTUM    1
+#define KERNEL_TIMER_QUEUE_SIZE             8
+
+// work daemon, which executes the work deferred by interrupts in batches
+#ifndef KERNEL_WORK_DAEMON_PRIORITY
+#define KERNEL_WORK_DAEMON_PRIORITY         0
+#endif
+#define KERNEL_WORK_DAEMON_ID               (KERNEL_MAX_TASK - 3)
+#define KERNEL_WORK_DAEMON_TIME_QUANTUM     1
+// has to be a power of 2
+#ifndef KERNEL_WORK_QUEUE_SIZE
+#define KERNEL_WORK_QUEUE_SIZE              16
+#endif
+
+// cpu load, which is sampled every KERNEL_CPU_LOAD_PERIOD ticks over a sliding window of KERNEL_CPU_LOAD_SAMPLES samples
+#ifndef KERNEL_CPU_LOAD_PERIOD
+#define KERNEL_CPU_LOAD_PERIOD              100
+#endif
+#ifndef KERNEL_CPU_LOAD_SAMPLES
+#define KERNEL_CPU_LOAD_SAMPLES             10
+#endif
+
+// suppress the system tick while idle, requires a port layer timer
+#ifndef KERNEL_TICKLESS_IDLE
+#define KERNEL_TICKLESS_IDLE                0
+#endif
+#define KERNEL_TICKLESS_MINIMUM_TICKS       2
+
+// timeout of the '_timeout' calls, which blocks until the call succeeds, a timeout of 0 polls once
+#define KERNEL_WAIT_FOREVER                 SIZE_MAX
 
 
 #define KERNEL_SUCCESS                              0
@@ -121,6 +314,60 @@
 #define KERNEL_UNABLE_TO_DELETE_BLOCKED_LIST        41
 #define KERNEL_UNABLE_TO_DELETE_TERMINATED_LIST     42
 #define KERNEL_UNABLE_TO_DELETE_PRIORITY_LIST       43
+#define KERNEL_NO_READY_PRIORITIES                  44
+#define KERNEL_UNABLE_TO_DELETE_READY_PRIORITIES    45
+#define KERNEL_NO_TIMER_WHEEL                       46
+#define KERNEL_UNABLE_TO_DELETE_TIMER_WHEEL         47
+#define KERNEL_NO_TIMERS                            48
+#define KERNEL_UNABLE_TO_CREATE_TIMER               49
+#define KERNEL_UNABLE_TO_START_TIMER                50
+#define KERNEL_UNABLE_TO_STOP_TIMER                 51
+#define KERNEL_UNABLE_TO_RESET_TIMER                52
+#define KERNEL_UNABLE_TO_DELETE_TIMER_LIST          53
+#define KERNEL_UNABLE_TO_CREATE_WORK_QUEUE          54
+#define KERNEL_NO_WORK_QUEUE                        55
+#define KERNEL_UNABLE_TO_POST_WORK                  56
+#define KERNEL_UNABLE_TO_GET_TASK                   57
+#define KERNEL_UNABLE_TO_NOTIFY                     58
+#define KERNEL_UNABLE_TO_WAIT_FOR_NOTIFICATION      59
+#define KERNEL_UNABLE_TO_ALLOC_MESSAGE              60
+#define KERNEL_UNABLE_TO_RELEASE_MESSAGE            61
+#define KERNEL_NO_TOPICS                            62
+#define KERNEL_UNABLE_TO_ADD_TOPIC                  63
+#define KERNEL_UNABLE_TO_DELETE_TOPIC               64
+#define KERNEL_UNABLE_TO_SUBSCRIBE                  65
+#define KERNEL_UNABLE_TO_PUBLISH                    66
+#define KERNEL_UNABLE_TO_RECEIVE_SAMPLE             67
+#define KERNEL_UNABLE_TO_DELETE_TOPIC_LIST          68
+// returned without concatenated subcomponents, if the timeout of a '_timeout' call elapsed
+#define KERNEL_TIMEOUT                              69
+#define KERNEL_NO_QUEUE_SETS                        70
+#define KERNEL_UNABLE_TO_ADD_QUEUE_SET              71
+#define KERNEL_UNABLE_TO_DELETE_QUEUE_SET           72
+#define KERNEL_UNABLE_TO_ADD_MEMBER                 73
+#define KERNEL_UNABLE_TO_SELECT                     74
+#define KERNEL_UNABLE_TO_DELETE_QUEUE_SET_LIST      75
+#define KERNEL_NO_EVENT_GROUPS                      76
+#define KERNEL_UNABLE_TO_ADD_EVENT_GROUP            77
+#define KERNEL_UNABLE_TO_DELETE_EVENT_GROUP         78
+#define KERNEL_UNABLE_TO_SET_EVENT_GROUP            79
+#define KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP       80
+#define KERNEL_UNABLE_TO_DELETE_EVENT_GROUP_LIST    81
+#define KERNEL_NO_STREAM_BUFFERS                    82
+#define KERNEL_UNABLE_TO_ADD_STREAM_BUFFER          83
+#define KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER       84
+#define KERNEL_UNABLE_TO_WRITE_STREAM               85
+#define KERNEL_UNABLE_TO_READ_STREAM                86
+#define KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER_LIST  87
+#define KERNEL_NO_MEMPOOLS                          88
+#define KERNEL_UNABLE_TO_ADD_MEMPOOL                89
+#define KERNEL_UNABLE_TO_DELETE_MEMPOOL             90
+#define KERNEL_UNABLE_TO_ALLOC_BLOCK                91
+#define KERNEL_UNABLE_TO_FREE_BLOCK                 92
+#define KERNEL_UNABLE_TO_DELETE_MEMPOOL_LIST        93
+#define KERNEL_NO_HEAP                              94
+#define KERNEL_UNABLE_TO_DELETE_HEAP                95
+#define KERNEL_UNABLE_TO_DELETE_TASK                96
 
 
 #define KERNEL_LENGTH                            6
@@ -132,6 +379,21 @@
 #define KERNEL_MESSAGE_QUEUE_ERROR_REGISTER KERNEL_TASK_ERROR_REGISTER + MESSAGE_QUEUE_LENGTH
 #define KERNEL_SEMAPHORE_ERROR_REGISTER     KERNEL_MESSAGE_QUEUE_ERROR_REGISTER + SEMAPHORE_LENGTH
 #define KERNEL_MUTEX_ERROR_REGISTER         KERNEL_SEMAPHORE_ERROR_REGISTER + MUTEX_LENGTH
+#define KERNEL_BITMAP_ERROR_REGISTER        KERNEL_MUTEX_ERROR_REGISTER + BITMAP_LENGTH
+#define KERNEL_TIMER_WHEEL_ERROR_REGISTER   KERNEL_BITMAP_ERROR_REGISTER + TIMER_WHEEL_LENGTH
+#define KERNEL_SOFTWARE_TIMER_ERROR_REGISTER KERNEL_TIMER_WHEEL_ERROR_REGISTER + SOFTWARE_TIMER_LENGTH
+// size_t has 32 bits on the target, so further subcomponents share the register of a subcomponent of the same kind,
+// the kernel code tells which of them failed
+// kernel objects share the register of the message queue, their status contains the status of a linked list
+#define KERNEL_TOPIC_ERROR_REGISTER         KERNEL_MESSAGE_QUEUE_ERROR_REGISTER
+#define KERNEL_QUEUE_SET_ERROR_REGISTER     KERNEL_MESSAGE_QUEUE_ERROR_REGISTER
+#define KERNEL_EVENT_GROUP_ERROR_REGISTER   KERNEL_MESSAGE_QUEUE_ERROR_REGISTER
+#define KERNEL_STREAM_BUFFER_ERROR_REGISTER KERNEL_MESSAGE_QUEUE_ERROR_REGISTER
+#define KERNEL_MEMPOOL_ERROR_REGISTER       KERNEL_MESSAGE_QUEUE_ERROR_REGISTER
+// containers share the register of the bitmap
+#define KERNEL_WORK_QUEUE_ERROR_REGISTER    KERNEL_BITMAP_ERROR_REGISTER
+#define KERNEL_TLSF_ERROR_REGISTER          KERNEL_BITMAP_ERROR_REGISTER
+#define KERNEL_HANDLE_TABLE_ERROR_REGISTER  KERNEL_BITMAP_ERROR_REGISTER
 /* Public Preprocessor macros */
 /* Public type definitions */
 typedef enum {
@@ -143,40 +405,158 @@ typedef enum {
   EN_KERNEL_MAX_STATE
 } Kernel_Status_e;
 
+/// statistics of the deferred work, latencies are measured by kernel_get_cycles
+typedef struct {
+    size_t executed;        ///< work items executed by the work daemon
+    size_t overflows;       ///< work items rejected, because the work queue was full
+    size_t batches;         ///< wake ups of the work daemon, which executed work items
+    size_t batch_max;       ///< most work items executed by a single wake up
+    size_t latency_last;    ///< cycles between post and execution of the last work item
+    size_t latency_max;     ///< most cycles between post and execution
+    size_t latency_total;   ///< sum of all latencies, divided by executed it is the average latency
+} kernel_work_statistics_t;
+
+/// cpu time of a task since its creation, measured by kernel_get_cycles on every task switch
+typedef struct {
+    uint64_t cycles;        ///< cycles the task ran, accounted interrupts excluded
+    size_t activations;     ///< task switches to the task
+    size_t load;            ///< percentage of the cycles since its creation, which the task ran
+} kernel_task_statistics_t;
+
+/// cpu time of the system since kernel_init, measured by kernel_get_cycles
+typedef struct {
+    uint64_t total_cycles;  ///< cycles since kernel_init
+    uint64_t idle_cycles;   ///< cycles, in which neither a task nor an accounted interrupt ran, including those before kernel_start
+    uint64_t isr_cycles;    ///< cycles of the tick and the interrupts, which call kernel_cpu_isr_enter and kernel_cpu_isr_exit
+    size_t load;            ///< percentage of the cycles outside of idle over the last KERNEL_CPU_LOAD_SAMPLES sample periods
+} kernel_cpu_statistics_t;
+
+/// statistics of a memory pool since its creation
+typedef struct {
+    size_t block_size;      ///< usable size of a single block, rounded up to 8 bytes
+    size_t count;           ///< amount of blocks
+    size_t free_blocks;     ///< blocks, which can currently be allocated
+    size_t high_water;      ///< most blocks allocated at once
+    size_t failures;        ///< allocations, which returned without a block after their timeout
+} kernel_mempool_statistics_t;
+
 /* Public functions (prototypes) */
 /* Core Kernel */
 size_t kernel_init(void);
 size_t kernel_deinit(void);
 size_t kernel_add_task(size_t (*task_main)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout);
+size_t kernel_add_task_with_stack(size_t (*task_main)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack);
+size_t kernel_task_create(size_t (*task_main)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack);
+size_t kernel_task_delete(size_t task_id);
 size_t kernel_start(void);
 size_t kernel_delay(size_t delay_millisecods);
 
 size_t kernel_message_queue_create(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t element_size);
+size_t kernel_message_queue_create_static(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t element_size, message_queue_static_t *storage, void **data, void *buffer);
+size_t kernel_message_queue_create_loan(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t message_size);
+size_t kernel_message_queue_create_loan_static(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t message_size, message_queue_static_t *storage, void **data, void *buffer, void *blocks);
 size_t kernel_message_queue_delete(message_queue_identifier_t **message_queue_identifier);
 size_t kernel_message_queue_send(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent);
+size_t kernel_message_queue_send_from_isr(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent, bool *higher_priority_task_woken);
 size_t kernel_message_queue_send_blocking(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent);
+size_t kernel_message_queue_send_timeout(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent, size_t timeout_milliseconds);
 size_t kernel_message_queue_receive(message_queue_identifier_t **message_queue_identifier, void **message);
+size_t kernel_message_queue_receive_timeout(message_queue_identifier_t **message_queue_identifier, void **message, size_t timeout_milliseconds);
+size_t kernel_message_queue_alloc(message_queue_identifier_t **message_queue_identifier, void **block);
+size_t kernel_message_queue_release(message_queue_identifier_t **message_queue_identifier, void *block);
+
+size_t kernel_topic_create(size_t *id, size_t size, size_t sample_size, size_t max_subscribers);
+size_t kernel_topic_create_static(size_t *id, size_t size, size_t sample_size, size_t max_subscribers, topic_static_t *storage, void *samples, topic_subscriber_t *subscribers);
+size_t kernel_topic_delete(size_t *id);
+size_t kernel_topic_subscribe(size_t id, size_t *subscriber);
+size_t kernel_topic_publish(size_t id, void *sample);
+size_t kernel_topic_publish_from_isr(size_t id, void *sample, bool *higher_priority_task_woken);
+size_t kernel_topic_receive(size_t id, size_t subscriber, void *sample);
+size_t kernel_topic_get_overruns(size_t id, size_t subscriber, size_t *overruns);
 
 size_t kernel_semaphore_create(size_t *id, size_t tokens);
 size_t kernel_semaphore_delete(size_t *id);
 size_t kernel_semaphore_acquire(size_t id);
+size_t kernel_semaphore_acquire_timeout(size_t id, size_t timeout_milliseconds);
 size_t kernel_semaphore_release(size_t id);
+size_t kernel_semaphore_release_from_isr(size_t id, bool *higher_priority_task_woken);
 size_t kernel_semaphore_acquire_non_blocking(size_t id);
 size_t kernel_semaphore_release_non_blocking(size_t id);
 size_t kernel_semaphore_is_available(size_t id);
 
 size_t kernel_mutex_create(size_t *id);
+size_t kernel_mutex_create_ceiling(size_t *id, uint8_t ceiling_priority);
 size_t kernel_mutex_delete(size_t *id);
 size_t kernel_mutex_acquire(size_t id);
+size_t kernel_mutex_acquire_timeout(size_t id, size_t timeout_milliseconds);
 size_t kernel_mutex_release(size_t id);
 size_t kernel_mutex_acquire_non_blocking(size_t id);
 size_t kernel_mutex_release_non_blocking(size_t id);
 
+size_t kernel_queue_set_create(size_t *id, size_t size);
+size_t kernel_queue_set_create_static(size_t *id, size_t size, queue_set_static_t *storage, void **data, queue_set_member_t *buffer);
+size_t kernel_queue_set_delete(size_t *id);
+size_t kernel_queue_set_add_message_queue(size_t id, message_queue_identifier_t **message_queue_identifier);
+size_t kernel_queue_set_add_semaphore(size_t id, size_t semaphore_id);
+size_t kernel_queue_set_select(size_t id, queue_set_member_t *member, size_t timeout_milliseconds);
+
+size_t kernel_event_group_create(size_t *id);
+size_t kernel_event_group_delete(size_t *id);
+size_t kernel_event_group_set(size_t id, size_t events);
+size_t kernel_event_group_set_from_isr(size_t id, size_t events, bool *higher_priority_task_woken);
+size_t kernel_event_group_clear(size_t id, size_t events);
+size_t kernel_event_group_get(size_t id, size_t *events);
+size_t kernel_event_group_wait(size_t id, size_t wanted_events, bool wait_all, bool clear_on_exit, size_t *received_events, size_t timeout_milliseconds);
+
+size_t kernel_stream_buffer_create(size_t *id, size_t size, size_t trigger_level, bool message_mode);
+size_t kernel_stream_buffer_create_static(size_t *id, size_t size, size_t trigger_level, bool message_mode, stream_buffer_static_t *storage, uint8_t *buffer);
+size_t kernel_stream_buffer_delete(size_t *id);
+size_t kernel_stream_buffer_write(size_t id, const void *data, size_t length, size_t *written, size_t timeout_milliseconds);
+size_t kernel_stream_buffer_write_from_isr(size_t id, const void *data, size_t length, size_t *written, bool *higher_priority_task_woken);
+size_t kernel_stream_buffer_read(size_t id, void *data, size_t max_length, size_t *read, size_t timeout_milliseconds);
+
+size_t kernel_mempool_create(size_t *id, size_t block_size, size_t count, void *storage);
+size_t kernel_mempool_delete(size_t *id);
+size_t kernel_mempool_alloc(size_t id, void **block, size_t timeout_milliseconds);
+size_t kernel_mempool_alloc_from_isr(size_t id, void **block);
+size_t kernel_mempool_free(size_t id, void *block);
+size_t kernel_mempool_free_from_isr(size_t id, void *block, bool *higher_priority_task_woken);
+size_t kernel_mempool_get_statistics(size_t id, kernel_mempool_statistics_t *statistics);
+
+size_t kernel_heap_create(void *memory, size_t size);
+size_t kernel_heap_delete(void);
+size_t kernel_heap_get_statistics(tlsf_statistics_t *statistics);
+
 size_t kernel_event_receive_timeout(size_t *received_events);
 size_t kernel_event_receive_blocking(size_t *received_events);
 size_t kernel_event_send(size_t task_id, size_t event);
+size_t kernel_event_send_from_isr(size_t task_id, size_t event, bool *higher_priority_task_woken);
+
+size_t kernel_task_get_handle(size_t task_id, task_t **task);
+size_t kernel_task_get_statistics(size_t task_id, kernel_task_statistics_t *statistics);
+size_t kernel_notify(task_t **task, size_t value, task_notify_action_e action);
+size_t kernel_notify_from_isr(task_t **task, size_t value, task_notify_action_e action, bool *higher_priority_task_woken);
+size_t kernel_notify_give(task_t **task);
+size_t kernel_notify_take(bool clear, size_t *value);
+size_t kernel_notify_wait(size_t clear_bits, size_t *value);
+
+size_t kernel_timer_create(size_t *id, void (*callback)(size_t id), size_t period_milliseconds, bool auto_reload);
+size_t kernel_timer_start(size_t id);
+size_t kernel_timer_stop(size_t id);
+size_t kernel_timer_reset(size_t id);
+
+size_t kernel_work_queue_create(void);
+size_t kernel_work_post_from_isr(void (*function)(void *argument), void *argument, bool *higher_priority_task_woken);
+size_t kernel_work_get_statistics(kernel_work_statistics_t *statistics);
+
+size_t kernel_cpu_get_statistics(kernel_cpu_statistics_t *statistics);
+void kernel_cpu_isr_enter(void);
+void kernel_cpu_isr_exit(void);
 
 size_t kernel_exit_to_scheduler(void);
+void kernel_enter_critical(void);
+void kernel_exit_critical(void);
+void kernel_yield_from_isr(bool higher_priority_task_woken);
 
 #ifdef DEBUG
 dictionary_t* kernel_debug_get_list_of_tasks(void);
@@ -190,13 +570,25 @@ void kernel_update(void);
 void kernel_delay_blocking(size_t delay_millisecods);
 
 size_t kernel_get_tick(void);
+size_t kernel_get_cycles(void);
+size_t kernel_get_skipped_ticks(void);
 
 void kernel_enter_idle(void);
 void kernel_exit_idle(void);
 
 void kernel_disable_interrupts(void);
 void kernel_enable_interrupts(void);
+void kernel_mask_interrupts(void);
+void kernel_unmask_interrupts(void);
+void kernel_validate_interrupt_priority(void);
 
 void kernel_shutdown(void);
 
+#ifndef __arm__
+/* Host Kernel */
+void kernel_host_tick(void);
+void kernel_host_raise_interrupt(uint8_t priority, void (*handler)(void));
+void kernel_host_set_expiry_hook(void (*hook)(void));
+#endif
+
 #endif /* KERNEL_KERNEL_H_ */
@@ -0,0 +1,83 @@
+/**
+**************************************************
+* @file kernel_config.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for the compile time kernel configuration
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Does not contain any functions, only defines!
+  (#) Define KERNEL_STATIC_ALLOCATION as 1 to take every
+      kernel object and list node from fixed-size pools
+      instead of the heap. The pools are sized by the
+      KERNEL_MAX_* constants.
+  (#) Variable sized storage, like queue buffers, has no
+      pool. Supply it with the '*_create_static' functions
+      in static allocation mode.
+  (#) The KERNEL_MAX_* constants of the kernel objects
+      limit the objects, which exist at once. A deleted
+      object frees its slot and its key becomes stale.
+  (#) Interrupts with a numerically lower priority than
+      KERNEL_MAX_SYSCALL_PRIORITY are never masked by the
+      kernel and must not call kernel functions.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_KERNEL_CONFIG_H_
+#define KERNEL_KERNEL_CONFIG_H_
+/* Includes */
+/* Public Preprocessor defines */
+#define KERNEL_MAX_TASK                     (256 / 4)
+#define KERNEL_MAX_MESSAGE_QUEUE            8
+#define KERNEL_DEFAULT_QUEUE_SIZE           8
+#define KERNEL_MAX_SEMAPHORE                8
+#define KERNEL_MAX_MUTEX                    8
+#define KERNEL_MAX_TIMER                    8
+#define KERNEL_MAX_TOPIC                    8
+#define KERNEL_MAX_QUEUE_SET                8
+#define KERNEL_MAX_EVENT_GROUP              8
+#define KERNEL_MAX_STREAM_BUFFER            8
+#define KERNEL_MAX_MEMPOOL                  8
+
+// highest interrupt priority, which is masked by a critical section, it has to be greater than 0
+#ifndef KERNEL_MAX_SYSCALL_PRIORITY
+#define KERNEL_MAX_SYSCALL_PRIORITY         5
+#endif
+
+// take kernel objects from pools instead of the heap
+#ifndef KERNEL_STATIC_ALLOCATION
+#define KERNEL_STATIC_ALLOCATION            0
+#endif
+
+// pool sizes, a mutex contains a binary semaphore
+#define KERNEL_POOL_TASKS                   KERNEL_MAX_TASK
+#ifndef KERNEL_POOL_STACKS
+#define KERNEL_POOL_STACKS                  KERNEL_MAX_TASK     ///< stacks of the default size, other sizes are supplied by the caller
+#endif
+#define KERNEL_POOL_SEMAPHORES              (KERNEL_MAX_SEMAPHORE + KERNEL_MAX_MUTEX)
+#define KERNEL_POOL_MUTEXES                 KERNEL_MAX_MUTEX
+#define KERNEL_POOL_TIMERS                  KERNEL_MAX_TIMER
+#define KERNEL_POOL_EVENT_GROUPS            KERNEL_MAX_EVENT_GROUP
+#define KERNEL_POOL_MEMPOOLS                KERNEL_MAX_MEMPOOL
+// priority groups, delayed, blocked and terminated tasks
+#define KERNEL_POOL_LINKED_LISTS            (KERNEL_MAX_TASK + 3)
+// task lists link the element embedded in each task, these elements are left for application lists
+#ifndef KERNEL_POOL_LINKED_LIST_ELEMENTS
+#define KERNEL_POOL_LINKED_LIST_ELEMENTS    8
+#endif
+// kernel singletons
+#define KERNEL_POOL_TIMER_WHEELS            1
+#define KERNEL_POOL_SOFTWARE_TIMER_LISTS    1
+#define KERNEL_POOL_TICKLESS                1
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+/* Public functions (prototypes) */
+#endif /* KERNEL_KERNEL_CONFIG_H_ */
@@ -0,0 +1,97 @@
+/**
+**************************************************
+* @file mempool.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for pools of fixed-size blocks shared by tasks and interrupts
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'mempool_create' to create a memory pool over
+      caller supplied blocks
+  (#) Call 'mempool_create_static' to create a memory pool
+      in caller supplied storage
+  (#) Call 'mempool_delete' to delete a memory pool
+  (#) Call 'mempool_alloc' to take a block in constant time
+  (#) Call 'mempool_free' to return a block in constant time
+  (#) Call 'mempool_get_waiting_task' to get the task, which
+      waits longest for a block
+  (#) Call 'mempool_wait' to block a task until a block
+      is returned
+  (#) All functions call 'mempool_checking' to validate
+      proper memory pool structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_MEMPOOL_H_
+#define KERNEL_MEMPOOL_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/linked_list.h"
+#include "utils/pool.h"
+#include "kernel/task.h"
+
+/* Public Preprocessor defines */
+#define MEMPOOL_SUCCESS             0
+#define MEMPOOL_NO_MEMORY           1
+#define MEMPOOL_IS_NULL             2
+#define MEMPOOL_NO_POOL             3
+#define MEMPOOL_NO_WAITING_LIST     4
+#define MEMPOOL_EXHAUSTED           5
+#define MEMPOOL_UNABLE_TO_FREE      6
+#define MEMPOOL_UNABLE_TO_WAIT      7
+
+#define MEMPOOL_LENGTH              3
+
+#define MEMPOOL_LINKED_LIST_ERROR_REGISTER MEMPOOL_LENGTH
+#define MEMPOOL_POOL_ERROR_REGISTER MEMPOOL_LENGTH
+
+/* Public Preprocessor macros */
+
+// size of a single block, which holds size bytes and the link of the returned blocks
+#define MEMPOOL_BLOCK_SIZE(size)    POOL_BLOCK_SIZE((size) < sizeof(void *) ? sizeof(void *) : (size))
+// bytes of the 8 byte aligned storage of count blocks
+#define MEMPOOL_STORAGE_SIZE(size, count) (MEMPOOL_BLOCK_SIZE(size) * (count))
+
+/* Public type definitions */
+
+/// Control information for a memory pool
+typedef struct {
+    size_t id;                          ///< memory pools id
+    pool_t *pool;                       ///< blocks and their embedded free list
+    size_t high_water;                  ///< most blocks allocated at once
+    size_t failures;                    ///< allocations, which returned without a block
+    linked_list_t *waiting_task_list;   ///< linked list for storing tasks waiting for a block
+    bool allocated;                     ///< storage is released on delete, false for caller supplied storage
+} mempool_t;
+
+/// Storage for a memory pool including its pool control and waiting list, the blocks are supplied separately
+typedef struct {
+    mempool_t mempool;                  ///< memory pool, has to stay the first member
+    pool_t pool;                        ///< storage of the pool control
+    linked_list_t waiting_task_list;    ///< storage of the waiting list
+} mempool_static_t;
+
+/* Public functions (prototypes) */
+size_t mempool_create(mempool_t **mempool, size_t id, void *blocks, size_t block_size, size_t count);
+size_t mempool_create_static(mempool_t **mempool, mempool_static_t *storage, void *blocks, size_t id, size_t block_size, size_t count);
+size_t mempool_delete(mempool_t **mempool);
+size_t mempool_alloc(mempool_t **mempool, void **block);
+size_t mempool_free(mempool_t **mempool, void *block);
+size_t mempool_get_waiting_task(mempool_t **mempool, linked_list_element_t **element, task_t **task);
+size_t mempool_wait(mempool_t **mempool, linked_list_t **running_task_list, linked_list_element_t **running_task_element);
+
+size_t mempool_checking(mempool_t **mempool);
+
+#endif /* KERNEL_MEMPOOL_H_ */
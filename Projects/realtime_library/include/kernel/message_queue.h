@@ -12,11 +12,20 @@
  ==================================================
  ### Usage ###
  (#) Call 'message_queue_create' to create a message queue
+ (#) Call 'message_queue_create_static' to create a message queue
+     in caller supplied storage
+ (#) Call 'message_queue_create_loan' to create a message queue,
+     which loans its blocks to the senders instead of copying
+ (#) Call 'message_queue_create_loan_static' to create a loaning
+     message queue in caller supplied storage
  (#) Call 'message_queue_delete' to delete a message queue
  (#) Call 'message_queue_send' to send info to a task
  (#) Call 'message_queue_send_blocking' to send info to a task,
      but the sending task can be blocked
  (#) Call 'message_queue_receive' to receive a message
+ (#) Call 'message_queue_alloc' to loan a block, which is filled in
+     place and sent as pointer
+ (#) Call 'message_queue_release' to return a received block
  (#) Call 'message_queue_identifier_checking' to check the message queues identifier
  (#) Call 'message_queue_checking' to check the message queues
  ==================================================
@@ -31,6 +40,8 @@
 #include <utils/queue.h>
 #include <kernel/task.h>
 #include <utils/linked_list.h>
+#include <utils/pool.h>
+#include <kernel/queue_set.h>
 #include <stddef.h>
 #include <stdbool.h>
 #include "kernel/task.h"
@@ -49,6 +60,9 @@
 #define MESSAGE_QUEUE_UNABLE_TO_DELETE                  9
 #define MESSAGE_QUEUE_LINKED_LIST_ERROR_REGISTER        10
 #define MESSAGE_QUEUE_INVALID_TASK_REGISTER             11
+#define MESSAGE_QUEUE_NO_LOAN                           12
+#define MESSAGE_QUEUE_NO_FREE_BLOCK                     13
+#define MESSAGE_QUEUE_UNABLE_TO_RELEASE                 14
 
 #define MESSAGE_QUEUE_LENGTH                            4
 
@@ -79,15 +93,32 @@ typedef struct {
     queue_t *qcb;                                           ///< message queues control block
     linked_list_t *receiving_task_list;                     ///< linked list for storing blocked receiving tasks
     linked_list_t *sending_task_list;                       ///< linked list for storing blocked sending tasks
+    pool_t *blocks;                                         ///< blocks loaned to the senders, the queue only carries their pointers, NULL in copy mode
+    queue_set_t *queue_set;                                 ///< queue set, which announces every queued message, NULL without a queue set
+    bool allocated;                                         ///< storage is released on delete, false for caller supplied storage
 } message_queue_t;
 
+/// Storage for a message queue, the queue data and buffer are supplied separately
+typedef struct {
+    message_queue_t message_queue;                          ///< message queue, has to stay the first member
+    message_queue_identifier_t message_queue_identifier;    ///< storage of the identifier
+    queue_t qcb;                                            ///< storage of the control block
+    linked_list_t receiving_task_list;                      ///< storage of the receiving task list
+    linked_list_t sending_task_list;                        ///< storage of the sending task list
+    pool_t blocks;                                          ///< storage of the loaned blocks control information
+} message_queue_static_t;
+
 /* Public functions (prototypes) */
 size_t message_queue_create(message_queue_t **message_queue, size_t message_queue_size, size_t element_size, size_t id, char *name);
+size_t message_queue_create_static(message_queue_t **message_queue, message_queue_static_t *storage, void **data, void *buffer, size_t message_queue_size, size_t element_size, size_t id, char *name);
+size_t message_queue_create_loan(message_queue_t **message_queue, size_t message_queue_size, size_t message_size, size_t id, char *name);
+size_t message_queue_create_loan_static(message_queue_t **message_queue, message_queue_static_t *storage, void **data, void *buffer, void *blocks, size_t message_queue_size, size_t message_size, size_t id, char *name);
 size_t message_queue_delete(message_queue_t **message_queue);
+size_t message_queue_alloc(message_queue_t **message_queue, void **block);
+size_t message_queue_release(message_queue_t **message_queue, void *block);
 size_t message_queue_send(message_queue_t **message_queue, linked_list_element_t **element, task_t **task, void *message, size_t element_size, bool urgent);
 size_t message_queue_send_blocking(message_queue_t **message_queue, linked_list_t **running_task_list, linked_list_element_t **sender_element, linked_list_element_t **receiver_element, task_t **receiver_task, void *message, size_t element_size, bool urgent);
 size_t message_queue_receive(message_queue_t **message_queue, linked_list_t **running_task_list, linked_list_element_t **running_task_element, task_t **receiver_task, linked_list_element_t **sender_element, task_t **sender_task, void **message);
-size_t message_queue_broadcast(message_queue_t **message_queue, void *message);
 size_t message_queue_identifier_checking(message_queue_identifier_t **message_queue_identifier);
 
 #endif /* MESSAGE_QUEUE_MESSAGE_QUEUE_H_ */
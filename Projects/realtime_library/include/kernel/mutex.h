@@ -17,6 +17,18 @@
   (#) Call 'mutex_release' to release an acquired mutex
   (#) Call 'mutex_acquire_non_blocking' to acquire a mutex
   (#) Call 'mutex_release_non_blocking' to release an acquired mutex
+  (#) Call 'mutex_get_waiting_priority' to get the highest priority
+      of the tasks waiting for a mutex, which its owner inherits
+  (#) Call 'mutex_set_ceiling' to turn a mutex into a priority
+      ceiling mutex
+  (#) Call 'mutex_acquire_ceiling' to acquire a ceiling mutex
+      without a token of the binary semaphore
+  (#) Call 'mutex_release_ceiling' to release an acquired
+      ceiling mutex
+  (#) Call 'mutex_acquire_atomic' to acquire a mutex
+      without a critical section
+  (#) Call 'mutex_release_atomic' to release a mutex
+      without a critical section
 ==================================================
 @endverbatim
 **************************************************
@@ -39,6 +51,9 @@
 #define MUTEX_UNABLE_TO_ACQUIRE		6
 #define MUTEX_UNABLE_TO_RELEASE		7
 #define MUTEX_OWNED_BY_OTHER_TASK	8
+#define MUTEX_CEILING_VIOLATED		9
+
+#define MUTEX_NO_CEILING			UINT8_MAX
 
 #define MUTEX_LENGTH				4
 
@@ -48,10 +63,11 @@
 /* Public type definitions */
 
 /// control information for a mutex
-typedef struct {
+typedef struct mutex {
 	semaphore_t *binary_semaphore;///< mutexes binary semaphore
 	task_t *owner;///< mutexes task owner
 	size_t lock_count;///< mutexes lock count
+	uint8_t ceiling_priority;///< priority an owner runs with at once, MUTEX_NO_CEILING for priority inheritance
 } mutex_t;
 
 /* Public functions (prototypes) */
@@ -61,5 +77,11 @@ size_t mutex_acquire(mutex_t **mutex, linked_list_t **running_task_list, linked_
 size_t mutex_release(mutex_t **mutex, linked_list_element_t **element, task_t **task);
 size_t mutex_acquire_non_blocking(mutex_t **mutex, task_t **task);
 size_t mutex_release_non_blocking(mutex_t **mutex, task_t **task);
+size_t mutex_get_waiting_priority(mutex_t **mutex, uint8_t *priority);
+size_t mutex_set_ceiling(mutex_t **mutex, uint8_t ceiling_priority);
+size_t mutex_acquire_ceiling(mutex_t **mutex, task_t **task);
+size_t mutex_release_ceiling(mutex_t **mutex, task_t **task);
+size_t mutex_acquire_atomic(mutex_t **mutex, task_t **task);
+size_t mutex_release_atomic(mutex_t **mutex, task_t **task, bool *task_waiting);
 
 #endif /* KERNEL_MUTEX_H_ */
@@ -0,0 +1,105 @@
+/**
+**************************************************
+* @file queue_set.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for waiting on several message queues and semaphores at once
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'queue_set_create' to create a queue set
+  (#) Call 'queue_set_create_static' to create a queue set in
+      caller supplied storage
+  (#) Call 'queue_set_delete' to delete a queue set
+  (#) Call 'queue_set_reserve' to reserve the entries of a
+      new member, a member announces each stored message or
+      token by one entry
+  (#) Call 'queue_set_post' to announce a ready member and
+      to get the first waiting task
+  (#) Call 'queue_set_read' to get the member, which became
+      ready first
+  (#) Call 'queue_set_wait' to block a task until a member
+      becomes ready
+  (#) All functions call 'queue_set_checking' to validate
+      proper queue set structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_QUEUE_SET_H_
+#define KERNEL_QUEUE_SET_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/queue.h"
+#include "utils/linked_list.h"
+#include "kernel/task.h"
+
+/* Public Preprocessor defines */
+#define QUEUE_SET_SUCCESS               0
+#define QUEUE_SET_NO_MEMORY             1
+#define QUEUE_SET_IS_NULL               2
+#define QUEUE_SET_NO_READY_QUEUE        3
+#define QUEUE_SET_NO_WAITING_LIST       4
+#define QUEUE_SET_FULL                  5
+#define QUEUE_SET_NO_MEMBER             6
+#define QUEUE_SET_UNABLE_TO_POST        7
+#define QUEUE_SET_UNABLE_TO_WAIT        8
+
+#define QUEUE_SET_LENGTH                4
+
+#define QUEUE_SET_LINKED_LIST_ERROR_REGISTER QUEUE_SET_LENGTH
+#define QUEUE_SET_QUEUE_ERROR_REGISTER QUEUE_SET_LENGTH
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// kind of object, which is a member of a queue set
+typedef enum {
+    QUEUE_SET_MESSAGE_QUEUE = 0,        ///< member is a message queue, its id is the message queue identifier id
+    QUEUE_SET_SEMAPHORE,                ///< member is a semaphore, its id is the semaphore id
+} queue_set_member_type_e;
+
+/// member of a queue set, which became ready
+typedef struct {
+    queue_set_member_type_e type;       ///< kind of the member
+    size_t id;                          ///< id of the member
+} queue_set_member_t;
+
+/// Control information for a queue set
+typedef struct queue_set {
+    size_t id;                          ///< queue sets id
+    queue_t *ready;                     ///< members in the order they became ready, one entry per stored message or token
+    size_t reserved;                    ///< entries reserved by the members, which never exceed the size of the ready queue
+    linked_list_t *waiting_task_list;   ///< linked list for storing tasks waiting for a ready member
+    bool allocated;                     ///< storage is released on delete, false for caller supplied storage
+} queue_set_t;
+
+/// Storage for a queue set including its ready queue and waiting list, the ready queue data and buffer are supplied separately
+typedef struct {
+    queue_set_t queue_set;              ///< queue set, has to stay the first member
+    queue_t ready;                      ///< storage of the ready queue control block
+    linked_list_t waiting_task_list;    ///< storage of the waiting list
+} queue_set_static_t;
+
+/* Public functions (prototypes) */
+size_t queue_set_create(queue_set_t **queue_set, size_t id, size_t size);
+size_t queue_set_create_static(queue_set_t **queue_set, queue_set_static_t *storage, void **data, queue_set_member_t *buffer, size_t id, size_t size);
+size_t queue_set_delete(queue_set_t **queue_set);
+size_t queue_set_reserve(queue_set_t **queue_set, size_t entries);
+size_t queue_set_post(queue_set_t **queue_set, queue_set_member_type_e type, size_t id, linked_list_element_t **element, task_t **task);
+size_t queue_set_read(queue_set_t **queue_set, queue_set_member_t *member);
+size_t queue_set_wait(queue_set_t **queue_set, linked_list_t **running_task_list, linked_list_element_t **running_task_element);
+
+size_t queue_set_checking(queue_set_t **queue_set);
+
+#endif /* KERNEL_QUEUE_SET_H_ */
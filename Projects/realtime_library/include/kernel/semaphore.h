@@ -12,6 +12,8 @@
 ==================================================
   ### Usage ###
   (#) Call 'semaphore_create' to create a semaphore
+  (#) Call 'semaphore_create_static' to create a semaphore
+      in caller supplied storage
   (#) Call 'semaphore_delete' to delete a semaphore
   (#) Call 'semaphore_acquire' to acquire a semaphore
   (#) Call 'semaphore_release' to release an acquired
@@ -24,10 +26,17 @@
       semaphore is available
   (#) Call 'semaphore_flush' to flush all waiting list
       entries of a semaphore
+  (#) Call 'semaphore_acquire_atomic' to take a token
+      without a critical section
+  (#) Call 'semaphore_release_atomic' to return a token
+      without a critical section
+  (#) Call 'semaphore_get_waiting_task' to get the first
+      task of the waiting list
   (#) All functions call 'semaphore_checking' to validate
       proper semaphore structure. Refer to this function
       for potential error codes not documented in each
-      function.
+      function. The atomic functions skip the check to
+      keep the uncontended path short.
 ==================================================
 @endverbatim
 **************************************************
@@ -38,9 +47,11 @@
 /* Includes */
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "utils/linked_list.h"
 #include "kernel/task.h"
+#include "kernel/queue_set.h"
 
 /* Public Preprocessor defines */
 #define SEMAPHORE_SUCCESS               0
@@ -67,11 +78,20 @@ typedef struct {
     size_t token;                       ///< semaphores available tokens
     size_t max_token;                   ///< semaphores max tokens
     linked_list_t *task_waiting_list;   ///< linked list for storing blocked tasks
+    queue_set_t *queue_set;             ///< queue set, which announces every released token, NULL without a queue set
+    bool allocated;                     ///< storage is released on delete, false for caller supplied storage
 } semaphore_t;
 
+/// Storage for a semaphore including its waiting list
+typedef struct {
+    semaphore_t semaphore;              ///< semaphore, has to stay the first member
+    linked_list_t task_waiting_list;    ///< storage of the waiting list
+} semaphore_static_t;
+
 
 /* Public functions (prototypes) */
 size_t semaphore_create(semaphore_t **semaphore, size_t id, size_t token);
+size_t semaphore_create_static(semaphore_t **semaphore, semaphore_static_t *storage, size_t id, size_t token);
 size_t semaphore_delete(semaphore_t **semaphore);
 size_t semaphore_acquire(semaphore_t **semaphore, linked_list_t **running_task_list, linked_list_element_t **running_task_element, task_t **task);
 size_t semaphore_release(semaphore_t **semaphore, linked_list_element_t **element, task_t **task);
@@ -79,6 +99,9 @@ size_t semaphore_acquire_non_blocking(semaphore_t **semaphore);
 size_t semaphore_release_non_blocking(semaphore_t **semaphore);
 size_t semaphore_is_available(semaphore_t **semaphore);
 size_t semaphore_flush(semaphore_t **semaphore);
+size_t semaphore_acquire_atomic(semaphore_t **semaphore);
+size_t semaphore_release_atomic(semaphore_t **semaphore, bool *task_waiting);
+size_t semaphore_get_waiting_task(semaphore_t **semaphore, linked_list_element_t **element, task_t **task);
 
 size_t semaphore_checking(semaphore_t **semaphore);
 
@@ -0,0 +1,86 @@
+/**
+**************************************************
+* @file software_timer.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using software timers
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'software_timer_create' to create a one shot
+      or auto reload software timer
+  (#) Call 'software_timer_delete' to delete a software
+      timer
+  (#) Call 'software_timer_list_create' to create a list
+      of active software timers sorted by deadline
+  (#) Call 'software_timer_list_delete' to delete a list
+      of active software timers
+  (#) Call 'software_timer_start' to (re)arm a software
+      timer relative to a start tick
+  (#) Call 'software_timer_stop' to disarm a software timer
+  (#) Call 'software_timer_get_next_ticks' to get the ticks
+      until the earliest deadline
+  (#) Call 'software_timer_process' to run the callbacks
+      of all due software timers in deadline order
+  (#) All functions call 'software_timer_checking' to
+      validate proper software timer structure. Refer to
+      this function for potential error codes not
+      documented in each function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_SOFTWARE_TIMER_H_
+#define KERNEL_SOFTWARE_TIMER_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Preprocessor defines */
+#define SOFTWARE_TIMER_SUCCESS          0
+#define SOFTWARE_TIMER_NO_MEMORY        1
+#define SOFTWARE_TIMER_NO_CALLBACK      2
+#define SOFTWARE_TIMER_NO_PERIOD        3
+#define SOFTWARE_TIMER_NO_LIST          4
+#define SOFTWARE_TIMER_IS_EMPTY         5
+
+#define SOFTWARE_TIMER_LENGTH           3
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// control information for a software timer
+typedef struct software_timer {
+    struct software_timer *previous;    ///< active timer with an earlier or equal deadline
+    struct software_timer *next;        ///< active timer with a later deadline
+    void (*callback)(size_t id);        ///< callback executed on expiration
+    size_t id;                          ///< timers id, passed to the callback
+    size_t period;                      ///< ticks between start and expiration
+    size_t deadline;                    ///< absolute tick of the next expiration
+    bool auto_reload;                   ///< rearms the timer after every expiration
+    bool active;                        ///< indicates, whether the timer is stored in a list of active timers
+} software_timer_t;
+
+/// control information for active software timers
+typedef struct {
+    software_timer_t *first;    ///< timer with the earliest deadline
+    size_t size;                ///< amount of active timers
+} software_timer_list_t;
+
+/* Public functions (prototypes) */
+size_t software_timer_create(software_timer_t **software_timer, size_t id, void (*callback)(size_t id), size_t period, bool auto_reload);
+size_t software_timer_delete(software_timer_t **software_timer);
+size_t software_timer_list_create(software_timer_list_t **software_timer_list);
+size_t software_timer_list_delete(software_timer_list_t **software_timer_list);
+size_t software_timer_start(software_timer_list_t **software_timer_list, software_timer_t **software_timer, size_t start_tick);
+size_t software_timer_stop(software_timer_list_t **software_timer_list, software_timer_t **software_timer);
+size_t software_timer_get_next_ticks(software_timer_list_t **software_timer_list, size_t now, size_t *ticks);
+size_t software_timer_process(software_timer_list_t **software_timer_list, size_t now, size_t *expired_timers);
+size_t software_timer_checking(software_timer_t **software_timer);
+#endif /* KERNEL_SOFTWARE_TIMER_H_ */
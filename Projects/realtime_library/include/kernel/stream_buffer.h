@@ -0,0 +1,102 @@
+/**
+**************************************************
+* @file stream_buffer.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for streams of bytes and messages of variable size
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'stream_buffer_create' to create a stream buffer
+  (#) Call 'stream_buffer_create_static' to create a stream
+      buffer in caller supplied storage
+  (#) Call 'stream_buffer_delete' to delete a stream buffer
+  (#) Call 'stream_buffer_write' to copy bytes or a message
+      into the ring
+  (#) Call 'stream_buffer_read' to copy bytes or a message
+      out of the ring
+  (#) Call 'stream_buffer_is_readable' to check whether a
+      receiver has to be woken up
+  (#) Call 'stream_buffer_get_waiting_task' to get the first
+      task of a waiting list
+  (#) Call 'stream_buffer_wait' to block a task in a
+      waiting list
+  (#) All functions call 'stream_buffer_checking' to validate
+      proper stream buffer structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_STREAM_BUFFER_H_
+#define KERNEL_STREAM_BUFFER_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/linked_list.h"
+#include "kernel/task.h"
+
+/* Public Preprocessor defines */
+#define STREAM_BUFFER_SUCCESS           0
+#define STREAM_BUFFER_NO_MEMORY         1
+#define STREAM_BUFFER_IS_NULL           2
+#define STREAM_BUFFER_INVALID_SIZE      3
+#define STREAM_BUFFER_NO_WAITING_LIST   4
+#define STREAM_BUFFER_FULL              5
+#define STREAM_BUFFER_EMPTY             6
+#define STREAM_BUFFER_MESSAGE_TOO_LARGE 7
+#define STREAM_BUFFER_UNABLE_TO_WAIT    8
+
+#define STREAM_BUFFER_LENGTH            4
+
+#define STREAM_BUFFER_LINKED_LIST_ERROR_REGISTER STREAM_BUFFER_LENGTH
+
+// every message of a message buffer is preceded by its length
+#define STREAM_BUFFER_MESSAGE_HEADER_SIZE   sizeof(size_t)
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// Control information for a stream buffer
+typedef struct {
+    size_t id;                          ///< stream buffers id
+    uint8_t *buffer;                    ///< continuous ring of size bytes
+    size_t size;                        ///< capacity of the ring in bytes
+    size_t head;                        ///< position of the next written byte
+    size_t tail;                        ///< position of the next read byte
+    size_t length;                      ///< stored bytes including message headers
+    size_t trigger_level;               ///< stored bytes, which wake up a receiver, 1 for messages
+    bool message_mode;                  ///< bytes are stored as messages preceded by their length
+    linked_list_t *receiving_task_list; ///< linked list for storing tasks waiting for bytes
+    linked_list_t *sending_task_list;   ///< linked list for storing tasks waiting for free space
+    bool allocated;                     ///< storage is released on delete, false for caller supplied storage
+} stream_buffer_t;
+
+/// Storage for a stream buffer including its waiting lists, the ring is supplied separately
+typedef struct {
+    stream_buffer_t stream_buffer;      ///< stream buffer, has to stay the first member
+    linked_list_t receiving_task_list;  ///< storage of the receiving list
+    linked_list_t sending_task_list;    ///< storage of the sending list
+} stream_buffer_static_t;
+
+/* Public functions (prototypes) */
+size_t stream_buffer_create(stream_buffer_t **stream_buffer, size_t id, size_t size, size_t trigger_level, bool message_mode);
+size_t stream_buffer_create_static(stream_buffer_t **stream_buffer, stream_buffer_static_t *storage, uint8_t *buffer, size_t id, size_t size, size_t trigger_level, bool message_mode);
+size_t stream_buffer_delete(stream_buffer_t **stream_buffer);
+size_t stream_buffer_write(stream_buffer_t **stream_buffer, const void *data, size_t length, size_t *written);
+size_t stream_buffer_read(stream_buffer_t **stream_buffer, void *data, size_t max_length, size_t *read);
+bool stream_buffer_is_readable(stream_buffer_t **stream_buffer);
+size_t stream_buffer_get_waiting_task(linked_list_t **waiting_task_list, linked_list_element_t **element, task_t **task);
+size_t stream_buffer_wait(stream_buffer_t **stream_buffer, linked_list_t **waiting_task_list, linked_list_t **running_task_list, linked_list_element_t **running_task_element);
+
+size_t stream_buffer_checking(stream_buffer_t **stream_buffer);
+
+#endif /* KERNEL_STREAM_BUFFER_H_ */
@@ -12,12 +12,18 @@
 ==================================================
   ### Usage ###
   (#) Call 'task_create' to create a task
+  (#) Call 'task_create_static' to create a task in caller
+      supplied storage
   (#) Call 'task_set_state' to set a tasks state
   (#) Call 'task_set_time_quantum_remaining' to set the
       remaining time quantum of a task
   (#) Call 'task_set_priority' to set a tasks priority
+  (#) Call 'task_set_inherited_priority' to set a tasks
+      effective priority without changing its base priority
   (#) Call 'task_set_blocked_info' to set a tasks current
       blocked information of which list it belongs to
+  (#) Call 'task_notify' to update the notification value
+      of a task by a notification action
   (#) All functions call 'task_checking' to validate
       proper task structure. Refer to this function
       for potential error codes not documented in each
@@ -35,6 +41,9 @@
 #include "utils/support.h"
 #include <stdbool.h>
 #include "utils/linked_list.h"
+#include "utils/timer_wheel.h"
+
+struct mutex;
 
 /* Public Preprocessor defines */
 #define TASK_SUCCESS			0
@@ -42,8 +51,15 @@
 #define TASK_DATA_NO_MEMORY		2
 #define TASK_LENGTH				3
 #define TASK_UNDEFINED_STATE	4
+#define TASK_STACK_NO_MEMORY	5
+#define TASK_INVALID_STACK		6
+#define TASK_INVALID_ACTION		7
 #define TASK_MAX_PRIORITY		(UINT8_MAX / 4)
 /* Public Preprocessor macros */
+
+// gets the task, which embeds the linked list element of a priority group or waiting list
+#define TASK_FROM_LIST_ELEMENT(element)	LINKED_LIST_CONTAINER_OF(element, task_t, list_element)
+
 /* Public type definitions */
 
 /// control information for events
@@ -54,6 +70,37 @@ typedef struct {
 	size_t timeout; ///< event receive timeout
 } event_register_t;
 
+/// actions applied to the notification value of a task
+typedef enum {
+	TASK_NOTIFY_NO_ACTION,///< only marks a notification as pending
+	TASK_NOTIFY_SET_BITS,///< sets the given bits in the notification value
+	TASK_NOTIFY_INCREMENT,///< increments the notification value, the given value is ignored
+	TASK_NOTIFY_OVERWRITE,///< replaces the notification value
+	TASK_NOTIFY_MAX_ACTION
+} task_notify_action_e;
+
+/// wait condition of a task blocked on an event group
+typedef struct {
+	size_t wanted_events;///< bits the task waits for
+	size_t received_events;///< bits of the event group, which satisfied the wait, 0 while unsatisfied
+	bool wait_all;///< all wanted bits have to be set, otherwise any of them
+	bool clear_on_exit;///< the wanted bits are cleared in the event group, when the wait is satisfied
+} event_group_wait_t;
+
+/// control information for direct task notifications
+typedef struct {
+	size_t value;///< notification value
+	bool pending;///< a notification arrived, which was not waited for yet
+	bool waiting;///< the task is blocked until a notification arrives
+} task_notification_t;
+
+/// cpu time of a task, which is charged by the kernel on every task switch
+typedef struct {
+	uint64_t cycles;///< cycles the task ran
+	uint64_t created;///< cycles of the system, when the task was inserted
+	size_t activations;///< task switches to the task
+} task_cpu_t;
+
 /// control information for a task
 typedef struct {
 	TCB_sctTCB_t *task_data;///< tasks data
@@ -65,18 +112,36 @@ typedef struct {
 	char task_name[32];///< tasks name
 	void *message;///< stored message from a message queue
 	bool message_set;///< indicated, whether a message was set
-	size_t delta_time;///< tasks delta time, if blocked and stored in a separate waiting list
+	linked_list_element_t list_element;///< links the task in its priority group or the waiting list it is blocked in
+	timer_wheel_node_t timeout_node;///< tasks timeout, if blocked and stored in a separate waiting list
 	event_register_t event_register; ///< tasks event register
+	task_notification_t notification;///< tasks notification word, addressed without a dictionary lookup
+	task_cpu_t cpu;///< tasks cpu time
+	event_group_wait_t event_group_wait;///< wait condition, if blocked on an event group
 	linked_list_t *blocked_timeout_list;///< shows in which waiting list the task was stored, if receiving events
 	linked_list_element_t *blocked_timeout_list_element;///< is the linked list element in a separate waiting list, if receiving events
 	size_t return_value;///< tasks exit code
+	uint8_t base_priority;///< assigned priority, the task data holds the effective priority including inherited priorities
+	uint8_t ceiling_locks;///< amount of held ceiling mutexes, round robin in the ceiling priority group is deferred meanwhile
+	struct mutex *blocked_mutex;///< mutex the task waits for, to pass an inherited priority along a chain of owners
+	bool stack_owned;///< indicates, whether the stack was allocated on creation and has to be freed on deletion
+	bool allocated;///< indicates, whether the task was allocated on creation, false for caller supplied storage
 } task_t;
+
+/// storage for a task including its task control block, the stack is supplied separately
+typedef struct {
+	task_t task;///< task, has to stay the first member
+	TCB_sctTCB_t task_data;///< storage of the tasks data
+} task_static_t;
 /* Public functions (prototypes) */
-size_t task_create(task_t **task, size_t (*task_main)(void), void (*kernel_task_terminate)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout);
+size_t task_create(task_t **task, size_t (*task_main)(void), void (*kernel_task_terminate)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack);
+size_t task_create_static(task_t **task, task_static_t *storage, size_t (*task_main)(void), void (*kernel_task_terminate)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack);
 size_t task_delete(task_t **task);
 size_t task_set_state(task_t **task, TCB_eTastStates_t TaskState_Ready);
 size_t task_reset_time_quantum_remaining(task_t **task);
 size_t task_set_priority(task_t **task, uint8_t u8_task_priority);
+size_t task_set_inherited_priority(task_t **task, uint8_t u8_task_priority);
 size_t task_set_blocked_info(task_t **task, linked_list_t **blocked_timeout_list, linked_list_element_t **blocked_timeout_list_element);
+size_t task_notify(task_t **task, size_t value, task_notify_action_e action);
 size_t task_checking(task_t **task);
 #endif /* TASK_TASK_H_ */
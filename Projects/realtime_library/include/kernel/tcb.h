@@ -11,7 +11,9 @@
 #include <stdint.h>
 
 /// Stack size of a single task
-#define TCB_TASK_STACK_SIZE                 ( 128u )    ///< TODO: Must be adapted if a task requires a lot of stack!
+#define TCB_TASK_STACK_SIZE                 ( 128u )    ///< Default stack size in words, tasks can request their own size
+/// Smallest stack size of a single task in words, covering the initial stack frame and R4-R11
+#define TCB_TASK_MINIMUM_STACK_SIZE         ( 32u )
 
 /// Enum for task states
 typedef enum
@@ -25,7 +27,7 @@ typedef enum
     TaskState_Blocked,      ///< Indicates that a task is blocked and still not ready to be selected by scheduler.
 
     // TODO: For the future...
-    TaskState_Deleted,      ///< [FUTURE] Indicates that a task was deleted and will never run again.
+    TaskState_Deleted,      ///< Indicates that a task terminated or was deleted and will never run again.
     TaskState_MAX_STATE,    ///< Used for validity checks
 } TCB_eTastStates_t;
 
@@ -36,8 +38,9 @@ typedef struct
     uint8_t u8TaskPrio;           ///< priority of the task
     TCB_eTastStates_t eTaskState; ///< the tasks state
 
-    uint32_t au32TaskStack[TCB_TASK_STACK_SIZE];    ///< Tasks stack. We will push our registers R4-R11 on the stack because PendSV pushes the rest of the registers on the stack too.
-    uint32_t u32TaskSP;                             ///< To store the current stack pointer. As an alternative, we could use an index 'u8IdxSP' which points to the current cell on the stack. The address the corresponds to &au32TaskStack[u8IdxSP]
+    uint32_t *pu32TaskStack;                        ///< Tasks stack, allocated or provided by the caller. We will push our registers R4-R11 on the stack because PendSV pushes the rest of the registers on the stack too.
+    uint32_t u32TaskStackSize;                      ///< Size of the tasks stack in words
+    uint32_t u32TaskSP;                             ///< To store the current stack pointer. As an alternative, we could use an index 'u8IdxSP' which points to the current cell on the stack. The address the corresponds to &pu32TaskStack[u8IdxSP]
 } TCB_sctTCB_t;
 
 #endif /* DOS_INC_TCB_H_ */
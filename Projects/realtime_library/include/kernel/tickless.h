@@ -0,0 +1,80 @@
+/**
+**************************************************
+* @file tickless.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for suppressing the system tick during idle
+@verbatim
+==================================================
+  ### Resources used ###
+  A one shot timer provided by the port layer
+==================================================
+  ### Usage ###
+  (#) Provide a 'tickless_timer_t' with the port
+      specific timer functions
+  (#) Call 'tickless_create' to create a tickless
+      idle control
+  (#) Call 'tickless_delete' to delete a tickless
+      idle control
+  (#) Call 'tickless_idle' with interrupts disabled to
+      sleep until the next timeout of the timing wheel
+      is due or any other interrupt arrived
+  (#) Call 'tickless_get_skipped_ticks' to get the
+      amount of suppressed ticks
+  (#) All functions call 'tickless_checking' to validate
+      proper tickless structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_TICKLESS_H_
+#define KERNEL_TICKLESS_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/timer_wheel.h"
+
+/* Public Preprocessor defines */
+#define TICKLESS_SUCCESS                0
+#define TICKLESS_NO_MEMORY              1
+#define TICKLESS_NO_TIMER               2
+#define TICKLESS_IDLE_TOO_SHORT         3
+#define TICKLESS_UNABLE_TO_IDLE         4
+
+#define TICKLESS_LENGTH                 3
+
+#define TICKLESS_WAIT_FOREVER           SIZE_MAX
+
+#define TICKLESS_TIMER_WHEEL_ERROR_REGISTER TICKLESS_LENGTH
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// port layer timer, which replaces the system tick during idle
+typedef struct {
+    size_t (*start)(size_t ticks);          ///< suppresses the tick, programs a one shot wakeup and returns the programmed ticks
+    void (*sleep)(void);                    ///< suspends the core until the wakeup or any other interrupt
+    size_t (*stop)(void);                   ///< stops the wakeup, resumes the tick and returns the elapsed ticks
+    void (*increment_tick)(size_t ticks);   ///< credits the elapsed ticks to the system tick
+} tickless_timer_t;
+
+/// control information for tickless idle
+typedef struct {
+    const tickless_timer_t *timer;  ///< port layer timer
+    size_t minimum_ticks;           ///< shortest idle period worth suppressing the tick
+    size_t skipped_ticks;           ///< total amount of suppressed ticks
+    size_t sleeps;                  ///< amount of tickless sleeps
+} tickless_t;
+
+/* Public functions (prototypes) */
+size_t tickless_create(tickless_t **tickless, const tickless_timer_t *timer, size_t minimum_ticks);
+size_t tickless_delete(tickless_t **tickless);
+size_t tickless_idle(tickless_t **tickless, timer_wheel_t **timer_wheel, size_t *elapsed_ticks);
+size_t tickless_get_skipped_ticks(tickless_t **tickless, size_t *skipped_ticks);
+size_t tickless_checking(tickless_t **tickless);
+#endif /* KERNEL_TICKLESS_H_ */
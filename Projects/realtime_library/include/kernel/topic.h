@@ -0,0 +1,102 @@
+/**
+**************************************************
+* @file topic.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for publishing samples to any amount of subscribers
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'topic_create' to create a topic
+  (#) Call 'topic_create_static' to create a topic in caller
+      supplied storage
+  (#) Call 'topic_delete' to delete a topic
+  (#) Call 'topic_subscribe' to add a subscriber, which reads
+      the samples published afterwards
+  (#) Call 'topic_publish' to write a sample once into the
+      ring, its costs do not depend on the subscribers
+  (#) Call 'topic_read' to copy the next sample of a
+      subscriber. A subscriber, which fell behind by more
+      than the ring size, skips the overwritten samples and
+      counts them as overruns.
+  (#) Call 'topic_wait' to block a task until the next sample
+  (#) Call 'topic_get_overruns' to get the overruns of a
+      subscriber
+  (#) All functions call 'topic_checking' to validate
+      proper topic structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef KERNEL_TOPIC_H_
+#define KERNEL_TOPIC_H_
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/linked_list.h"
+
+/* Public Preprocessor defines */
+#define TOPIC_SUCCESS               0
+#define TOPIC_NO_MEMORY             1
+#define TOPIC_IS_NULL               2
+#define TOPIC_INVALID_SIZE          3
+#define TOPIC_NO_WAITING_LIST       4
+#define TOPIC_NO_SUBSCRIBER         5
+#define TOPIC_NO_SAMPLE             6
+#define TOPIC_UNABLE_TO_WAIT        7
+
+#define TOPIC_LENGTH                3
+
+#define TOPIC_LINKED_LIST_ERROR_REGISTER TOPIC_LENGTH
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// read position of a subscriber
+typedef struct {
+    size_t cursor;                      ///< sequence number of the next sample to read
+    size_t overruns;                    ///< samples overwritten by the publisher before they were read
+} topic_subscriber_t;
+
+/// Control information for a topic
+typedef struct {
+    size_t id;                          ///< topics id
+    uint8_t *samples;                   ///< ring of size samples, which is shared by all subscribers
+    size_t sample_size;                 ///< size of a single sample
+    size_t size;                        ///< amount of samples, a power of 2
+    size_t sequence;                    ///< sequence number of the next published sample
+    topic_subscriber_t *subscribers;    ///< read positions of max_subscribers subscribers
+    size_t max_subscribers;             ///< amount of subscribers the topic has storage for
+    size_t subscriber_count;            ///< amount of subscribers
+    linked_list_t *waiting_task_list;   ///< linked list for storing tasks waiting for the next sample
+    bool allocated;                     ///< storage is released on delete, false for caller supplied storage
+} topic_t;
+
+/// Storage for a topic including its waiting list
+typedef struct {
+    topic_t topic;                      ///< topic, has to stay the first member
+    linked_list_t waiting_task_list;    ///< storage of the waiting list
+} topic_static_t;
+
+/* Public functions (prototypes) */
+size_t topic_create(topic_t **topic, size_t id, size_t size, size_t sample_size, size_t max_subscribers);
+size_t topic_create_static(topic_t **topic, topic_static_t *storage, void *samples, topic_subscriber_t *subscribers, size_t id, size_t size, size_t sample_size, size_t max_subscribers);
+size_t topic_delete(topic_t **topic);
+size_t topic_subscribe(topic_t **topic, size_t *subscriber);
+size_t topic_publish(topic_t **topic, void *sample);
+size_t topic_read(topic_t **topic, size_t subscriber, void *sample);
+size_t topic_wait(topic_t **topic, linked_list_t **running_task_list, linked_list_element_t **running_task_element);
+size_t topic_get_overruns(topic_t **topic, size_t subscriber, size_t *overruns);
+
+size_t topic_checking(topic_t **topic);
+
+#endif /* KERNEL_TOPIC_H_ */
@@ -0,0 +1,53 @@
+/**
+**************************************************
+* @file allocator.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for the exchangeable heap of all dynamically created objects
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'allocator_set' to replace malloc and free by
+      another heap before any object is created, e.g. by
+      a TLSF heap with a bounded worst case
+  (#) Call 'allocator_allocate' instead of malloc
+  (#) Call 'allocator_free' instead of free, NULL is
+      ignored
+  (#) A block has to be freed by the heap, which allocated
+      it. Replace the heap only while no block is in use.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_ALLOCATOR_H_
+#define UTILS_ALLOCATOR_H_
+
+/* Includes */
+#include <stddef.h>
+
+/* Public Preprocessor defines */
+#define ALLOCATOR_SUCCESS           0
+#define ALLOCATOR_IS_NULL           1
+
+#define ALLOCATOR_LENGTH            1
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// Heap used for every dynamically created object
+typedef struct {
+    void *(*allocate)(void *context, size_t size);  ///< returns a block of size bytes or NULL
+    void (*free)(void *context, void *block);       ///< returns a block, which is not NULL
+    void *context;                                  ///< passed to both functions, e.g. the heap control
+} allocator_t;
+
+/* Public functions (prototypes) */
+size_t allocator_set(const allocator_t *allocator);
+void *allocator_allocate(size_t size);
+void allocator_free(void *block);
+#endif /* UTILS_ALLOCATOR_H_ */
@@ -0,0 +1,135 @@
+/**
+**************************************************
+* @file atomic.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for lock free operations on single words
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Only contains inline functions, which are used by
+      the kernel fast paths without masking interrupts
+  (#) Call 'atomic_compare_exchange' to replace a word,
+      if it still holds the expected value
+  (#) Call 'atomic_compare_exchange_pointer' to replace
+      a pointer, if it still holds the expected pointer
+  (#) Call 'atomic_decrement_if_positive' to take a
+      token from a counter
+  (#) Call 'atomic_increment_if_below' to return a
+      token to a counter with a maximum
+  (#) Call 'atomic_fence' to order memory accesses, before
+      a word publishes data written in front of it
+  (#) The target uses LDREX/STREX, an interrupt between
+      both instructions clears the exclusive monitor and
+      the exchange is retried. The host uses C11 atomics.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_ATOMIC_H_
+#define UTILS_ATOMIC_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef __arm__
+#include <stdatomic.h>
+#endif
+
+/* Public Preprocessor defines */
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/* Public functions (prototypes) */
+
+/**
+ * @brief Replaces a word, if it holds the expected value.
+ * @param value is a pointer to the word
+ * @param expected is the value the word has to hold
+ * @param desired is the value to store
+ * @return true, if the word was replaced
+ */
+static inline bool atomic_compare_exchange(volatile size_t *value, size_t expected, size_t desired) {
+#ifdef __arm__
+    size_t current = 0;
+    uint32_t failed = 0;
+    do {
+        __asm volatile ("ldrex %0, [%1]" : "=r" (current) : "r" (value) : "memory");
+        if (current != expected) {
+            __asm volatile ("clrex" ::: "memory");
+            return false;
+        }
+        __asm volatile ("strex %0, %2, [%1]" : "=&r" (failed) : "r" (value), "r" (desired) : "memory");
+    } while (failed != 0);
+    __asm volatile ("dmb" ::: "memory");
+    return true;
+#else
+    return atomic_compare_exchange_strong((_Atomic size_t *) value, &expected, desired);
+#endif
+}
+
+/**
+ * @brief Replaces a pointer, if it holds the expected pointer.
+ * @param pointer is a pointer to the pointer
+ * @param expected is the pointer it has to hold
+ * @param desired is the pointer to store
+ * @return true, if the pointer was replaced
+ */
+static inline bool atomic_compare_exchange_pointer(void * volatile *pointer, void *expected, void *desired) {
+    // pointers and words have the same size on both the target and the host
+    return atomic_compare_exchange((volatile size_t *) pointer, (size_t) expected, (size_t) desired);
+}
+
+/**
+ * @brief Decrements a counter, if it is greater than 0.
+ * @param value is a pointer to the counter
+ * @return true, if the counter was decremented
+ */
+static inline bool atomic_decrement_if_positive(volatile size_t *value) {
+    size_t current = *value;
+    while (current > 0) {
+        if (atomic_compare_exchange(value, current, current - 1)) {
+            return true;
+        }
+        current = *value;
+    }
+    return false;
+}
+
+/**
+ * @brief Increments a counter, if it is below a maximum.
+ * @param value is a pointer to the counter
+ * @param maximum is the value the counter must not exceed
+ * @return true, if the counter was incremented
+ */
+static inline bool atomic_increment_if_below(volatile size_t *value, size_t maximum) {
+    size_t current = *value;
+    while (current < maximum) {
+        if (atomic_compare_exchange(value, current, current + 1)) {
+            return true;
+        }
+        current = *value;
+    }
+    return false;
+}
+
+/**
+ * @brief Orders the memory accesses in front of the fence before the reads and writes behind it.
+ *        Only a write followed by a read may still be reordered, which publishing data never needs.
+ */
+static inline void atomic_fence(void) {
+#ifdef __arm__
+    __asm volatile ("dmb" ::: "memory");
+#else
+    atomic_thread_fence(memory_order_acq_rel);
+#endif
+}
+
+#endif /* UTILS_ATOMIC_H_ */
@@ -0,0 +1,79 @@
+/**
+**************************************************
+* @file bitmap.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using two level bitmaps
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'bitmap_create' to create a bitmap
+  (#) Call 'bitmap_create_static' to create a bitmap in
+      caller supplied storage of BITMAP_WORDS words
+  (#) Call 'bitmap_set' to set a bit in the bitmap
+  (#) Call 'bitmap_clear' to clear a bit in the bitmap
+  (#) Call 'bitmap_is_set' to check a single bit
+  (#) Call 'bitmap_get_first' to get the lowest set bit
+      in constant time
+  (#) Call 'bitmap_delete' to delete a bitmap
+  (#) All functions call 'bitmap_checking' to validate
+      proper bitmap structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_BITMAP_H_
+#define UTILS_BITMAP_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Preprocessor defines */
+#define BITMAP_SUCCESS              0
+#define BITMAP_NO_MEMORY            1
+#define BITMAP_DATA_NO_MEMORY       2
+#define BITMAP_OVERFLOW             3
+#define BITMAP_IS_EMPTY             4
+
+#define BITMAP_LENGTH               3
+
+#define BITMAP_WORD_BITS            32
+#define BITMAP_MAX_SIZE             (BITMAP_WORD_BITS * BITMAP_WORD_BITS)
+
+/* Public Preprocessor macros */
+
+// amount of words to store the given amount of bits
+#define BITMAP_WORDS(size)                  (((size) + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS)
+
+// lowered to a single CLZ instruction on Cortex-M4, value must not be 0
+#define BITMAP_COUNT_LEADING_ZEROS(value)   ((size_t) __builtin_clz((uint32_t) (value)))
+
+/* Public type definitions */
+
+/// Control information for a bitmap
+typedef struct {
+    uint32_t summary;   ///< one bit per non empty word, most significant bit is word 0
+    uint32_t *words;    ///< bit fields, most significant bit of word 0 is index 0
+    size_t size;        ///< amount of bits a bitmap can store
+    bool allocated;     ///< storage is released on delete, false for caller supplied storage
+} bitmap_t;
+
+/* Public functions (prototypes) */
+size_t bitmap_create(bitmap_t **bitmap, size_t size);
+size_t bitmap_create_static(bitmap_t **bitmap, bitmap_t *storage, uint32_t *words, size_t size);
+size_t bitmap_delete(bitmap_t **bitmap);
+size_t bitmap_set(bitmap_t **bitmap, size_t index);
+size_t bitmap_clear(bitmap_t **bitmap, size_t index);
+size_t bitmap_is_set(bitmap_t **bitmap, size_t index, bool *is_set);
+size_t bitmap_get_first(bitmap_t **bitmap, size_t *index);
+size_t bitmap_checking(bitmap_t **bitmap);
+#endif /* UTILS_BITMAP_H_ */
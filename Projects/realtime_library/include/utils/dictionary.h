@@ -12,6 +12,8 @@
 ==================================================
   ### Usage ###
   (#) Call 'dictionary_create' to create a dictionary
+  (#) Call 'dictionary_create_static' to create a dictionary
+      in caller supplied storage
   (#) Call 'dictionary_add' to add an entry to the dictionary
   (#) Call 'dictionary_get' to get an entry from the dictionary
   (#) Call 'dictionary_delete' to delete a dictionary
@@ -30,6 +32,7 @@
 /* Includes */
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 /* Public Preprocessor defines */
 #define DICTIONARY_SUCCESS	    	0
@@ -45,10 +48,12 @@
 typedef struct {
 	void **data;    ///< data fileds for pointers
 	size_t size;    ///< amount of data a dictionary it can store
+	bool allocated; ///< storage is released on delete, false for caller supplied storage
 } dictionary_t;
 
 /* Public functions (prototypes) */
 size_t dictionary_create(dictionary_t **dictionary, size_t size);
+size_t dictionary_create_static(dictionary_t **dictionary, dictionary_t *storage, void **data, size_t size);
 size_t dictionary_add(dictionary_t **dictionary, size_t key, void **value);
 size_t dictionary_get(dictionary_t **dictionary, size_t key, void **value);
 size_t dictionary_delete(dictionary_t **dictionary);
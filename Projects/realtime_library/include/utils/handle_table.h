@@ -0,0 +1,115 @@
+/**
+**************************************************
+* @file handle_table.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for tables of objects accessed by generation checked handles
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'handle_table_create' to create a handle table,
+      which optionally grows up to a maximum size
+  (#) Call 'handle_table_create_static' to create a handle
+      table of a fixed size in caller supplied storage
+  (#) Call 'handle_table_delete' to delete a handle table
+  (#) Call 'handle_table_reserve' to take a free slot and
+      get its handle before the object is created
+  (#) Call 'handle_table_set' to store the object of a
+      reserved handle
+  (#) Call 'handle_table_release' to free the slot of a
+      handle, the handle and all its copies become stale
+      and the slot is reused by the next reservation
+  (#) Call 'handle_table_get' to get the object of a handle
+      with a status for stale handles
+  (#) Use 'handle_table_lookup' in fast paths, it returns
+      the object with a single indexed load or NULL
+  (#) All functions call 'handle_table_checking' to validate
+      proper handle table structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+  (#) The handle table is not locked, the caller has to
+      serialize reservations and releases.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_HANDLE_TABLE_H_
+#define UTILS_HANDLE_TABLE_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Preprocessor defines */
+#define HANDLE_TABLE_SUCCESS            0
+#define HANDLE_TABLE_NO_MEMORY          1
+#define HANDLE_TABLE_SLOTS_NO_MEMORY    2
+#define HANDLE_TABLE_IS_NULL            3
+#define HANDLE_TABLE_FULL               4
+#define HANDLE_TABLE_INVALID_SIZE       5
+#define HANDLE_TABLE_STALE_HANDLE       6
+
+#define HANDLE_TABLE_LENGTH             3
+
+// the lower bits of a handle are the slot index, the upper bits are the generation of the slot
+#define HANDLE_TABLE_INDEX_BITS         16
+#define HANDLE_TABLE_INDEX_MASK         (((size_t) 1 << HANDLE_TABLE_INDEX_BITS) - 1)
+#define HANDLE_TABLE_GENERATION_STEP    ((size_t) 1 << HANDLE_TABLE_INDEX_BITS)
+// the highest index is never used, so that the invalid handle never matches a slot
+#define HANDLE_TABLE_MAX_SIZE           HANDLE_TABLE_INDEX_MASK
+#define HANDLE_TABLE_INVALID_HANDLE     ((size_t) -1)
+
+/* Public Preprocessor macros */
+
+// slot index of a handle
+#define HANDLE_TABLE_INDEX(handle)      ((handle) & HANDLE_TABLE_INDEX_MASK)
+
+/* Public type definitions */
+
+/// Slot of a handle table
+typedef struct {
+    void *value;        ///< object of the slot, NULL for a free or reserved slot
+    size_t handle;      ///< handle of the current generation, older handles of the slot differ in the generation
+    size_t next_free;   ///< index of the next free slot, size of the table for the last one
+} handle_table_slot_t;
+
+/// Control information for a handle table
+typedef struct {
+    handle_table_slot_t *slots; ///< slots indexed by the lower bits of a handle
+    size_t size;                ///< amount of slots
+    size_t max_size;            ///< amount of slots the table may grow to, equal size for a fixed table
+    size_t free_head;           ///< index of the first free slot, size of the table if all are taken
+    size_t used;                ///< amount of reserved slots
+    bool allocated;             ///< storage is released on delete, false for caller supplied storage
+} handle_table_t;
+
+/* Public functions (prototypes) */
+size_t handle_table_create(handle_table_t **handle_table, size_t size, size_t max_size);
+size_t handle_table_create_static(handle_table_t **handle_table, handle_table_t *storage, handle_table_slot_t *slots, size_t size);
+size_t handle_table_delete(handle_table_t **handle_table);
+size_t handle_table_reserve(handle_table_t **handle_table, size_t *handle);
+size_t handle_table_set(handle_table_t **handle_table, size_t handle, void *value);
+size_t handle_table_release(handle_table_t **handle_table, size_t handle);
+size_t handle_table_get(handle_table_t **handle_table, size_t handle, void **value);
+size_t handle_table_checking(handle_table_t **handle_table);
+
+/**
+ * @brief Gets the object of a handle without validating the table.
+ * @param handle_table is a pointer to a created handle table
+ * @param handle is the handle of the object
+ * @return the object or NULL for a stale, reserved or unknown handle
+ */
+static inline void *handle_table_lookup(const handle_table_t *handle_table, size_t handle) {
+    size_t index = HANDLE_TABLE_INDEX(handle);
+    if (index >= handle_table->size || handle_table->slots[index].handle != handle) {
+        return NULL;
+    }
+    return handle_table->slots[index].value;
+}
+#endif /* UTILS_HANDLE_TABLE_H_ */
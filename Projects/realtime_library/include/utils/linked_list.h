@@ -12,6 +12,18 @@
 ==================================================
   ### Usage ###
   (#) Call 'linked_list_create' to create a linked list
+  (#) Call 'linked_list_create_static' to create a linked
+      list in caller supplied storage
+  (#) Call 'linked_list_create_intrusive' or
+      'linked_list_create_intrusive_static' to create a
+      linked list, whose elements are embedded in the
+      stored data. Such a list never allocates or releases
+      elements, use LINKED_LIST_CONTAINER_OF to get the
+      data of an element.
+  (#) Call 'linked_list_element_init' to initialize an
+      embedded element
+  (#) Call 'linked_list_push_front_element' to push an
+      embedded element to the start of an intrusive list
   (#) Call 'linked_list_delete' to delete a linked list
   (#) Call 'linked_list_push_back' to push an element to
       the end of a linked list
@@ -51,6 +63,7 @@
 /* Includes */
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 /* Public Preprocessor defines */
 #define LINKED_LIST_SUCCESS	            0
@@ -61,11 +74,18 @@
 #define LINKED_LIST_NO_ELEMENT 	        4
 #define LINKED_LIST_ELEMENT_IS_NULL     5
 #define LINKED_LIST_SOURCE_IS_EMPTY		6
+#define LINKED_LIST_NOT_INTRUSIVE       7
+#define LINKED_LIST_IS_INTRUSIVE        8
 
 
 #define LINKED_LIST_LENGTH				3
 
 /* Public Preprocessor macros */
+
+// gets the structure, which embeds the linked list element as member
+#define LINKED_LIST_CONTAINER_OF(element, type, member) \
+    ((type *) ((uint8_t *) (element) - offsetof(type, member)))
+
 /* Public type definitions */
 
 /// Control information for a linked list element
@@ -80,11 +100,18 @@ typedef struct {
 	linked_list_element_t *head;    ///< linked lists head
 	linked_list_element_t *tail;    ///< linked lists tail
 	size_t size;                    ///< linked lists size
+	bool allocated;                 ///< storage is released on delete, false for caller supplied storage
+	bool intrusive;                 ///< elements are embedded in their data and never allocated or released
 } linked_list_t;
 
 /* Public functions (prototypes) */
 size_t linked_list_create(linked_list_t **linked_list);
+size_t linked_list_create_static(linked_list_t **linked_list, linked_list_t *storage);
+size_t linked_list_create_intrusive(linked_list_t **linked_list);
+size_t linked_list_create_intrusive_static(linked_list_t **linked_list, linked_list_t *storage);
 size_t linked_list_delete(linked_list_t **linked_list);
+size_t linked_list_element_init(linked_list_element_t *linked_list_element, void *data);
+size_t linked_list_push_front_element(linked_list_t **linked_list, linked_list_element_t *linked_list_element);
 size_t linked_list_push_back(linked_list_t **linked_list, void **data);
 size_t linked_list_pop_front(linked_list_t **linked_list, void **data);
 size_t linked_list_pop_back(linked_list_t **linked_list, void **data);
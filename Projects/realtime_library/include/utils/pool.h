@@ -0,0 +1,94 @@
+/**
+**************************************************
+* @file pool.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for fixed-size block pools
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Use POOL_DEFINE to define a pool of a type with
+      static storage for a fixed amount of blocks
+  (#) Use POOL_ALLOCATE and POOL_FREE to take and return
+      a block. Without KERNEL_STATIC_ALLOCATION both map
+      to the allocator and POOL_DEFINE reserves nothing.
+  (#) Call 'pool_create_static' to create a pool of a block
+      size only known at runtime in caller supplied storage
+  (#) Call 'pool_allocate' to take a block in constant time
+  (#) Call 'pool_free' to return a block in constant time
+  (#) Call 'pool_get_free_blocks' to get the amount of
+      blocks left
+  (#) All functions call 'pool_checking' to validate
+      proper pool structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_POOL_H_
+#define UTILS_POOL_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "kernel/kernel_config.h"
+#include "utils/allocator.h"
+
+/* Public Preprocessor defines */
+#define POOL_SUCCESS                0
+#define POOL_IS_NULL                1
+#define POOL_FOREIGN_BLOCK          2
+#define POOL_INVALID_BLOCK_SIZE     3
+
+#define POOL_LENGTH                 2
+
+/* Public Preprocessor macros */
+
+// blocks are 8 byte aligned to hold stacks and store the free list in unused blocks
+#define POOL_BLOCK(type)            union { type object; void *next; uint64_t alignment; }
+// size of a block of a runtime pool, which holds size bytes
+#define POOL_BLOCK_SIZE(size)       (((size) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+#define POOL_INITIALIZER(storage, block_count) \
+    { (uint8_t *) (storage), sizeof((storage)[0]), (block_count), 0, NULL, 0 }
+
+#if KERNEL_STATIC_ALLOCATION
+#define POOL_DEFINE(name, type, block_count) \
+    static POOL_BLOCK(type) name##_storage[(block_count)]; \
+    static pool_t name##_control = POOL_INITIALIZER(name##_storage, (block_count)); \
+    static pool_t *name = &name##_control
+#define POOL_ALLOCATE(name, type)   ((type *) pool_allocate(&(name)))
+#define POOL_FREE(name, pointer)    pool_free(&(name), (pointer))
+#else
+#define POOL_DEFINE(name, type, block_count) \
+    typedef type name##_type
+#define POOL_ALLOCATE(name, type)   ((type *) allocator_allocate(sizeof(type)))
+#define POOL_FREE(name, pointer)    allocator_free(pointer)
+#endif
+
+/* Public type definitions */
+
+/// Control information for a pool of fixed-size blocks
+typedef struct {
+    uint8_t *storage;       ///< first block
+    size_t block_size;      ///< size of a single block
+    size_t count;           ///< amount of blocks
+    size_t used;            ///< blocks handed out at least once, all following blocks are untouched
+    void *free_blocks;      ///< returned blocks, linked through their first word
+    size_t in_use;          ///< currently allocated blocks
+} pool_t;
+
+/* Public functions (prototypes) */
+size_t pool_create_static(pool_t **pool, pool_t *storage, void *blocks, size_t block_size, size_t count);
+void *pool_allocate(pool_t **pool);
+size_t pool_free(pool_t **pool, void *block);
+size_t pool_get_free_blocks(pool_t **pool, size_t *free_blocks);
+size_t pool_checking(pool_t **pool);
+#endif /* UTILS_POOL_H_ */
@@ -12,6 +12,8 @@
 ==================================================
   ### Usage ###
   (#) Call 'queue_create' to create a queue.
+  (#) Call 'queue_create_static' to create a queue in caller
+        supplied storage.
   (#) Call 'queue_delete' to delete a queue.
   (#) Call 'queue_write_back' to store a new element at the head
   	  and to use a queue as a fifo.
@@ -29,6 +31,7 @@
 
 /* Includes */
 #include <stddef.h>
+#include <stdbool.h>
 
 /* Public Preprocessor defines */
 #define QUEUE_SUCCESS               0
@@ -52,10 +55,12 @@ typedef struct {
 	size_t head;            ///< queues head
 	size_t tail;            ///< queues tail
 	void **data;            ///< queues data pointer
+	bool allocated;         ///< storage is released on delete, false for caller supplied storage
 } queue_t;
 
 /* Public functions (prototypes) */
 size_t queue_create(queue_t **queue, size_t queue_size, size_t element_size);
+size_t queue_create_static(queue_t **queue, queue_t *storage, void **data, void *buffer, size_t queue_size, size_t element_size);
 size_t queue_delete(queue_t **queue);
 size_t queue_push_front(queue_t **queue, void *element, size_t element_size);
 size_t queue_push_back(queue_t **queue, void *element, size_t element_size);
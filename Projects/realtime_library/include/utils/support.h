@@ -38,7 +38,10 @@
 // sub_component_status = subcomponent, register = where to store status, component_status = component itself
 #define ERROR_INFO(sub_component_status, component_register, component_status) (((sub_component_status) << (component_register)) | (component_status))
 
+// System View records on the target only
+#ifdef __arm__
 #define SEGGER
+#endif
 
 #ifdef SEGGER
 // Segger SysView
@@ -0,0 +1,93 @@
+/**
+**************************************************
+* @file timer_wheel.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using hierarchical timing wheels
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'timer_wheel_create' to create a timing wheel
+  (#) Call 'timer_wheel_delete' to delete a timing wheel
+  (#) Call 'timer_wheel_node_init' to prepare a node,
+      which is usually embedded in the timed structure
+  (#) Call 'timer_wheel_insert' to start a node in
+      constant time
+  (#) Call 'timer_wheel_cancel' to stop a node in
+      constant time
+  (#) Call 'timer_wheel_tick' to advance the timing wheel
+      by one tick and to obtain all expired nodes at once
+  (#) Call 'timer_wheel_get_idle_ticks' to get the amount
+      of ticks without any expiration
+  (#) Call 'timer_wheel_skip' to advance the timing wheel
+      by ticks without any expiration
+  (#) All functions call 'timer_wheel_checking' to validate
+      proper timing wheel structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_TIMER_WHEEL_H_
+#define UTILS_TIMER_WHEEL_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Preprocessor defines */
+#define TIMER_WHEEL_SUCCESS             0
+#define TIMER_WHEEL_NO_MEMORY           1
+#define TIMER_WHEEL_NODE_IS_NULL        2
+#define TIMER_WHEEL_NODE_IS_ACTIVE      3
+#define TIMER_WHEEL_NODE_IS_INACTIVE    4
+#define TIMER_WHEEL_IS_EMPTY            5
+#define TIMER_WHEEL_OVERFLOW            6
+
+#define TIMER_WHEEL_LENGTH              3
+
+#define TIMER_WHEEL_LEVELS              4
+#define TIMER_WHEEL_SLOT_BITS           6
+#define TIMER_WHEEL_SLOTS               (1u << TIMER_WHEEL_SLOT_BITS)
+// ticks covered by all levels, longer periods are cascaded repeatedly through the last level
+#define TIMER_WHEEL_RANGE               ((size_t) 1 << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS))
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// Control information for a timing wheel node
+typedef struct timer_wheel_node {
+    struct timer_wheel_node *previous;  ///< previous node in the same slot
+    struct timer_wheel_node *next;      ///< next node in the same slot or in the expired nodes
+    struct timer_wheel_node **slot;     ///< slot containing the node, NULL if inactive
+    size_t expiry;                      ///< absolute tick of expiration
+    void *data;                         ///< timed data
+} timer_wheel_node_t;
+
+/// Control information for a timing wheel
+typedef struct {
+    timer_wheel_node_t *slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];  ///< slots of every level
+    uint64_t occupied[TIMER_WHEEL_LEVELS];                              ///< one bit per non empty slot
+    size_t now;                                                         ///< current tick
+    size_t size;                                                        ///< amount of active nodes
+} timer_wheel_t;
+
+/* Public functions (prototypes) */
+size_t timer_wheel_create(timer_wheel_t **timer_wheel);
+size_t timer_wheel_delete(timer_wheel_t **timer_wheel);
+size_t timer_wheel_node_init(timer_wheel_node_t *node, void *data);
+bool timer_wheel_node_is_active(timer_wheel_node_t *node);
+size_t timer_wheel_insert(timer_wheel_t **timer_wheel, timer_wheel_node_t *node, size_t ticks);
+size_t timer_wheel_cancel(timer_wheel_t **timer_wheel, timer_wheel_node_t *node);
+size_t timer_wheel_tick(timer_wheel_t **timer_wheel, timer_wheel_node_t **expired);
+size_t timer_wheel_get_idle_ticks(timer_wheel_t **timer_wheel, size_t *ticks);
+size_t timer_wheel_skip(timer_wheel_t **timer_wheel, size_t ticks);
+size_t timer_wheel_checking(timer_wheel_t **timer_wheel);
+#endif /* UTILS_TIMER_WHEEL_H_ */
@@ -0,0 +1,106 @@
+/**
+**************************************************
+* @file tlsf.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for a two level segregated fit heap with constant time allocation
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'tlsf_create_static' to create a heap over a
+      caller supplied memory region
+  (#) Call 'tlsf_allocate' to take a block in constant time
+  (#) Call 'tlsf_free' to return a block in constant time,
+      it is merged with its free neighbours immediately
+  (#) Call 'tlsf_get_statistics' to get the free space and
+      the fragmentation of the heap
+  (#) Use 'tlsf_allocator_allocate' and 'tlsf_allocator_free'
+      with the heap as context to plug it into allocator_set
+  (#) All functions call 'tlsf_checking' to validate
+      proper heap structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+  (#) The heap is not locked, the caller has to serialize
+      the access, e.g. by a critical section.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_TLSF_H_
+#define UTILS_TLSF_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Preprocessor defines */
+#define TLSF_SUCCESS                0
+#define TLSF_IS_NULL                1
+#define TLSF_INVALID_SIZE           2
+#define TLSF_INVALID_BLOCK          3
+
+#define TLSF_LENGTH                 2
+
+// every second level divides a power of two range into 2^TLSF_SL_INDEX_COUNT_LOG2 size classes
+#define TLSF_SL_INDEX_COUNT_LOG2    4
+#define TLSF_SL_INDEX_COUNT         (1 << TLSF_SL_INDEX_COUNT_LOG2)
+// blocks are 8 byte aligned like the blocks of a pool
+#define TLSF_ALIGN_SIZE_LOG2        3
+#define TLSF_ALIGN_SIZE             (1 << TLSF_ALIGN_SIZE_LOG2)
+// blocks below 2^TLSF_FL_INDEX_SHIFT bytes share the first level 0 in linear steps of TLSF_ALIGN_SIZE
+#define TLSF_FL_INDEX_SHIFT         (TLSF_SL_INDEX_COUNT_LOG2 + TLSF_ALIGN_SIZE_LOG2)
+// blocks are smaller than 2^TLSF_FL_INDEX_MAX bytes
+#ifndef TLSF_FL_INDEX_MAX
+#define TLSF_FL_INDEX_MAX           30
+#endif
+#define TLSF_FL_INDEX_COUNT         (TLSF_FL_INDEX_MAX - TLSF_FL_INDEX_SHIFT + 1)
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// Header in front of every block, a free block stores its list links in the payload
+typedef struct tlsf_block {
+    struct tlsf_block *prev_physical;   ///< block in front of this block in memory, NULL for the first block
+    size_t size;                        ///< payload size in bytes, the lowest bit marks a free block
+} tlsf_block_t;
+
+/// Statistics of a heap, the block counts and the largest free block are gathered by walking the heap
+typedef struct {
+    size_t heap_size;           ///< payload bytes of the heap after creation
+    size_t free_size;           ///< payload bytes of all free blocks
+    size_t used_size;           ///< payload bytes of all allocated blocks
+    size_t used_size_max;       ///< most payload bytes allocated at once
+    size_t free_blocks;         ///< amount of free blocks
+    size_t used_blocks;         ///< amount of allocated blocks
+    size_t largest_free_block;  ///< payload bytes of the largest free block, requests are rounded up to the next size class
+    size_t fragmentation;       ///< percentage of the free bytes outside of the largest free block
+    size_t failures;            ///< allocations, which returned NULL
+} tlsf_statistics_t;
+
+/// Control information of a heap
+typedef struct {
+    tlsf_block_t *first;                                                    ///< first block of the memory region
+    size_t heap_size;                                                       ///< payload bytes of the heap after creation
+    size_t used_size;                                                       ///< payload bytes of all allocated blocks
+    size_t used_size_max;                                                   ///< most payload bytes allocated at once
+    size_t failures;                                                        ///< allocations, which returned NULL
+    size_t fl_bitmap;                                                       ///< first levels with a free block
+    size_t sl_bitmap[TLSF_FL_INDEX_COUNT];                                  ///< second levels with a free block
+    tlsf_block_t *free_blocks[TLSF_FL_INDEX_COUNT][TLSF_SL_INDEX_COUNT];    ///< free lists of all size classes
+} tlsf_t;
+
+/* Public functions (prototypes) */
+size_t tlsf_create_static(tlsf_t **tlsf, tlsf_t *storage, void *memory, size_t size);
+void *tlsf_allocate(tlsf_t **tlsf, size_t size);
+size_t tlsf_free(tlsf_t **tlsf, void *block);
+size_t tlsf_get_statistics(tlsf_t **tlsf, tlsf_statistics_t *statistics);
+void *tlsf_allocator_allocate(void *context, size_t size);
+void tlsf_allocator_free(void *context, void *block);
+size_t tlsf_checking(tlsf_t **tlsf);
+#endif /* UTILS_TLSF_H_ */
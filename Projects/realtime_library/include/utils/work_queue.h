@@ -0,0 +1,84 @@
+/**
+**************************************************
+* @file work_queue.h
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using lock free work queues
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'work_queue_create' to create a work queue
+  (#) Call 'work_queue_create_static' to create a work
+      queue in caller supplied storage
+  (#) Call 'work_queue_delete' to delete a work queue
+  (#) Call 'work_queue_post' to store a function and its
+      argument. Any amount of interrupts and tasks may post
+      concurrently without masking interrupts.
+  (#) Call 'work_queue_read' to take the oldest work item.
+      Only a single consumer may read.
+  (#) Every slot carries a sequence number, which tells
+      the producers whether it is free and the consumer
+      whether it is published. The size has to be a power
+      of 2.
+  (#) All functions call 'work_queue_checking' to validate
+      proper work queue structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+
+#ifndef UTILS_WORK_QUEUE_H_
+#define UTILS_WORK_QUEUE_H_
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Preprocessor defines */
+#define WORK_QUEUE_SUCCESS          0
+#define WORK_QUEUE_NO_MEMORY        1
+#define WORK_QUEUE_IS_NULL          2
+#define WORK_QUEUE_INVALID_SIZE     3
+#define WORK_QUEUE_NO_FUNCTION      4
+#define WORK_QUEUE_IS_FULL          5
+#define WORK_QUEUE_IS_EMPTY         6
+
+#define WORK_QUEUE_LENGTH           3
+
+/* Public Preprocessor macros */
+/* Public type definitions */
+
+/// deferred function call
+typedef struct {
+    void (*function)(void *argument);   ///< function executed by the consumer
+    void *argument;                     ///< argument passed to the function
+    size_t timestamp;                   ///< caller supplied time of the post, e.g. to measure the latency
+    volatile size_t sequence;           ///< position the slot is free for or position + 1 once it is published
+} work_item_t;
+
+/// control information for a work queue
+typedef struct {
+    work_item_t *items;         ///< ring of size slots
+    size_t size;                ///< amount of slots, a power of 2
+    volatile size_t head;       ///< next position to post, claimed by the producers
+    size_t tail;                ///< next position to read, owned by the consumer
+    volatile size_t overflows;  ///< posts rejected, because the queue was full
+    bool allocated;             ///< storage is released on delete, false for caller supplied storage
+} work_queue_t;
+
+/* Public functions (prototypes) */
+size_t work_queue_create(work_queue_t **work_queue, size_t size);
+size_t work_queue_create_static(work_queue_t **work_queue, work_queue_t *storage, work_item_t *items, size_t size);
+size_t work_queue_delete(work_queue_t **work_queue);
+size_t work_queue_post(work_queue_t **work_queue, void (*function)(void *argument), void *argument, size_t timestamp);
+size_t work_queue_read(work_queue_t **work_queue, work_item_t *work_item);
+size_t work_queue_checking(work_queue_t **work_queue);
+
+#endif /* UTILS_WORK_QUEUE_H_ */
@@ -0,0 +1,291 @@
+/**
+**************************************************
+* @file event_group.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for event bits shared by several tasks
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'event_group_create' to create an event group
+  (#) Call 'event_group_create_static' to create an event
+      group in caller supplied storage
+  (#) Call 'event_group_delete' to delete an event group
+  (#) Call 'event_group_set' to set event bits
+  (#) Call 'event_group_clear' to clear event bits
+  (#) Call 'event_group_try' to satisfy the wait condition
+      of the running task
+  (#) Call 'event_group_release' to satisfy the wait
+      condition of a waiting task on behalf of a setter
+  (#) Call 'event_group_wait' to block a task until its
+      wait condition is satisfied
+  (#) All functions call 'event_group_checking' to validate
+      proper event group structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "kernel/event_group.h"
+#include "kernel/kernel_config.h"
+#include "utils/pool.h"
+#include "utils/support.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+POOL_DEFINE(g_event_group_pool, event_group_static_t, KERNEL_POOL_EVENT_GROUPS);
+
+/* Static module functions (prototypes) */
+static bool event_group_is_satisfied(size_t events, event_group_wait_t *wait);
+
+/* Public functions */
+/**
+ * @brief Creates an event group without any set event bits.
+ * @param event_group is a pointer of pointer to be initialized as an event group
+ * @param id is the unique id of the event group with which it is accessed
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  EVENT_GROUP_NO_MEMORY: unable to allocate memory for the event group
+ *  EVENT_GROUP_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t event_group_create(event_group_t **event_group, size_t id) {
+    event_group_static_t *storage = POOL_ALLOCATE(g_event_group_pool, event_group_static_t);
+    if (storage == NULL) {
+        return EVENT_GROUP_NO_MEMORY;
+    }
+
+    size_t status = event_group_create_static(event_group, storage, id);
+    if (status != EVENT_GROUP_SUCCESS) {
+        POOL_FREE(g_event_group_pool, storage);
+        (*event_group) = NULL;
+        return status;
+    }
+    (*event_group)->allocated = true;
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Creates an event group in caller supplied storage, which is never released.
+ * @param event_group is a pointer of pointer to be initialized as an event group
+ * @param storage is the memory of the event group and its waiting list, which must outlive it
+ * @param id is the unique id of the event group with which it is accessed
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  EVENT_GROUP_NO_MEMORY: storage is NULL
+ *  EVENT_GROUP_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t event_group_create_static(event_group_t **event_group, event_group_static_t *storage, size_t id) {
+
+    if (storage == NULL) {
+        return EVENT_GROUP_NO_MEMORY;
+    }
+
+    (*event_group) = &storage->event_group;
+    (*event_group)->id = id;
+    (*event_group)->events = 0;
+    (*event_group)->allocated = false;
+
+    // waiting tasks are linked by their embedded element
+    size_t status = linked_list_create_intrusive_static(&(*event_group)->waiting_task_list, &storage->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, EVENT_GROUP_LINKED_LIST_ERROR_REGISTER, EVENT_GROUP_NO_WAITING_LIST);
+    }
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Deletes an event group, the waiting tasks have to be released before.
+ * @param event_group is a pointer of pointer to be deleted
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  EVENT_GROUP_NO_WAITING_LIST: unable to delete waiting list
+ */
+size_t event_group_delete(event_group_t **event_group) {
+
+    size_t status = event_group_checking(event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_delete(&(*event_group)->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, EVENT_GROUP_LINKED_LIST_ERROR_REGISTER, EVENT_GROUP_NO_WAITING_LIST);
+    }
+
+    // the waiting list is stored in the same block
+    if ((*event_group)->allocated) {
+        POOL_FREE(g_event_group_pool, *event_group);
+    }
+    (*event_group) = NULL;
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Sets event bits. The waiting tasks have to be released by event_group_release afterwards.
+ * @param event_group is a pointer of pointer to the event group
+ * @param events are the bits to set
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ */
+size_t event_group_set(event_group_t **event_group, size_t events) {
+
+    size_t status = event_group_checking(event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return status;
+    }
+
+    (*event_group)->events |= events;
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Clears event bits.
+ * @param event_group is a pointer of pointer to the event group
+ * @param events are the bits to clear
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ */
+size_t event_group_clear(event_group_t **event_group, size_t events) {
+
+    size_t status = event_group_checking(event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return status;
+    }
+
+    (*event_group)->events &= ~events;
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Satisfies the wait condition of the running task, if the set event bits allow it.
+ *        The wanted bits are cleared immediately, if requested by the wait condition.
+ * @param event_group is a pointer of pointer to the event group
+ * @param wait is an event_group_wait_t pointer to the wait condition, which receives the set event bits on success
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for these errors:
+ *  EVENT_GROUP_NO_WANTED_EVENTS: the wait condition does not want any bit
+ *  EVENT_GROUP_NOT_SATISFIED: the wait condition is not satisfied yet
+ */
+size_t event_group_try(event_group_t **event_group, event_group_wait_t *wait) {
+
+    size_t status = event_group_checking(event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return status;
+    }
+
+    if (wait->wanted_events == 0) {
+        return EVENT_GROUP_NO_WANTED_EVENTS;
+    }
+
+    if (!event_group_is_satisfied((*event_group)->events, wait)) {
+        return EVENT_GROUP_NOT_SATISFIED;
+    }
+
+    wait->received_events = (*event_group)->events;
+    if (wait->clear_on_exit) {
+        (*event_group)->events &= ~wait->wanted_events;
+    }
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Satisfies the wait condition of a waiting task on behalf of a setter. Every waiter of one set
+ *        sees the same event bits, therefore the bits to clear are collected and cleared after all waiters.
+ * @param event_group is a pointer of pointer to the event group
+ * @param wait is an event_group_wait_t pointer to the wait condition, which receives the set event bits on success
+ * @param clear_events is a size_t pointer, which collects the bits to clear after all waiters were released
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for this error:
+ *  EVENT_GROUP_NOT_SATISFIED: the wait condition is not satisfied yet, the task keeps waiting
+ */
+size_t event_group_release(event_group_t **event_group, event_group_wait_t *wait, size_t *clear_events) {
+
+    size_t status = event_group_checking(event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return status;
+    }
+
+    if (!event_group_is_satisfied((*event_group)->events, wait)) {
+        return EVENT_GROUP_NOT_SATISFIED;
+    }
+
+    wait->received_events = (*event_group)->events;
+    if (wait->clear_on_exit) {
+        (*clear_events) |= wait->wanted_events;
+    }
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Moves the running task into the waiting list of the event group.
+ * @param event_group is a pointer of pointer to the event group
+ * @param running_task_list is a linked_list_t pointer of pointer to the priority group of the running task
+ * @param running_task_element is a linked_list_element_t pointer of pointer to the running task
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  EVENT_GROUP_UNABLE_TO_WAIT: unable to move the task
+ */
+size_t event_group_wait(event_group_t **event_group, linked_list_t **running_task_list, linked_list_element_t **running_task_element) {
+
+    size_t status = event_group_checking(event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_transfer(&(*event_group)->waiting_task_list, running_task_list, running_task_element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, EVENT_GROUP_LINKED_LIST_ERROR_REGISTER, EVENT_GROUP_UNABLE_TO_WAIT);
+    }
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/**
+ * @brief Validates an event group
+ * @param event_group is a pointer of pointer to the event group
+ * @return EVENT_GROUP_SUCCESS on success or unequal EVENT_GROUP_SUCCESS for an error
+ * @info On error check for these errors:
+ *  EVENT_GROUP_IS_NULL: event group is not initialized
+ *  EVENT_GROUP_NO_WAITING_LIST: waiting list is not initialized
+ */
+size_t event_group_checking(event_group_t **event_group) {
+
+    if (event_group == NULL || (*event_group) == NULL) {
+        return EVENT_GROUP_IS_NULL;
+    }
+
+    if ((*event_group)->waiting_task_list == NULL) {
+        return EVENT_GROUP_NO_WAITING_LIST;
+    }
+
+    return EVENT_GROUP_SUCCESS;
+}
+
+/* Static module functions (implementation) */
+/**
+ * @brief Checks a wait condition against event bits.
+ * @param events are the set event bits
+ * @param wait is an event_group_wait_t pointer to the wait condition
+ * @return true, if all wanted bits or any of them are set as requested
+ */
+static bool event_group_is_satisfied(size_t events, event_group_wait_t *wait) {
+    if (wait->wait_all) {
+        return (events & wait->wanted_events) == wait->wanted_events;
+    }
+
+    return (events & wait->wanted_events) != 0;
+}
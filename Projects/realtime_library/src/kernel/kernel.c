@@ -14,45 +14,202 @@
   (#) Call 'kernel_init' to initialize the kernel
   (#) Call 'kernel_deinit' to deinitialize the kernel
   (#) Call 'kernel_add_task' to add a task to be executed
+  (#) Call 'kernel_add_task_with_stack' to add a task with
+      an individual stack size or a provided stack buffer
+  (#) Call 'kernel_task_create' to create a task, which
+      also works while the kernel is running
+  (#) Call 'kernel_task_delete' to delete a task, its stack
+      is freed by the idle loop
   (#) Call 'kernel_start' to start the kernel
   (#) Call 'kernel_delay' to delay the running task
 
   (#) Call 'kernel_message_queue_create' to create
       a message queue
+  (#) Call 'kernel_message_queue_create_static' to create
+      a message queue in caller supplied storage
+  (#) Call 'kernel_message_queue_create_loan' to create
+      a message queue, which loans blocks instead of copying
+  (#) Call 'kernel_message_queue_create_loan_static' to create
+      a loaning message queue in caller supplied storage
   (#) Call 'kernel_message_queue_delete' to delete
       a message queue
   (#) Call 'kernel_message_queue_send' to send a message
       to a task
+  (#) Call 'kernel_message_queue_send_from_isr' to send a
+      message from an interrupt
   (#) Call 'kernel_message_queue_send_blocking' to send a
       blocking message to a task
+  (#) Call 'kernel_message_queue_send_timeout' to send a
+      message, which waits for a full queue up to a timeout
   (#) Call 'kernel_message_queue_receive' to receive a message
+  (#) Call 'kernel_message_queue_receive_timeout' to receive a
+      message, which waits up to a timeout
+  (#) Call 'kernel_message_queue_alloc' to loan a block, which
+      is filled in place and passed to the send functions
+  (#) Call 'kernel_message_queue_release' to return a block
+      after it was received
+
+  (#) Call 'kernel_topic_create' to create a topic, which
+      shares every published sample with all subscribers
+  (#) Call 'kernel_topic_create_static' to create a topic
+      in caller supplied storage
+  (#) Call 'kernel_topic_delete' to delete a topic
+  (#) Call 'kernel_topic_subscribe' to add a subscriber with
+      its own read position
+  (#) Call 'kernel_topic_publish' to write a sample once and
+      wake all waiting subscribers
+  (#) Call 'kernel_topic_publish_from_isr' to publish a
+      sample from an interrupt
+  (#) Call 'kernel_topic_receive' to read the next sample of
+      a subscriber or to wait for it
+  (#) Call 'kernel_topic_get_overruns' to get the samples a
+      slow subscriber missed
 
   (#) Call 'kernel_semaphore_create' to create a semaphore
   (#) Call 'kernel_semaphore_delete' to delete a semaphore
   (#) Call 'kernel_semaphore_acquire' to acquire semaphore
+  (#) Call 'kernel_semaphore_acquire_timeout' to acquire a
+      semaphore, which waits up to a timeout
   (#) Call 'kernel_semaphore_release' to release an
       acquired semaphore
+  (#) Call 'kernel_semaphore_release_from_isr' to release a
+      semaphore from an interrupt
   (#) Call 'kernel_semaphore_is_available' to check if an
       existing semaphore is available
 
   (#) Call 'kernel_mutex_create' to create a mutex
   (#) Call 'kernel_mutex_delete' to delete a mutex
   (#) Call 'kernel_mutex_acquire' to acquire a mutex
+  (#) Call 'kernel_mutex_acquire_timeout' to acquire a mutex,
+      which waits up to a timeout
   (#) Call 'kernel_mutex_release' to release an
       acquired mutex
 
+  (#) Call 'kernel_queue_set_create' to create a queue set,
+      which lets a task wait on several objects at once
+  (#) Call 'kernel_queue_set_create_static' to create a queue
+      set in caller supplied storage
+  (#) Call 'kernel_queue_set_delete' to delete a queue set
+  (#) Call 'kernel_queue_set_add_message_queue' to add a
+      message queue to a queue set once
+  (#) Call 'kernel_queue_set_add_semaphore' to add a semaphore
+      to a queue set once
+  (#) Call 'kernel_queue_set_select' to wait for the next ready
+      member, whose message or token is taken afterwards by a
+      receive or acquire with a timeout of 0
+
+  (#) Call 'kernel_event_group_create' to create an event group,
+      whose event bits are shared by several tasks
+  (#) Call 'kernel_event_group_delete' to delete an event group
+  (#) Call 'kernel_event_group_set' to set event bits and to
+      wake every satisfied waiter at once
+  (#) Call 'kernel_event_group_set_from_isr' to set event bits
+      from an interrupt
+  (#) Call 'kernel_event_group_clear' to clear event bits
+  (#) Call 'kernel_event_group_get' to get the set event bits
+  (#) Call 'kernel_event_group_wait' to wait for any or all
+      wanted event bits, which waits up to a timeout
+
+  (#) Call 'kernel_stream_buffer_create' to create a stream
+      buffer for bytes or a message buffer for messages of
+      variable size
+  (#) Call 'kernel_stream_buffer_create_static' to create a
+      stream buffer in caller supplied storage
+  (#) Call 'kernel_stream_buffer_delete' to delete a stream
+      buffer
+  (#) Call 'kernel_stream_buffer_write' to write bytes or a
+      message, which waits up to a timeout for free space
+  (#) Call 'kernel_stream_buffer_write_from_isr' to write
+      bytes or a message from an interrupt
+  (#) Call 'kernel_stream_buffer_read' to read bytes or a
+      message, which waits up to a timeout for the trigger
+      level
+
+  (#) Call 'kernel_mempool_create' to create a memory pool of
+      fixed-size blocks over caller supplied storage
+  (#) Call 'kernel_mempool_delete' to delete a memory pool
+  (#) Call 'kernel_mempool_alloc' to take a block in constant
+      time, which waits up to a timeout for a returned block
+  (#) Call 'kernel_mempool_alloc_from_isr' to take a block
+      from an interrupt without waiting
+  (#) Call 'kernel_mempool_free' to return a block and to wake
+      the task, which waits longest for it
+  (#) Call 'kernel_mempool_free_from_isr' to return a block
+      from an interrupt
+  (#) Call 'kernel_mempool_get_statistics' to get the high
+      water mark and the failed allocations of a memory pool
+
+  (#) Call 'kernel_heap_create' before kernel_init to take
+      every dynamically created object from a TLSF heap with
+      constant time allocation instead of malloc
+  (#) Call 'kernel_heap_delete' to restore malloc and free
+      after every block was returned
+  (#) Call 'kernel_heap_get_statistics' to get the free
+      space and the fragmentation of the heap
+  (#) A task blocked on a mutex passes its priority on to
+      the owner and transitively to the owners of mutexes
+      the owner waits for. The owner returns to its base
+      priority, when it releases the mutex.
+  (#) Call 'kernel_mutex_create_ceiling' to create a mutex for
+      short critical sections. Its owner runs with the ceiling
+      priority at once and acquiring never blocks.
+
   (#) Call 'kernel_event_receive_timeout' to receive events
       for a set timeout period
   (#) Call 'kernel_event_receive_blocking' to receive events
       until they arrive
   (#) Call 'kernel_event_send' to send an event to a task
+  (#) Call 'kernel_event_send_from_isr' to send an event
+      from an interrupt
+
+  (#) Call 'kernel_task_get_handle' to get the handle of a
+      task once, notifications address it without a lookup
+  (#) Call 'kernel_notify' to update the notification value
+      of a task by an action and to wake it up
+  (#) Call 'kernel_notify_from_isr' to notify a task from
+      an interrupt
+  (#) Call 'kernel_notify_give' to increment the notification
+      value of a task like releasing a semaphore
+  (#) Call 'kernel_notify_take' to wait for a notification
+      value greater 0 like acquiring a semaphore
+  (#) Call 'kernel_notify_wait' to wait for any notification
+
+  (#) Call 'kernel_timer_create' to create a one shot or
+      auto reload software timer, the first timer adds
+      the timer daemon task
+  (#) Call 'kernel_timer_start' to start a software timer
+  (#) Call 'kernel_timer_stop' to stop a software timer
+  (#) Call 'kernel_timer_reset' to restart the period of
+      a software timer
+
+  (#) Call 'kernel_work_queue_create' to add the work daemon
+      task, which executes work deferred by interrupts
+  (#) Call 'kernel_work_post_from_isr' to defer a function
+      call from an interrupt without a critical section
+  (#) Call 'kernel_work_get_statistics' to get the overflows
+      and latencies of the deferred work
+
+  (#) Call 'kernel_task_get_statistics' to get the cycles a
+      task ran and its share of the CPU
+  (#) Call 'kernel_cpu_get_statistics' to get the cycles of
+      the tasks, interrupts and idle and the CPU load over a
+      sliding window
+  (#) Call 'kernel_cpu_isr_enter' and 'kernel_cpu_isr_exit' at
+      the start and the end of an interrupt, whose cycles are
+      accounted to interrupts instead of the interrupted task
 
   (#) Call 'kernel_exit_to_scheduler' to force another task
       to run
-  (#) Call 'kernel_toggle_critical_section' to toggle the
-      current critical section status
+  (#) Call 'kernel_enter_critical' to enter a critical section,
+      which masks the interrupts up to KERNEL_MAX_SYSCALL_PRIORITY
+  (#) Call 'kernel_exit_critical' to exit a critical section,
+      only the outermost exit unmasks the interrupts
+  (#) Call 'kernel_yield_from_isr' at the end of an interrupt,
+      which woke a higher priority task by a '_from_isr' call
   (#) Call 'kernel_reinsert_task' to move a task from blocked
       to running task list
+  (#) Call 'kernel_change_task_priority' to move a task to the
+      priority group of its new effective priority
 
 ==================================================
 @endverbatim
@@ -61,11 +218,41 @@
 /* Includes */
 #include "kernel/kernel.h"
 #include "utils/support.h"
+#include "utils/atomic.h"
 #include <stdbool.h>
 
 /* Preprocessor defines */
+#define KERNEL_TIMER_COMMAND_START          0
+#define KERNEL_TIMER_COMMAND_STOP           1
+#define KERNEL_TIMER_COMMAND_RESET          2
+
+#define KERNEL_TIMER_EVENT_COMMAND          (1 << 0)
+
+#define KERNEL_WORK_EVENT_POSTED            (1 << 0)
+
 /* Preprocessor macros */
+// a debug build and the host catch '_from_isr' calls of interrupts, which are never masked by the kernel
+#if defined(DEBUG) || !defined(__arm__)
+#define KERNEL_VALIDATE_INTERRUPT_PRIORITY()    kernel_validate_interrupt_priority()
+#else
+#define KERNEL_VALIDATE_INTERRUPT_PRIORITY()
+#endif
+
 /* Module intern type definitions */
+
+/// command sent to the timer daemon
+typedef struct {
+    size_t command;     ///< command to be executed by the timer daemon
+    size_t id;          ///< addressed timer
+    size_t tick;        ///< tick the command was issued, which starts the timers period
+} kernel_timer_command_t;
+
+/// cycles of the system at the start of a cpu load sample period
+typedef struct {
+    uint64_t total_cycles;  ///< cycles since kernel_init
+    uint64_t idle_cycles;   ///< idle cycles since kernel_init
+} kernel_cpu_sample_t;
+
 /* Static module variables */
 
 // tasks
@@ -74,31 +261,100 @@ extern task_t                   *g_running_task_next;
 extern dictionary_t             *g_prioritized_tasks;
 dictionary_t                    *g_list_of_tasks                    = NULL;
 linked_list_t                   *g_delayed_tasks                    = NULL;
+timer_wheel_t                   *g_timer_wheel                      = NULL;
 extern linked_list_element_t    *g_linked_list_task_iterator;
 extern linked_list_element_t    *g_linked_list_task_iterator_next;
 extern linked_list_t            *g_priority_group_current;
-size_t                          g_task_lower_priority               = 0;
-size_t                          g_task_lowest_priority              = 0;
 extern uint8_t                  g_dictionary_priority;
 extern uint8_t                  g_dictionary_priority_next;
 extern linked_list_t            *g_priority_group_next;
 size_t                          g_available_tasks                   = 0;
+bitmap_t                        *g_ready_priorities                 = NULL;
 
 // message queues
-dictionary_t                    *g_message_queue_list               = NULL;
-size_t                          g_message_queue_ids                 = 0;
+handle_table_t                  *g_message_queue_list               = NULL;
+
+// topics
+handle_table_t                  *g_topic_list                       = NULL;
+
+// queue sets
+handle_table_t                  *g_queue_set_list                   = NULL;
+
+// event groups
+handle_table_t                  *g_event_group_list                 = NULL;
+
+// stream buffers
+handle_table_t                  *g_stream_buffer_list               = NULL;
+
+// memory pools
+handle_table_t                  *g_mempool_list                     = NULL;
+
+// heap of all dynamically created objects, malloc and free without it
+tlsf_t                          *g_heap                             = NULL;
+static tlsf_t                   g_heap_storage;
 
 // semaphores
-dictionary_t                    *g_semaphore_list                   = NULL;
-size_t                          g_semaphore_ids                     = 0;
+handle_table_t                  *g_semaphore_list                   = NULL;
 
 // mutexes
-dictionary_t                    *g_mutex_list                       = NULL;
-size_t                          g_mutex_ids                         = 0;
+handle_table_t                  *g_mutex_list                       = NULL;
+
+// software timers
+handle_table_t                  *g_timer_list                       = NULL;
+software_timer_list_t           *g_active_timers                    = NULL;
+message_queue_identifier_t      *g_timer_command_queue              = NULL;
+static message_queue_static_t   g_timer_command_queue_storage;
+static void                     *g_timer_command_queue_data[KERNEL_TIMER_QUEUE_SIZE];
+static kernel_timer_command_t   g_timer_command_queue_buffer[KERNEL_TIMER_QUEUE_SIZE];
+
+// deferred work
+work_queue_t                    *g_work_queue                       = NULL;
+volatile size_t                 g_work_signaled                     = 0;
+kernel_work_statistics_t        g_work_statistics                   = { 0 };
+static work_queue_t             g_work_queue_storage;
+static work_item_t              g_work_queue_items[KERNEL_WORK_QUEUE_SIZE];
+
+// cpu accounting, the cycles since the last switch are charged to the account of the running task, idle or interrupts
+static uint64_t                 g_cpu_total_cycles                  = 0;
+static uint64_t                 g_cpu_idle_cycles                   = 0;
+static uint64_t                 g_cpu_isr_cycles                    = 0;
+static uint64_t                 *g_cpu_account                      = &g_cpu_idle_cycles;
+static uint64_t                 *g_cpu_account_interrupted          = &g_cpu_idle_cycles;
+static size_t                   g_cpu_timestamp                     = 0;
+static size_t                   g_cpu_isr_nesting                   = 0;
+static kernel_cpu_sample_t      g_cpu_samples[KERNEL_CPU_LOAD_SAMPLES];
+static size_t                   g_cpu_sample_index                  = 0;
+static size_t                   g_cpu_sample_ticks                  = 0;
+
+// storage of the kernel structures, their size is known at compile time
+static dictionary_t             g_prioritized_tasks_storage;
+static void                     *g_prioritized_tasks_data[KERNEL_MAX_TASK];
+static bitmap_t                 g_ready_priorities_storage;
+static uint32_t                 g_ready_priorities_words[BITMAP_WORDS(KERNEL_MAX_TASK)];
+static dictionary_t             g_list_of_tasks_storage;
+static void                     *g_list_of_tasks_data[KERNEL_MAX_TASK];
+static handle_table_t           g_message_queue_list_storage;
+static handle_table_slot_t      g_message_queue_list_slots[KERNEL_MAX_MESSAGE_QUEUE];
+static handle_table_t           g_topic_list_storage;
+static handle_table_slot_t      g_topic_list_slots[KERNEL_MAX_TOPIC];
+static handle_table_t           g_queue_set_list_storage;
+static handle_table_slot_t      g_queue_set_list_slots[KERNEL_MAX_QUEUE_SET];
+static handle_table_t           g_event_group_list_storage;
+static handle_table_slot_t      g_event_group_list_slots[KERNEL_MAX_EVENT_GROUP];
+static handle_table_t           g_stream_buffer_list_storage;
+static handle_table_slot_t      g_stream_buffer_list_slots[KERNEL_MAX_STREAM_BUFFER];
+static handle_table_t           g_mempool_list_storage;
+static handle_table_slot_t      g_mempool_list_slots[KERNEL_MAX_MEMPOOL];
+static handle_table_t           g_semaphore_list_storage;
+static handle_table_slot_t      g_semaphore_list_slots[KERNEL_MAX_SEMAPHORE];
+static handle_table_t           g_mutex_list_storage;
+static handle_table_slot_t      g_mutex_list_slots[KERNEL_MAX_MUTEX];
+static handle_table_t           g_timer_list_storage;
+static handle_table_slot_t      g_timer_list_slots[KERNEL_MAX_TIMER];
 
 // kernel
 extern Kernel_Status_e          g_kernel_status;
-bool                            g_kernel_critical_section_active    = false;
+size_t                          g_kernel_critical_nesting           = 0;
 linked_list_t                   *g_blocked_tasks                    = NULL;
 linked_list_t                   *g_terminated_tasks_list            = NULL;
 
@@ -109,11 +365,46 @@ extern size_t kernel_swap_task(linked_list_t** priority_group, linked_list_eleme
 extern size_t kernel_set_status(Kernel_Status_e status);
 extern size_t kernel_set_stack_pointer(void);
 
-void kernel_toggle_critical_section(void);
 size_t kernel_reinsert_task(linked_list_t **source, linked_list_element_t **element, task_t **task);
+size_t kernel_update_ready_priority(size_t priority);
+void kernel_check_higher_priority_task_woken(task_t *next_task, bool *higher_priority_task_woken);
+size_t kernel_insert_delayed_task(size_t ticks, size_t error_code);
+size_t kernel_get_remaining_ticks(size_t start, size_t timeout_milliseconds);
+size_t kernel_start_timeout(linked_list_t **waiting_list, size_t ticks, size_t error_code);
+size_t kernel_notify_block(void);
+size_t kernel_change_task_priority(task_t **task, uint8_t priority);
+size_t kernel_inherit_priority(mutex_t **mutex, uint8_t priority);
+size_t kernel_restore_priority(task_t **task);
+size_t kernel_withdraw_priority(mutex_t **mutex);
+size_t kernel_mutex_acquire_ceiling(mutex_t **mutex);
+size_t kernel_mutex_release_ceiling(mutex_t **mutex);
+size_t kernel_message_queue_register(message_queue_identifier_t **message_queue_identifier, message_queue_t **message_queue);
+size_t kernel_topic_register(size_t *id, topic_t **topic);
+size_t kernel_topic_wake_all(topic_t **topic);
+size_t kernel_queue_set_register(size_t *id, queue_set_t **queue_set);
+size_t kernel_queue_set_post(queue_set_t **queue_set, queue_set_member_type_e type, size_t id);
+size_t kernel_stream_buffer_register(size_t *id, stream_buffer_t **stream_buffer);
+size_t kernel_stream_buffer_wake(linked_list_t **waiting_task_list);
+size_t kernel_mempool_wake(mempool_t **mempool);
+size_t kernel_insert_task(task_t **task);
+size_t kernel_unlink_terminated_task(task_t **task);
+size_t kernel_reap_task(task_t **task);
+size_t kernel_reap_terminated_tasks(void);
+void kernel_cpu_reset(void);
+void kernel_cpu_charge(uint64_t *account);
+void kernel_cpu_switch(task_t *task);
+void kernel_cpu_enter_idle(void);
+void kernel_cpu_tick(void);
+void *kernel_heap_allocate(void *context, size_t size);
+void kernel_heap_free(void *context, void *block);
+size_t kernel_timer_send_command(size_t id, size_t command, size_t error_code);
+size_t kernel_timer_receive_commands(void);
+size_t kernel_timer_daemon(void);
+size_t kernel_work_daemon(void);
 
 extern void kernel_set_system_functions(void);
 extern void kernel_task_terminate(void);
+extern void kernel_reset_task_context(uint8_t task_id);
 
 
 /* Public functions */
@@ -127,15 +418,26 @@ extern void kernel_task_terminate(void);
  *  KERNEL_NO_LIST_OF_TASKS: unable to initialize tasks
  *  KERNEL_NO_DELAYED_TASKS: unable to initialize delayed tasks
  *  KERNEL_NO_MESSAGE_QUEUE: unable to initialize message queues
+ *  KERNEL_NO_TOPICS: unable to initialize topics
+ *  KERNEL_NO_QUEUE_SETS: unable to initialize queue sets
+ *  KERNEL_NO_EVENT_GROUPS: unable to initialize event groups
+ *  KERNEL_NO_STREAM_BUFFERS: unable to initialize stream buffers
+ *  KERNEL_NO_MEMPOOLS: unable to initialize memory pools
  *  KERNEL_NO_SEMAPHORES: unable to initialize semaphores
  *  KERNEL_NO_MUTEXES: unable to initialize mutexes
  *  KERNEL_NO_BLOCKED_TASKS: unable to initialize blocked tasks
+ *  KERNEL_NO_READY_PRIORITIES: unable to initialize ready priorities
+ *  KERNEL_NO_TIMER_WHEEL: unable to initialize the timing wheel
+ *  KERNEL_NO_TIMERS: unable to initialize software timers
  */
 size_t kernel_init(void) {
     // set relevant system functions, depending on the used platform
     kernel_set_system_functions();
+    // the cycle counter runs from here on, every cycle is accounted from now
+    kernel_cpu_reset();
+    // structures of a fixed size use kernel owned storage instead of the heap
     // create prioritized task list with groups
-    size_t status = dictionary_create(&g_prioritized_tasks, KERNEL_MAX_TASK);
+    size_t status = dictionary_create_static(&g_prioritized_tasks, &g_prioritized_tasks_storage, g_prioritized_tasks_data, KERNEL_MAX_TASK);
     if (status!=DICTIONARY_SUCCESS) {
         return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_NO_PRIORITIZED_TASKS);
     }
@@ -144,7 +446,7 @@ size_t kernel_init(void) {
     linked_list_t *priority_group = NULL;
     for (size_t priority = 0; priority<KERNEL_MAX_TASK; priority++) {
 
-        status = linked_list_create(&priority_group);
+        status = linked_list_create_intrusive(&priority_group);
         if (status!=LINKED_LIST_SUCCESS) {
             return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_NO_PRIORITIZED_TASKS);
         }
@@ -156,43 +458,96 @@ size_t kernel_init(void) {
 
     }
 
+    // mark every non empty priority group to find the next runnable group in constant time
+    status = bitmap_create_static(&g_ready_priorities, &g_ready_priorities_storage, g_ready_priorities_words, KERNEL_MAX_TASK);
+    if (status!=BITMAP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_NO_READY_PRIORITIES);
+    }
+
     // create dictionary which lists all tasks by there linked list element
-    status = dictionary_create(&g_list_of_tasks, KERNEL_MAX_TASK);
+    status = dictionary_create_static(&g_list_of_tasks, &g_list_of_tasks_storage, g_list_of_tasks_data, KERNEL_MAX_TASK);
     if (status!=DICTIONARY_SUCCESS) {
         return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_NO_LIST_OF_TASKS);
     }
 
 
     // create linked list which lists all delayed tasks
-    status = linked_list_create(&g_delayed_tasks);
+    status = linked_list_create_intrusive(&g_delayed_tasks);
     if (status!=LINKED_LIST_SUCCESS) {
         return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_NO_DELAYED_TASKS);
     }
 
+    // timing wheel which releases the delayed tasks
+    status = timer_wheel_create(&g_timer_wheel);
+    if (status!=TIMER_WHEEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TIMER_WHEEL_ERROR_REGISTER, KERNEL_NO_TIMER_WHEEL);
+    }
 
-    // using a dictionary for a fast access of message queues
-    status = dictionary_create(&g_message_queue_list, KERNEL_MAX_MESSAGE_QUEUE);
-    if (status!=DICTIONARY_SUCCESS) {
-        return status;
+
+    // using a handle table for a fast access of message queues, deleted ones free their slot
+    status = handle_table_create_static(&g_message_queue_list, &g_message_queue_list_storage, g_message_queue_list_slots, KERNEL_MAX_MESSAGE_QUEUE);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_MESSAGE_QUEUE);
     }
 
-    // using a dictionary for a fast access of semaphores
-    status = dictionary_create(&g_semaphore_list, KERNEL_MAX_SEMAPHORE);
-    if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_NO_SEMAPHORES);
+    // using a handle table for a fast access of topics, deleted ones free their slot
+    status = handle_table_create_static(&g_topic_list, &g_topic_list_storage, g_topic_list_slots, KERNEL_MAX_TOPIC);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_TOPICS);
     }
 
-    status = dictionary_create(&g_mutex_list, KERNEL_MAX_MUTEX);
-    if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_NO_MUTEXES);
+    // using a handle table for a fast access of queue sets, deleted ones free their slot
+    status = handle_table_create_static(&g_queue_set_list, &g_queue_set_list_storage, g_queue_set_list_slots, KERNEL_MAX_QUEUE_SET);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_QUEUE_SETS);
+    }
+
+    // using a handle table for a fast access of event groups, deleted ones free their slot
+    status = handle_table_create_static(&g_event_group_list, &g_event_group_list_storage, g_event_group_list_slots, KERNEL_MAX_EVENT_GROUP);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_EVENT_GROUPS);
+    }
+
+    // using a handle table for a fast access of stream buffers, deleted ones free their slot
+    status = handle_table_create_static(&g_stream_buffer_list, &g_stream_buffer_list_storage, g_stream_buffer_list_slots, KERNEL_MAX_STREAM_BUFFER);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_STREAM_BUFFERS);
+    }
+
+    // using a handle table for a fast access of memory pools, deleted ones free their slot
+    status = handle_table_create_static(&g_mempool_list, &g_mempool_list_storage, g_mempool_list_slots, KERNEL_MAX_MEMPOOL);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_MEMPOOLS);
+    }
+
+    // using a handle table for a fast access of semaphores, deleted ones free their slot
+    status = handle_table_create_static(&g_semaphore_list, &g_semaphore_list_storage, g_semaphore_list_slots, KERNEL_MAX_SEMAPHORE);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_SEMAPHORES);
+    }
+
+    status = handle_table_create_static(&g_mutex_list, &g_mutex_list_storage, g_mutex_list_slots, KERNEL_MAX_MUTEX);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_MUTEXES);
+    }
+
+    // software timers are accessed by id, the active ones are sorted by deadline
+    status = handle_table_create_static(&g_timer_list, &g_timer_list_storage, g_timer_list_slots, KERNEL_MAX_TIMER);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_NO_TIMERS);
+    }
+
+    status = software_timer_list_create(&g_active_timers);
+    if (status!=SOFTWARE_TIMER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_SOFTWARE_TIMER_ERROR_REGISTER, KERNEL_NO_TIMERS);
     }
 
-    status = linked_list_create(&g_blocked_tasks);
+    status = linked_list_create_intrusive(&g_blocked_tasks);
     if (status!=LINKED_LIST_SUCCESS) {
         return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_NO_BLOCKED_TASKS);
     }
 
-    status = linked_list_create(&g_terminated_tasks_list);
+    status = linked_list_create_intrusive(&g_terminated_tasks_list);
     if (status!=LINKED_LIST_SUCCESS) {
         return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_NO_TERMINATED_TASKS_LIST);
     }
@@ -219,63 +574,183 @@ size_t kernel_deinit(void) {
     if (status!=DICTIONARY_SUCCESS) {
         return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_PRIORITIZED_TASKS);
     }
+
+    status = bitmap_delete(&g_ready_priorities);
+    if (status!=BITMAP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_READY_PRIORITIES);
+    }
+
     // delete delayed task linked list
     status = linked_list_delete(&g_delayed_tasks);
 
+    status = timer_wheel_delete(&g_timer_wheel);
+    if (status!=TIMER_WHEEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TIMER_WHEEL_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TIMER_WHEEL);
+    }
+
 
     // delete message queues
     message_queue_t *message_queue = NULL;
-    for (size_t message_queue_id = 0; message_queue_id < g_message_queue_ids; message_queue_id++) {
+    for (size_t index = 0; index < g_message_queue_list->size; index++) {
 
-        status = dictionary_get(&g_message_queue_list, message_queue_id, (void **) &message_queue);
-        if (status==DICTIONARY_SUCCESS) {
+        message_queue = g_message_queue_list->slots[index].value;
+        if (message_queue != NULL) {
             message_queue_delete(&message_queue);
         }
     }
 
-    // reset message queue ids
-    g_message_queue_ids = 0;
 
     // delete list of message queue
-    status = dictionary_delete(&g_message_queue_list);
-    if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE_LIST);
+    status = handle_table_delete(&g_message_queue_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE_LIST);
+    }
+
+    // delete topics
+    topic_t *topic = NULL;
+    for (size_t index = 0; index < g_topic_list->size; index++) {
+
+        topic = g_topic_list->slots[index].value;
+        if (topic != NULL) {
+            topic_delete(&topic);
+        }
+    }
+
+
+    // delete list of topics
+    status = handle_table_delete(&g_topic_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TOPIC_LIST);
+    }
+
+    // delete queue sets
+    queue_set_t *queue_set = NULL;
+    for (size_t index = 0; index < g_queue_set_list->size; index++) {
+
+        queue_set = g_queue_set_list->slots[index].value;
+        if (queue_set != NULL) {
+            queue_set_delete(&queue_set);
+        }
+    }
+
+
+    // delete list of queue sets
+    status = handle_table_delete(&g_queue_set_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_QUEUE_SET_LIST);
+    }
+
+    // delete event groups
+    event_group_t *event_group = NULL;
+    for (size_t index = 0; index < g_event_group_list->size; index++) {
+
+        event_group = g_event_group_list->slots[index].value;
+        if (event_group != NULL) {
+            event_group_delete(&event_group);
+        }
+    }
+
+
+    // delete list of event groups
+    status = handle_table_delete(&g_event_group_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_EVENT_GROUP_LIST);
+    }
+
+    // delete stream buffers
+    stream_buffer_t *stream_buffer = NULL;
+    for (size_t index = 0; index < g_stream_buffer_list->size; index++) {
+
+        stream_buffer = g_stream_buffer_list->slots[index].value;
+        if (stream_buffer != NULL) {
+            stream_buffer_delete(&stream_buffer);
+        }
+    }
+
+
+    // delete list of stream buffers
+    status = handle_table_delete(&g_stream_buffer_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER_LIST);
+    }
+
+    // delete memory pools
+    mempool_t *mempool = NULL;
+    for (size_t index = 0; index < g_mempool_list->size; index++) {
+
+        mempool = g_mempool_list->slots[index].value;
+        if (mempool != NULL) {
+            mempool_delete(&mempool);
+        }
+    }
+
+
+    // delete list of memory pools
+    status = handle_table_delete(&g_mempool_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MEMPOOL_LIST);
     }
 
     // delete semaphores
     semaphore_t *semaphore = NULL;
-    for (size_t semaphore_id = 0; semaphore_id < g_semaphore_ids; semaphore_id++) {
+    for (size_t index = 0; index < g_semaphore_list->size; index++) {
 
-        status = dictionary_get(&g_semaphore_list, semaphore_id, (void **) &semaphore);
-        if (status==DICTIONARY_SUCCESS) {
+        semaphore = g_semaphore_list->slots[index].value;
+        if (semaphore != NULL) {
             semaphore_delete(&semaphore);
         }
     }
 
     // delete list of semaphores
-    status = dictionary_delete(&g_semaphore_list);
-    if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE_LIST);
+    status = handle_table_delete(&g_semaphore_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE_LIST);
     }
 
 
     // delete mutexes
     mutex_t *mutex = NULL;
-    for (size_t mutex_id = 0; mutex_id < g_mutex_ids; mutex_id++) {
+    for (size_t index = 0; index < g_mutex_list->size; index++) {
 
-        status = dictionary_get(&g_mutex_list, mutex_id, (void **) &mutex);
-        if (status==DICTIONARY_SUCCESS) {
+        mutex = g_mutex_list->slots[index].value;
+        if (mutex != NULL) {
             mutex_delete(&mutex);
         }
     }
 
-    // reset mutex ids
-    g_mutex_ids = 0;
 
     // delete list of semaphores
-    status = dictionary_delete(&g_mutex_list);
-    if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX_LIST);
+    status = handle_table_delete(&g_mutex_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX_LIST);
+    }
+
+
+    // delete software timers, the command queue was deleted with the message queues
+    status = software_timer_list_delete(&g_active_timers);
+    if (status!=SOFTWARE_TIMER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_SOFTWARE_TIMER_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TIMER_LIST);
+    }
+
+    software_timer_t *timer = NULL;
+    for (size_t index = 0; index < g_timer_list->size; index++) {
+
+        timer = g_timer_list->slots[index].value;
+        if (timer != NULL) {
+            software_timer_delete(&timer);
+        }
+    }
+
+    g_timer_command_queue = NULL;
+
+    // the work queue lives in static storage, the work daemon is deleted with all tasks
+    g_work_queue = NULL;
+    g_work_signaled = 0;
+    g_work_statistics = (kernel_work_statistics_t) { 0 };
+
+    status = handle_table_delete(&g_timer_list);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TIMER_LIST);
     }
 
 
@@ -306,6 +781,8 @@ size_t kernel_deinit(void) {
         return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_LIST_OF_TASKS);
     }
 
+    // the account must not point into a deleted task
+    kernel_cpu_reset();
 
     return KERNEL_SUCCESS;
 }
@@ -320,136 +797,285 @@ size_t kernel_deinit(void) {
  *  KERNEL_UNABLE_TO_ADD_TASK: unable to add task due to different subcomponent errors
  */
 size_t kernel_add_task(size_t (*task_main)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout) {
+    return kernel_add_task_with_stack(task_main, u8_task_id, task_name, u8_task_priority, time_quantum, wanted_events, notification_conditions, timeout, TCB_TASK_STACK_SIZE, NULL);
+}
+
+/**
+ * @brief Inserts a new task with an individual stack to be executed on kernel start.
+ * @param task_main is a function pointer to the task function
+ * @param u8_task_id is an uint8_t to set the task id
+ * @param u8_task_priority is an uint8_t to indicate in which priority goup it shall be inserted in the prioritized task list
+ * @param stack_size is a size_t, which defines the stack size in 32 bit words
+ * @param stack is an optional 8 byte aligned buffer of stack_size words, if NULL the kernel allocates the stack
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_TASK: unable to add task due to different subcomponent errors
+ */
+size_t kernel_add_task_with_stack(size_t (*task_main)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack) {
 
     // create a mandatory task structure as base for the tcb and relevant kernel attributes
     task_t *task = NULL;
-    size_t status = task_create(&task, task_main, kernel_task_terminate, u8_task_id, task_name, u8_task_priority, time_quantum, wanted_events, notification_conditions, timeout);
+    size_t status = task_create(&task, task_main, kernel_task_terminate, u8_task_id, task_name, u8_task_priority, time_quantum, wanted_events, notification_conditions, timeout, stack_size, stack);
     if (status!=TASK_SUCCESS) {
         return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
     }
 
-    task_t *already_inserted_task = NULL;
-    status = dictionary_get(&g_list_of_tasks, u8_task_id, (void **) &already_inserted_task);
-    if (status == DICTIONARY_VALUE_IS_NULL) {
-        status = dictionary_add(&g_list_of_tasks, u8_task_id, (void **) &task);
-        if (status != DICTIONARY_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
-        }
+    return kernel_insert_task(&task);
+}
+
+/**
+ * @brief Creates a task, which is inserted in its priority group at once, also while the kernel is running.
+ *        A task with a higher priority than the running task preempts it before the call returns.
+ *        Before kernel_start it adds the task like kernel_add_task_with_stack.
+ * @param task_main is a function pointer to the task function, the task terminates on return
+ * @param u8_task_id is an uint8_t to set the task id, which must not be used by another task.
+ *        The id of a terminated task is free again, once the task was reaped.
+ * @param u8_task_priority is an uint8_t below KERNEL_MAX_TASK, a lower number specifies a higher priority
+ * @param stack_size is a size_t, which defines the stack size in 32 bit words
+ * @param stack is an optional 8 byte aligned buffer of stack_size words, if NULL the kernel allocates the stack
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_TASK: unable to add task due to a used id or different subcomponent errors
+ */
+size_t kernel_task_create(size_t (*task_main)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack) {
+    if (g_running_task_current == NULL) {
+        return kernel_add_task_with_stack(task_main, u8_task_id, task_name, u8_task_priority, time_quantum, wanted_events, notification_conditions, timeout, stack_size, stack);
     }
-    else if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+
+    // the task and its stack are allocated and freed outside of the critical sections,
+    // which keeps the kernel interrupts masked for a bounded time with any allocator
+    task_t *task = NULL;
+    size_t status = task_create(&task, task_main, kernel_task_terminate, u8_task_id, task_name, u8_task_priority, time_quantum, wanted_events, notification_conditions, timeout, stack_size, stack);
+    if (status != TASK_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
     }
 
-    // insert the task in the corresponding priority group
-    linked_list_t *priority_group = NULL;
-    status = dictionary_get(&g_prioritized_tasks, u8_task_priority, (void **) &priority_group);
-    if (status!=DICTIONARY_SUCCESS) {
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // a terminated task keeps its id until it is reaped, which is done at once to reuse the id
+    task_t *terminated_task = NULL;
+    status = dictionary_get(&g_list_of_tasks, u8_task_id, (void **) &terminated_task);
+    if (status == DICTIONARY_SUCCESS && terminated_task->task_data->eTaskState == TaskState_Deleted) {
+        status = kernel_unlink_terminated_task(&terminated_task);
+    }
+    else {
+        terminated_task = NULL;
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (terminated_task != NULL) {
+        if (status != KERNEL_SUCCESS) {
+            task_delete(&task);
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+        }
+        task_delete(&terminated_task);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // another task might have taken the id in the meantime
+    task_t *used_task = NULL;
+    status = dictionary_get(&g_list_of_tasks, u8_task_id, (void **) &used_task);
+    if (status != DICTIONARY_VALUE_IS_NULL) {
+        kernel_exit_critical();
+        task_delete(&task);
+        if (status == DICTIONARY_SUCCESS) {
+            return KERNEL_UNABLE_TO_ADD_TASK;
+        }
         return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
     }
 
-    // always push a task at the linked list head, because the kernel uses the tail by default as first
-    status = linked_list_push_front(&priority_group, (void **) &task);
-    if (status!=LINKED_LIST_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+    status = kernel_insert_task(&task);
+    if (status != KERNEL_SUCCESS) {
+        kernel_exit_critical();
+        task_delete(&task);
+        return status;
     }
 
-    // preset for priority inheritance
-    if (u8_task_priority > g_task_lowest_priority) {
-        g_task_lower_priority = u8_task_priority;
-        g_task_lowest_priority = u8_task_priority;
+    // the new task preempts the running task like a reinserted task, the others wait for their turn
+    if (u8_task_priority < g_running_task_current->task_data->u8TaskPrio) {
+        status = dictionary_get(&g_prioritized_tasks, u8_task_priority, (void **) &g_priority_group_next);
+        if (status != DICTIONARY_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+        }
+        g_linked_list_task_iterator_next = &task->list_element;
+        g_running_task_next = task;
+        g_dictionary_priority_next = u8_task_priority;
+        g_dictionary_priority = u8_task_priority;
+
+        // pends the switch and ends the critical section
+        return kernel_start_task(&g_priority_group_next, &g_linked_list_task_iterator_next, &g_running_task_next);
     }
 
-    g_available_tasks++;
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
 
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Starts the kernel with the previous added tasks.
- *        Is able to start multiple tasks, if the system supports it.
- *        If the system does not support parallel tasks, starts the firt task
- *        and never returns.
+ * @brief Deletes a task, also while the kernel is running. The task leaves its priority group or the list it is
+ *        blocked in at once and waits in the terminated task list, until the idle loop frees it and its stack.
+ *        The running task deletes itself by terminating, the call does not return then.
+ * @param task_id is size_t of the task
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY: error during priority compacting due to subcomponents
- *  KERNEL_UNABLE_TO_ADD_TASK: unable to add task for starting
- */
-size_t kernel_start(void){
+ *  KERNEL_UNABLE_TO_DELETE_TASK: unable to delete the task, because it owns or waits for a mutex or due to subcomponents
+ * @note A blocked task, also one waiting without a timeout, is unlinked from the list stored in its blocked info.
+ * */
+size_t kernel_task_delete(size_t task_id) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
 
-    kernel_set_status(EN_KERNEL_STARTING);
     task_t *task = NULL;
-    linked_list_t *priority_group = NULL;
-    linked_list_element_t *task_iterator = NULL;
+    size_t status = dictionary_get(&g_list_of_tasks, task_id, (void **) &task);
+    if (status != DICTIONARY_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
+    }
+
+    if (task->task_data->eTaskState == TaskState_Deleted) {
+        // the task already terminated and waits to be reaped
+        kernel_exit_critical();
+        return KERNEL_SUCCESS;
+    }
 
+    if (task == g_running_task_current) {
+        // the task leaves the critical section on the switch and is never resumed
+        kernel_task_terminate();
+        return KERNEL_SUCCESS;
+    }
 
-    size_t status = 0;
+    // an owned mutex would never be released and a waiting task passed its priority on to the owner
+    bool uses_mutex = task->blocked_mutex != NULL || task->ceiling_locks > 0;
+    for (size_t index = 0; index < g_mutex_list->size && !uses_mutex; index++) {
+        mutex_t *mutex = g_mutex_list->slots[index].value;
+        uses_mutex = mutex != NULL && mutex->owner == task;
+    }
+    if (uses_mutex) {
+        kernel_exit_critical();
+        return KERNEL_UNABLE_TO_DELETE_TASK;
+    }
 
-    // reallocate tasks by compacting
-    for (size_t task_priority = 0; task_priority < TASK_MAX_PRIORITY; task_priority++) {
+    // a ready task is linked in its priority group, a blocked task in the list, which releases it on its timeout
+    bool blocked = task->task_data->eTaskState == TaskState_Blocked;
+    linked_list_t *source = NULL;
+    if (!blocked) {
+        status = dictionary_get(&g_prioritized_tasks, task->task_data->u8TaskPrio, (void **) &source);
+        if (status != DICTIONARY_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
+        }
+    }
+    else if (task->blocked_timeout_list != NULL) {
+        source = task->blocked_timeout_list;
+    }
+    else if (timer_wheel_node_is_active(&task->timeout_node)) {
+        source = g_delayed_tasks;
+    }
+    else {
+        kernel_exit_critical();
+        return KERNEL_UNABLE_TO_DELETE_TASK;
+    }
 
-        status = dictionary_get(&g_prioritized_tasks, task_priority, (void **) &priority_group);
-        if (status!=DICTIONARY_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+    if (timer_wheel_node_is_active(&task->timeout_node)) {
+        status = timer_wheel_cancel(&g_timer_wheel, &task->timeout_node);
+        if (status != TIMER_WHEEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TIMER_WHEEL_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
         }
+    }
 
-        if (priority_group->size > 0) {
-            continue;
+    linked_list_element_t *element = &task->list_element;
+    status = linked_list_transfer(&g_terminated_tasks_list, &source, &element);
+    if (status != LINKED_LIST_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
+    }
+    task->blocked_timeout_list = NULL;
+    task->blocked_timeout_list_element = NULL;
+    task_set_state(&task, TaskState_Deleted);
+
+    if (!blocked) {
+        // the priority group might not be runnable anymore
+        status = kernel_update_ready_priority(task->task_data->u8TaskPrio);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return status;
         }
 
-        // empty priority list discovered
-        linked_list_t *lower_priority_group = NULL;
-        for (size_t lower_task_priority = task_priority; lower_task_priority <= TASK_MAX_PRIORITY; lower_task_priority++) {
-            status = dictionary_get(&g_prioritized_tasks, lower_task_priority, (void **) &lower_priority_group);
-            if (status==DICTIONARY_VALUE_IS_NULL) {
-                continue;
-            }
-            else if (status!=DICTIONARY_SUCCESS) {
-                return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+        if (task == g_running_task_next) {
+            // the preset next task might have preempted the running task, so the highest ready priority group is started next
+            size_t running_priority = g_running_task_current->task_data->u8TaskPrio;
+            size_t next_priority = running_priority;
+            status = bitmap_get_first(&g_ready_priorities, &next_priority);
+            if (status != BITMAP_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
             }
 
-            if (lower_priority_group->size == 0) {
-                continue;
+            if (next_priority < running_priority) {
+                status = dictionary_get(&g_prioritized_tasks, next_priority, (void **) &g_priority_group_next);
+                if (status != DICTIONARY_SUCCESS) {
+                    kernel_exit_critical();
+                    return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
+                }
+                g_linked_list_task_iterator_next = g_priority_group_next->tail;
+                g_dictionary_priority_next = next_priority;
             }
-
-            // update priority according to the priority group, where the tasks are being reinserted
-            linked_list_element_t *update_task_priority_iterator = lower_priority_group->tail;
-            while (update_task_priority_iterator != NULL) {
-                task_t *update_task_priority = (task_t *) update_task_priority_iterator->data;
-                status = task_set_priority(&update_task_priority, task_priority);
-                if (status != TASK_SUCCESS) {
-                    return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+            else {
+                // otherwise the running priority group is continued in round robin
+                g_priority_group_next = g_priority_group_current;
+                g_linked_list_task_iterator_next = g_linked_list_task_iterator->next;
+                if (g_linked_list_task_iterator_next == NULL) {
+                    g_linked_list_task_iterator_next = g_priority_group_current->tail;
                 }
-                update_task_priority_iterator = update_task_priority_iterator->next;
             }
-
-            g_task_lower_priority = task_priority;
-            g_task_lowest_priority = task_priority;
-
-            linked_list_move_linked_list_after(&priority_group, &lower_priority_group);
-            break;
+            g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
+            g_dictionary_priority = next_priority;
         }
     }
 
-    for (int priority = g_task_lowest_priority + 1; priority < KERNEL_MAX_TASK; priority++) {
-        // iterate over potentially empty priority groups and delete the lists to save memory
-        linked_list_t *priority_group = NULL;
-        status = dictionary_get(&g_prioritized_tasks, priority, (void **) &priority_group);
-        if (status!=DICTIONARY_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
-        }
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
 
-        status = linked_list_delete(&priority_group);
-        if (status != LINKED_LIST_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_PRIORITY_LIST);
-        }
-    }
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Starts the kernel with the previous added tasks.
+ *        Starts the first task of the highest priority group, the scheduler runs all other tasks.
+ *        Returns only, if the system is shut down.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_TASK: unable to add task for starting
+ */
+size_t kernel_start(void){
+
+    kernel_set_status(EN_KERNEL_STARTING);
+    task_t *task = NULL;
+    linked_list_t *priority_group = NULL;
+    linked_list_element_t *task_iterator = NULL;
+
+
+    size_t status = 0;
+
+    // the priorities are kept as assigned and every priority group stays available,
+    // so tasks can be created at any priority while the kernel is running,
+    // the highest ready priority group is found by the ready priorities without compacting them
 
     // set the alternative stack pointer to a default position
     kernel_set_stack_pointer();
 
 
-    // iterate over all priority lists and start all containing tasks
-    for (size_t task_priority=0; task_priority < TASK_MAX_PRIORITY; task_priority++) {
+    // iterate over all priority lists and start the first containing task
+    for (size_t task_priority=0; task_priority < KERNEL_MAX_TASK; task_priority++) {
 
         // check, if the priority group was actually set or abort on any other error
         status = dictionary_get(&g_prioritized_tasks, task_priority, (void **) &priority_group);
@@ -463,28 +1089,29 @@ size_t kernel_start(void){
         // iterate over the priority group from the prioritized task list and start the task
         task_iterator = priority_group->tail;
         while (task_iterator!=NULL) {
-            task = (task_t *) task_iterator->data;
+            task = TASK_FROM_LIST_ELEMENT(task_iterator);
 
             // check task before any use
             status = task_checking(&task);
             if (status==TASK_SUCCESS) {
                 kernel_set_status(EN_KERNEL_RUNNING);
-                status = kernel_start_task(&priority_group, &task_iterator, &task);
-                if (status!=KERNEL_SUCCESS) {
-                    return status;
-                }
+                // the running priority follows the first started priority group
+                g_dictionary_priority = task_priority;
+
+                // it only returns after a shutdown, when the started tasks might already be reaped
+                return kernel_start_task(&priority_group, &task_iterator, &task);
             }
 
             task_iterator = task_iterator->next;
         }
     }
 
-    // it will return if the system is capable of running tasks in parallel
     return KERNEL_SUCCESS;
 }
 
 /**
  * @brief Create a new message queue for interprocess communication.
+ *        In static allocation mode the queue buffer has to be supplied with kernel_message_queue_create_static.
  * @param message_queue_identifier is a pointer of pointer to the message queue identifier, which is being used as a key to the message queue
  * @param name is a char pointer to a string, which can be used to identify the message queue
  * @param queue_size is a size_t for the amount of entries in a message queue
@@ -494,72 +1121,165 @@ size_t kernel_start(void){
  *  KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE: unable to add message queue due to subcomponents
  */
 size_t kernel_message_queue_create(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t element_size) {
-    // return immediately if the amount of message queue exceeded
-    if (g_message_queue_ids>=KERNEL_MAX_MESSAGE_QUEUE) {
-        return KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE;
+    // reserve the key, a full handle table limits the amount of message queues
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_message_queue_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
     }
 
     // create a new message on the provided parameters
     message_queue_t *message_queue = NULL;
-    size_t status = message_queue_create(&message_queue, queue_size, element_size, g_message_queue_ids, name);
+    status = message_queue_create(&message_queue, queue_size, element_size, handle, name);
     if (status!=MESSAGE_QUEUE_SUCCESS) {
+        handle_table_release(&g_message_queue_list, handle);
         return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
     }
 
-    // add created message queue in a dictionary for fast access
-    status = dictionary_add(&g_message_queue_list, g_message_queue_ids, (void **) &message_queue);
-    if (status!=MESSAGE_QUEUE_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
-    }
-
-    // increment the amount of message queue to limit the amount
-    g_message_queue_ids++;
-
-    // set the key to the message queue
-    (*message_queue_identifier) = message_queue->message_queue_identifier;
-
-    return KERNEL_SUCCESS;
+    return kernel_message_queue_register(message_queue_identifier, &message_queue);
 }
 
 /**
- * @brief Deletes a message queue.
+ * @brief Create a new message queue for interprocess communication in caller supplied storage, which is never released.
+ *        In static allocation mode message queues can only be created this way.
  * @param message_queue_identifier is a pointer of pointer to the message queue identifier, which is being used as a key to the message queue
- * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error and the message_queue_identifier will be set to null
+ * @param name is a char pointer to a string, which can be used to identify the message queue
+ * @param queue_size is a size_t for the amount of entries in a message queue
+ * @param element_size is a size_t, which determines the size of each entry in the message queue
+ * @param storage is a pointer to the memory of the message queue, which must outlive it
+ * @param data is an array of queue_size entries
+ * @param buffer is continuous memory of queue_size * element_size bytes
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE: unable to delete message queue due to subcomponents
+ *  KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE: unable to add message queue due to subcomponents
  */
-size_t kernel_message_queue_delete(message_queue_identifier_t **message_queue_identifier) {
-    // check for valid key
-    size_t status = message_queue_identifier_checking(message_queue_identifier);
-    if (status!=MESSAGE_QUEUE_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE);
+size_t kernel_message_queue_create_static(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t element_size, message_queue_static_t *storage, void **data, void *buffer) {
+    // reserve the key, a full handle table limits the amount of message queues
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_message_queue_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
     }
 
-    // get the corresponding message queue
+    // create a new message queue in the provided storage
     message_queue_t *message_queue = NULL;
-    status = dictionary_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
-    if (status!=DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE);
-    }
-
-    // delete the message queue and the key and the message shall become null
-    status = message_queue_delete(&message_queue);
+    status = message_queue_create_static(&message_queue, storage, data, buffer, queue_size, element_size, handle, name);
     if (status!=MESSAGE_QUEUE_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE);
+        handle_table_release(&g_message_queue_list, handle);
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
     }
 
-    return KERNEL_SUCCESS;
+    return kernel_message_queue_register(message_queue_identifier, &message_queue);
 }
 
 /**
- * @brief Sends a message to a task or stores a message in the message queue.
- * @param message_queue_identifier is a message_queue_identifier pointer of pointer, which is being used as a key to the message queue
- * @param message is data to be send
- * @param element_size is the amount of bytes to stored
- * @param urgent is a bool, if set to true, the message queue becomes a lifo
+ * @brief Create a new message queue, which loans blocks of message_size bytes instead of copying messages.
+ *        A block from kernel_message_queue_alloc is filled in place and its pointer is sent,
+ *        the receiver gets the pointer and returns the block with kernel_message_queue_release.
+ * @param message_queue_identifier is a pointer of pointer to the message queue identifier, which is being used as a key to the message queue
+ * @param name is a char pointer to a string, which can be used to identify the message queue
+ * @param queue_size is a size_t for the amount of blocks and queued messages
+ * @param message_size is a size_t, which determines the size of each block
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_SEND_MESSAGE: unable to send message due to subcomponents
+ *  KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE: unable to add message queue due to subcomponents
+ */
+size_t kernel_message_queue_create_loan(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t message_size) {
+    // reserve the key, a full handle table limits the amount of message queues
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_message_queue_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
+    }
+
+    // create a new loaning message queue on the provided parameters
+    message_queue_t *message_queue = NULL;
+    status = message_queue_create_loan(&message_queue, queue_size, message_size, handle, name);
+    if (status!=MESSAGE_QUEUE_SUCCESS) {
+        handle_table_release(&g_message_queue_list, handle);
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
+    }
+
+    return kernel_message_queue_register(message_queue_identifier, &message_queue);
+}
+
+/**
+ * @brief Create a new message queue, which loans its blocks, in caller supplied storage, which is never released.
+ * @param message_queue_identifier is a pointer of pointer to the message queue identifier, which is being used as a key to the message queue
+ * @param name is a char pointer to a string, which can be used to identify the message queue
+ * @param queue_size is a size_t for the amount of blocks and queued messages
+ * @param message_size is a size_t, which determines the size of each block
+ * @param storage is a pointer to the memory of the message queue, which must outlive it
+ * @param data is an array of queue_size entries
+ * @param buffer is an array of queue_size pointers
+ * @param blocks is continuous 8 byte aligned memory of queue_size * POOL_BLOCK_SIZE(message_size) bytes
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE: unable to add message queue due to subcomponents
+ */
+size_t kernel_message_queue_create_loan_static(message_queue_identifier_t **message_queue_identifier, char *name, size_t queue_size, size_t message_size, message_queue_static_t *storage, void **data, void *buffer, void *blocks) {
+    // reserve the key, a full handle table limits the amount of message queues
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_message_queue_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
+    }
+
+    // create a new loaning message queue in the provided storage
+    message_queue_t *message_queue = NULL;
+    status = message_queue_create_loan_static(&message_queue, storage, data, buffer, blocks, queue_size, message_size, handle, name);
+    if (status!=MESSAGE_QUEUE_SUCCESS) {
+        handle_table_release(&g_message_queue_list, handle);
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
+    }
+
+    return kernel_message_queue_register(message_queue_identifier, &message_queue);
+}
+
+/**
+ * @brief Deletes a message queue.
+ * @param message_queue_identifier is a pointer of pointer to the message queue identifier, which is being used as a key to the message queue
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error and the message_queue_identifier will be set to null
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE: unable to delete message queue due to subcomponents
+ */
+size_t kernel_message_queue_delete(message_queue_identifier_t **message_queue_identifier) {
+    // check for valid key
+    size_t status = message_queue_identifier_checking(message_queue_identifier);
+    if (status!=MESSAGE_QUEUE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE);
+    }
+
+    // get the corresponding message queue
+    message_queue_t *message_queue = NULL;
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE);
+    }
+
+    // delete the message queue and the key and the message shall become null
+    size_t handle = (*message_queue_identifier)->id;
+    status = message_queue_delete(&message_queue);
+    if (status!=MESSAGE_QUEUE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MESSAGE_QUEUE);
+    }
+
+    // the slot is reused by the next message queue, copies of the key become stale
+    handle_table_release(&g_message_queue_list, handle);
+    (*message_queue_identifier) = NULL;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Sends a message to a task or stores a message in the message queue.
+ * @param message_queue_identifier is a message_queue_identifier pointer of pointer, which is being used as a key to the message queue
+ * @param message is data to be send
+ * @param element_size is the amount of bytes to stored
+ * @param urgent is a bool, if set to true, the message queue becomes a lifo
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SEND_MESSAGE: unable to send message due to subcomponents
  */
 size_t kernel_message_queue_send(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent) {
 
@@ -572,20 +1292,21 @@ size_t kernel_message_queue_send(message_queue_identifier_t **message_queue_iden
 
     // obtain message queue
     message_queue_t *message_queue = NULL;
-    status = dictionary_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **)&message_queue);
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **)&message_queue);
     if (status) {
-        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
     }
 
     // prevent other tasks of manipulating the message queue by blocking the context switch
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    kernel_enter_critical();
 
     // send message and be ready for reinserting a task
     linked_list_element_t *element = NULL;
     task_t *task = NULL;
     status = message_queue_send(&message_queue, &element, &task, message, element_size, urgent);
     if (status!=MESSAGE_QUEUE_SUCCESS) {
+        kernel_exit_critical();
         return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
     }
 
@@ -593,13 +1314,42 @@ size_t kernel_message_queue_send(message_queue_identifier_t **message_queue_iden
         // task was returned
         kernel_reinsert_task(&message_queue->receiving_task_list, &element, &task);
     }
+    else if (message_queue->queue_set != NULL) {
+        // message was stored, announce it to the queue set
+        status = kernel_queue_set_post(&message_queue->queue_set, QUEUE_SET_MESSAGE_QUEUE, (*message_queue_identifier)->id);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
+        }
+    }
 
-    kernel_toggle_critical_section();
+    kernel_exit_critical();
     // ------------------- critical section end ----------------------------
 
     return KERNEL_SUCCESS;
 }
 
+/**
+ * @brief Sends a message from an interrupt service routine, it never blocks.
+ * @param message_queue_identifier is a message_queue_identifier pointer of pointer, which is being used as a key to the message queue
+ * @param message is data to be send
+ * @param element_size is the amount of bytes to stored
+ * @param urgent is a bool, if set to true, the message queue becomes a lifo
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SEND_MESSAGE: unable to send message due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
+ */
+size_t kernel_message_queue_send_from_isr(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_message_queue_send(message_queue_identifier, message, element_size, urgent);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
+
 
 /**
  * @brief Sends a message to a task or stores a message in the message queue. The sender can be blocked
@@ -612,6 +1362,22 @@ size_t kernel_message_queue_send(message_queue_identifier_t **message_queue_iden
  *  KERNEL_UNABLE_TO_SEND_MESSAGE: unable to send message due to subcomponents
  */
 size_t kernel_message_queue_send_blocking(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent) {
+    return kernel_message_queue_send_timeout(message_queue_identifier, message, element_size, urgent, KERNEL_WAIT_FOREVER);
+}
+
+/**
+ * @brief Sends a message to a task or stores a message in the message queue.
+ *        The sender is blocked by a full message queue until the message was stored or the timeout elapsed.
+ * @param message_queue_identifier is a message_queue_identifier pointer of pointer, which is being used as a key to the message queue
+ * @param message is data to be send
+ * @param element_size is the amount of bytes to stored
+ * @param urgent is a bool, if set to true, the message queue becomes a lifo
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SEND_MESSAGE: unable to send message due to subcomponents
+ */
+size_t kernel_message_queue_send_timeout(message_queue_identifier_t **message_queue_identifier, void *message, size_t element_size, bool urgent, size_t timeout_milliseconds) {
 
     // check message queue identifier for irregular structure
     size_t status = message_queue_identifier_checking(message_queue_identifier);
@@ -621,40 +1387,60 @@ size_t kernel_message_queue_send_blocking(message_queue_identifier_t **message_q
 
     // obtain message queue
     message_queue_t *message_queue = NULL;
-    status = dictionary_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **)&message_queue);
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **)&message_queue);
     if (status) {
-        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
     }
 
     // try to send a message and be ready for reinserting a task
     linked_list_element_t *element = NULL;
     task_t *task = NULL;
+    size_t start = g_timer_wheel->now;
     do {
         // prevent other tasks of manipulating the message queue by blocking the context switch
         // ------------------- critical section start -------------------------
-        kernel_toggle_critical_section();
+        kernel_enter_critical();
+
+        // a task, whose timeout elapsed, gives up before it is inserted in the sending list
+        size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+        if (ticks == 0 && message_queue->receiving_task_list->size == 0 && message_queue->qcb->length >= message_queue->qcb->size) {
+            kernel_exit_critical();
+            return KERNEL_TIMEOUT;
+        }
+
         status = message_queue_send_blocking(&message_queue, &g_priority_group_current, &g_linked_list_task_iterator, &element, &task, message, element_size, urgent);
         if (status==MESSAGE_QUEUE_SUCCESS) {
             // task succesfully received a message
-            kernel_toggle_critical_section();
+            if (task != NULL) {
+                // task was returned
+                status = kernel_reinsert_task(&message_queue->receiving_task_list, &element, &task);
+            }
+            else if (message_queue->queue_set != NULL) {
+                // message was stored, announce it to the queue set
+                status = kernel_queue_set_post(&message_queue->queue_set, QUEUE_SET_MESSAGE_QUEUE, (*message_queue_identifier)->id);
+            }
+            kernel_exit_critical();
             // ------------------- critical section end ----------------------------
             break;
         }
         else if (status==MESSAGE_QUEUE_UNABLE_TO_SEND) {
-            // task was inserted in the message queue waiting list
+            // task was inserted in the message queue waiting list and is released by a receiver or its timeout
+            size_t timeout_status = kernel_start_timeout(&message_queue->sending_task_list, ticks, KERNEL_UNABLE_TO_SEND_MESSAGE);
+            if (timeout_status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return timeout_status;
+            }
+
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
             kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
         }
         else {
+            kernel_exit_critical();
             return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_MESSAGE);
         }
     } while(status == MESSAGE_QUEUE_UNABLE_TO_SEND);
 
-    if (task != NULL) {
-        // task was returned
-        return kernel_reinsert_task(&message_queue->receiving_task_list, &element, &task);
-    }
-
-    return KERNEL_SUCCESS;
+    return status;
 }
 
 /**
@@ -666,6 +1452,19 @@ size_t kernel_message_queue_send_blocking(message_queue_identifier_t **message_q
  *  KERNEL_UNABLE_TO_RECEIVE_MESSAGE: unable to receive message due to subcomponents
  */
 size_t kernel_message_queue_receive(message_queue_identifier_t **message_queue_identifier, void **message) {
+    return kernel_message_queue_receive_timeout(message_queue_identifier, message, KERNEL_WAIT_FOREVER);
+}
+
+/**
+ * @brief Receive a message or will be blocked until a message was received or the timeout elapsed.
+ * @param message_queue_identifier is a message_queue_identifier_t pointer of pointer to the message queue identifier, which is being used as a key to the message queue
+ * @param message is a void pointer of pointer to the message content, which will be copied to the receiving task
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_MESSAGE: unable to receive message due to subcomponents
+ */
+size_t kernel_message_queue_receive_timeout(message_queue_identifier_t **message_queue_identifier, void **message, size_t timeout_milliseconds) {
 
     // check message queue identifier for irregular structure
     size_t status = message_queue_identifier_checking(message_queue_identifier);
@@ -675,30 +1474,49 @@ size_t kernel_message_queue_receive(message_queue_identifier_t **message_queue_i
 
     // obtain message queue
     message_queue_t *message_queue = NULL;
-    status = dictionary_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
     }
 
     // try to receive a message and be ready for reinserting a task
     linked_list_element_t *sender_element = NULL;
     task_t *sender_task = NULL;
+    size_t start = g_timer_wheel->now;
     do {
         // prevent other tasks of manipulating the message queue by blocking the context switch
         // ------------------- critical section start -------------------------
-        kernel_toggle_critical_section();
+        kernel_enter_critical();
+
+        // a task, whose timeout elapsed, gives up before it is inserted in the receiving list
+        size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+        if (ticks == 0 && !g_running_task_current->message_set && message_queue->qcb->length == 0) {
+            // no sender writes to the destination of the previous wait anymore
+            g_running_task_current->message = NULL;
+            kernel_exit_critical();
+            return KERNEL_TIMEOUT;
+        }
+
         status = message_queue_receive(&message_queue, &g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current, &sender_element, &sender_task, message);
         if (status==MESSAGE_QUEUE_SUCCESS) {
             // task succesfully received a message
-            kernel_toggle_critical_section();
+            kernel_exit_critical();
             // ------------------- critical section end ----------------------------
             break;
         }
         else if (status==MESSAGE_QUEUE_UNABLE_TO_RECEIVE) {
-            // task was inserted in the message queue waiting list
+            // task was inserted in the message queue waiting list and is released by a sender or its timeout
+            size_t timeout_status = kernel_start_timeout(&message_queue->receiving_task_list, ticks, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
+            if (timeout_status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return timeout_status;
+            }
+
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
             kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
         }
         else {
+            kernel_exit_critical();
             return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
         }
 
@@ -713,432 +1531,569 @@ size_t kernel_message_queue_receive(message_queue_identifier_t **message_queue_i
 }
 
 /**
- * @brief Creates a semaphore to block other tasks from entering a protected section.
- * @param id is a pointer of size_t, which is used as a key for fast access.
- * @param tokens is the maximum amount of tokens that can be acquired from a semaphore
+ * @brief Loans a free block of a loaning message queue. The block is owned by the caller
+ *        until it is passed to a send function or returned by kernel_message_queue_release.
+ * @param message_queue_identifier is a message_queue_identifier_t pointer of pointer, which is being used as a key to the message queue
+ * @param block is a void pointer of pointer, which receives the block
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_ADD_SEMAPHORE: unable to add semaphore due to subcomponents
+ *  KERNEL_UNABLE_TO_ALLOC_MESSAGE: unable to loan a block due to subcomponents, e.g. every block is in use
  */
-size_t kernel_semaphore_create(size_t *id, size_t tokens) {
-    // return immediately if the amount of semaphores exceeded
-    if (g_semaphore_ids >= KERNEL_MAX_SEMAPHORE) {
-        return KERNEL_UNABLE_TO_ADD_SEMAPHORE;
-    }
+size_t kernel_message_queue_alloc(message_queue_identifier_t **message_queue_identifier, void **block) {
 
-    // create semaphore and check for errors
-    semaphore_t *semaphore = NULL;
-    size_t status = semaphore_create(&semaphore, g_semaphore_ids, tokens);
-    if (status != SEMAPHORE_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_SEMAPHORE);
+    // check message queue identifier for irregular structure
+    size_t status = message_queue_identifier_checking(message_queue_identifier);
+    if (status!=MESSAGE_QUEUE_IDENTIFIER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_MESSAGE);
     }
 
-    // insert semaphore in a dictionary for fast access
-    status = dictionary_add(&g_semaphore_list, g_semaphore_ids, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_SEMAPHORE);
+    // obtain message queue
+    message_queue_t *message_queue = NULL;
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_MESSAGE);
     }
 
-    // assign key to the semaphore
-    *id = g_semaphore_ids;
+    // the free blocks are shared by all senders and receivers
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    status = message_queue_alloc(&message_queue, block);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status!=MESSAGE_QUEUE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_MESSAGE);
+    }
 
-    // increment amount the amount of semaphores to limit the amount
-    g_semaphore_ids++;
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Deletes an existing semaphore.
- * @param id is a pointer of size_t, which is used as a key for fast access.
+ * @brief Returns a received or unsent block to its loaning message queue.
+ * @param message_queue_identifier is a message_queue_identifier_t pointer of pointer, which is being used as a key to the message queue
+ * @param block is a void pointer to the block, which must not be used afterwards
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_DELETE_SEMAPHORE: unable to delete semaphore due to subcomponents
+ *  KERNEL_UNABLE_TO_RELEASE_MESSAGE: unable to return the block due to subcomponents, e.g. it belongs to another queue
  */
-size_t kernel_semaphore_delete(size_t *id) {
-    semaphore_t *semaphore = NULL;
-    size_t status = dictionary_get(&g_semaphore_list, *id, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE);
-    }
+size_t kernel_message_queue_release(message_queue_identifier_t **message_queue_identifier, void *block) {
 
-    while (semaphore->task_waiting_list->size > 0) {
-        status = kernel_reinsert_task(&semaphore->task_waiting_list, &semaphore->task_waiting_list->tail, (task_t **) &semaphore->task_waiting_list->tail->data);
-        if (status != KERNEL_SUCCESS) {
-            return status;
-        }
+    // check message queue identifier for irregular structure
+    size_t status = message_queue_identifier_checking(message_queue_identifier);
+    if (status!=MESSAGE_QUEUE_IDENTIFIER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MESSAGE);
     }
 
-    status = semaphore_delete(&semaphore);
-    if (status != SEMAPHORE_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE);
+    // obtain message queue
+    message_queue_t *message_queue = NULL;
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MESSAGE);
     }
 
-    *id = 0;
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    status = message_queue_release(&message_queue, block);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status!=MESSAGE_QUEUE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MESSAGE);
+    }
 
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Acquires a semaphore to enter a critical section.
- *        The task will try to acquire the semaphore and will be blocked until it was successful.
- * @param id is size_t, which is used as a key for fast access.
+ * @brief Creates a topic, which shares every published sample with all of its subscribers.
+ *        In static allocation mode the ring has to be supplied with kernel_topic_create_static.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param size is the amount of samples kept for slow subscribers, which has to be a power of 2
+ * @param sample_size is the size of a single sample
+ * @param max_subscribers is the amount of subscribers
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE: unable to acquire semaphore due to subcomponents
+ *  KERNEL_UNABLE_TO_ADD_TOPIC: unable to add topic due to subcomponents
  */
-size_t kernel_semaphore_acquire(size_t id) {
-
-    if (id >= KERNEL_MAX_SEMAPHORE) {
-        return KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE;
+size_t kernel_topic_create(size_t *id, size_t size, size_t sample_size, size_t max_subscribers) {
+    // reserve the key, a full handle table limits the amount of topics
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_topic_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TOPIC);
     }
 
-    // get the requested semaphore by the id from the semaphore dictionary
-    semaphore_t* semaphore = NULL;
-    size_t status = dictionary_get(&g_semaphore_list, id, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
+    topic_t *topic = NULL;
+    status = topic_create(&topic, handle, size, sample_size, max_subscribers);
+    if (status != TOPIC_SUCCESS) {
+        handle_table_release(&g_topic_list, handle);
+        return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TOPIC);
     }
 
-    // try to obtain a token from the semaphore
-    do {
-        // prevent other tasks of manipulating the semaphore by blocking the context switch
-        // ------------------- critical section start -------------------------
-        kernel_toggle_critical_section();
-        while (!g_kernel_critical_section_active);
+    return kernel_topic_register(id, &topic);
+}
 
-        status = semaphore_acquire(&semaphore, &g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+/**
+ * @brief Creates a topic in caller supplied storage, which is never released.
+ *        In static allocation mode topics can only be created this way.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param size is the amount of samples kept for slow subscribers, which has to be a power of 2
+ * @param sample_size is the size of a single sample
+ * @param max_subscribers is the amount of subscribers
+ * @param storage is a pointer to the memory of the topic, which must outlive it
+ * @param samples is continuous memory of size * sample_size bytes
+ * @param subscribers is an array of max_subscribers read positions
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_TOPIC: unable to add topic due to subcomponents
+ */
+size_t kernel_topic_create_static(size_t *id, size_t size, size_t sample_size, size_t max_subscribers, topic_static_t *storage, void *samples, topic_subscriber_t *subscribers) {
+    // reserve the key, a full handle table limits the amount of topics
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_topic_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TOPIC);
+    }
 
-        if (status == SEMAPHORE_SUCCESS) {
-            // acquired semaphore and semaphore will not be modified
-            kernel_toggle_critical_section();
-            // ------------------- critical section end ----------------------------
-            break;
-        }
-        else if (status == SEMAPHORE_NO_TOKENS) {
-            // task was inserted in the semaphore waiting list
-            kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
-        }
-        else {
-            // error happened with the semaphore
-            return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
-        }
-    } while (status == SEMAPHORE_NO_TOKENS);
+    topic_t *topic = NULL;
+    status = topic_create_static(&topic, storage, samples, subscribers, handle, size, sample_size, max_subscribers);
+    if (status != TOPIC_SUCCESS) {
+        handle_table_release(&g_topic_list, handle);
+        return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TOPIC);
+    }
 
-    return KERNEL_SUCCESS;
+    return kernel_topic_register(id, &topic);
 }
 
-
 /**
- * @brief Releases a semaphore to exit a critical section.
- *        On every release a task will be moved to its corresponding priority group
- * @param id is size_t, which is used as a key for fast access.
+ * @brief Deletes a topic, its waiting subscribers are released.
+ * @param id is a pointer of size_t, which is used as a key for fast access
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
+ *  KERNEL_UNABLE_TO_DELETE_TOPIC: unable to delete topic due to subcomponents
  */
-size_t kernel_semaphore_release(size_t id) {
-    if (id >= KERNEL_MAX_SEMAPHORE) {
-        return KERNEL_UNABLE_TO_RELEASE_SEMAPHORE;
+size_t kernel_topic_delete(size_t *id) {
+    topic_t *topic = NULL;
+    size_t status = handle_table_get(&g_topic_list, *id, (void **) &topic);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TOPIC);
     }
 
-    // prevent other tasks of manipulating the semaphore by blocking the context switch
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
-
-    // get the requested semaphore by the id from the semaphore dictionary
-    semaphore_t* semaphore = NULL;
-    size_t status = dictionary_get(&g_semaphore_list, id, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS){
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+    kernel_enter_critical();
+    status = kernel_topic_wake_all(&topic);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+    if (status != KERNEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TOPIC);
     }
 
-    // release the semaphore and check, if a task can be moved from the waiting list to the corresponding priority group
-    task_t* task = NULL;
-    linked_list_element_t* element = NULL;
-    status = semaphore_release(&semaphore, &element, &task);
-
-    if (task!=NULL) {
-        status = kernel_reinsert_task(&semaphore->task_waiting_list, &element, &task);
-        if (status != KERNEL_SUCCESS) {
-            return status;
-        }
-    }
-    if (status != SEMAPHORE_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+    status = topic_delete(&topic);
+    if (status != TOPIC_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TOPIC);
     }
 
-    kernel_toggle_critical_section();
-    // ------------------- critical section end ----------------------------
-
+    // the key must not find the released topic anymore
+    handle_table_release(&g_topic_list, *id);
+    *id = HANDLE_TABLE_INVALID_HANDLE;
 
     return KERNEL_SUCCESS;
-
 }
 
 /**
- * @brief Acquires a semaphore to enter a critical section.
- *        The task will try to acquire the semaphore and returns, even if unsuccessful.
- * @param id is size_t, which is used as a key for fast access.
+ * @brief Adds a subscriber to a topic, which reads the samples published afterwards.
+ * @param id is size_t, which is used as a key for fast access
+ * @param subscriber is a pointer of size_t, which receives the key of the subscriber
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE: unable to acquire semaphore due to subcomponents
+ *  KERNEL_UNABLE_TO_SUBSCRIBE: unable to subscribe due to subcomponents, e.g. every subscriber is in use
  */
-size_t kernel_semaphore_acquire_non_blocking(size_t id) {
-
-    if (id >= KERNEL_MAX_SEMAPHORE) {
-        return KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE;
+size_t kernel_topic_subscribe(size_t id, size_t *subscriber) {
+    topic_t *topic = NULL;
+    size_t status = handle_table_get(&g_topic_list, id, (void **) &topic);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_SUBSCRIBE);
     }
 
-    // prevent other tasks of manipulating the semaphore by blocking the context switch
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
-
-    // get the requested semaphore by the id from the semaphore dictionary
-    semaphore_t* semaphore = NULL;
-    size_t status = dictionary_get(&g_semaphore_list, id, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
-    }
-
-    // try to obtain a token from the semaphore
-    status = semaphore_acquire_non_blocking(&semaphore);
-
-    // acquired semaphore and semaphore will not be modified
-    kernel_toggle_critical_section();
+    kernel_enter_critical();
+    status = topic_subscribe(&topic, subscriber);
+    kernel_exit_critical();
     // ------------------- critical section end ----------------------------
 
-    if (status != SEMAPHORE_SUCCESS) {
-        // can be error or failed to acquire (SEMAPHORE_NO_TOKENS), handling required by caller
-        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
+    if (status != TOPIC_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_SUBSCRIBE);
     }
 
     return KERNEL_SUCCESS;
 }
 
-
 /**
- * @brief Releases a semaphore to exit a critical section.
- *        Does not access the waiting list.
- * @param id is size_t, which is used as a key for fast access.
+ * @brief Publishes a sample to all subscribers of a topic. The sample is written once into the ring,
+ *        the subscribers read it by their own position and slow subscribers never stall the publisher.
+ *        All waiting subscribers are woken within the same critical section.
+ * @param id is size_t, which is used as a key for fast access
+ * @param sample is a pointer to the sample, which is copied once
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
+ *  KERNEL_UNABLE_TO_PUBLISH: unable to publish due to subcomponents
  */
-size_t kernel_semaphore_release_non_blocking(size_t id) {
-    if (id >= KERNEL_MAX_SEMAPHORE) {
-        return KERNEL_UNABLE_TO_RELEASE_SEMAPHORE;
+size_t kernel_topic_publish(size_t id, void *sample) {
+    topic_t *topic = NULL;
+    size_t status = handle_table_get(&g_topic_list, id, (void **) &topic);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_PUBLISH);
     }
 
-    // prevent other tasks of manipulating the semaphore by blocking the context switch
+    // prevent the subscribers of reading a partially written sample
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    kernel_enter_critical();
 
-    // get the requested semaphore by the id from the semaphore dictionary
-    semaphore_t* semaphore = NULL;
-    size_t status = dictionary_get(&g_semaphore_list, id, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS){
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+    status = topic_publish(&topic, sample);
+    if (status != TOPIC_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_PUBLISH);
     }
 
-    // release the semaphore
-    status = semaphore_release_non_blocking(&semaphore);
+    status = kernel_topic_wake_all(&topic);
 
-    kernel_toggle_critical_section();
+    kernel_exit_critical();
     // ------------------- critical section end ----------------------------
 
-    if (status != SEMAPHORE_SUCCESS) {
-        // can be error or failed to release (SEMAPHORE_REACHED_MAX_TOKENS), handling required by caller
-        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+    if (status != KERNEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_PUBLISH);
     }
 
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Checks if a semaphore is avaialable for acquiring.
- * @param id is size_t, which is used as a key for fast access.
- * @return SEMAPHORE_SUCCESS if available, SEMAPHORE_NO_TOKENS if unavailable or unequal on error
- * @info the return value can be a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
- *  KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY: unable to check availability due to subcomponents
+ * @brief Publishes a sample from an interrupt service routine, it never blocks.
+ * @param id is size_t, which is used as a key for fast access
+ * @param sample is a pointer to the sample, which is copied once
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_PUBLISH: unable to publish due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
  */
-size_t kernel_semaphore_is_available(size_t id) {
-    if (id >= KERNEL_MAX_SEMAPHORE)
-        return KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY;
+size_t kernel_topic_publish_from_isr(size_t id, void *sample, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_topic_publish(id, sample);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
 
-    semaphore_t* semaphore = NULL;
+/**
+ * @brief Copies the next sample of a subscriber or blocks until it is published.
+ *        A subscriber, which fell behind by more than the ring size, continues with the oldest sample
+ *        and the skipped samples are counted as overruns.
+ * @param id is size_t, which is used as a key for fast access
+ * @param subscriber is size_t, which is the key of the subscriber
+ * @param sample is a pointer to sample_size bytes, which receives the sample
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_SAMPLE: unable to receive a sample due to subcomponents
+ */
+size_t kernel_topic_receive(size_t id, size_t subscriber, void *sample) {
+    topic_t *topic = NULL;
+    size_t status = handle_table_get(&g_topic_list, id, (void **) &topic);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_SAMPLE);
+    }
 
-    size_t status = dictionary_get(&g_semaphore_list, id, (void **) &semaphore);
-    if (status != DICTIONARY_SUCCESS)
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY);
+    do {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
 
-    status = semaphore_is_available(&semaphore);
-    if (status == SEMAPHORE_SUCCESS || status == SEMAPHORE_NO_TOKENS) {
-        return status;
-    }
+        status = topic_read(&topic, subscriber, sample);
+        if (status == TOPIC_SUCCESS) {
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            break;
+        }
+        else if (status == TOPIC_NO_SAMPLE) {
+            // wait for the next publish, the task leaves the critical section on the switch
+            status = topic_wait(&topic, &g_priority_group_current, &g_linked_list_task_iterator);
+            if (status != TOPIC_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_SAMPLE);
+            }
+            status = kernel_start_timeout(&topic->waiting_task_list, KERNEL_WAIT_FOREVER, KERNEL_UNABLE_TO_RECEIVE_SAMPLE);
+            if (status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return status;
+            }
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+            kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+            status = TOPIC_NO_SAMPLE;
+        }
+        else {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_SAMPLE);
+        }
+    } while (status == TOPIC_NO_SAMPLE);
 
-    return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY);
+    return KERNEL_SUCCESS;
 }
 
+/**
+ * @brief Gets the amount of samples a subscriber missed, because the publisher overwrote them.
+ * @param id is size_t, which is used as a key for fast access
+ * @param subscriber is size_t, which is the key of the subscriber
+ * @param overruns is a pointer of size_t, which receives the amount of missed samples
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_SAMPLE: unable to get the overruns due to subcomponents
+ */
+size_t kernel_topic_get_overruns(size_t id, size_t subscriber, size_t *overruns) {
+    topic_t *topic = NULL;
+    size_t status = handle_table_get(&g_topic_list, id, (void **) &topic);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_SAMPLE);
+    }
+
+    status = topic_get_overruns(&topic, subscriber, overruns);
+    if (status != TOPIC_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TOPIC_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_SAMPLE);
+    }
 
-// MUTEX
+    return KERNEL_SUCCESS;
+}
 
 /**
- * @brief Creates a mutex to block other tasks from entering a protected section.
+ * @brief Creates a semaphore to block other tasks from entering a protected section.
  * @param id is a pointer of size_t, which is used as a key for fast access.
+ * @param tokens is the maximum amount of tokens that can be acquired from a semaphore
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_CREATE_MUTEX: unable to create mutex due to subcomponents
+ *  KERNEL_UNABLE_TO_ADD_SEMAPHORE: unable to add semaphore due to subcomponents
  */
-size_t kernel_mutex_create(size_t *id) {
-    // return immediately if the amount of mutexes exceeded
-    if (g_mutex_ids >= KERNEL_MAX_MUTEX) {
-        return KERNEL_UNABLE_TO_CREATE_MUTEX;
+size_t kernel_semaphore_create(size_t *id, size_t tokens) {
+    // reserve the key, a full handle table limits the amount of semaphores
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_semaphore_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_SEMAPHORE);
     }
 
-    // create mutex and check for errors
-    mutex_t *mutex = NULL;
-    size_t status = mutex_create(&mutex, g_mutex_ids);
-    if (status != MUTEX_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
+    // create semaphore and check for errors
+    semaphore_t *semaphore = NULL;
+    status = semaphore_create(&semaphore, handle, tokens);
+    if (status != SEMAPHORE_SUCCESS) {
+        handle_table_release(&g_semaphore_list, handle);
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_SEMAPHORE);
     }
 
-    // insert mutex in a dictionary for fast access
-    status = dictionary_add(&g_mutex_list, g_mutex_ids, (void **) &mutex);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
+    // add created semaphore to the handle table for fast access
+    status = handle_table_set(&g_semaphore_list, handle, semaphore);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        semaphore_delete(&semaphore);
+        handle_table_release(&g_semaphore_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_SEMAPHORE);
     }
 
-    // assign key to the mutex
-    *id = g_mutex_ids;
-
-    // increment amount the amount of mutexes to limit the amount
-    g_mutex_ids++;
+    // assign key to the semaphore
+    *id = handle;
 
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Deletes an existing mutex
+ * @brief Deletes an existing semaphore.
  * @param id is a pointer of size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_DELETE_MUTEX: unable to delete mutex due to subcomponents
+ *  KERNEL_UNABLE_TO_DELETE_SEMAPHORE: unable to delete semaphore due to subcomponents
  */
-size_t kernel_mutex_delete(size_t *id) {
-    mutex_t *mutex = NULL;
-    size_t status = dictionary_get(&g_mutex_list, *id, (void **) &mutex);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX);
+size_t kernel_semaphore_delete(size_t *id) {
+    semaphore_t *semaphore = NULL;
+    size_t status = handle_table_get(&g_semaphore_list, *id, (void **) &semaphore);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE);
     }
 
-    while (mutex->binary_semaphore->task_waiting_list->size > 0) {
-        status = kernel_reinsert_task(&mutex->binary_semaphore->task_waiting_list, &mutex->binary_semaphore->task_waiting_list->tail, (task_t **) &mutex->binary_semaphore->task_waiting_list->tail->data);
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // the released tasks look the semaphore up again and find its key stale, the slot is reused by the next semaphore
+    handle_table_release(&g_semaphore_list, *id);
+
+    // the tick handler unlinks timed out waiters from the same list
+    linked_list_t *waiting_task_list = semaphore->task_waiting_list;
+    while (waiting_task_list->size > 0) {
+        task_t *task = TASK_FROM_LIST_ELEMENT(waiting_task_list->tail);
+        status = kernel_reinsert_task(&waiting_task_list, &waiting_task_list->tail, &task);
         if (status != KERNEL_SUCCESS) {
-            return status;
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE);
         }
     }
 
-    status = mutex_delete(&mutex);
-    if (status != MUTEX_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX);
-    }
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
 
-    *id = 0;
+    status = semaphore_delete(&semaphore);
+    if (status != SEMAPHORE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_SEMAPHORE);
+    }
+    *id = HANDLE_TABLE_INVALID_HANDLE;
 
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Acquires a mutex to enter a critical section.
- *        The task will try to acquire the mutex and will be blocked until it was successful.
+ * @brief Acquires a semaphore to enter a critical section.
+ *        The task will try to acquire the semaphore and will be blocked until it was successful.
  * @param id is size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_ACQUIRE_MUTEX: unable to acquire mutex due to subcomponents
+ *  KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE: unable to acquire semaphore due to subcomponents
  */
-size_t kernel_mutex_acquire(size_t id) {
+size_t kernel_semaphore_acquire(size_t id) {
+    return kernel_semaphore_acquire_timeout(id, KERNEL_WAIT_FOREVER);
+}
+
+/**
+ * @brief Acquires a semaphore to enter a critical section.
+ *        The task will try to acquire the semaphore and will be blocked until it was successful or the timeout elapsed.
+ * @param id is size_t, which is used as a key for fast access.
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE: unable to acquire semaphore due to subcomponents
+ */
+size_t kernel_semaphore_acquire_timeout(size_t id, size_t timeout_milliseconds) {
 
-    if (id >= KERNEL_MAX_MUTEX) {
-        return KERNEL_UNABLE_TO_ACQUIRE_MUTEX;
+    // get the requested semaphore by indexing the semaphore handle table directly
+    semaphore_t* semaphore = g_semaphore_list != NULL ? handle_table_lookup(g_semaphore_list, id) : NULL;
+    if (semaphore == NULL) {
+        size_t status = handle_table_get(&g_semaphore_list, id, (void **) &semaphore);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
     }
 
-    // get the requested mutex by the id from the mutex dictionary
-    mutex_t* mutex = NULL;
-    size_t status = dictionary_get(&g_mutex_list, id, (void **) &mutex);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    // a free token is taken by an atomic exchange without masking interrupts
+    if (semaphore_acquire_atomic(&semaphore) == SEMAPHORE_SUCCESS) {
+        return KERNEL_SUCCESS;
     }
 
-    // try to obtain a token from the mutex
+    // try to obtain a token from the semaphore
+    size_t start = g_timer_wheel->now;
+    size_t status = KERNEL_SUCCESS;
     do {
-        // prevent other tasks of manipulating the mutex by blocking the context switch
+        // prevent other tasks of manipulating the semaphore by blocking the context switch
         // ------------------- critical section start -------------------------
-        kernel_toggle_critical_section();
-        while (!g_kernel_critical_section_active);
+        kernel_enter_critical();
+
+        // a task released by deleting the semaphore does not find it anymore
+        semaphore = handle_table_lookup(g_semaphore_list, id);
+        if (semaphore == NULL) {
+            kernel_exit_critical();
+            status = handle_table_get(&g_semaphore_list, id, (void **) &semaphore);
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
+        }
 
-        status = mutex_acquire(&mutex, &g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+        // a task, whose timeout elapsed, gives up before it is inserted in the waiting list
+        size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+        if (ticks == 0 && semaphore->token == 0) {
+            kernel_exit_critical();
+            return KERNEL_TIMEOUT;
+        }
 
-        if (status == MUTEX_SUCCESS) {
+        status = semaphore_acquire(&semaphore, &g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+
+        if (status == SEMAPHORE_SUCCESS) {
             // acquired semaphore and semaphore will not be modified
-            kernel_toggle_critical_section();
+            kernel_exit_critical();
             // ------------------- critical section end ----------------------------
             break;
         }
-        else if (status == MUTEX_OWNED_BY_OTHER_TASK) {
-            // task was inserted in the mutexes binary semaphore waiting list
+        else if (status == SEMAPHORE_NO_TOKENS) {
+            // task was inserted in the semaphore waiting list and is released by a token or its timeout
+            size_t timeout_status = kernel_start_timeout(&semaphore->task_waiting_list, ticks, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
+            if (timeout_status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return timeout_status;
+            }
+
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
             kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
         }
         else {
-            // error happened with the mutex
-            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+            // error happened with the semaphore
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
         }
-    } while (status == MUTEX_OWNED_BY_OTHER_TASK);
+    } while (status == SEMAPHORE_NO_TOKENS);
 
     return KERNEL_SUCCESS;
 }
 
 
 /**
- * @brief Releases a mutex to exit a critical section.
+ * @brief Releases a semaphore to exit a critical section.
  *        On every release a task will be moved to its corresponding priority group
  * @param id is size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RELEASE_MUTEX: unable to release mutex due to subcomponents
+ *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
  */
-size_t kernel_mutex_release(size_t id) {
-    if (id >= KERNEL_MAX_MUTEX) {
-        return KERNEL_UNABLE_TO_RELEASE_MUTEX;
+size_t kernel_semaphore_release(size_t id) {
+    // get the requested semaphore by indexing the semaphore handle table directly
+    semaphore_t* semaphore = g_semaphore_list != NULL ? handle_table_lookup(g_semaphore_list, id) : NULL;
+    if (semaphore == NULL) {
+        size_t status = handle_table_get(&g_semaphore_list, id, (void **) &semaphore);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
     }
 
-    // prevent other tasks of manipulating the mutex by blocking the context switch
-    // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    // the token is returned by an atomic exchange without masking interrupts
+    bool task_waiting = false;
+    size_t status = semaphore_release_atomic(&semaphore, &task_waiting);
+    if (status != SEMAPHORE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+    }
+    if (!task_waiting) {
+        if (semaphore->queue_set == NULL) {
+            return KERNEL_SUCCESS;
+        }
 
-    // get the requested mutex by the id from the mutex dictionary
-    mutex_t* mutex = NULL;
-    size_t status = dictionary_get(&g_mutex_list, id, (void **) &mutex);
-    if (status != DICTIONARY_SUCCESS){
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
+        // the token was stored, announce it to the queue set
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+        status = kernel_queue_set_post(&semaphore->queue_set, QUEUE_SET_SEMAPHORE, id);
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+
+        if (status != KERNEL_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+        }
+        return KERNEL_SUCCESS;
     }
 
-    // release the mutex and check, if a task can be moved from the waiting list to the corresponding priority group
-    task_t* task = g_running_task_current;
+    // prevent other tasks of manipulating the waiting list by blocking the context switch
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // move the first waiting task to its priority group, it retries to acquire the token
+    task_t* task = NULL;
     linked_list_element_t* element = NULL;
-    status = mutex_release(&mutex, &element, &task);
+    status = semaphore_get_waiting_task(&semaphore, &element, &task);
+    if (status != SEMAPHORE_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+    }
 
     if (task!=NULL) {
-        status = kernel_reinsert_task(&mutex->binary_semaphore->task_waiting_list, &element, &task);
+        status = kernel_reinsert_task(&semaphore->task_waiting_list, &element, &task);
         if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
             return status;
         }
     }
-    if (status != MUTEX_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
-    }
 
-    kernel_toggle_critical_section();
+    kernel_exit_critical();
     // ------------------- critical section end ----------------------------
 
 
@@ -1147,40 +2102,55 @@ size_t kernel_mutex_release(size_t id) {
 }
 
 /**
- * @brief Acquires a mutex to enter a critical section.
- *        The task will try to acquire the mutex and returns, even if unsuccessful.
+ * @brief Releases a semaphore from an interrupt service routine, it never blocks.
  * @param id is size_t, which is used as a key for fast access.
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_ACQUIRE_MUTEX: unable to acquire mutex due to subcomponents
+ *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
  */
-size_t kernel_mutex_acquire_non_blocking(size_t id) {
+size_t kernel_semaphore_release_from_isr(size_t id, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_semaphore_release(id);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
 
-    if (id >= KERNEL_MAX_MUTEX) {
-        return KERNEL_UNABLE_TO_ACQUIRE_MUTEX;
-    }
+/**
+ * @brief Acquires a semaphore to enter a critical section.
+ *        The task will try to acquire the semaphore and returns, even if unsuccessful.
+ * @param id is size_t, which is used as a key for fast access.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE: unable to acquire semaphore due to subcomponents
+ */
+size_t kernel_semaphore_acquire_non_blocking(size_t id) {
 
-    // prevent other tasks of manipulating the mutex by blocking the context switch
+    // prevent other tasks of manipulating the semaphore by blocking the context switch
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    kernel_enter_critical();
 
-    // get the requested mutex by the id from the mutex dictionary
-    mutex_t* mutex = NULL;
-    size_t status = dictionary_get(&g_mutex_list, id, (void **) &mutex);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    // get the requested semaphore by the id from the semaphore handle table
+    semaphore_t* semaphore = NULL;
+    size_t status = handle_table_get(&g_semaphore_list, id, (void **) &semaphore);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
     }
 
-    // try to obtain a token from the mutex
-    status = mutex_acquire_non_blocking(&mutex, &g_running_task_current);
+    // try to obtain a token from the semaphore
+    status = semaphore_acquire_non_blocking(&semaphore);
 
-    // acquired mutex and mutex will not be modified
-    kernel_toggle_critical_section();
+    // acquired semaphore and semaphore will not be modified
+    kernel_exit_critical();
     // ------------------- critical section end ----------------------------
 
-    if (status != MUTEX_SUCCESS) {
-        // error happened with the semaphore
-        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    if (status != SEMAPHORE_SUCCESS) {
+        // can be error or failed to acquire (SEMAPHORE_NO_TOKENS), handling required by caller
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_SEMAPHORE);
     }
 
     return KERNEL_SUCCESS;
@@ -1188,448 +2158,3539 @@ size_t kernel_mutex_acquire_non_blocking(size_t id) {
 
 
 /**
- * @brief Release a mutex to exit a critical section.
- *        Does not manage the waiting list or blocked tasks.
+ * @brief Releases a semaphore to exit a critical section.
+ *        Does not access the waiting list.
  * @param id is size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RELEASE_MUTEX: unable to release mutex due to subcomponents
+ *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
  */
-size_t kernel_mutex_release_non_blocking(size_t id) {
-    if (id >= KERNEL_MAX_MUTEX) {
-        return KERNEL_UNABLE_TO_ACQUIRE_MUTEX;
-    }
-
-    // prevent other tasks of manipulating the mutex by blocking the context switch
+size_t kernel_semaphore_release_non_blocking(size_t id) {
+    // prevent other tasks of manipulating the semaphore by blocking the context switch
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    kernel_enter_critical();
 
-    // get the requested mutex by the id from the mutex dictionary
-    mutex_t* mutex = NULL;
-    size_t status = dictionary_get(&g_mutex_list, id, (void **) &mutex);
-    if (status != DICTIONARY_SUCCESS){
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    // get the requested semaphore by the id from the semaphore handle table
+    semaphore_t* semaphore = NULL;
+    size_t status = handle_table_get(&g_semaphore_list, id, (void **) &semaphore);
+    if (status != HANDLE_TABLE_SUCCESS){
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
     }
 
-    // release the mutex and check, if a task can be moved from the waiting list to the corresponding priority group
-    status = mutex_release_non_blocking(&mutex, &g_running_task_current);
+    // release the semaphore
+    status = semaphore_release_non_blocking(&semaphore);
+    if (status == SEMAPHORE_SUCCESS && semaphore->queue_set != NULL) {
+        // the token was stored, announce it to the queue set
+        size_t post_status = kernel_queue_set_post(&semaphore->queue_set, QUEUE_SET_SEMAPHORE, id);
+        if (post_status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(post_status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
+        }
+    }
 
-    kernel_toggle_critical_section();
+    kernel_exit_critical();
     // ------------------- critical section end ----------------------------
 
-    if (status != MUTEX_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    if (status != SEMAPHORE_SUCCESS) {
+        // can be error or failed to release (SEMAPHORE_REACHED_MAX_TOKENS), handling required by caller
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_SEMAPHORE);
     }
 
     return KERNEL_SUCCESS;
 }
 
+/**
+ * @brief Checks if a semaphore is avaialable for acquiring.
+ * @param id is size_t, which is used as a key for fast access.
+ * @return SEMAPHORE_SUCCESS if available, SEMAPHORE_NO_TOKENS if unavailable or unequal on error
+ * @info the return value can be a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RELEASE_SEMAPHORE: unable to release semaphore due to subcomponents
+ *  KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY: unable to check availability due to subcomponents
+ */
+size_t kernel_semaphore_is_available(size_t id) {
+    semaphore_t* semaphore = NULL;
+
+    size_t status = handle_table_get(&g_semaphore_list, id, (void **) &semaphore);
+    if (status != HANDLE_TABLE_SUCCESS)
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY);
+
+    status = semaphore_is_available(&semaphore);
+    if (status == SEMAPHORE_SUCCESS || status == SEMAPHORE_NO_TOKENS) {
+        return status;
+    }
+
+    return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNEXPECTED_SEMAPHORE_AVAILABILTY);
+}
+
+
+// MUTEX
 
 /**
- * @brief Delays the task by the amount in milliseconds.
- * @param delay_millisecods is size_t, which is the amount to delay the current running task.
+ * @brief Creates a mutex to block other tasks from entering a protected section.
+ * @param id is a pointer of size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_DELAY_TASK: unable to delay tasks due to subcomponents
- * */
-size_t kernel_delay(size_t delay_millisecods) {
-
-    if (delay_millisecods == 0) {
-        return KERNEL_SUCCESS;
+ *  KERNEL_UNABLE_TO_CREATE_MUTEX: unable to create mutex due to subcomponents
+ */
+size_t kernel_mutex_create(size_t *id) {
+    // reserve the key, a full handle table limits the amount of mutexes
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_mutex_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
     }
 
-    // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    // create mutex and check for errors
+    mutex_t *mutex = NULL;
+    status = mutex_create(&mutex, handle);
+    if (status != MUTEX_SUCCESS) {
+        handle_table_release(&g_mutex_list, handle);
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
+    }
 
-    // checking for valid linked list
-    size_t status = linked_list_checking(&g_delayed_tasks);
-    if (status!=LINKED_LIST_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_DELAY_TASK);
+    // add created mutex to the handle table for fast access
+    status = handle_table_set(&g_mutex_list, handle, mutex);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        mutex_delete(&mutex);
+        handle_table_release(&g_mutex_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
     }
 
-    // iterate over the delayed list and insert the task in the list by a delta
-    task_t *task = g_running_task_current;
-    linked_list_element_t *iterator = g_delayed_tasks->tail;
-    size_t delta_sum = 0;
-    task_t *delayed_task = NULL;
-
-    // skip iteration if the list is still empty
-    while (iterator != NULL) {
-
-        // checking for valid task
-        delayed_task = (task_t *) iterator->data;
-        status = task_checking(&task);
-        if (status != TASK_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELAY_TASK);
-        }
-
-        // sum up the deltas to get the delayed time for each task
-        delta_sum += delayed_task->delta_time;
-
-        // check for abort conditions
-        if (delta_sum > delay_millisecods) {
-            // task is inserted before an already delayed task
-            delta_sum -= delayed_task->delta_time;
-            // update the delta before insertion to update the total delay for the already delayed task
-            delayed_task->delta_time -= delay_millisecods - delta_sum;
-            // go a step back, because the linked list supports only insert after
-            iterator = iterator->previous;
-            break;
-        }
-        else if (iterator->next == NULL) {
-            // end of list reached
-            break;
-        }
+    // assign key to the mutex
+    *id = handle;
 
+    return KERNEL_SUCCESS;
+}
 
-        iterator = iterator->next;
+/**
+ * @brief Creates a mutex using the immediate priority ceiling protocol.
+ *        The owner is raised to the ceiling priority on acquire and restored on release,
+ *        so the mutex is never contended and needs no waiting list or context switch.
+ * @param id is a pointer of size_t, which is used as a key for fast access.
+ * @param ceiling_priority is uint8_t of the highest priority of all tasks using the mutex
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CREATE_MUTEX: unable to create mutex due to subcomponents
+ *  The ceiling priority is compacted together with the task priorities by kernel_start.
+ *  A mutex created after kernel_start uses the compacted priorities of the running tasks.
+ *  The owner must not block while it holds a ceiling mutex.
+ */
+size_t kernel_mutex_create_ceiling(size_t *id, uint8_t ceiling_priority) {
+    if (ceiling_priority > TASK_MAX_PRIORITY) {
+        return KERNEL_UNABLE_TO_CREATE_MUTEX;
     }
 
-    // determine the delta time to delay the task
-    task->delta_time = delay_millisecods - delta_sum;
+    size_t status = kernel_mutex_create(id);
+    if (status != KERNEL_SUCCESS) {
+        return status;
+    }
 
-    // insert task in delayed task list at the corresponding position determined by the iteration
-    // a null iterator would mean to insert the element in the first position
-    status = linked_list_transfer_after(&g_delayed_tasks, &iterator, &g_priority_group_current, &g_linked_list_task_iterator);
-    if (status!=LINKED_LIST_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_DELAY_TASK);
+    mutex_t *mutex = NULL;
+    status = handle_table_get(&g_mutex_list, *id, (void **) &mutex);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
     }
 
-    kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+    status = mutex_set_ceiling(&mutex, ceiling_priority);
+    if (status != MUTEX_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_MUTEX);
+    }
 
     return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Tries to receive events until a previously set timeout was reached.
- * @param received_events is a size_t pointer, which will return the set events.
- * @return KERNEL_SUCCESS on success, KERNEL_UNABLE_TO_RECEIVE_EVENTS on timeout or unequal on error
+ * @brief Deletes an existing mutex
+ * @param id is a pointer of size_t, which is used as a key for fast access.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RECEIVE_EVENTS: unable to receive events due to timeout or subcomponents
- * @note Be aware of the difference of returns:
- *       KERNEL_UNABLE_TO_RECEIVE_EVENTS as return signifies a timeout,
- *       the same with concatenated subcomponents signifies an error!
- * */
-size_t kernel_event_receive_timeout(size_t *received_events) {
-    // shorten the variables
-    size_t task_wanted_events = g_running_task_current->event_register.wanted_events;
-    size_t task_received_events = g_running_task_current->event_register.received_events;
-    size_t status = KERNEL_UNABLE_TO_RECEIVE_EVENTS;
+ *  KERNEL_UNABLE_TO_DELETE_MUTEX: unable to delete mutex due to subcomponents or an owned mutex
+ * @note An owned mutex is not deleted, its owner might run with an inherited or a ceiling priority.
+ */
+size_t kernel_mutex_delete(size_t *id) {
+    mutex_t *mutex = NULL;
+    size_t status = handle_table_get(&g_mutex_list, *id, (void **) &mutex);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX);
+    }
 
     // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
-
+    kernel_enter_critical();
 
-    // abort loop if wanted events were set
-    task_received_events = g_running_task_current->event_register.received_events;
-    if ((task_wanted_events & task_received_events) == task_wanted_events) {
-
-        kernel_toggle_critical_section();
-        // ------------------- critical section end ----------------------------
-        status = KERNEL_SUCCESS;
+    // the owner would keep the priority passed on by the waiting tasks or the ceiling
+    if (mutex->owner != NULL) {
+        kernel_exit_critical();
+        return ERROR_INFO(MUTEX_OWNED_BY_OTHER_TASK, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX);
     }
-    else {
-
-        task_t *task = g_running_task_current;
-        size_t delay_milliseconds = task->event_register.timeout;
-        // insert in delayed task list
-        if (delay_milliseconds == 0) {
-            return KERNEL_UNABLE_TO_RECEIVE_EVENTS;
-        }
-
-        // checking for valid linked list
-        size_t status = linked_list_checking(&g_delayed_tasks);
-        if (status!=LINKED_LIST_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
-        }
-
-        // iterate over the delayed list and insert the task in the list by a delta
-        linked_list_element_t *iterator = g_delayed_tasks->tail;
-        size_t delta_sum = 0;
-        task_t *delayed_task = NULL;
-
-        // skip iteration if the list is still empty
-        while (iterator != NULL) {
-
-            // checking for valid task
-            delayed_task = (task_t *) iterator->data;
-            status = task_checking(&task);
-            if (status != TASK_SUCCESS) {
-                return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
-            }
-
-            // sum up the deltas to get the delayed time for each task
-            delta_sum += delayed_task->delta_time;
-
-            // check for abort conditions
-            if (delta_sum > delay_milliseconds) {
-                // task is inserted before an already delayed task
-                delta_sum -= delayed_task->delta_time;
-                // update the delta before insertion to update the total delay for the already delayed task
-                delayed_task->delta_time -= delay_milliseconds - delta_sum;
-                // go a step back, because the linked list supports only insert after
-                iterator = iterator->previous;
-                break;
-            }
-            else if (iterator->next == NULL) {
-                // end of list reached
-                break;
-            }
 
-            iterator = iterator->next;
-        }
-
-        // determine the delta time to delay the task
-        task->delta_time = delay_milliseconds - delta_sum;
+    // the released tasks look the mutex up again and find its key stale, the slot is reused by the next mutex
+    handle_table_release(&g_mutex_list, *id);
 
-        // insert task in delayed task list at the corresponding position determined by the iteration
-        // a null iterator would mean to insert the element in the first position
-        status = linked_list_transfer_after(&g_delayed_tasks, &iterator, &g_priority_group_current, &g_linked_list_task_iterator);
-        if (status!=LINKED_LIST_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+    // the tick handler unlinks timed out waiters from the same list
+    linked_list_t *waiting_task_list = mutex->binary_semaphore->task_waiting_list;
+    while (waiting_task_list->size > 0) {
+        task_t *task = TASK_FROM_LIST_ELEMENT(waiting_task_list->tail);
+        status = kernel_reinsert_task(&waiting_task_list, &waiting_task_list->tail, &task);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX);
         }
+    }
 
-        if (iterator == NULL) {
-            status = task_set_blocked_info(&g_running_task_current, &g_delayed_tasks, &g_delayed_tasks->tail);
-        }
-        else {
-            status = task_set_blocked_info(&g_running_task_current, &g_delayed_tasks, &iterator->next);
+    // a waiting task released before by the owner or by its timeout has not retried yet,
+    // no chain of owners must lead to the freed mutex
+    for (size_t task_id = 0; task_id < KERNEL_MAX_TASK; task_id++) {
+        task_t *task = NULL;
+        if (dictionary_get(&g_list_of_tasks, task_id, (void **) &task) == DICTIONARY_SUCCESS && task->blocked_mutex == mutex) {
+            task->blocked_mutex = NULL;
         }
-        if (status != TASK_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
-        }
-
-        kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
-        kernel_toggle_critical_section();
+    }
 
-        task_received_events = g_running_task_current->event_register.received_events;
-        if ((task_wanted_events & task_received_events) == task_wanted_events) {
-            status = KERNEL_SUCCESS;
-        }
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
 
-        kernel_toggle_critical_section();
-        // ------------------- critical section end ----------------------------
+    status = mutex_delete(&mutex);
+    if (status != MUTEX_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MUTEX);
     }
+    *id = HANDLE_TABLE_INVALID_HANDLE;
 
-    // provide set events
-    *received_events = task_received_events;
-
-    // delete received events
-    g_running_task_current->event_register.received_events &= ~g_running_task_current->event_register.wanted_events;
-    return status;
+    return KERNEL_SUCCESS;
 }
 
 /**
- * @brief Tries to receive events until the events are set.
- * @param received_events is a size_t pointer, which will return the set events.
+ * @brief Acquires a mutex to enter a critical section.
+ *        The task will try to acquire the mutex and will be blocked until it was successful.
+ * @param id is size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_RECEIVE_EVENTS: unable to receive events due to subcomponents
- * */
-size_t kernel_event_receive_blocking(size_t *received_events) {
+ *  KERNEL_UNABLE_TO_ACQUIRE_MUTEX: unable to acquire mutex due to subcomponents
+ */
+size_t kernel_mutex_acquire(size_t id) {
+    return kernel_mutex_acquire_timeout(id, KERNEL_WAIT_FOREVER);
+}
 
-    // shorten the variables
-    size_t task_wanted_events = g_running_task_current->event_register.wanted_events;
-    size_t task_received_events = g_running_task_current->event_register.received_events;
+/**
+ * @brief Acquires a mutex to enter a critical section.
+ *        The task will try to acquire the mutex and will be blocked until it was successful or the timeout elapsed.
+ *        On timeout the owners no longer inherit the priority of the task.
+ * @param id is size_t, which is used as a key for fast access.
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ACQUIRE_MUTEX: unable to acquire mutex due to subcomponents
+ */
+size_t kernel_mutex_acquire_timeout(size_t id, size_t timeout_milliseconds) {
+
+    // get the requested mutex by indexing the mutex handle table directly
+    mutex_t* mutex = g_mutex_list != NULL ? handle_table_lookup(g_mutex_list, id) : NULL;
+    if (mutex == NULL) {
+        size_t status = handle_table_get(&g_mutex_list, id, (void **) &mutex);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    }
 
-    // preconfigure error
     size_t status = KERNEL_SUCCESS;
-    while (true) {
+
+    // a ceiling mutex is never owned by another ready task and does not block
+    if (mutex->ceiling_priority != MUTEX_NO_CEILING) {
         // ------------------- critical section start -------------------------
-        kernel_toggle_critical_section();
+        kernel_enter_critical();
+        status = kernel_mutex_acquire_ceiling(&mutex);
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+        return status;
+    }
 
-        // abort loop if wanted events were set
-        task_received_events = g_running_task_current->event_register.received_events;
-        if ((task_wanted_events & task_received_events) == task_wanted_events) {
+    // an uncontended mutex is acquired by an atomic exchange without masking interrupts
+    task_t *task = g_running_task_current;
+    if (mutex_acquire_atomic(&mutex, &task) == MUTEX_SUCCESS) {
+        return KERNEL_SUCCESS;
+    }
 
-            kernel_toggle_critical_section();
-            // ------------------- critical section end ----------------------------
-            status = KERNEL_SUCCESS;
-            break;
+    // try to obtain a token from the mutex
+    size_t start = g_timer_wheel->now;
+    do {
+        // prevent other tasks of manipulating the mutex by blocking the context switch
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        // a task released by deleting the mutex does not find it anymore
+        mutex = handle_table_lookup(g_mutex_list, id);
+        if (mutex == NULL) {
+            kernel_exit_critical();
+            status = handle_table_get(&g_mutex_list, id, (void **) &mutex);
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
         }
 
-        // transfer to blocked list
-        status = linked_list_transfer(&g_blocked_tasks, &g_priority_group_current, &g_linked_list_task_iterator);
-        if (status!=LINKED_LIST_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+        // a task, whose timeout elapsed, gives up before it is inserted in the waiting list
+        size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+        if (ticks == 0 && mutex->owner != NULL && mutex->owner != g_running_task_current) {
+            // the owners drop the priority, which they inherited from the task
+            g_running_task_current->blocked_mutex = NULL;
+            status = kernel_withdraw_priority(&mutex);
+            kernel_exit_critical();
+            if (status != KERNEL_SUCCESS) {
+                return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+            }
+            return KERNEL_TIMEOUT;
         }
 
-        // set info, where the task was inserted
-        status = task_set_blocked_info(&g_running_task_current, &g_blocked_tasks, &g_blocked_tasks->head);
-        if (status != TASK_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+        status = mutex_acquire(&mutex, &g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+
+        if (status == MUTEX_SUCCESS) {
+            g_running_task_current->blocked_mutex = NULL;
+            // acquired semaphore and semaphore will not be modified
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            break;
         }
+        else if (status == MUTEX_OWNED_BY_OTHER_TASK) {
+            // task was inserted in the mutexes binary semaphore waiting list
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+
+            // the owner and the owners it waits for run with the priority of the blocked task
+            g_running_task_current->blocked_mutex = mutex;
+            size_t inherit_status = kernel_inherit_priority(&mutex, g_running_task_current->task_data->u8TaskPrio);
+            if (inherit_status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(inherit_status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+            }
 
-        kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
-    }
+            // the task is released by the owner or by its timeout
+            size_t timeout_status = kernel_start_timeout(&mutex->binary_semaphore->task_waiting_list, ticks, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+            if (timeout_status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return timeout_status;
+            }
 
-    // provide set events
-    *received_events = task_received_events;
+            // a boosted owner might have joined the priority group of the blocked task,
+            // so the next task is determined by the highest ready priority group
+            g_running_task_next = NULL;
+            kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+        }
+        else {
+            // error happened with the mutex
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+        }
+    } while (status == MUTEX_OWNED_BY_OTHER_TASK);
 
-    // delete received events
-    g_running_task_current->event_register.received_events &= ~g_running_task_current->event_register.wanted_events;
-    return status;
+    return KERNEL_SUCCESS;
 }
 
 
 /**
- * @brief Send events to tasks.
- * @param task_id is size_t to the receiving task
- * @param event is size_t with events to set at the corresponding task
+ * @brief Releases a mutex to exit a critical section.
+ *        On every release a task will be moved to its corresponding priority group
+ * @param id is size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_SEND_EVENTS: unable to send events due to subcomponents
- * */
-size_t kernel_event_send(size_t task_id, size_t event) {
+ *  KERNEL_UNABLE_TO_RELEASE_MUTEX: unable to release mutex due to subcomponents
+ */
+size_t kernel_mutex_release(size_t id) {
+    // get the requested mutex by indexing the mutex handle table directly
+    mutex_t* mutex = g_mutex_list != NULL ? handle_table_lookup(g_mutex_list, id) : NULL;
+    if (mutex == NULL) {
+        size_t status = handle_table_get(&g_mutex_list, id, (void **) &mutex);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
+    }
 
-    // ------------------- critical section start -------------------------
-    kernel_toggle_critical_section();
+    size_t status = KERNEL_SUCCESS;
 
-    // obtain task were an event should be set
-    task_t *task = NULL;
-    size_t status = dictionary_get(&g_list_of_tasks, task_id, (void *) &task);
-    if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_EVENTS);
+    // a ceiling mutex has no waiting tasks
+    if (mutex->ceiling_priority != MUTEX_NO_CEILING) {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+        status = kernel_mutex_release_ceiling(&mutex);
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+        return status;
     }
 
-    // shorten event variables and notification condition
-    size_t wanted_events = task->event_register.wanted_events;
-    size_t received_event = task->event_register.received_events;
-    void (*notification_conditions)(size_t *, size_t) = task->event_register.notification_conditions;
-    // preset received event in order to allow to reset them by the notification condition
-    received_event |= event;
+    task_t* owner = g_running_task_current;
+    task_t* task = owner;
+    linked_list_element_t* element = NULL;
+    bool released = false;
+
+    if (owner->task_data->u8TaskPrio == owner->base_priority) {
+        // an owner without inherited priority releases by an atomic exchange without masking interrupts
+        bool task_waiting = false;
+        status = mutex_release_atomic(&mutex, &task, &task_waiting);
+        if (status != MUTEX_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
+        }
+        if (!task_waiting) {
+            return KERNEL_SUCCESS;
+        }
 
-    if (notification_conditions!=NULL) {
-        // allow to modify the received event
-        notification_conditions(&received_event, wanted_events);
+        // a waiting task might have passed its priority on in the meantime
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+        released = true;
+        status = semaphore_get_waiting_task(&mutex->binary_semaphore, &element, &task);
+        if (status != SEMAPHORE_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
+        }
     }
+    else {
+        // prevent other tasks of manipulating the mutex by blocking the context switch
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
 
-    // update received event
-    task->event_register.received_events |= received_event;
-
-    // check if the addressed task can be reinserted
-    if ((received_event & wanted_events) == wanted_events) {
-        // check if addressed task was inserted in a blocked list or in a delayed task list
-        if (task->blocked_timeout_list == g_blocked_tasks) {
-            kernel_reinsert_task(&task->blocked_timeout_list, &task->blocked_timeout_list_element, &task);
+        // release the mutex and check, if a task can be moved from the waiting list to the corresponding priority group
+        status = mutex_release(&mutex, &element, &task);
+        if (status != MUTEX_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
         }
-        else if (task->blocked_timeout_list == g_delayed_tasks) {
-            // resume addressed task before timeout elapsed
-            // check for a delayed task and update its delta time
-            linked_list_element_t *next_delayed_task_element = task->blocked_timeout_list_element->next;
-            if (next_delayed_task_element != NULL) {
-                task_t *next_delayed_task = (task_t *) next_delayed_task_element->data;
-                status = task_checking(&task);
-                if (status!=TASK_SUCCESS) {
-                    return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_EVENTS);
-                }
-                // update delta time
-                next_delayed_task->delta_time += task->delta_time;
-                task->delta_time = 0;
-            }
+        released = mutex->owner == NULL;
+    }
 
-            kernel_reinsert_task(&task->blocked_timeout_list, &task->blocked_timeout_list_element, &task);
+    // the owner drops the priority inherited by this mutex, before a waiting task is reinserted
+    if (released) {
+        status = kernel_restore_priority(&owner);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
         }
+    }
 
-        // addressed task is no longer inserted in a delayed task list or blocked list
-        task->blocked_timeout_list = NULL;
-        task->blocked_timeout_list_element = NULL;
+    // a recursive release keeps the mutex and does not supply a waiting task
+    if (task!=NULL && element!=NULL) {
+        status = kernel_reinsert_task(&mutex->binary_semaphore->task_waiting_list, &element, &task);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return status;
+        }
     }
 
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
 
-    kernel_toggle_critical_section();
-    // ------------------- critical section end -------------------------
 
     return KERNEL_SUCCESS;
-}
 
+}
 
 /**
- * @brief It will force to start a next task.
+ * @brief Acquires a mutex to enter a critical section.
+ *        The task will try to acquire the mutex and returns, even if unsuccessful.
+ * @param id is size_t, which is used as a key for fast access.
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
- * @info It inherits error codes from kernel_start_task.
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ACQUIRE_MUTEX: unable to acquire mutex due to subcomponents
  */
-size_t kernel_exit_to_scheduler(void) {
-
-    size_t status = KERNEL_SUCCESS;
-    task_t *task = g_running_task_current;
+size_t kernel_mutex_acquire_non_blocking(size_t id) {
 
-    kernel_toggle_critical_section();
+    // prevent other tasks of manipulating the mutex by blocking the context switch
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // get the requested mutex by the id from the mutex handle table
+    mutex_t* mutex = NULL;
+    size_t status = handle_table_get(&g_mutex_list, id, (void **) &mutex);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    }
+
+    // a ceiling mutex does not block anyway
+    if (mutex->ceiling_priority != MUTEX_NO_CEILING) {
+        status = kernel_mutex_acquire_ceiling(&mutex);
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+        return status;
+    }
+
+    // try to obtain a token from the mutex
+    status = mutex_acquire_non_blocking(&mutex, &g_running_task_current);
+
+    // acquired mutex and mutex will not be modified
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status != MUTEX_SUCCESS) {
+        // error happened with the semaphore
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+
+/**
+ * @brief Release a mutex to exit a critical section.
+ *        Does not manage the waiting list or blocked tasks.
+ * @param id is size_t, which is used as a key for fast access.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RELEASE_MUTEX: unable to release mutex due to subcomponents
+ */
+size_t kernel_mutex_release_non_blocking(size_t id) {
+    // prevent other tasks of manipulating the mutex by blocking the context switch
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // get the requested mutex by the id from the mutex handle table
+    mutex_t* mutex = NULL;
+    size_t status = handle_table_get(&g_mutex_list, id, (void **) &mutex);
+    if (status != HANDLE_TABLE_SUCCESS){
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    }
+
+    if (mutex->ceiling_priority != MUTEX_NO_CEILING) {
+        status = kernel_mutex_release_ceiling(&mutex);
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+        return status;
+    }
+
+    // release the mutex and check, if a task can be moved from the waiting list to the corresponding priority group
+    task_t *owner = g_running_task_current;
+    status = mutex_release_non_blocking(&mutex, &owner);
+
+    // the owner drops the priority inherited by this mutex
+    size_t restore_status = KERNEL_SUCCESS;
+    if (status == MUTEX_SUCCESS && mutex->owner == NULL) {
+        restore_status = kernel_restore_priority(&owner);
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status != MUTEX_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    }
+
+    return restore_status;
+}
+
+/**
+ * @brief Creates a queue set, which lets a single task wait on several message queues and semaphores.
+ *        In static allocation mode the ready queue has to be supplied with kernel_queue_set_create_static.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param size is the amount of entries, which has to cover the size of every member queue and the tokens of every member semaphore
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_QUEUE_SET: unable to add queue set due to subcomponents
+ */
+size_t kernel_queue_set_create(size_t *id, size_t size) {
+    // reserve the key, a full handle table limits the amount of queue sets
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_queue_set_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_QUEUE_SET);
+    }
+
+    queue_set_t *queue_set = NULL;
+    status = queue_set_create(&queue_set, handle, size);
+    if (status != QUEUE_SET_SUCCESS) {
+        handle_table_release(&g_queue_set_list, handle);
+        return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_QUEUE_SET);
+    }
+
+    return kernel_queue_set_register(id, &queue_set);
+}
+
+/**
+ * @brief Creates a queue set in caller supplied storage, which is never released.
+ *        In static allocation mode queue sets can only be created this way.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param size is the amount of entries, which has to cover the size of every member queue and the tokens of every member semaphore
+ * @param storage is a pointer to the memory of the queue set, which must outlive it
+ * @param data is an array of size entries
+ * @param buffer is an array of size members
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_QUEUE_SET: unable to add queue set due to subcomponents
+ */
+size_t kernel_queue_set_create_static(size_t *id, size_t size, queue_set_static_t *storage, void **data, queue_set_member_t *buffer) {
+    // reserve the key, a full handle table limits the amount of queue sets
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_queue_set_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_QUEUE_SET);
+    }
+
+    queue_set_t *queue_set = NULL;
+    status = queue_set_create_static(&queue_set, storage, data, buffer, handle, size);
+    if (status != QUEUE_SET_SUCCESS) {
+        handle_table_release(&g_queue_set_list, handle);
+        return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_QUEUE_SET);
+    }
+
+    return kernel_queue_set_register(id, &queue_set);
+}
+
+/**
+ * @brief Deletes a queue set, its waiting tasks are released and its members are detached.
+ * @param id is a pointer of size_t, which is used as a key for fast access
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_QUEUE_SET: unable to delete queue set due to subcomponents
+ */
+size_t kernel_queue_set_delete(size_t *id) {
+    queue_set_t *queue_set = NULL;
+    size_t status = handle_table_get(&g_queue_set_list, *id, (void **) &queue_set);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_QUEUE_SET);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // the members do not know their queue set anymore, deleting is rare and may visit every object
+    for (size_t index = 0; index < g_message_queue_list->size; index++) {
+        message_queue_t *message_queue = g_message_queue_list->slots[index].value;
+        if (message_queue != NULL && message_queue->queue_set == queue_set) {
+            message_queue->queue_set = NULL;
+        }
+    }
+    for (size_t index = 0; index < g_semaphore_list->size; index++) {
+        semaphore_t *semaphore = g_semaphore_list->slots[index].value;
+        if (semaphore != NULL && semaphore->queue_set == queue_set) {
+            semaphore->queue_set = NULL;
+        }
+    }
+
+    // the released tasks fail on their next select
+    linked_list_t *waiting_task_list = queue_set->waiting_task_list;
+    while (waiting_task_list->size > 0) {
+        task_t *task = TASK_FROM_LIST_ELEMENT(waiting_task_list->tail);
+        status = kernel_reinsert_task(&waiting_task_list, &waiting_task_list->tail, &task);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_QUEUE_SET);
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    status = queue_set_delete(&queue_set);
+    if (status != QUEUE_SET_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_QUEUE_SET);
+    }
+
+    // the key must not find the released queue set anymore
+    handle_table_release(&g_queue_set_list, *id);
+    *id = HANDLE_TABLE_INVALID_HANDLE;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Adds a message queue to a queue set. The queue set announces every message, which is queued afterwards
+ *        and which was queued already. A message handed to a receiver blocked on the message queue is not announced.
+ * @param id is size_t, which is used as a key for fast access
+ * @param message_queue_identifier is a message_queue_identifier_t pointer of pointer, which is being used as a key to the message queue
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_MEMBER: unable to add the member due to subcomponents, e.g. it is a member already or the queue set is too small
+ */
+size_t kernel_queue_set_add_message_queue(size_t id, message_queue_identifier_t **message_queue_identifier) {
+    size_t status = message_queue_identifier_checking(message_queue_identifier);
+    if (status != MESSAGE_QUEUE_IDENTIFIER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MESSAGE_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+
+    queue_set_t *queue_set = NULL;
+    status = handle_table_get(&g_queue_set_list, id, (void **) &queue_set);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+
+    message_queue_t *message_queue = NULL;
+    status = handle_table_get(&g_message_queue_list, (*message_queue_identifier)->id, (void **) &message_queue);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    if (message_queue->queue_set != NULL) {
+        kernel_exit_critical();
+        return KERNEL_UNABLE_TO_ADD_MEMBER;
+    }
+
+    // every message the queue can hold has an entry in the queue set
+    status = queue_set_reserve(&queue_set, message_queue->qcb->size);
+    if (status != QUEUE_SET_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+    message_queue->queue_set = queue_set;
+
+    for (size_t message = 0; message < message_queue->qcb->length; message++) {
+        status = kernel_queue_set_post(&queue_set, QUEUE_SET_MESSAGE_QUEUE, (*message_queue_identifier)->id);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Adds a semaphore to a queue set. The queue set announces every token, which is released afterwards
+ *        and which is available already. A token taken by a task blocked on the semaphore is not announced.
+ * @param id is size_t, which is used as a key for fast access
+ * @param semaphore_id is size_t, which is the key of the semaphore
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_MEMBER: unable to add the member due to subcomponents, e.g. it is a member already or the queue set is too small
+ */
+size_t kernel_queue_set_add_semaphore(size_t id, size_t semaphore_id) {
+    queue_set_t *queue_set = NULL;
+    size_t status = handle_table_get(&g_queue_set_list, id, (void **) &queue_set);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+
+    semaphore_t *semaphore = NULL;
+    status = handle_table_get(&g_semaphore_list, semaphore_id, (void **) &semaphore);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    if (semaphore->queue_set != NULL) {
+        kernel_exit_critical();
+        return KERNEL_UNABLE_TO_ADD_MEMBER;
+    }
+
+    // every token the semaphore can hold has an entry in the queue set
+    status = queue_set_reserve(&queue_set, semaphore->max_token);
+    if (status != QUEUE_SET_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+    }
+    semaphore->queue_set = queue_set;
+
+    for (size_t token = 0; token < semaphore->token; token++) {
+        status = kernel_queue_set_post(&queue_set, QUEUE_SET_SEMAPHORE, semaphore_id);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMBER);
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Waits until a member of a queue set is ready and returns the member, which became ready first.
+ *        The costs do not depend on the amount of members. The message or token of the member has to be taken
+ *        afterwards by kernel_message_queue_receive_timeout or kernel_semaphore_acquire_timeout with a timeout of 0.
+ * @param id is size_t, which is used as a key for fast access
+ * @param member is a queue_set_member_t pointer, which receives the type and the id of the ready member
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SELECT: unable to wait for a member due to subcomponents
+ * @note Members should only be read after they were selected, otherwise a selected member might be empty already.
+ */
+size_t kernel_queue_set_select(size_t id, queue_set_member_t *member, size_t timeout_milliseconds) {
+    queue_set_t *queue_set = NULL;
+    size_t status = handle_table_get(&g_queue_set_list, id, (void **) &queue_set);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_SELECT);
+    }
+
+    size_t start = g_timer_wheel->now;
+    do {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        status = queue_set_read(&queue_set, member);
+        if (status == QUEUE_SET_SUCCESS) {
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            break;
+        }
+        else if (status == QUEUE_SET_NO_MEMBER) {
+            size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+            if (ticks == 0) {
+                kernel_exit_critical();
+                return KERNEL_TIMEOUT;
+            }
+
+            // wait for the next ready member, the task leaves the critical section on the switch
+            status = queue_set_wait(&queue_set, &g_priority_group_current, &g_linked_list_task_iterator);
+            if (status != QUEUE_SET_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_SELECT);
+            }
+
+            status = kernel_start_timeout(&queue_set->waiting_task_list, ticks, KERNEL_UNABLE_TO_SELECT);
+            if (status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return status;
+            }
+
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+            kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+            status = QUEUE_SET_NO_MEMBER;
+        }
+        else {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_SELECT);
+        }
+    } while (status == QUEUE_SET_NO_MEMBER);
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Creates an event group, whose event bits are shared by several tasks.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_EVENT_GROUP: unable to add event group due to subcomponents
+ */
+size_t kernel_event_group_create(size_t *id) {
+    // reserve the key, a full handle table limits the amount of event groups
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_event_group_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_EVENT_GROUP);
+    }
+
+    event_group_t *event_group = NULL;
+    status = event_group_create(&event_group, handle);
+    if (status != EVENT_GROUP_SUCCESS) {
+        handle_table_release(&g_event_group_list, handle);
+        return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_EVENT_GROUP);
+    }
+
+    // add created event group to the handle table for fast access
+    status = handle_table_set(&g_event_group_list, handle, event_group);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        event_group_delete(&event_group);
+        handle_table_release(&g_event_group_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_EVENT_GROUP);
+    }
+
+    // assign key to the event group
+    *id = handle;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Deletes an event group, its waiting tasks are released and fail their wait.
+ * @param id is a pointer of size_t, which is used as a key for fast access
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_EVENT_GROUP: unable to delete event group due to subcomponents
+ */
+size_t kernel_event_group_delete(size_t *id) {
+    event_group_t *event_group = NULL;
+    size_t status = handle_table_get(&g_event_group_list, *id, (void **) &event_group);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_EVENT_GROUP);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // the released tasks look the event group up again and find its key stale
+    handle_table_release(&g_event_group_list, *id);
+
+    linked_list_t *waiting_task_list = event_group->waiting_task_list;
+    while (waiting_task_list->size > 0) {
+        task_t *task = TASK_FROM_LIST_ELEMENT(waiting_task_list->tail);
+        status = kernel_reinsert_task(&waiting_task_list, &waiting_task_list->tail, &task);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_EVENT_GROUP);
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    status = event_group_delete(&event_group);
+    if (status != EVENT_GROUP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_EVENT_GROUP);
+    }
+    *id = HANDLE_TABLE_INVALID_HANDLE;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Sets event bits and wakes every waiter, whose wait condition is satisfied, in a single critical section.
+ *        All released waiters receive the same event bits, the bits they clear on exit are cleared afterwards.
+ * @param id is size_t, which is used as a key for fast access
+ * @param events are the bits to set
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SET_EVENT_GROUP: unable to set event bits due to subcomponents
+ */
+size_t kernel_event_group_set(size_t id, size_t events) {
+    event_group_t *event_group = NULL;
+    size_t status = handle_table_get(&g_event_group_list, id, (void **) &event_group);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    status = event_group_set(&event_group, events);
+    if (status != EVENT_GROUP_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+    }
+
+    // visit the waiters from the longest waiting one, a released waiter leaves the list
+    size_t clear_events = 0;
+    linked_list_element_t *element = event_group->waiting_task_list->tail;
+    while (element != NULL) {
+        linked_list_element_t *next = element->next;
+        task_t *task = TASK_FROM_LIST_ELEMENT(element);
+
+        status = event_group_release(&event_group, &task->event_group_wait, &clear_events);
+        if (status == EVENT_GROUP_SUCCESS) {
+            status = kernel_reinsert_task(&event_group->waiting_task_list, &element, &task);
+            if (status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+            }
+        }
+        else if (status != EVENT_GROUP_NOT_SATISFIED) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+        }
+
+        element = next;
+    }
+
+    status = event_group_clear(&event_group, clear_events);
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status != EVENT_GROUP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Sets event bits from an interrupt service routine, it never blocks.
+ * @param id is size_t, which is used as a key for fast access
+ * @param events are the bits to set
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SET_EVENT_GROUP: unable to set event bits due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
+ */
+size_t kernel_event_group_set_from_isr(size_t id, size_t events, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_event_group_set(id, events);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
+
+/**
+ * @brief Clears event bits, waiting tasks are not affected.
+ * @param id is size_t, which is used as a key for fast access
+ * @param events are the bits to clear
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SET_EVENT_GROUP: unable to clear event bits due to subcomponents
+ */
+size_t kernel_event_group_clear(size_t id, size_t events) {
+    event_group_t *event_group = NULL;
+    size_t status = handle_table_get(&g_event_group_list, id, (void **) &event_group);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    status = event_group_clear(&event_group, events);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status != EVENT_GROUP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_SET_EVENT_GROUP);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Gets the set event bits of an event group.
+ * @param id is size_t, which is used as a key for fast access
+ * @param events is a size_t pointer, which receives the set event bits
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP: unable to get event bits due to subcomponents
+ */
+size_t kernel_event_group_get(size_t id, size_t *events) {
+    event_group_t *event_group = NULL;
+    size_t status = handle_table_get(&g_event_group_list, id, (void **) &event_group);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP);
+    }
+
+    *events = event_group->events;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Waits until any or all wanted event bits of an event group are set or the timeout elapsed.
+ * @param id is size_t, which is used as a key for fast access
+ * @param wanted_events are the bits to wait for, at least one bit is required
+ * @param wait_all is a bool, if set to true, all wanted bits have to be set, otherwise any of them
+ * @param clear_on_exit is a bool, if set to true, the wanted bits are cleared, when the wait is satisfied
+ * @param received_events is a size_t pointer, which receives the event bits, which satisfied the wait,
+ *        or the set event bits on a timeout
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP: unable to wait for event bits due to subcomponents, e.g. the event group was deleted
+ */
+size_t kernel_event_group_wait(size_t id, size_t wanted_events, bool wait_all, bool clear_on_exit, size_t *received_events, size_t timeout_milliseconds) {
+
+    // the wait condition is evaluated by the setter, while the task is waiting
+    task_t *task = g_running_task_current;
+    task->event_group_wait.wanted_events = wanted_events;
+    task->event_group_wait.received_events = 0;
+    task->event_group_wait.wait_all = wait_all;
+    task->event_group_wait.clear_on_exit = clear_on_exit;
+
+    size_t start = g_timer_wheel->now;
+    size_t status = EVENT_GROUP_NOT_SATISFIED;
+    do {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        // a deleted event group is not found anymore
+        event_group_t *event_group = handle_table_lookup(g_event_group_list, id);
+        if (event_group == NULL) {
+            kernel_exit_critical();
+            status = handle_table_get(&g_event_group_list, id, (void **) &event_group);
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP);
+        }
+
+        // a setter satisfied the wait condition and cleared the bits already
+        if (task->event_group_wait.received_events != 0) {
+            kernel_exit_critical();
+            break;
+        }
+
+        status = event_group_try(&event_group, &task->event_group_wait);
+        if (status == EVENT_GROUP_SUCCESS) {
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            break;
+        }
+        else if (status == EVENT_GROUP_NOT_SATISFIED) {
+            size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+            if (ticks == 0) {
+                *received_events = event_group->events;
+                kernel_exit_critical();
+                return KERNEL_TIMEOUT;
+            }
+
+            // task is released by a setter or its timeout
+            status = event_group_wait(&event_group, &g_priority_group_current, &g_linked_list_task_iterator);
+            if (status != EVENT_GROUP_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP);
+            }
+
+            status = kernel_start_timeout(&event_group->waiting_task_list, ticks, KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP);
+            if (status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return status;
+            }
+
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+            kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+            status = EVENT_GROUP_NOT_SATISFIED;
+        }
+        else {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_EVENT_GROUP_ERROR_REGISTER, KERNEL_UNABLE_TO_WAIT_FOR_EVENT_GROUP);
+        }
+    } while (status == EVENT_GROUP_NOT_SATISFIED);
+
+    *received_events = task->event_group_wait.received_events;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Creates a stream buffer, which stores bytes in a single ring. In message mode every write stores
+ *        a message of variable size, which is read as a whole. In static allocation mode the ring has to be
+ *        supplied with kernel_stream_buffer_create_static.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param size is the capacity of the ring in bytes, every message additionally takes STREAM_BUFFER_MESSAGE_HEADER_SIZE bytes
+ * @param trigger_level is the amount of stored bytes, which wakes up a receiver, it is ignored for messages
+ * @param message_mode is a bool, if set to true, the stream buffer is a message buffer
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_STREAM_BUFFER: unable to add stream buffer due to subcomponents
+ */
+size_t kernel_stream_buffer_create(size_t *id, size_t size, size_t trigger_level, bool message_mode) {
+    // reserve the key, a full handle table limits the amount of stream buffers
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_stream_buffer_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_STREAM_BUFFER);
+    }
+
+    stream_buffer_t *stream_buffer = NULL;
+    status = stream_buffer_create(&stream_buffer, handle, size, trigger_level, message_mode);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        handle_table_release(&g_stream_buffer_list, handle);
+        return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_STREAM_BUFFER);
+    }
+
+    return kernel_stream_buffer_register(id, &stream_buffer);
+}
+
+/**
+ * @brief Creates a stream buffer in caller supplied storage, which is never released.
+ *        In static allocation mode stream buffers can only be created this way.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param size is the capacity of the ring in bytes, every message additionally takes STREAM_BUFFER_MESSAGE_HEADER_SIZE bytes
+ * @param trigger_level is the amount of stored bytes, which wakes up a receiver, it is ignored for messages
+ * @param message_mode is a bool, if set to true, the stream buffer is a message buffer
+ * @param storage is a pointer to the memory of the stream buffer, which must outlive it
+ * @param buffer is continuous memory of size bytes
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_STREAM_BUFFER: unable to add stream buffer due to subcomponents
+ */
+size_t kernel_stream_buffer_create_static(size_t *id, size_t size, size_t trigger_level, bool message_mode, stream_buffer_static_t *storage, uint8_t *buffer) {
+    // reserve the key, a full handle table limits the amount of stream buffers
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_stream_buffer_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_STREAM_BUFFER);
+    }
+
+    stream_buffer_t *stream_buffer = NULL;
+    status = stream_buffer_create_static(&stream_buffer, storage, buffer, handle, size, trigger_level, message_mode);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        handle_table_release(&g_stream_buffer_list, handle);
+        return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_STREAM_BUFFER);
+    }
+
+    return kernel_stream_buffer_register(id, &stream_buffer);
+}
+
+/**
+ * @brief Deletes a stream buffer, its waiting tasks are released and fail their read or write.
+ * @param id is a pointer of size_t, which is used as a key for fast access
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER: unable to delete stream buffer due to subcomponents
+ */
+size_t kernel_stream_buffer_delete(size_t *id) {
+    stream_buffer_t *stream_buffer = NULL;
+    size_t status = handle_table_get(&g_stream_buffer_list, *id, (void **) &stream_buffer);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // the released tasks look the stream buffer up again and find its key stale
+    handle_table_release(&g_stream_buffer_list, *id);
+
+    while (stream_buffer->receiving_task_list->size > 0 || stream_buffer->sending_task_list->size > 0) {
+        status = kernel_stream_buffer_wake(&stream_buffer->receiving_task_list);
+        status |= kernel_stream_buffer_wake(&stream_buffer->sending_task_list);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER);
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    status = stream_buffer_delete(&stream_buffer);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_STREAM_BUFFER);
+    }
+    *id = HANDLE_TABLE_INVALID_HANDLE;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Writes bytes or a message into a stream buffer. A stream takes the bytes in chunks as space becomes free,
+ *        a message is written as a whole. The writer waits up to the timeout for free space.
+ * @param id is size_t, which is used as a key for fast access
+ * @param data is the memory to copy from
+ * @param length is the amount of bytes to write
+ * @param written is a size_t pointer, which receives the amount of written bytes, also on a timeout
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WRITE_STREAM: unable to write due to subcomponents, e.g. the message exceeds the ring
+ */
+size_t kernel_stream_buffer_write(size_t id, const void *data, size_t length, size_t *written, size_t timeout_milliseconds) {
+
+    *written = 0;
+    const uint8_t *bytes = (const uint8_t *) data;
+    size_t start = g_timer_wheel->now;
+    size_t status = STREAM_BUFFER_FULL;
+    do {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        // a deleted stream buffer is not found anymore
+        stream_buffer_t *stream_buffer = handle_table_lookup(g_stream_buffer_list, id);
+        if (stream_buffer == NULL) {
+            kernel_exit_critical();
+            status = handle_table_get(&g_stream_buffer_list, id, (void **) &stream_buffer);
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_WRITE_STREAM);
+        }
+
+        size_t chunk = 0;
+        status = stream_buffer_write(&stream_buffer, &bytes[*written], length - *written, &chunk);
+        if (status == STREAM_BUFFER_SUCCESS) {
+            *written += chunk;
+
+            // the receiver is woken up once the trigger level is reached
+            if (stream_buffer_is_readable(&stream_buffer)) {
+                status = kernel_stream_buffer_wake(&stream_buffer->receiving_task_list);
+                if (status != KERNEL_SUCCESS) {
+                    kernel_exit_critical();
+                    return status;
+                }
+            }
+
+            if (*written == length) {
+                kernel_exit_critical();
+                // ------------------- critical section end ----------------------------
+                break;
+            }
+            status = STREAM_BUFFER_FULL;
+        }
+
+        if (status == STREAM_BUFFER_FULL) {
+            size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+            if (ticks == 0) {
+                kernel_exit_critical();
+                return KERNEL_TIMEOUT;
+            }
+
+            // task is released by a reader or its timeout
+            status = stream_buffer_wait(&stream_buffer, &stream_buffer->sending_task_list, &g_priority_group_current, &g_linked_list_task_iterator);
+            if (status != STREAM_BUFFER_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_WRITE_STREAM);
+            }
+
+            status = kernel_start_timeout(&stream_buffer->sending_task_list, ticks, KERNEL_UNABLE_TO_WRITE_STREAM);
+            if (status != KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return status;
+            }
+
+            kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+            kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+            status = STREAM_BUFFER_FULL;
+        }
+        else {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_WRITE_STREAM);
+        }
+    } while (status == STREAM_BUFFER_FULL);
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Writes bytes or a message from an interrupt service routine, it never blocks.
+ *        A stream takes as many bytes as fit, a message is written as a whole or not at all.
+ * @param id is size_t, which is used as a key for fast access
+ * @param data is the memory to copy from
+ * @param length is the amount of bytes to write
+ * @param written is a size_t pointer, which receives the amount of written bytes
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT if not all bytes fit or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WRITE_STREAM: unable to write due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
+ */
+size_t kernel_stream_buffer_write_from_isr(size_t id, const void *data, size_t length, size_t *written, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_stream_buffer_write(id, data, length, written, 0);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
+
+/**
+ * @brief Reads bytes or a message from a stream buffer. A stream returns the stored bytes up to max_length,
+ *        once the trigger level is reached or the timeout elapsed with fewer bytes stored. A message is read as a whole.
+ * @param id is size_t, which is used as a key for fast access
+ * @param data is the memory to copy to
+ * @param max_length is the size of data in bytes
+ * @param read is a size_t pointer, which receives the amount of read bytes
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout without any byte or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_READ_STREAM: unable to read due to subcomponents, e.g. the next message exceeds max_length
+ */
+size_t kernel_stream_buffer_read(size_t id, void *data, size_t max_length, size_t *read, size_t timeout_milliseconds) {
+
+    *read = 0;
+    size_t start = g_timer_wheel->now;
+    size_t status = STREAM_BUFFER_EMPTY;
+    do {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        // a deleted stream buffer is not found anymore
+        stream_buffer_t *stream_buffer = handle_table_lookup(g_stream_buffer_list, id);
+        if (stream_buffer == NULL) {
+            kernel_exit_critical();
+            status = handle_table_get(&g_stream_buffer_list, id, (void **) &stream_buffer);
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_READ_STREAM);
+        }
+
+        // below the trigger level the stored bytes are only taken, when the timeout elapsed
+        size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+        if (stream_buffer_is_readable(&stream_buffer) || (ticks == 0 && stream_buffer->length > 0)) {
+            status = stream_buffer_read(&stream_buffer, data, max_length, read);
+            if (status != STREAM_BUFFER_SUCCESS) {
+                kernel_exit_critical();
+                return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_READ_STREAM);
+            }
+
+            // a writer retries with the freed space
+            status = kernel_stream_buffer_wake(&stream_buffer->sending_task_list);
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            break;
+        }
+
+        if (ticks == 0) {
+            kernel_exit_critical();
+            return KERNEL_TIMEOUT;
+        }
+
+        // task is released by a writer reaching the trigger level or its timeout
+        status = stream_buffer_wait(&stream_buffer, &stream_buffer->receiving_task_list, &g_priority_group_current, &g_linked_list_task_iterator);
+        if (status != STREAM_BUFFER_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_READ_STREAM);
+        }
+
+        status = kernel_start_timeout(&stream_buffer->receiving_task_list, ticks, KERNEL_UNABLE_TO_READ_STREAM);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return status;
+        }
+
+        kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+        kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+        status = STREAM_BUFFER_EMPTY;
+    } while (status == STREAM_BUFFER_EMPTY);
+
+    return status;
+}
+
+/**
+ * @brief Creates a memory pool of fixed-size blocks over caller supplied storage. Blocks are allocated and freed
+ *        in constant time through a free list embedded in the returned blocks, which never fragments.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param block_size is the usable size of a single block in bytes, it is rounded up to 8 bytes
+ * @param count is the amount of blocks
+ * @param storage is continuous 8 byte aligned memory of MEMPOOL_STORAGE_SIZE(block_size, count) bytes, which must outlive the memory pool
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_MEMPOOL: unable to add memory pool due to subcomponents
+ */
+size_t kernel_mempool_create(size_t *id, size_t block_size, size_t count, void *storage) {
+    // reserve the key, a full handle table limits the amount of memory pools
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    size_t status = handle_table_reserve(&g_mempool_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMPOOL);
+    }
+
+    mempool_t *mempool = NULL;
+    status = mempool_create(&mempool, handle, storage, block_size, count);
+    if (status != MEMPOOL_SUCCESS) {
+        handle_table_release(&g_mempool_list, handle);
+        return ERROR_INFO(status, KERNEL_MEMPOOL_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMPOOL);
+    }
+
+    // add created memory pool to the handle table for fast access
+    status = handle_table_set(&g_mempool_list, handle, mempool);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        mempool_delete(&mempool);
+        handle_table_release(&g_mempool_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MEMPOOL);
+    }
+
+    // assign key to the memory pool
+    *id = handle;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Deletes a memory pool, its waiting tasks are released and fail their allocation.
+ *        The storage of the blocks stays with the caller.
+ * @param id is a pointer of size_t, which is used as a key for fast access
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_MEMPOOL: unable to delete memory pool due to subcomponents
+ */
+size_t kernel_mempool_delete(size_t *id) {
+    mempool_t *mempool = NULL;
+    size_t status = handle_table_get(&g_mempool_list, *id, (void **) &mempool);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MEMPOOL);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // the released tasks look the memory pool up again and find its key stale
+    handle_table_release(&g_mempool_list, *id);
+
+    while (mempool->waiting_task_list->size > 0) {
+        status = kernel_mempool_wake(&mempool);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MEMPOOL);
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    status = mempool_delete(&mempool);
+    if (status != MEMPOOL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MEMPOOL_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_MEMPOOL);
+    }
+    *id = HANDLE_TABLE_INVALID_HANDLE;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Takes a block from a memory pool in constant time. If all blocks are allocated, the task waits
+ *        up to the timeout for a returned block. Every allocation without a block counts as a failure.
+ * @param id is size_t, which is used as a key for fast access
+ * @param block is a pointer of pointer, which receives the block or NULL on a timeout
+ * @param timeout_milliseconds is size_t, which is the longest time to wait, 0 to poll once or KERNEL_WAIT_FOREVER
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT on timeout or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ALLOC_BLOCK: unable to allocate a block due to subcomponents
+ */
+size_t kernel_mempool_alloc(size_t id, void **block, size_t timeout_milliseconds) {
+
+    *block = NULL;
+    size_t start = g_timer_wheel->now;
+    size_t status = MEMPOOL_EXHAUSTED;
+    do {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        // a deleted memory pool is not found anymore
+        mempool_t *mempool = handle_table_lookup(g_mempool_list, id);
+        if (mempool == NULL) {
+            kernel_exit_critical();
+            status = handle_table_get(&g_mempool_list, id, (void **) &mempool);
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_BLOCK);
+        }
+
+        status = mempool_alloc(&mempool, block);
+        if (status == MEMPOOL_SUCCESS) {
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            break;
+        }
+        else if (status != MEMPOOL_EXHAUSTED) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_MEMPOOL_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_BLOCK);
+        }
+
+        size_t ticks = kernel_get_remaining_ticks(start, timeout_milliseconds);
+        if (ticks == 0) {
+            mempool->failures++;
+            kernel_exit_critical();
+            return KERNEL_TIMEOUT;
+        }
+
+        // task is released by a returned block or its timeout
+        status = mempool_wait(&mempool, &g_priority_group_current, &g_linked_list_task_iterator);
+        if (status != MEMPOOL_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_MEMPOOL_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_BLOCK);
+        }
+
+        status = kernel_start_timeout(&mempool->waiting_task_list, ticks, KERNEL_UNABLE_TO_ALLOC_BLOCK);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return status;
+        }
+
+        kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+        kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+        status = MEMPOOL_EXHAUSTED;
+    } while (status == MEMPOOL_EXHAUSTED);
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Takes a block from a memory pool from an interrupt service routine, it never blocks.
+ * @param id is size_t, which is used as a key for fast access
+ * @param block is a pointer of pointer, which receives the block or NULL, if all blocks are allocated
+ * @return KERNEL_SUCCESS on success, KERNEL_TIMEOUT if all blocks are allocated or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ALLOC_BLOCK: unable to allocate a block due to subcomponents
+ */
+size_t kernel_mempool_alloc_from_isr(size_t id, void **block) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    return kernel_mempool_alloc(id, block, 0);
+}
+
+/**
+ * @brief Returns a block to a memory pool in constant time and wakes the task, which waits longest for a block.
+ * @param id is size_t, which is used as a key for fast access
+ * @param block is the block to return, NULL is ignored like by free
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_FREE_BLOCK: unable to free the block due to subcomponents, e.g. it belongs to another memory pool
+ */
+size_t kernel_mempool_free(size_t id, void *block) {
+    mempool_t *mempool = NULL;
+    size_t status = handle_table_get(&g_mempool_list, id, (void **) &mempool);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_FREE_BLOCK);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    status = mempool_free(&mempool, block);
+    if (status != MEMPOOL_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_MEMPOOL_ERROR_REGISTER, KERNEL_UNABLE_TO_FREE_BLOCK);
+    }
+
+    // the released task retries its allocation with the returned block
+    status = kernel_mempool_wake(&mempool);
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return status;
+}
+
+/**
+ * @brief Returns a block to a memory pool from an interrupt service routine, it never blocks.
+ * @param id is size_t, which is used as a key for fast access
+ * @param block is the block to return, NULL is ignored like by free
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_FREE_BLOCK: unable to free the block due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
+ */
+size_t kernel_mempool_free_from_isr(size_t id, void *block, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_mempool_free(id, block);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
+
+/**
+ * @brief Provides the statistics of a memory pool since its creation.
+ * @param id is size_t, which is used as a key for fast access
+ * @param statistics is a pointer of kernel_mempool_statistics_t, which receives a copy
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ALLOC_BLOCK: unable to find the memory pool
+ */
+size_t kernel_mempool_get_statistics(size_t id, kernel_mempool_statistics_t *statistics) {
+    mempool_t *mempool = NULL;
+    size_t status = handle_table_get(&g_mempool_list, id, (void **) &mempool);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ALLOC_BLOCK);
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    statistics->block_size = mempool->pool->block_size;
+    statistics->count = mempool->pool->count;
+    statistics->free_blocks = mempool->pool->count - mempool->pool->in_use;
+    statistics->high_water = mempool->high_water;
+    statistics->failures = mempool->failures;
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Replaces malloc and free by a TLSF heap over a caller supplied memory region. Every object, which is
+ *        created afterwards, takes its storage from the heap in constant time. Call it before kernel_init.
+ * @param memory is the memory region of the heap, which must outlive it
+ * @param size is the size of the memory region in bytes
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_NO_HEAP: unable to create the heap due to subcomponents or a heap already exists
+ */
+size_t kernel_heap_create(void *memory, size_t size) {
+    if (g_heap != NULL) {
+        return KERNEL_NO_HEAP;
+    }
+
+    tlsf_t *heap = NULL;
+    size_t status = tlsf_create_static(&heap, &g_heap_storage, memory, size);
+    if (status != TLSF_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TLSF_ERROR_REGISTER, KERNEL_NO_HEAP);
+    }
+
+    // the heap is shared by all tasks and interrupts, every call is serialized by a short critical section
+    allocator_t allocator = { kernel_heap_allocate, kernel_heap_free, heap };
+    status = allocator_set(&allocator);
+    if (status != ALLOCATOR_SUCCESS) {
+        return KERNEL_NO_HEAP;
+    }
+    g_heap = heap;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Restores malloc and free, once every block of the heap was returned, e.g. after kernel_deinit.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_HEAP: no heap exists or blocks are still in use
+ */
+size_t kernel_heap_delete(void) {
+    if (g_heap == NULL || g_heap->used_size > 0) {
+        return KERNEL_UNABLE_TO_DELETE_HEAP;
+    }
+
+    allocator_set(NULL);
+    g_heap = NULL;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Provides the free space and the fragmentation of the heap. The heap is walked in a critical section,
+ *        which takes linear time in the amount of blocks, so it is meant for diagnostics only.
+ * @param statistics is a pointer of tlsf_statistics_t, which receives the statistics
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_NO_HEAP: kernel_heap_create was not called
+ */
+size_t kernel_heap_get_statistics(tlsf_statistics_t *statistics) {
+    if (g_heap == NULL) {
+        return KERNEL_NO_HEAP;
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    size_t status = tlsf_get_statistics(&g_heap, statistics);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    if (status != TLSF_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TLSF_ERROR_REGISTER, KERNEL_NO_HEAP);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+
+/**
+ * @brief Delays the task by the amount in milliseconds.
+ * @param delay_millisecods is size_t, which is the amount to delay the current running task.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELAY_TASK: unable to delay tasks due to subcomponents
+ * */
+size_t kernel_delay(size_t delay_millisecods) {
+
+    if (delay_millisecods == 0) {
+        return KERNEL_SUCCESS;
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // park the task in the delayed task list and start its timeout
+    size_t status = kernel_insert_delayed_task(delay_millisecods, KERNEL_UNABLE_TO_DELAY_TASK);
+    if (status!=KERNEL_SUCCESS) {
+        kernel_exit_critical();
+        return status;
+    }
+
+    // the priority group might not be runnable anymore
+    status = kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+    if (status!=KERNEL_SUCCESS) {
+        kernel_exit_critical();
+        return status;
+    }
+
+    kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Tries to receive events until a previously set timeout was reached.
+ * @param received_events is a size_t pointer, which will return the set events.
+ * @return KERNEL_SUCCESS on success, KERNEL_UNABLE_TO_RECEIVE_EVENTS on timeout or unequal on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_EVENTS: unable to receive events due to timeout or subcomponents
+ * @note Be aware of the difference of returns:
+ *       KERNEL_UNABLE_TO_RECEIVE_EVENTS as return signifies a timeout,
+ *       the same with concatenated subcomponents signifies an error!
+ * */
+size_t kernel_event_receive_timeout(size_t *received_events) {
+    // shorten the variables
+    size_t task_wanted_events = g_running_task_current->event_register.wanted_events;
+    size_t task_received_events = g_running_task_current->event_register.received_events;
+    size_t status = KERNEL_UNABLE_TO_RECEIVE_EVENTS;
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+
+    // abort loop if wanted events were set
+    task_received_events = g_running_task_current->event_register.received_events;
+    if ((task_wanted_events & task_received_events) == task_wanted_events) {
+
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+        status = KERNEL_SUCCESS;
+    }
+    else {
+
+        task_t *task = g_running_task_current;
+        size_t delay_milliseconds = task->event_register.timeout;
+        // insert in delayed task list
+        if (delay_milliseconds == 0) {
+            kernel_exit_critical();
+            return KERNEL_UNABLE_TO_RECEIVE_EVENTS;
+        }
+
+        // park the task in the delayed task list and start its timeout
+        size_t status = kernel_insert_delayed_task(delay_milliseconds, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+        if (status!=KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return status;
+        }
+
+        // the delayed task was appended at the head
+        status = task_set_blocked_info(&g_running_task_current, &g_delayed_tasks, &g_delayed_tasks->head);
+        if (status != TASK_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+        }
+
+        kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+        kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+        kernel_enter_critical();
+
+        task_received_events = g_running_task_current->event_register.received_events;
+        if ((task_wanted_events & task_received_events) == task_wanted_events) {
+            status = KERNEL_SUCCESS;
+        }
+
+        kernel_exit_critical();
+        // ------------------- critical section end ----------------------------
+    }
+
+    // provide set events
+    *received_events = task_received_events;
+
+    // delete received events
+    g_running_task_current->event_register.received_events &= ~g_running_task_current->event_register.wanted_events;
+    return status;
+}
+
+/**
+ * @brief Tries to receive events until the events are set.
+ * @param received_events is a size_t pointer, which will return the set events.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_EVENTS: unable to receive events due to subcomponents
+ * */
+size_t kernel_event_receive_blocking(size_t *received_events) {
+
+    // shorten the variables
+    size_t task_wanted_events = g_running_task_current->event_register.wanted_events;
+    size_t task_received_events = g_running_task_current->event_register.received_events;
+
+    // preconfigure error
+    size_t status = KERNEL_SUCCESS;
+    while (true) {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+
+        // abort loop if wanted events were set
+        task_received_events = g_running_task_current->event_register.received_events;
+        if ((task_wanted_events & task_received_events) == task_wanted_events) {
+
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+            status = KERNEL_SUCCESS;
+            break;
+        }
+
+        // transfer to blocked list
+        status = linked_list_transfer(&g_blocked_tasks, &g_priority_group_current, &g_linked_list_task_iterator);
+        if (status!=LINKED_LIST_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+        }
+
+        // set info, where the task was inserted
+        status = task_set_blocked_info(&g_running_task_current, &g_blocked_tasks, &g_blocked_tasks->head);
+        if (status != TASK_SUCCESS) {
+            kernel_exit_critical();
+            return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_EVENTS);
+        }
+
+        kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+        kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+    }
+
+    // provide set events
+    *received_events = task_received_events;
+
+    // delete received events
+    g_running_task_current->event_register.received_events &= ~g_running_task_current->event_register.wanted_events;
+    return status;
+}
+
+
+/**
+ * @brief Send events to tasks.
+ * @param task_id is size_t to the receiving task
+ * @param event is size_t with events to set at the corresponding task
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SEND_EVENTS: unable to send events due to subcomponents
+ * */
+size_t kernel_event_send(size_t task_id, size_t event) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // obtain task were an event should be set
+    task_t *task = NULL;
+    size_t status = dictionary_get(&g_list_of_tasks, task_id, (void *) &task);
+    if (status != DICTIONARY_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_SEND_EVENTS);
+    }
+
+    // shorten event variables and notification condition
+    size_t wanted_events = task->event_register.wanted_events;
+    size_t received_event = task->event_register.received_events;
+    void (*notification_conditions)(size_t *, size_t) = task->event_register.notification_conditions;
+    // preset received event in order to allow to reset them by the notification condition
+    received_event |= event;
+
+    if (notification_conditions!=NULL) {
+        // allow to modify the received event
+        notification_conditions(&received_event, wanted_events);
+    }
+
+    // update received event
+    task->event_register.received_events |= received_event;
+
+    // check if the addressed task can be reinserted
+    if ((received_event & wanted_events) == wanted_events) {
+        // check if addressed task was inserted in a blocked list or in a delayed task list
+        // a task waiting for an object keeps its blocked info, which is cleared by the reinsertion
+        if (task->blocked_timeout_list == g_blocked_tasks) {
+            kernel_reinsert_task(&task->blocked_timeout_list, &task->blocked_timeout_list_element, &task);
+        }
+        else if (task->blocked_timeout_list == g_delayed_tasks && timer_wheel_node_is_active(&task->timeout_node)) {
+            // resume addressed task before timeout elapsed, the reinsertion cancels the timeout
+            status = kernel_reinsert_task(&task->blocked_timeout_list, &task->blocked_timeout_list_element, &task);
+            if (status!=KERNEL_SUCCESS) {
+                kernel_exit_critical();
+                return status;
+            }
+        }
+    }
+
+
+    kernel_exit_critical();
+    // ------------------- critical section end -------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Send events to tasks from an interrupt service routine, it never blocks.
+ * @param task_id is size_t to the receiving task
+ * @param event is size_t with events to set at the corresponding task
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SEND_EVENTS: unable to send events due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
+ * */
+size_t kernel_event_send_from_isr(size_t task_id, size_t event, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_event_send(task_id, event);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
+
+/**
+ * @brief Provides the handle of a task, which addresses its notification without a dictionary lookup.
+ * @param task_id is size_t of the task
+ * @param task is a task_t pointer of pointer, which receives the handle
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_GET_TASK: unable to get the task due to subcomponents
+ * @note The handle stays valid until the task is deleted or terminated and reaped, or until kernel_deinit.
+ * */
+size_t kernel_task_get_handle(size_t task_id, task_t **task) {
+    size_t status = dictionary_get(&g_list_of_tasks, task_id, (void **) task);
+    if (status != DICTIONARY_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_GET_TASK);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Provides the cpu time of a task since its creation.
+ * @param task_id is size_t of the task
+ * @param statistics is a pointer of kernel_task_statistics_t, which receives the cpu time
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_GET_TASK: unable to get the task due to subcomponents
+ * */
+size_t kernel_task_get_statistics(size_t task_id, kernel_task_statistics_t *statistics) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    task_t *task = NULL;
+    size_t status = dictionary_get(&g_list_of_tasks, task_id, (void **) &task);
+    if (status != DICTIONARY_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_GET_TASK);
+    }
+
+    // the running task is charged up to now
+    kernel_cpu_charge(g_cpu_account);
+
+    uint64_t lifetime = g_cpu_total_cycles - task->cpu.created;
+    statistics->cycles = task->cpu.cycles;
+    statistics->activations = task->cpu.activations;
+    statistics->load = lifetime == 0 ? 0 : (size_t) ((task->cpu.cycles * 100) / lifetime);
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Applies an action to the notification value of a task and wakes it up, if it waits for a notification.
+ * @param task is a task_t pointer of pointer to the handle of the notified task
+ * @param value is size_t, which is set, or the bits to set, depending on the action
+ * @param action is task_notify_action_e, which is applied to the notification value
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_NOTIFY: unable to notify the task due to subcomponents
+ * */
+size_t kernel_notify(task_t **task, size_t value, task_notify_action_e action) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    size_t status = task_notify(task, value, action);
+    if (status != TASK_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_NOTIFY);
+    }
+
+    // the woken task checks its condition again and blocks, if it is not fulfilled
+    if ((*task)->notification.waiting) {
+        (*task)->notification.waiting = false;
+        status = kernel_reinsert_task(&(*task)->blocked_timeout_list, &(*task)->blocked_timeout_list_element, task);
+        if (status != KERNEL_SUCCESS) {
+            kernel_exit_critical();
+            return status;
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Notifies a task from an interrupt service routine, it never blocks.
+ * @param task is a task_t pointer of pointer to the handle of the notified task
+ * @param value is size_t, which is set, or the bits to set, depending on the action
+ * @param action is task_notify_action_e, which is applied to the notification value
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        than the interrupted task is ready, and left untouched otherwise
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_NOTIFY: unable to notify the task due to subcomponents
+ * @note Pass higher_priority_task_woken to kernel_yield_from_isr before the interrupt returns.
+ * */
+size_t kernel_notify_from_isr(task_t **task, size_t value, task_notify_action_e action, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    task_t *next_task = g_running_task_next;
+    size_t status = kernel_notify(task, value, action);
+    kernel_check_higher_priority_task_woken(next_task, higher_priority_task_woken);
+    return status;
+}
+
+/**
+ * @brief Increments the notification value of a task, which is taken by kernel_notify_take.
+ * @param task is a task_t pointer of pointer to the handle of the notified task
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info It inherits error codes from kernel_notify.
+ * */
+size_t kernel_notify_give(task_t **task) {
+    return kernel_notify(task, 0, TASK_NOTIFY_INCREMENT);
+}
+
+/**
+ * @brief Blocks the running task, until its notification value is greater 0.
+ * @param clear is a bool, if set to true, the notification value is cleared like a binary semaphore,
+ *        otherwise it is decremented like a counting semaphore
+ * @param value is a size_t pointer, which receives the notification value before it was cleared or decremented
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WAIT_FOR_NOTIFICATION: unable to block the task due to subcomponents
+ * */
+size_t kernel_notify_take(bool clear, size_t *value) {
+    task_t *task = g_running_task_current;
+
+    while (true) {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+        if (task->notification.value > 0) {
+            break;
+        }
+
+        size_t status = kernel_notify_block();
+        if (status != KERNEL_SUCCESS) {
+            return status;
+        }
+    }
+
+    *value = task->notification.value;
+    task->notification.value = clear ? 0 : task->notification.value - 1;
+    task->notification.pending = false;
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Blocks the running task, until it is notified by any action.
+ * @param clear_bits is size_t, which bits are cleared in the notification value after it was read
+ * @param value is a size_t pointer, which receives the notification value before the bits were cleared
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WAIT_FOR_NOTIFICATION: unable to block the task due to subcomponents
+ * */
+size_t kernel_notify_wait(size_t clear_bits, size_t *value) {
+    task_t *task = g_running_task_current;
+
+    while (true) {
+        // ------------------- critical section start -------------------------
+        kernel_enter_critical();
+        if (task->notification.pending) {
+            break;
+        }
+
+        size_t status = kernel_notify_block();
+        if (status != KERNEL_SUCCESS) {
+            return status;
+        }
+    }
+
+    *value = task->notification.value;
+    task->notification.value &= ~clear_bits;
+    task->notification.pending = false;
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+
+/**
+ * @brief Creates a software timer, whose callback is executed by the timer daemon task.
+ *        The first timer creates the command queue and adds the timer daemon task,
+ *        hence it has to be created before kernel_start.
+ * @param id is a pointer of size_t, which is used as a key for fast access.
+ * @param callback is a function pointer executed by the timer daemon on expiration, it receives the timer id
+ * @param period_milliseconds is size_t, which is the period between start and expiration
+ * @param auto_reload is a bool, if set to true, the timer restarts after every expiration, otherwise it is a one shot timer
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CREATE_TIMER: unable to create the timer due to subcomponents
+ * @note Callbacks share the stack of the timer daemon and must not block.
+ * */
+size_t kernel_timer_create(size_t *id, void (*callback)(size_t id), size_t period_milliseconds, bool auto_reload) {
+    size_t status = KERNEL_SUCCESS;
+    if (g_timer_command_queue == NULL) {
+        // the timer daemon is only added, if timers are used
+        status = kernel_message_queue_create_static(&g_timer_command_queue, "timer commands", KERNEL_TIMER_QUEUE_SIZE, sizeof(kernel_timer_command_t),
+                &g_timer_command_queue_storage, g_timer_command_queue_data, g_timer_command_queue_buffer);
+        if (status!=KERNEL_SUCCESS) {
+            return status;
+        }
+
+        status = kernel_add_task(kernel_timer_daemon, KERNEL_TIMER_DAEMON_ID, "timer daemon", KERNEL_TIMER_DAEMON_PRIORITY, KERNEL_TIMER_DAEMON_TIME_QUANTUM, KERNEL_TIMER_EVENT_COMMAND, NULL, 0);
+        if (status!=KERNEL_SUCCESS) {
+            return status;
+        }
+    }
+
+    // reserve the key, a full handle table limits the amount of software timers
+    size_t handle = HANDLE_TABLE_INVALID_HANDLE;
+    status = handle_table_reserve(&g_timer_list, &handle);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_TIMER);
+    }
+
+    // create timer and check for errors
+    software_timer_t *timer = NULL;
+    status = software_timer_create(&timer, handle, callback, period_milliseconds, auto_reload);
+    if (status!=SOFTWARE_TIMER_SUCCESS) {
+        handle_table_release(&g_timer_list, handle);
+        return ERROR_INFO(status, KERNEL_SOFTWARE_TIMER_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_TIMER);
+    }
+
+    // add created timer to the handle table for fast access
+    status = handle_table_set(&g_timer_list, handle, timer);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        software_timer_delete(&timer);
+        handle_table_release(&g_timer_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_TIMER);
+    }
+
+    *id = handle;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Starts a software timer, which expires one period after this call. A running timer stays untouched.
+ * @param id is size_t, which is the key of the timer
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_START_TIMER: unable to start the timer due to subcomponents
+ * */
+size_t kernel_timer_start(size_t id) {
+    return kernel_timer_send_command(id, KERNEL_TIMER_COMMAND_START, KERNEL_UNABLE_TO_START_TIMER);
+}
+
+/**
+ * @brief Stops a software timer, its callback will not be executed until it is started again.
+ * @param id is size_t, which is the key of the timer
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_STOP_TIMER: unable to stop the timer due to subcomponents
+ * */
+size_t kernel_timer_stop(size_t id) {
+    return kernel_timer_send_command(id, KERNEL_TIMER_COMMAND_STOP, KERNEL_UNABLE_TO_STOP_TIMER);
+}
+
+/**
+ * @brief Restarts the period of a software timer from this call on, a stopped timer is started.
+ * @param id is size_t, which is the key of the timer
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RESET_TIMER: unable to reset the timer due to subcomponents
+ * */
+size_t kernel_timer_reset(size_t id) {
+    return kernel_timer_send_command(id, KERNEL_TIMER_COMMAND_RESET, KERNEL_UNABLE_TO_RESET_TIMER);
+}
+
+/**
+ * @brief Creates the work queue and adds the work daemon task, which executes the work
+ *        posted by interrupts. Has to be called before kernel_start, further calls have no effect.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CREATE_WORK_QUEUE: unable to create the work queue due to subcomponents
+ * @note The depth is set by KERNEL_WORK_QUEUE_SIZE and the priority by KERNEL_WORK_DAEMON_PRIORITY.
+ * */
+size_t kernel_work_queue_create(void) {
+    if (g_work_queue != NULL) {
+        return KERNEL_SUCCESS;
+    }
+
+    size_t status = work_queue_create_static(&g_work_queue, &g_work_queue_storage, g_work_queue_items, KERNEL_WORK_QUEUE_SIZE);
+    if (status!=WORK_QUEUE_SUCCESS) {
+        g_work_queue = NULL;
+        return ERROR_INFO(status, KERNEL_WORK_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_CREATE_WORK_QUEUE);
+    }
+
+    status = kernel_add_task(kernel_work_daemon, KERNEL_WORK_DAEMON_ID, "work daemon", KERNEL_WORK_DAEMON_PRIORITY, KERNEL_WORK_DAEMON_TIME_QUANTUM, KERNEL_WORK_EVENT_POSTED, NULL, 0);
+    if (status!=KERNEL_SUCCESS) {
+        g_work_queue = NULL;
+        return status;
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Defers a function call from an interrupt to the work daemon.
+ *        The work item is posted without a critical section, only the first post
+ *        after the work daemon started a batch sends it an event.
+ * @param function is a function pointer executed by the work daemon
+ * @param argument is passed to the function
+ * @param higher_priority_task_woken is a bool pointer, which is set to true if the work daemon
+ *        preempts the interrupted task. It is never reset to false and can be NULL.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_NO_WORK_QUEUE: kernel_work_queue_create was not called
+ *  KERNEL_UNABLE_TO_POST_WORK: unable to post the work item due to subcomponents, a full work queue is counted as overflow
+ * @note Must only be called by interrupts at or below KERNEL_MAX_SYSCALL_PRIORITY, which end with kernel_yield_from_isr.
+ * */
+size_t kernel_work_post_from_isr(void (*function)(void *argument), void *argument, bool *higher_priority_task_woken) {
+    KERNEL_VALIDATE_INTERRUPT_PRIORITY();
+    if (g_work_queue == NULL) {
+        return KERNEL_NO_WORK_QUEUE;
+    }
+
+    size_t status = work_queue_post(&g_work_queue, function, argument, kernel_get_cycles());
+    if (status!=WORK_QUEUE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_WORK_QUEUE_ERROR_REGISTER, KERNEL_UNABLE_TO_POST_WORK);
+    }
+
+    // the work daemon clears the signal before it reads, hence a published item is never missed
+    if (g_work_signaled != 0 || !atomic_compare_exchange(&g_work_signaled, 0, 1)) {
+        return KERNEL_SUCCESS;
+    }
+
+    return kernel_event_send_from_isr(KERNEL_WORK_DAEMON_ID, KERNEL_WORK_EVENT_POSTED, higher_priority_task_woken);
+}
+
+/**
+ * @brief Provides the statistics of the deferred work since kernel_init.
+ * @param statistics is a pointer of kernel_work_statistics_t, which receives a copy
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_NO_WORK_QUEUE: kernel_work_queue_create was not called
+ * */
+size_t kernel_work_get_statistics(kernel_work_statistics_t *statistics) {
+    if (g_work_queue == NULL) {
+        return KERNEL_NO_WORK_QUEUE;
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    *statistics = g_work_statistics;
+    statistics->overflows = g_work_queue->overflows;
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Provides the cpu time of the system since kernel_init and the cpu load over the sliding window,
+ *        which covers between KERNEL_CPU_LOAD_SAMPLES - 1 and KERNEL_CPU_LOAD_SAMPLES sample periods.
+ * @param statistics is a pointer of kernel_cpu_statistics_t, which receives the cpu time
+ * @return KERNEL_SUCCESS
+ * */
+size_t kernel_cpu_get_statistics(kernel_cpu_statistics_t *statistics) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    // the running account is charged up to now
+    kernel_cpu_charge(g_cpu_account);
+
+    statistics->total_cycles = g_cpu_total_cycles;
+    statistics->idle_cycles = g_cpu_idle_cycles;
+    statistics->isr_cycles = g_cpu_isr_cycles;
+
+    // the next overwritten sample is the oldest one
+    kernel_cpu_sample_t *oldest = &g_cpu_samples[g_cpu_sample_index];
+    uint64_t window = g_cpu_total_cycles - oldest->total_cycles;
+    uint64_t idle = g_cpu_idle_cycles - oldest->idle_cycles;
+    statistics->load = window == 0 ? 0 : (size_t) (((window - idle) * 100) / window);
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Accounts the following cycles to interrupts. Call it at the start of an interrupt,
+ *        nested interrupts are accounted together with the outermost one.
+ * @info Must only be called by interrupts at or below KERNEL_MAX_SYSCALL_PRIORITY.
+ * */
+void kernel_cpu_isr_enter(void) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    if (g_cpu_isr_nesting == 0) {
+        g_cpu_account_interrupted = g_cpu_account;
+        kernel_cpu_charge(&g_cpu_isr_cycles);
+    }
+    g_cpu_isr_nesting++;
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+}
+
+/**
+ * @brief Accounts the following cycles to the interrupted task or idle again. Call it at the end of an interrupt,
+ *        a task switched to by the interrupt is accounted instead.
+ * @info Must only be called by interrupts at or below KERNEL_MAX_SYSCALL_PRIORITY.
+ * */
+void kernel_cpu_isr_exit(void) {
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    if (g_cpu_isr_nesting > 0) {
+        g_cpu_isr_nesting--;
+        if (g_cpu_isr_nesting == 0) {
+            kernel_cpu_charge(g_cpu_account_interrupted);
+        }
+    }
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+}
+
+/**
+ * @brief It will force to start a next task.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info It inherits error codes from kernel_start_task.
+ */
+size_t kernel_exit_to_scheduler(void) {
+
+    size_t status = KERNEL_SUCCESS;
+    task_t *task = g_running_task_current;
+
+    kernel_enter_critical();
     status = kernel_start_task(&g_priority_group_next, &g_linked_list_task_iterator_next, &g_running_task_next);
 
-    // Catch task
-    while(task->task_data->eTaskState != TaskState_Running);
+    // Catch task
+    while(task->task_data->eTaskState != TaskState_Running);
+
+    return status;
+}
+
+/**
+ * @brief Enters a critical section, which prevents a task switch and masks every interrupt
+ *        with a priority at or below KERNEL_MAX_SYSCALL_PRIORITY.
+ *        Critical sections can be nested.
+ * @info Interrupts above KERNEL_MAX_SYSCALL_PRIORITY are still served and must not call the kernel.
+ * */
+void kernel_enter_critical(void) {
+    kernel_mask_interrupts();
+    g_kernel_critical_nesting++;
+}
+
+/**
+ * @brief Exits a critical section. The interrupts are unmasked by the outermost exit.
+ * @info A task, which blocks, leaves all its critical sections on the task switch.
+ * */
+void kernel_exit_critical(void) {
+    if (g_kernel_critical_nesting == 0) {
+        return;
+    }
+
+    g_kernel_critical_nesting--;
+    if (g_kernel_critical_nesting == 0) {
+        kernel_unmask_interrupts();
+    }
+}
+
+/**
+ * @brief Pends a single context switch at the end of an interrupt service routine.
+ *        The switch is executed by PendSV, once the interrupt returned.
+ * @param higher_priority_task_woken is bool, which was collected by the '_from_isr' functions.
+ * @info Must only be called by interrupts at or below KERNEL_MAX_SYSCALL_PRIORITY.
+ * */
+void kernel_yield_from_isr(bool higher_priority_task_woken) {
+    if (!higher_priority_task_woken || g_running_task_current == NULL) {
+        return;
+    }
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    if (g_kernel_status == EN_KERNEL_IDLE) {
+        // the idle task continues with the reinserted task
+        kernel_exit_idle();
+    }
+    else if (g_kernel_status == EN_KERNEL_RUNNING) {
+        bool switch_task = false;
+        kernel_check_higher_priority_task_woken(NULL, &switch_task);
+        if (switch_task) {
+            // pends PendSV and ends the critical section
+            kernel_start_task(&g_priority_group_next, &g_linked_list_task_iterator_next, &g_running_task_next);
+            return;
+        }
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+}
+
+/* Debug module functions (implementation) */
+#ifdef DEBUG
+dictionary_t* kernel_debug_get_list_of_tasks(void) {
+    return g_list_of_tasks;
+}
+#endif
+
+/* Static module functions (implementation) */
+
+
+
+/**
+ * @brief Moves a task from blocked to running task list.
+ *        A pending timeout of the task is cancelled, so a task released by an object leaves the timing wheel
+ *        and a task released by the timing wheel has already left the waiting list of the object.
+ * @param source is a linked_list_t pointer of pointer where an element shall be removed
+ * @param element is a linked_list_element_t pointer of pointer which shall be transferred
+ * @param task is a task_t pointer of pointer which shall be transferred
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_REINSERT_TASK: unable to reinsert task due to subcomponents
+ * */
+size_t kernel_reinsert_task(linked_list_t **source, linked_list_element_t **element, task_t **task) {
+    // get the priority group for the task
+    linked_list_t* priority_group = NULL;
+    size_t status = dictionary_get(&g_prioritized_tasks, (*task)->task_data->u8TaskPrio, (void **) &priority_group);
+    if (status != DICTIONARY_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_REINSERT_TASK);
+    }
+
+    // the task was released before its timeout elapsed, the neighbouring timeouts stay untouched
+    if (timer_wheel_node_is_active(&(*task)->timeout_node)) {
+        status = timer_wheel_cancel(&g_timer_wheel, &(*task)->timeout_node);
+        if (status != TIMER_WHEEL_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_TIMER_WHEEL_ERROR_REGISTER, KERNEL_UNABLE_TO_REINSERT_TASK);
+        }
+    }
+
+    // transfer the task from the source list to its priority group
+    status = linked_list_transfer(&priority_group, source, element);
+    if (status != LINKED_LIST_ELEMENT_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_REINSERT_TASK);
+    }
+
+    // the task is no longer inserted in a waiting list, which has to be left on a timeout
+    (*task)->blocked_timeout_list = NULL;
+    (*task)->blocked_timeout_list_element = NULL;
+
+    // in idle the highest priority of the tasks, which were released before on the same tick, is already selected
+    size_t ready_priority = 0;
+    bool selected_in_idle = g_kernel_status == EN_KERNEL_IDLE
+            && bitmap_get_first(&g_ready_priorities, &ready_priority) == BITMAP_SUCCESS;
+
+    // the priority group is runnable again
+    status = bitmap_set(&g_ready_priorities, (*task)->task_data->u8TaskPrio);
+    if (status != BITMAP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_UNABLE_TO_REINSERT_TASK);
+    }
+
+    // mark task as ready again
+    task_set_state(task, TaskState_Ready);
+
+    // the reinserted tasks priority might be higher than the already selected priority
+    // or it is the first task, which wakes up the kernel from idle
+    size_t incoming_priority = (*task)->task_data->u8TaskPrio;
+    bool selected = g_kernel_status == EN_KERNEL_IDLE
+            ? !selected_in_idle || incoming_priority < ready_priority
+            : incoming_priority < g_dictionary_priority;
+    if (selected) {
+        g_priority_group_next = priority_group;
+        // the element of the task is the next iterator, the tail might be another task, which woke up before
+        g_linked_list_task_iterator_next = &(*task)->list_element;
+        g_running_task_next = *task;
+        g_dictionary_priority_next = incoming_priority;
+        g_dictionary_priority = incoming_priority;
+    }
+    else if (g_kernel_status != EN_KERNEL_IDLE
+            && g_running_task_current->task_data->eTaskState == TaskState_Running
+            && g_priority_group_next == g_priority_group_current) {
+        // it is important to update the next task logic, if the moved task belongs to the current running priority group,
+        // a pending preemption by a task of the same batch must not be discarded
+        g_linked_list_task_iterator_next = g_linked_list_task_iterator->next;
+        if (g_linked_list_task_iterator_next == NULL) {
+            // end of priority group and restart with first element
+            g_linked_list_task_iterator_next = g_priority_group_current->tail;
+        }
+        g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
+    }
+
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Checks, if the next task was changed to a task with a higher priority than the running task.
+ *        The next task is set to a higher priority task by kernel_reinsert_task.
+ * @param next_task is a task_t pointer to the next task before the check, NULL to check for any higher priority task
+ * @param higher_priority_task_woken is a bool pointer, which is set to true, if a task with a higher priority
+ *        is ready or the kernel is idle, and left untouched otherwise
+ * @return None
+ * */
+void kernel_check_higher_priority_task_woken(task_t *next_task, bool *higher_priority_task_woken) {
+    if (higher_priority_task_woken == NULL || g_running_task_current == NULL || g_running_task_next == next_task) {
+        return;
+    }
+
+    if (g_kernel_status == EN_KERNEL_IDLE) {
+        // any ready task ends the idle mode
+        size_t ready_priority = 0;
+        if (bitmap_get_first(&g_ready_priorities, &ready_priority) == BITMAP_SUCCESS) {
+            *higher_priority_task_woken = true;
+        }
+    }
+    else if (g_running_task_next != NULL
+            && g_running_task_next->task_data->u8TaskPrio < g_running_task_current->task_data->u8TaskPrio) {
+        *higher_priority_task_woken = true;
+    }
+}
+
+/**
+ * @brief Synchronizes the ready bit of a priority group with its content.
+ *        Has to be called whenever a task left or entered a priority group
+ *        outside of kernel_reinsert_task.
+ * @param priority is size_t of the priority group to synchronize
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_NO_READY_PRIORITIES: unable to update ready priorities due to subcomponents
+ * */
+size_t kernel_update_ready_priority(size_t priority) {
+    linked_list_t *priority_group = NULL;
+    size_t status = dictionary_get(&g_prioritized_tasks, priority, (void **) &priority_group);
+    if (status != DICTIONARY_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_NO_READY_PRIORITIES);
+    }
+
+    if (priority_group->size > 0) {
+        status = bitmap_set(&g_ready_priorities, priority);
+    }
+    else {
+        status = bitmap_clear(&g_ready_priorities, priority);
+    }
+
+    if (status != BITMAP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_NO_READY_PRIORITIES);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Moves a task to the priority group of a new effective priority, its base priority stays untouched.
+ *        A ready task is transferred between the priority groups in constant time,
+ *        a blocked task enters the priority group of its new priority once it is reinserted.
+ * @param task is a task_t pointer of pointer to the task, which changes its priority
+ * @param priority is uint8_t of the new effective priority
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY: unable to change the priority due to subcomponents
+ * */
+size_t kernel_change_task_priority(task_t **task, uint8_t priority) {
+    uint8_t previous_priority = (*task)->task_data->u8TaskPrio;
+    if (previous_priority == priority) {
+        return KERNEL_SUCCESS;
+    }
+
+    size_t status = task_set_inherited_priority(task, priority);
+    if (status != TASK_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+    }
+
+    // a blocked task is stored in a waiting list or the delayed task list
+    if ((*task)->task_data->eTaskState == TaskState_Blocked) {
+        return KERNEL_SUCCESS;
+    }
+
+    linked_list_t *source = NULL;
+    linked_list_t *destination = NULL;
+    status = dictionary_get(&g_prioritized_tasks, previous_priority, (void **) &source);
+    if (status == DICTIONARY_SUCCESS) {
+        status = dictionary_get(&g_prioritized_tasks, priority, (void **) &destination);
+    }
+    if (status != DICTIONARY_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+    }
+
+    // the element is embedded in the task, so the move neither searches nor allocates
+    linked_list_element_t *element = &(*task)->list_element;
+    status = linked_list_transfer(&destination, &source, &element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+    }
+
+    status = kernel_update_ready_priority(previous_priority);
+    if (status != KERNEL_SUCCESS) {
+        return status;
+    }
+    status = kernel_update_ready_priority(priority);
+    if (status != KERNEL_SUCCESS) {
+        return status;
+    }
+
+    if (*task == g_running_task_current) {
+        // the running task continues in its new priority group
+        g_priority_group_current = destination;
+        g_dictionary_priority = priority;
+
+        // a higher ready priority group is started next, like a reinserted task
+        size_t next_priority = priority;
+        status = bitmap_get_first(&g_ready_priorities, &next_priority);
+        if (status != BITMAP_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+        }
+
+        if (next_priority < priority) {
+            status = dictionary_get(&g_prioritized_tasks, next_priority, (void **) &g_priority_group_next);
+            if (status != DICTIONARY_SUCCESS) {
+                return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+            }
+            g_linked_list_task_iterator_next = g_priority_group_next->tail;
+            g_dictionary_priority_next = next_priority;
+            g_dictionary_priority = next_priority;
+        }
+        else {
+            // otherwise the new priority group is continued in round robin
+            g_priority_group_next = destination;
+            g_linked_list_task_iterator_next = element->next;
+            if (g_linked_list_task_iterator_next == NULL) {
+                g_linked_list_task_iterator_next = destination->tail;
+            }
+        }
+        g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
+    }
+    else if (*task == g_running_task_next) {
+        // the preset next task is started in its new priority group
+        g_priority_group_next = destination;
+        g_dictionary_priority = priority;
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Passes a priority on to the owner of a mutex. If the owner waits for another mutex,
+ *        the priority is passed on along the chain of owners.
+ * @param mutex is a mutex_t pointer of pointer to the mutex, a task with the given priority is blocked on
+ * @param priority is uint8_t of the blocked task
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY: unable to change the priority due to subcomponents
+ * */
+size_t kernel_inherit_priority(mutex_t **mutex, uint8_t priority) {
+    mutex_t *blocking_mutex = *mutex;
+
+    // a chain without a deadlock cannot contain more owners than mutexes
+    for (size_t depth = 0; depth < KERNEL_MAX_MUTEX && blocking_mutex != NULL; depth++) {
+        task_t *owner = blocking_mutex->owner;
+        if (owner == NULL || owner->task_data->u8TaskPrio <= priority) {
+            break;
+        }
+
+        size_t status = kernel_change_task_priority(&owner, priority);
+        if (status != KERNEL_SUCCESS) {
+            return status;
+        }
+
+        blocking_mutex = owner->blocked_mutex;
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Restores a tasks priority to its base priority or to the highest priority,
+ *        which is still inherited by tasks waiting for another mutex owned by the task
+ *        or by the ceiling of another owned ceiling mutex.
+ * @param task is a task_t pointer of pointer to the task, which released a mutex
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY: unable to change the priority due to subcomponents
+ * */
+size_t kernel_restore_priority(task_t **task) {
+    uint8_t priority = (*task)->base_priority;
+
+    // a task without inherited priority keeps running in its priority group
+    if ((*task)->task_data->u8TaskPrio == priority) {
+        return KERNEL_SUCCESS;
+    }
+
+    for (size_t index = 0; index < g_mutex_list->size; index++) {
+        mutex_t *mutex = g_mutex_list->slots[index].value;
+        if (mutex == NULL || mutex->owner != *task) {
+            continue;
+        }
+
+        size_t status = mutex_get_waiting_priority(&mutex, &priority);
+        if (status != MUTEX_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY);
+        }
+
+        if (mutex->ceiling_priority < priority) {
+            priority = mutex->ceiling_priority;
+        }
+    }
+
+    return kernel_change_task_priority(task, priority);
+}
+
+/**
+ * @brief Withdraws the priority, which a task passed on to the chain of owners of a mutex, after it stopped waiting.
+ *        Every owner of the chain is restored to the highest priority it still inherits.
+ * @param mutex is a mutex_t pointer of pointer to the mutex, the task no longer waits for
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_CHANGE_TASK_PRIORITY: unable to change the priority due to subcomponents
+ * */
+size_t kernel_withdraw_priority(mutex_t **mutex) {
+    mutex_t *blocking_mutex = *mutex;
+
+    // a chain without a deadlock cannot contain more owners than mutexes
+    for (size_t depth = 0; depth < KERNEL_MAX_MUTEX && blocking_mutex != NULL; depth++) {
+        task_t *owner = blocking_mutex->owner;
+        if (owner == NULL) {
+            break;
+        }
+
+        size_t status = kernel_restore_priority(&owner);
+        if (status != KERNEL_SUCCESS) {
+            return status;
+        }
+
+        blocking_mutex = owner->blocked_mutex;
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Acquires a ceiling mutex for the running task and raises it to the ceiling priority.
+ *        Has to be called in a critical section.
+ * @param mutex is a mutex_t pointer of pointer to the ceiling mutex
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ACQUIRE_MUTEX: unable to acquire the mutex due to subcomponents
+ * */
+size_t kernel_mutex_acquire_ceiling(mutex_t **mutex) {
+    task_t *task = g_running_task_current;
+    size_t status = mutex_acquire_ceiling(mutex, &task);
+    if (status != MUTEX_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+    }
+
+    // a recursive acquire keeps the priority
+    if ((*mutex)->lock_count > 1) {
+        return KERNEL_SUCCESS;
+    }
+
+    task->ceiling_locks++;
+    if ((*mutex)->ceiling_priority < task->task_data->u8TaskPrio) {
+        status = kernel_change_task_priority(&task, (*mutex)->ceiling_priority);
+        if (status != KERNEL_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_ACQUIRE_MUTEX);
+        }
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Releases a ceiling mutex of the running task and restores its priority.
+ *        Has to be called in a critical section.
+ * @param mutex is a mutex_t pointer of pointer to the ceiling mutex
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RELEASE_MUTEX: unable to release the mutex due to subcomponents
+ * */
+size_t kernel_mutex_release_ceiling(mutex_t **mutex) {
+    task_t *task = g_running_task_current;
+    size_t status = mutex_release_ceiling(mutex, &task);
+    if (status != MUTEX_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
+    }
+
+    if ((*mutex)->owner != NULL) {
+        return KERNEL_SUCCESS;
+    }
+
+    task->ceiling_locks--;
+    status = kernel_restore_priority(&task);
+    if (status != KERNEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MUTEX_ERROR_REGISTER, KERNEL_UNABLE_TO_RELEASE_MUTEX);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Parks the running task in the delayed task list and inserts its timeout node in the timing wheel.
+ *        Insertion and a later cancellation are independent of the amount of delayed tasks.
+ * @param ticks is size_t, which is the amount of ticks until the task is released
+ * @param error_code is size_t, which is the callers error code for subcomponent errors
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents with the given error code
+ * */
+size_t kernel_insert_delayed_task(size_t ticks, size_t error_code) {
+    task_t *task = g_running_task_current;
+
+    // the delayed task list only keeps the elements, the order is determined by the timing wheel
+    size_t status = linked_list_transfer(&g_delayed_tasks, &g_priority_group_current, &g_linked_list_task_iterator);
+    if (status!=LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, error_code);
+    }
+
+    // the timeout node is embedded in the task next to its element, which is released on expiry
+    status = timer_wheel_insert(&g_timer_wheel, &task->timeout_node, ticks);
+    if (status!=TIMER_WHEEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TIMER_WHEEL_ERROR_REGISTER, error_code);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Gets the ticks left of a timeout, which started with a blocking call.
+ * @param start is size_t, which is the tick of the timing wheel, when the blocking call was entered
+ * @param timeout_milliseconds is size_t, which is the timeout of the blocking call or KERNEL_WAIT_FOREVER
+ * @return the remaining ticks, 0 for an elapsed timeout or KERNEL_WAIT_FOREVER
+ * */
+size_t kernel_get_remaining_ticks(size_t start, size_t timeout_milliseconds) {
+    if (timeout_milliseconds == KERNEL_WAIT_FOREVER) {
+        return KERNEL_WAIT_FOREVER;
+    }
+
+    // the elapsed ticks stay valid, when the tick counter wraps around
+    size_t elapsed = g_timer_wheel->now - start;
+    return elapsed < timeout_milliseconds ? timeout_milliseconds - elapsed : 0;
+}
+
+/**
+ * @brief Starts the timeout of the running task, which was moved into the waiting list of an object.
+ *        The task is inserted in the waiting list and in the timing wheel, the side which releases
+ *        it first removes it from the other side by kernel_reinsert_task. Has to be called in a critical section.
+ * @param waiting_list is a linked_list_t pointer of pointer to the waiting list of the object
+ * @param ticks is size_t, which is the amount of ticks until the task is released or KERNEL_WAIT_FOREVER
+ * @param error_code is size_t, which is the callers error code for subcomponent errors
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents with the given error code
+ * */
+size_t kernel_start_timeout(linked_list_t **waiting_list, size_t ticks, size_t error_code) {
+    // the expiry and kernel_task_delete remove the task from the waiting list, which is stored in the blocked info
+    task_t *task = g_running_task_current;
+    linked_list_element_t *element = &task->list_element;
+    size_t status = task_set_blocked_info(&task, waiting_list, &element);
+    if (status != TASK_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, error_code);
+    }
+
+    // a task waiting forever is only released by the object
+    if (ticks == KERNEL_WAIT_FOREVER) {
+        return KERNEL_SUCCESS;
+    }
+
+    status = timer_wheel_insert(&g_timer_wheel, &task->timeout_node, ticks);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TIMER_WHEEL_ERROR_REGISTER, error_code);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Parks the running task in the blocked task list, until a notification wakes it up.
+ *        Has to be called in a critical section, which is left on the task switch or on error.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WAIT_FOR_NOTIFICATION: unable to block the task due to subcomponents
+ * */
+size_t kernel_notify_block(void) {
+    size_t status = linked_list_transfer(&g_blocked_tasks, &g_priority_group_current, &g_linked_list_task_iterator);
+    if (status!=LINKED_LIST_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_WAIT_FOR_NOTIFICATION);
+    }
+
+    // the notifying task reinserts the task by its blocked info
+    status = task_set_blocked_info(&g_running_task_current, &g_blocked_tasks, &g_blocked_tasks->head);
+    if (status != TASK_SUCCESS) {
+        kernel_exit_critical();
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_WAIT_FOR_NOTIFICATION);
+    }
+    g_running_task_current->notification.waiting = true;
+
+    kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+    kernel_swap_task(&g_priority_group_current, &g_linked_list_task_iterator, &g_running_task_current);
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Stores a created message queue in its reserved slot of the handle table for fast access.
+ * @param message_queue_identifier is a pointer of pointer to the message queue identifier, which is set to the key of the message queue
+ * @param message_queue is a pointer of pointer to the created message queue
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE: unable to add message queue due to subcomponents
+ */
+size_t kernel_message_queue_register(message_queue_identifier_t **message_queue_identifier, message_queue_t **message_queue) {
+
+    // store created message queue in its reserved slot for fast access
+    size_t handle = (*message_queue)->message_queue_identifier->id;
+    size_t status = handle_table_set(&g_message_queue_list, handle, *message_queue);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        message_queue_delete(message_queue);
+        handle_table_release(&g_message_queue_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_MESSAGE_QUEUE);
+    }
+
+    // set the key to the message queue
+    (*message_queue_identifier) = (*message_queue)->message_queue_identifier;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Stores a created topic in its reserved slot of the handle table and assigns its key.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param topic is a pointer of pointer to the created topic
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_TOPIC: unable to add topic due to subcomponents
+ * */
+size_t kernel_topic_register(size_t *id, topic_t **topic) {
+
+    // store created topic in its reserved slot for fast access
+    size_t handle = (*topic)->id;
+    size_t status = handle_table_set(&g_topic_list, handle, *topic);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        topic_delete(topic);
+        handle_table_release(&g_topic_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TOPIC);
+    }
+
+    // assign key to the topic
+    *id = handle;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Moves all tasks waiting for a sample of a topic to their priority groups.
+ *        Each woken task reads by its own position, so none of them has to be woken twice.
+ * @param topic is a pointer of pointer to the topic
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info Has to be called within a critical section.
+ * */
+size_t kernel_topic_wake_all(topic_t **topic) {
+
+    linked_list_t *waiting_task_list = (*topic)->waiting_task_list;
+    while (waiting_task_list->size > 0) {
+        task_t *task = TASK_FROM_LIST_ELEMENT(waiting_task_list->tail);
+        size_t status = kernel_reinsert_task(&waiting_task_list, &waiting_task_list->tail, &task);
+        if (status != KERNEL_SUCCESS) {
+            return status;
+        }
+    }
+
+    return KERNEL_SUCCESS;
+}
 
-    return status;
+/**
+ * @brief Stores a created queue set in its reserved slot of the handle table and assigns its key.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param queue_set is a queue_set_t pointer of pointer to the created queue set, which is deleted on error
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_QUEUE_SET: unable to add queue set due to subcomponents
+ * */
+size_t kernel_queue_set_register(size_t *id, queue_set_t **queue_set) {
+
+    // store created queue set in its reserved slot for fast access
+    size_t handle = (*queue_set)->id;
+    size_t status = handle_table_set(&g_queue_set_list, handle, *queue_set);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        queue_set_delete(queue_set);
+        handle_table_release(&g_queue_set_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_QUEUE_SET);
+    }
+
+    // assign key to the queue set
+    *id = handle;
+
+    return KERNEL_SUCCESS;
 }
 
-/* Debug module functions (implementation) */
-#ifdef DEBUG
-dictionary_t* kernel_debug_get_list_of_tasks(void) {
-    return g_list_of_tasks;
+/**
+ * @brief Announces a member, which stored a message or a token, and wakes the first task waiting for the queue set.
+ *        Has to be called in a critical section.
+ * @param queue_set is a queue_set_t pointer of pointer to the queue set of the member
+ * @param type is queue_set_member_type_e, which is the kind of the member
+ * @param id is size_t, which is the id of the member
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_SELECT: unable to announce the member due to subcomponents
+ * */
+size_t kernel_queue_set_post(queue_set_t **queue_set, queue_set_member_type_e type, size_t id) {
+    linked_list_element_t *element = NULL;
+    task_t *task = NULL;
+    size_t status = queue_set_post(queue_set, type, id, &element, &task);
+    if (status != QUEUE_SET_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_QUEUE_SET_ERROR_REGISTER, KERNEL_UNABLE_TO_SELECT);
+    }
+
+    if (task != NULL) {
+        return kernel_reinsert_task(&(*queue_set)->waiting_task_list, &element, &task);
+    }
+
+    return KERNEL_SUCCESS;
 }
-#endif
 
-/* Static module functions (implementation) */
+/**
+ * @brief Stores a created stream buffer in its reserved slot of the handle table and assigns its key.
+ * @param id is a pointer of size_t, which receives the key for fast access
+ * @param stream_buffer is a stream_buffer_t pointer of pointer to the created stream buffer, which is deleted on error
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_ADD_STREAM_BUFFER: unable to add stream buffer due to subcomponents
+ * */
+size_t kernel_stream_buffer_register(size_t *id, stream_buffer_t **stream_buffer) {
+
+    // store created stream buffer in its reserved slot for fast access
+    size_t handle = (*stream_buffer)->id;
+    size_t status = handle_table_set(&g_stream_buffer_list, handle, *stream_buffer);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        stream_buffer_delete(stream_buffer);
+        handle_table_release(&g_stream_buffer_list, handle);
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_STREAM_BUFFER);
+    }
+
+    // assign key to the stream buffer
+    *id = handle;
+
+    return KERNEL_SUCCESS;
+}
 
 /**
- * @brief Toggle a critical section to prevent a task switch.
- * @info It allows atomic operations.
+ * @brief Wakes the task of a stream buffer waiting list, which waits longest. Has to be called in a critical section.
+ * @param waiting_task_list is a linked_list_t pointer of pointer to the receiving or the sending list
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_WRITE_STREAM: unable to get the waiting task due to subcomponents
  * */
-void kernel_toggle_critical_section(void) {
-    if (g_kernel_critical_section_active) {
-        kernel_disable_interrupts();
+size_t kernel_stream_buffer_wake(linked_list_t **waiting_task_list) {
+    linked_list_element_t *element = NULL;
+    task_t *task = NULL;
+    size_t status = stream_buffer_get_waiting_task(waiting_task_list, &element, &task);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_STREAM_BUFFER_ERROR_REGISTER, KERNEL_UNABLE_TO_WRITE_STREAM);
     }
-    else {
-        kernel_enable_interrupts();
+
+    if (task != NULL) {
+        return kernel_reinsert_task(waiting_task_list, &element, &task);
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Wakes the task, which waits longest for a block of a memory pool. Has to be called in a critical section.
+ * @param mempool is a mempool_t pointer of pointer to the memory pool
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_FREE_BLOCK: unable to get the waiting task due to subcomponents
+ * */
+size_t kernel_mempool_wake(mempool_t **mempool) {
+    linked_list_element_t *element = NULL;
+    task_t *task = NULL;
+    size_t status = mempool_get_waiting_task(mempool, &element, &task);
+    if (status != MEMPOOL_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_MEMPOOL_ERROR_REGISTER, KERNEL_UNABLE_TO_FREE_BLOCK);
+    }
+
+    if (task != NULL) {
+        return kernel_reinsert_task(&(*mempool)->waiting_task_list, &element, &task);
     }
-    g_kernel_critical_section_active = !g_kernel_critical_section_active;
+
+    return KERNEL_SUCCESS;
 }
 
+/**
+ * @brief Takes a block from the heap in a critical section, used as allocate function of the allocator.
+ * @param context is a tlsf_t pointer to the heap
+ * @param size is the amount of bytes
+ * @return pointer to the block or NULL
+ * */
+void *kernel_heap_allocate(void *context, size_t size) {
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    void *block = tlsf_allocator_allocate(context, size);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return block;
+}
 
 /**
- * @brief Moves a task from blocked to running task list.
- * @param source is a linked_list_t pointer of pointer where an element shall be removed
- * @param element is a linked_list_element_t pointer of pointer which shall be transferred
- * @param task is a task_t pointer of pointer which shall be transferred
+ * @brief Returns a block to the heap in a critical section, used as free function of the allocator.
+ * @param context is a tlsf_t pointer to the heap
+ * @param block is the block to return
+ * */
+void kernel_heap_free(void *context, void *block) {
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+    tlsf_allocator_free(context, block);
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+}
+
+/**
+ * @brief Lists a created task by its id and pushes it into its priority group, which is runnable afterwards.
+ *        The priority group is addressed by the priority, so the insertion takes constant time at every priority.
+ * @param task is a task_t pointer of pointer to the created task
  * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
  * @info the return value is a concatenated status error code based of subcomponents:
- *  KERNEL_UNABLE_TO_REINSERT_TASK: unable to reinsert task due to subcomponents
+ *  KERNEL_UNABLE_TO_ADD_TASK: unable to add task due to different subcomponent errors
  * */
-size_t kernel_reinsert_task(linked_list_t **source, linked_list_element_t **element, task_t **task) {
-    // get the priority group for the task
-    linked_list_t* priority_group = NULL;
-    size_t status = dictionary_get(&g_prioritized_tasks, (*task)->task_data->u8TaskPrio, (void **) &priority_group);
+size_t kernel_insert_task(task_t **task) {
+    uint8_t priority = (*task)->task_data->u8TaskPrio;
+
+    // get the corresponding priority group first, an invalid priority leaves no trace
+    linked_list_t *priority_group = NULL;
+    size_t status = dictionary_get(&g_prioritized_tasks, priority, (void **) &priority_group);
+    if (status!=DICTIONARY_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+    }
+
+    task_t *already_inserted_task = NULL;
+    status = dictionary_get(&g_list_of_tasks, (*task)->task_data->u8TaskId, (void **) &already_inserted_task);
+    if (status == DICTIONARY_VALUE_IS_NULL) {
+        status = dictionary_add(&g_list_of_tasks, (*task)->task_data->u8TaskId, (void **) task);
+        if (status != DICTIONARY_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+        }
+    }
+    else if (status!=DICTIONARY_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+    }
+
+    // always push a task at the linked list head, because the kernel uses the tail by default as first
+    // the element is embedded in the task, every task list is intrusive and never allocates
+    status = linked_list_push_front_element(&priority_group, &(*task)->list_element);
+    if (status!=LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+    }
+
+    status = bitmap_set(&g_ready_priorities, priority);
+    if (status!=BITMAP_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_BITMAP_ERROR_REGISTER, KERNEL_UNABLE_TO_ADD_TASK);
+    }
+
+    g_available_tasks++;
+
+    // the share of the task relates to the cycles since its insertion
+    (*task)->cpu.created = g_cpu_total_cycles;
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Removes a terminated task from the terminated task list and releases its id, the caller frees it by task_delete.
+ *        Has to be called in a critical section and never for the running task.
+ * @param task is a task_t pointer of pointer to a task in the terminated task list
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_TASK: unable to unlink the task due to subcomponents
+ * */
+size_t kernel_unlink_terminated_task(task_t **task) {
+    uint8_t task_id = (*task)->task_data->u8TaskId;
+
+    linked_list_element_t *element = &(*task)->list_element;
+    size_t status = linked_list_pop_inner(&g_terminated_tasks_list, &element, NULL);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_LINK_LIST_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
+    }
+
+    // forget the task, so its id can be used by the next created task
+    task_t *no_task = NULL;
+    status = dictionary_add(&g_list_of_tasks, task_id, (void **) &no_task);
     if (status != DICTIONARY_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_REINSERT_TASK);
+        return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
     }
+    kernel_reset_task_context(task_id);
+    g_available_tasks--;
 
+    return KERNEL_SUCCESS;
+}
 
-    // transfer the task from the source list to its priority group
-    status = linked_list_transfer(&priority_group, source, element);
-    if (status != LINKED_LIST_ELEMENT_SUCCESS) {
-        return ERROR_INFO(status, KERNEL_SEMAPHORE_ERROR_REGISTER, KERNEL_UNABLE_TO_REINSERT_TASK);
+/**
+ * @brief Frees a terminated task and its stack and releases its id. Has to be called in a critical section
+ *        and never for the running task, whose stack stays in use until the next task switch.
+ * @param task is a task_t pointer of pointer to a task in the terminated task list
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_TASK: unable to free the task due to subcomponents
+ * */
+size_t kernel_reap_task(task_t **task) {
+    size_t status = kernel_unlink_terminated_task(task);
+    if (status != KERNEL_SUCCESS) {
+        return status;
     }
 
-    // mark task as ready again
-    task_set_state(task, TaskState_Ready);
+    status = task_delete(task);
+    if (status != TASK_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_DELETE_TASK);
+    }
 
-    // the reinserted tasks priority might be higher than the current priority list
-    // or the kernel wakes up from idle
-    size_t incoming_priority = (*task)->task_data->u8TaskPrio;
-    if (incoming_priority < g_dictionary_priority || g_kernel_status == EN_KERNEL_IDLE) {
-        g_priority_group_next = priority_group;
-        g_linked_list_task_iterator_next = priority_group->tail;
-        g_running_task_next = *task;
-        g_dictionary_priority_next = incoming_priority;
-        g_dictionary_priority = incoming_priority;
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Frees every terminated task and its stack, except the running and the preset next task.
+ *        Is called by the idle loop of the port, so neither a terminating task nor the task, which deleted another one,
+ *        pays for releasing the memory.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_DELETE_TASK: unable to free a task due to subcomponents
+ * */
+size_t kernel_reap_terminated_tasks(void) {
+    size_t status = KERNEL_SUCCESS;
+
+    // ------------------- critical section start -------------------------
+    kernel_enter_critical();
+
+    linked_list_element_t *element = g_terminated_tasks_list->tail;
+    while (element != NULL && status == KERNEL_SUCCESS) {
+        // reaping unlinks the element, so the following one is read first
+        linked_list_element_t *next = element->next;
+        task_t *task = TASK_FROM_LIST_ELEMENT(element);
+        if (task != g_running_task_current && task != g_running_task_next) {
+            status = kernel_reap_task(&task);
+        }
+        element = next;
+    }
+
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    return status;
+}
+
+/**
+ * @brief Clears all cycles and charges the following cycles to idle, until the first task switch.
+ * @return None
+ * */
+void kernel_cpu_reset(void) {
+    g_cpu_total_cycles = 0;
+    g_cpu_idle_cycles = 0;
+    g_cpu_isr_cycles = 0;
+    g_cpu_account = &g_cpu_idle_cycles;
+    g_cpu_account_interrupted = &g_cpu_idle_cycles;
+    g_cpu_isr_nesting = 0;
+    g_cpu_timestamp = kernel_get_cycles();
+
+    for (size_t sample = 0; sample < KERNEL_CPU_LOAD_SAMPLES; sample++) {
+        g_cpu_samples[sample] = (kernel_cpu_sample_t) { 0 };
+    }
+    g_cpu_sample_index = 0;
+    g_cpu_sample_ticks = 0;
+}
+
+/**
+ * @brief Charges the cycles since the last charge to the current account and switches to the given account.
+ *        The counter difference is unsigned, so a wrapping cycle counter is charged correctly.
+ *        Has to be called with masked interrupts.
+ * @param account is a uint64_t pointer, which is charged with the following cycles
+ * @return None
+ * */
+void kernel_cpu_charge(uint64_t *account) {
+    size_t now = kernel_get_cycles();
+    size_t elapsed = now - g_cpu_timestamp;
+    g_cpu_timestamp = now;
+    *g_cpu_account += elapsed;
+    g_cpu_total_cycles += elapsed;
+    g_cpu_account = account;
+}
+
+/**
+ * @brief Charges the following cycles to the task, which is switched to. Called by the ports on every
+ *        task switch with disabled interrupts. Inside an interrupt the task is charged after its exit.
+ * @param task is a task_t pointer to the task, which runs next
+ * @return None
+ * */
+void kernel_cpu_switch(task_t *task) {
+    uint64_t *account = &task->cpu.cycles;
+    if (g_cpu_isr_nesting > 0) {
+        if (g_cpu_account_interrupted != account) {
+            task->cpu.activations++;
+        }
+        g_cpu_account_interrupted = account;
+    }
+    else if (g_cpu_account != account) {
+        task->cpu.activations++;
+        kernel_cpu_charge(account);
+    }
+}
+
+/**
+ * @brief Charges the following cycles to idle. Called by the ports on entering idle,
+ *        before the interrupts are unmasked and before terminated tasks are reaped.
+ * @return None
+ * */
+void kernel_cpu_enter_idle(void) {
+    if (g_cpu_isr_nesting > 0) {
+        g_cpu_account_interrupted = &g_cpu_idle_cycles;
     }
     else {
-        // it is important to update the next task logic, if the moved task belongs to the current running priority group
-        g_linked_list_task_iterator_next = g_linked_list_task_iterator->next;
-        g_running_task_next = g_linked_list_task_iterator_next->data;
+        kernel_cpu_charge(&g_cpu_idle_cycles);
+    }
+}
+
+/**
+ * @brief Takes a cpu load sample every KERNEL_CPU_LOAD_PERIOD ticks. Called by the ports on every tick
+ *        inside the accounted tick interrupt. The oldest sample starts the sliding window of the cpu load.
+ * @return None
+ * */
+void kernel_cpu_tick(void) {
+    g_cpu_sample_ticks++;
+    if (g_cpu_sample_ticks < KERNEL_CPU_LOAD_PERIOD) {
+        return;
+    }
+    g_cpu_sample_ticks = 0;
+
+    kernel_cpu_charge(g_cpu_account);
+    g_cpu_samples[g_cpu_sample_index].total_cycles = g_cpu_total_cycles;
+    g_cpu_samples[g_cpu_sample_index].idle_cycles = g_cpu_idle_cycles;
+    g_cpu_sample_index = (g_cpu_sample_index + 1) % KERNEL_CPU_LOAD_SAMPLES;
+}
+
+/**
+ * @brief Queues a command for the timer daemon and wakes it up.
+ * @param id is size_t, which is the key of the timer
+ * @param command is size_t, which is one of KERNEL_TIMER_COMMAND_x
+ * @param error_code is size_t, which is the callers error code for subcomponent errors
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents with the given error code
+ * */
+size_t kernel_timer_send_command(size_t id, size_t command, size_t error_code) {
+    // check for an existing timer before the daemon receives the command
+    software_timer_t *timer = NULL;
+    size_t status = handle_table_get(&g_timer_list, id, (void **) &timer);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, error_code);
+    }
+
+    // the period starts with the command and not with its execution
+    kernel_timer_command_t timer_command = {
+        .command = command,
+        .id = id,
+        .tick = g_timer_wheel->now,
+    };
+
+    status = kernel_message_queue_send(&g_timer_command_queue, &timer_command, sizeof(kernel_timer_command_t), false);
+    if (status!=KERNEL_SUCCESS) {
+        return status;
+    }
+
+    return kernel_event_send(KERNEL_TIMER_DAEMON_ID, KERNEL_TIMER_EVENT_COMMAND);
+}
+
+/**
+ * @brief Executes all queued timer commands without blocking the timer daemon.
+ * @return KERNEL_SUCCESS on success or unequal KERNEL_SUCCESS on error
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_MESSAGE: unable to receive commands due to subcomponents
+ * */
+size_t kernel_timer_receive_commands(void) {
+    message_queue_t *message_queue = NULL;
+    size_t status = handle_table_get(&g_message_queue_list, g_timer_command_queue->id, (void **) &message_queue);
+    if (status!=HANDLE_TABLE_SUCCESS) {
+        return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
+    }
+
+    kernel_timer_command_t timer_command;
+    void *message = &timer_command;
+    software_timer_t *timer = NULL;
+
+    // only the timer daemon receives, so a non empty queue never blocks
+    while (message_queue->qcb->length > 0) {
+
+        status = kernel_message_queue_receive(&g_timer_command_queue, &message);
+        if (status!=KERNEL_SUCCESS) {
+            return status;
+        }
+
+        status = handle_table_get(&g_timer_list, timer_command.id, (void **) &timer);
+        if (status!=HANDLE_TABLE_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_HANDLE_TABLE_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
+        }
+
+        switch (timer_command.command) {
+        case KERNEL_TIMER_COMMAND_START:
+            if (!timer->active) {
+                status = software_timer_start(&g_active_timers, &timer, timer_command.tick);
+            }
+            break;
+        case KERNEL_TIMER_COMMAND_STOP:
+            status = software_timer_stop(&g_active_timers, &timer);
+            break;
+        case KERNEL_TIMER_COMMAND_RESET:
+            status = software_timer_start(&g_active_timers, &timer, timer_command.tick);
+            break;
+        default:
+            break;
+        }
+
+        if (status!=SOFTWARE_TIMER_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_SOFTWARE_TIMER_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
+        }
+    }
+
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Timer daemon task, which executes the callbacks of all software timers in deadline order.
+ *        It sleeps until the earliest deadline or until a command arrives.
+ * @return Only returns on error, which is the exit code of the daemon.
+ * @info the return value is a concatenated status error code based of subcomponents:
+ *  KERNEL_UNABLE_TO_RECEIVE_MESSAGE: unable to receive commands or to get the next deadline due to subcomponents
+ * */
+size_t kernel_timer_daemon(void) {
+    size_t received_events = 0;
+    size_t expired_timers = 0;
+    size_t ticks = 0;
+
+    while (true) {
+        // the timers are only manipulated by the daemon, hence the callbacks run outside a critical section
+        software_timer_process(&g_active_timers, g_timer_wheel->now, &expired_timers);
+
+        // a failed command queue or timer list would be retried forever, the daemon terminates instead
+        size_t status = kernel_timer_receive_commands();
+        if (status != KERNEL_SUCCESS) {
+            return status;
+        }
+
+        status = software_timer_get_next_ticks(&g_active_timers, g_timer_wheel->now, &ticks);
+        if (status == SOFTWARE_TIMER_IS_EMPTY) {
+            // nothing to expire, wait for the next command
+            kernel_event_receive_blocking(&received_events);
+        }
+        else if (status != SOFTWARE_TIMER_SUCCESS) {
+            return ERROR_INFO(status, KERNEL_SOFTWARE_TIMER_ERROR_REGISTER, KERNEL_UNABLE_TO_RECEIVE_MESSAGE);
+        }
+        else if (ticks > 0) {
+            // a command ends the wait before the earliest deadline
+            g_running_task_current->event_register.timeout = ticks;
+            kernel_event_receive_timeout(&received_events);
+        }
     }
 
+    return KERNEL_SUCCESS;
+}
+
+/**
+ * @brief Work daemon task, which executes all posted work items in posting order as a batch.
+ *        It sleeps until an interrupt posts to an empty batch.
+ * @return Never returns.
+ * */
+size_t kernel_work_daemon(void) {
+    size_t received_events = 0;
+    work_item_t work_item;
+
+    while (true) {
+        // later posts signal again, their event ends the next wait at once
+        g_work_signaled = 0;
+
+        size_t batch = 0;
+        while (work_queue_read(&g_work_queue, &work_item) == WORK_QUEUE_SUCCESS) {
+            size_t latency = kernel_get_cycles() - work_item.timestamp;
+
+            // the work items run outside a critical section like the timer callbacks
+            work_item.function(work_item.argument);
+            batch++;
+
+            // ------------------- critical section start -------------------------
+            kernel_enter_critical();
+            g_work_statistics.executed++;
+            g_work_statistics.latency_last = latency;
+            g_work_statistics.latency_total += latency;
+            if (latency > g_work_statistics.latency_max) {
+                g_work_statistics.latency_max = latency;
+            }
+            kernel_exit_critical();
+            // ------------------- critical section end ----------------------------
+        }
+
+        if (batch > 0) {
+            kernel_enter_critical();
+            g_work_statistics.batches++;
+            if (batch > g_work_statistics.batch_max) {
+                g_work_statistics.batch_max = batch;
+            }
+            kernel_exit_critical();
+        }
+
+        kernel_event_receive_blocking(&received_events);
+    }
 
     return KERNEL_SUCCESS;
 }
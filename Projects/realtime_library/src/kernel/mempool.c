@@ -0,0 +1,274 @@
+/**
+**************************************************
+* @file mempool.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for pools of fixed-size blocks shared by tasks and interrupts
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'mempool_create' to create a memory pool over
+      caller supplied blocks
+  (#) Call 'mempool_create_static' to create a memory pool
+      in caller supplied storage
+  (#) Call 'mempool_delete' to delete a memory pool
+  (#) Call 'mempool_alloc' to take a block in constant time
+  (#) Call 'mempool_free' to return a block in constant time
+  (#) Call 'mempool_get_waiting_task' to get the task, which
+      waits longest for a block
+  (#) Call 'mempool_wait' to block a task until a block
+      is returned
+  (#) All functions call 'mempool_checking' to validate
+      proper memory pool structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "kernel/mempool.h"
+#include "kernel/kernel_config.h"
+#include "utils/support.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+POOL_DEFINE(g_mempool_pool, mempool_static_t, KERNEL_POOL_MEMPOOLS);
+
+/* Static module functions (prototypes) */
+
+/* Public functions */
+/**
+ * @brief Creates a memory pool over caller supplied blocks, its control information is allocated.
+ * @param mempool is a pointer of pointer to be initialized as a memory pool
+ * @param id is the unique id of the memory pool with which it is accessed
+ * @param blocks is continuous 8 byte aligned memory of MEMPOOL_STORAGE_SIZE(block_size, count) bytes
+ * @param block_size is the usable size of a single block in bytes
+ * @param count is the amount of blocks
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  MEMPOOL_NO_MEMORY: unable to allocate memory for the memory pool
+ *  MEMPOOL_NO_POOL: unable to initialize the blocks
+ *  MEMPOOL_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t mempool_create(mempool_t **mempool, size_t id, void *blocks, size_t block_size, size_t count) {
+    mempool_static_t *storage = POOL_ALLOCATE(g_mempool_pool, mempool_static_t);
+    if (storage == NULL) {
+        return MEMPOOL_NO_MEMORY;
+    }
+
+    size_t status = mempool_create_static(mempool, storage, blocks, id, block_size, count);
+    if (status != MEMPOOL_SUCCESS) {
+        POOL_FREE(g_mempool_pool, storage);
+        (*mempool) = NULL;
+        return status;
+    }
+    (*mempool)->allocated = true;
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Creates a memory pool in caller supplied storage, which is never released.
+ * @param mempool is a pointer of pointer to be initialized as a memory pool
+ * @param storage is the memory of the memory pool and its waiting list, which must outlive it
+ * @param blocks is continuous 8 byte aligned memory of MEMPOOL_STORAGE_SIZE(block_size, count) bytes
+ * @param id is the unique id of the memory pool with which it is accessed
+ * @param block_size is the usable size of a single block in bytes
+ * @param count is the amount of blocks
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  MEMPOOL_NO_MEMORY: storage is NULL
+ *  MEMPOOL_NO_POOL: blocks is NULL or count is 0
+ *  MEMPOOL_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t mempool_create_static(mempool_t **mempool, mempool_static_t *storage, void *blocks, size_t id, size_t block_size, size_t count) {
+
+    if (storage == NULL) {
+        return MEMPOOL_NO_MEMORY;
+    }
+
+    if (count == 0) {
+        return MEMPOOL_NO_POOL;
+    }
+
+    (*mempool) = &storage->mempool;
+    (*mempool)->id = id;
+    (*mempool)->high_water = 0;
+    (*mempool)->failures = 0;
+    (*mempool)->allocated = false;
+
+    // returned blocks are linked through their first word, the blocks need no initialization
+    size_t status = pool_create_static(&(*mempool)->pool, &storage->pool, blocks, MEMPOOL_BLOCK_SIZE(block_size), count);
+    if (status != POOL_SUCCESS) {
+        return ERROR_INFO(status, MEMPOOL_POOL_ERROR_REGISTER, MEMPOOL_NO_POOL);
+    }
+
+    // waiting tasks are linked by their embedded element
+    status = linked_list_create_intrusive_static(&(*mempool)->waiting_task_list, &storage->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, MEMPOOL_LINKED_LIST_ERROR_REGISTER, MEMPOOL_NO_WAITING_LIST);
+    }
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Deletes a memory pool, the waiting tasks have to be released before. The blocks stay with the caller.
+ * @param mempool is a pointer of pointer to be deleted
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  MEMPOOL_NO_WAITING_LIST: unable to delete waiting list
+ */
+size_t mempool_delete(mempool_t **mempool) {
+
+    size_t status = mempool_checking(mempool);
+    if (status != MEMPOOL_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_delete(&(*mempool)->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, MEMPOOL_LINKED_LIST_ERROR_REGISTER, MEMPOOL_NO_WAITING_LIST);
+    }
+
+    // the pool control and the waiting list are stored in the same block
+    if ((*mempool)->allocated) {
+        POOL_FREE(g_mempool_pool, *mempool);
+    }
+    (*mempool) = NULL;
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Takes a block from the memory pool in constant time and tracks the most blocks allocated at once.
+ * @param mempool is a pointer of pointer to the memory pool
+ * @param block is a pointer of pointer, which receives the block
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for this error:
+ *  MEMPOOL_EXHAUSTED: all blocks are allocated, block is set to NULL
+ */
+size_t mempool_alloc(mempool_t **mempool, void **block) {
+
+    size_t status = mempool_checking(mempool);
+    if (status != MEMPOOL_SUCCESS) {
+        return status;
+    }
+
+    (*block) = pool_allocate(&(*mempool)->pool);
+    if ((*block) == NULL) {
+        return MEMPOOL_EXHAUSTED;
+    }
+
+    if ((*mempool)->pool->in_use > (*mempool)->high_water) {
+        (*mempool)->high_water = (*mempool)->pool->in_use;
+    }
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Returns a block to the memory pool in constant time. The waiting tasks have to be released afterwards.
+ * @param mempool is a pointer of pointer to the memory pool
+ * @param block is the block to return, NULL is ignored like by free
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  MEMPOOL_UNABLE_TO_FREE: block was not handed out by this memory pool
+ */
+size_t mempool_free(mempool_t **mempool, void *block) {
+
+    size_t status = mempool_checking(mempool);
+    if (status != MEMPOOL_SUCCESS) {
+        return status;
+    }
+
+    status = pool_free(&(*mempool)->pool, block);
+    if (status != POOL_SUCCESS) {
+        return ERROR_INFO(status, MEMPOOL_POOL_ERROR_REGISTER, MEMPOOL_UNABLE_TO_FREE);
+    }
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Gets the task, which waits longest for a block.
+ * @param mempool is a pointer of pointer to the memory pool
+ * @param element is a linked_list_element_t pointer of pointer, which receives the element of the task
+ * @param task is a task_t pointer of pointer, which receives the task or NULL, if no task is waiting
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ */
+size_t mempool_get_waiting_task(mempool_t **mempool, linked_list_element_t **element, task_t **task) {
+
+    size_t status = mempool_checking(mempool);
+    if (status != MEMPOOL_SUCCESS) {
+        return status;
+    }
+
+    (*task) = NULL;
+    if ((*mempool)->waiting_task_list->size > 0) {
+        (*element) = (*mempool)->waiting_task_list->tail;
+        (*task) = TASK_FROM_LIST_ELEMENT(*element);
+    }
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Moves the running task into the waiting list of the memory pool.
+ * @param mempool is a pointer of pointer to the memory pool
+ * @param running_task_list is a linked_list_t pointer of pointer to the priority group of the running task
+ * @param running_task_element is a linked_list_element_t pointer of pointer to the running task
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  MEMPOOL_UNABLE_TO_WAIT: unable to move the task
+ */
+size_t mempool_wait(mempool_t **mempool, linked_list_t **running_task_list, linked_list_element_t **running_task_element) {
+
+    size_t status = mempool_checking(mempool);
+    if (status != MEMPOOL_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_transfer(&(*mempool)->waiting_task_list, running_task_list, running_task_element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, MEMPOOL_LINKED_LIST_ERROR_REGISTER, MEMPOOL_UNABLE_TO_WAIT);
+    }
+
+    return MEMPOOL_SUCCESS;
+}
+
+/**
+ * @brief Validates a memory pool
+ * @param mempool is a pointer of pointer to the memory pool
+ * @return MEMPOOL_SUCCESS on success or unequal MEMPOOL_SUCCESS for an error
+ * @info On error check for these errors:
+ *  MEMPOOL_IS_NULL: memory pool is not initialized
+ *  MEMPOOL_NO_POOL: blocks are not initialized
+ *  MEMPOOL_NO_WAITING_LIST: waiting list is not initialized
+ */
+size_t mempool_checking(mempool_t **mempool) {
+
+    if (mempool == NULL || (*mempool) == NULL) {
+        return MEMPOOL_IS_NULL;
+    }
+
+    if (pool_checking(&(*mempool)->pool) != POOL_SUCCESS) {
+        return MEMPOOL_NO_POOL;
+    }
+
+    if ((*mempool)->waiting_task_list == NULL) {
+        return MEMPOOL_NO_WAITING_LIST;
+    }
+
+    return MEMPOOL_SUCCESS;
+}
+
+/* Static module functions (implementation) */
@@ -12,11 +12,20 @@
  ==================================================
  ### Usage ###
  (#) Call 'message_queue_create' to create a message queue
+ (#) Call 'message_queue_create_static' to create a message queue
+     in caller supplied storage
+ (#) Call 'message_queue_create_loan' to create a message queue,
+     which loans its blocks to the senders instead of copying
+ (#) Call 'message_queue_create_loan_static' to create a loaning
+     message queue in caller supplied storage
  (#) Call 'message_queue_delete' to delete a message queue
  (#) Call 'message_queue_send' to send info to a task
  (#) Call 'message_queue_send_blocking' to send info to a task,
      but the sending task can be blocked
  (#) Call 'message_queue_receive' to receive a message
+ (#) Call 'message_queue_alloc' to loan a block, which is filled in
+     place and sent as pointer
+ (#) Call 'message_queue_release' to return a received block
  (#) Call 'message_queue_identifier_checking' to check the message queues identifier
  (#) Call 'message_queue_checking' to check the message queues
  ==================================================
@@ -28,6 +37,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include "utils/linked_list.h"
+#include "utils/pool.h"
 #include "utils/support.h"
 
 /* Preprocessor defines */
@@ -47,42 +57,91 @@ size_t message_queue_checking(message_queue_t **message_queue);
  * @param name is a string identifier
  * @return 0 on success or greater 0 on error
  * @info On error check for these errors and component errors:
- *     MESSAGE_QUEUE_NO_MEMORY: unable to allocate memory for message queue
- *    MESSAGE_QUEUE_NO_IDENTIFIER: unable to allocate memory for message queue identifier
+ *     MESSAGE_QUEUE_NO_MEMORY: unable to allocate memory for message queue, always in static allocation mode
+ *  MESSAGE_QUEUE_NO_QUEUE: unable to allocate memory for the queue data
  *  MESSAGE_QUEUE_NO_RECEIVING_LIST: unable to initialize receiving list
  *  MESSAGE_QUEUE_NO_SENDING_LIST: unable to initialize sending list
  */
 size_t message_queue_create(message_queue_t **message_queue, size_t message_queue_size, size_t element_size, size_t id, char *name) {
 
+#if KERNEL_STATIC_ALLOCATION
+    // the buffer size is only known at runtime, supply it with message_queue_create_static
+    (void) message_queue_size;
+    (void) element_size;
+    (void) id;
+    (void) name;
+    (*message_queue) = NULL;
+    return MESSAGE_QUEUE_NO_MEMORY;
+#else
     // allocate memory and return to error
-    (*message_queue) = (message_queue_t*) malloc(sizeof(message_queue_t));
-    if ((*message_queue) == NULL) {
+    message_queue_static_t *storage = (message_queue_static_t *) allocator_allocate(sizeof(message_queue_static_t));
+    if (storage == NULL) {
         return MESSAGE_QUEUE_NO_MEMORY;
     }
 
-    // assign identifier for id and name
-    (*message_queue)->message_queue_identifier = (message_queue_identifier_t*) malloc(sizeof(message_queue_identifier_t));
-    if ((*message_queue)->message_queue_identifier == NULL) {
-        return MESSAGE_QUEUE_NO_IDENTIFIER;
+    void **data = (void **) allocator_allocate(message_queue_size * sizeof(void *));
+    void *buffer = allocator_allocate(message_queue_size * element_size);
+    if (data == NULL || buffer == NULL) {
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free(storage);
+        return ERROR_INFO(QUEUE_DATA_NO_MEMORY, MESSAGE_QUEUE_QUEUE_ERROR_REGISTER, MESSAGE_QUEUE_NO_QUEUE);
+    }
+
+    size_t status = message_queue_create_static(message_queue, storage, data, buffer, message_queue_size, element_size, id, name);
+    (*message_queue)->allocated = true;
+
+    return status;
+#endif
+}
+
+/**
+ * @brief Creates a message queue in caller supplied storage, which is never released.
+ * @param message_queue is a message_queue_t pointer of pointer to be initialized as a message queue
+ * @param storage is the memory of the message queue and its components, which must outlive it
+ * @param data is an array of queue_size entries
+ * @param buffer is continuous memory of queue_size * element_size bytes
+ * @param queue_size is the amount of data to be stored
+ * @param element_size is the expected data size of an element
+ * @param id is a numeric identifier
+ * @param name is a string identifier
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors and component errors:
+ *     MESSAGE_QUEUE_NO_MEMORY: storage is NULL
+ *  MESSAGE_QUEUE_NO_QUEUE: unable to initialize the queue, data or buffer is NULL
+ *  MESSAGE_QUEUE_NO_RECEIVING_LIST: unable to initialize receiving list
+ *  MESSAGE_QUEUE_NO_SENDING_LIST: unable to initialize sending list
+ */
+size_t message_queue_create_static(message_queue_t **message_queue, message_queue_static_t *storage, void **data, void *buffer, size_t message_queue_size, size_t element_size, size_t id, char *name) {
+
+    if (storage == NULL) {
+        return MESSAGE_QUEUE_NO_MEMORY;
     }
 
+    (*message_queue) = &storage->message_queue;
+    (*message_queue)->allocated = false;
+    (*message_queue)->blocks = NULL;
+    (*message_queue)->queue_set = NULL;
+
+    // assign identifier for id and name
+    (*message_queue)->message_queue_identifier = &storage->message_queue_identifier;
     (*message_queue)->message_queue_identifier->id = id;
     (*message_queue)->message_queue_identifier->name = name;
 
     // create queue for message queue
-    size_t status = queue_create(&(*message_queue)->qcb, message_queue_size, element_size);
+    size_t status = queue_create_static(&(*message_queue)->qcb, &storage->qcb, data, buffer, message_queue_size, element_size);
     if (status != QUEUE_SUCCESS) {
         return ERROR_INFO(status, MESSAGE_QUEUE_QUEUE_ERROR_REGISTER, MESSAGE_QUEUE_NO_QUEUE);
     }
 
-    // create receiving task linked list
-    status = linked_list_create(&(*message_queue)->receiving_task_list);
+    // create receiving task linked list, the tasks are linked by their embedded element
+    status = linked_list_create_intrusive_static(&(*message_queue)->receiving_task_list, &storage->receiving_task_list);
     if (status != LINKED_LIST_SUCCESS) {
         return ERROR_INFO(status, MESSAGE_QUEUE_RECEIVING_LINKED_LIST_ERROR_REGISTER, MESSAGE_QUEUE_NO_RECEIVING_LIST);
     }
 
     // create sending task linked list
-    status = linked_list_create(&(*message_queue)->sending_task_list);
+    status = linked_list_create_intrusive_static(&(*message_queue)->sending_task_list, &storage->sending_task_list);
     if (status != LINKED_LIST_SUCCESS) {
         return ERROR_INFO(status, MESSAGE_QUEUE_SENDING_LINKED_LIST_ERROR_REGISTER, MESSAGE_QUEUE_NO_SENDING_LIST);
     }
@@ -90,6 +149,87 @@ size_t message_queue_create(message_queue_t **message_queue, size_t message_queu
     return MESSAGE_QUEUE_SUCCESS;
 }
 
+/**
+ * @brief Creates a message queue, which loans blocks of message_size bytes to the senders.
+ *        A block is filled in place and only its pointer is queued, the receiver releases it.
+ * @param message_queue is a message_queue_t pointer of pointer to be initialized as a message queue
+ * @param queue_size is the amount of blocks and queued pointers
+ * @param message_size is the size of a single block
+ * @param id is a numeric identifier
+ * @param name is a string identifier
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors and component errors:
+ *     MESSAGE_QUEUE_NO_MEMORY: unable to allocate memory for message queue, always in static allocation mode
+ *  MESSAGE_QUEUE_NO_QUEUE: unable to allocate memory for the queue data or the blocks
+ */
+size_t message_queue_create_loan(message_queue_t **message_queue, size_t message_queue_size, size_t message_size, size_t id, char *name) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the block size is only known at runtime, supply it with message_queue_create_loan_static
+    (void) message_queue_size;
+    (void) message_size;
+    (void) id;
+    (void) name;
+    (*message_queue) = NULL;
+    return MESSAGE_QUEUE_NO_MEMORY;
+#else
+    message_queue_static_t *storage = (message_queue_static_t *) allocator_allocate(sizeof(message_queue_static_t));
+    if (storage == NULL) {
+        return MESSAGE_QUEUE_NO_MEMORY;
+    }
+
+    void **data = (void **) allocator_allocate(message_queue_size * sizeof(void *));
+    void **buffer = (void **) allocator_allocate(message_queue_size * sizeof(void *));
+    void *blocks = allocator_allocate(message_queue_size * POOL_BLOCK_SIZE(message_size));
+    if (data == NULL || buffer == NULL || blocks == NULL) {
+        allocator_free(blocks);
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free(storage);
+        return ERROR_INFO(QUEUE_DATA_NO_MEMORY, MESSAGE_QUEUE_QUEUE_ERROR_REGISTER, MESSAGE_QUEUE_NO_QUEUE);
+    }
+
+    size_t status = message_queue_create_loan_static(message_queue, storage, data, buffer, blocks, message_queue_size, message_size, id, name);
+    (*message_queue)->allocated = true;
+
+    return status;
+#endif
+}
+
+/**
+ * @brief Creates a message queue, which loans its blocks to the senders, in caller supplied storage.
+ * @param message_queue is a message_queue_t pointer of pointer to be initialized as a message queue
+ * @param storage is the memory of the message queue and its components, which must outlive it
+ * @param data is an array of queue_size entries
+ * @param buffer is an array of queue_size pointers, which carries the sent blocks
+ * @param blocks is continuous 8 byte aligned memory of queue_size * POOL_BLOCK_SIZE(message_size) bytes
+ * @param queue_size is the amount of blocks and queued pointers
+ * @param message_size is the size of a single block
+ * @param id is a numeric identifier
+ * @param name is a string identifier
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors and component errors:
+ *     MESSAGE_QUEUE_NO_MEMORY: storage is NULL
+ *  MESSAGE_QUEUE_NO_QUEUE: unable to initialize the queue or the blocks
+ */
+size_t message_queue_create_loan_static(message_queue_t **message_queue, message_queue_static_t *storage, void **data, void *buffer, void *blocks, size_t message_queue_size, size_t message_size, size_t id, char *name) {
+
+    // the queue only carries the pointers of the blocks
+    size_t status = message_queue_create_static(message_queue, storage, data, buffer, message_queue_size, sizeof(void *), id, name);
+    if (status != MESSAGE_QUEUE_SUCCESS) {
+        return status;
+    }
+
+    // every queued pointer can refer to its own block, hence sending a loaned block never fails
+    status = pool_create_static(&(*message_queue)->blocks, &storage->blocks, blocks, POOL_BLOCK_SIZE(message_size), message_queue_size);
+    if (status != POOL_SUCCESS) {
+        (*message_queue)->blocks = NULL;
+        return ERROR_INFO(status, MESSAGE_QUEUE_LENGTH, MESSAGE_QUEUE_NO_QUEUE);
+    }
+
+    return MESSAGE_QUEUE_SUCCESS;
+}
+
 /**
  * @brief Deletes a message queue
  * @param message_queue is a message_queue_t pointer of pointer to be deleted
@@ -104,6 +244,11 @@ size_t message_queue_delete(message_queue_t **message_queue) {
         return status;
     }
 
+    // data, buffer and blocks are only owned, when the queue was created by message_queue_create or message_queue_create_loan
+    void **data = (*message_queue)->qcb->data;
+    void *buffer = (*message_queue)->qcb->data[0];
+    void *blocks = (*message_queue)->blocks != NULL ? (*message_queue)->blocks->storage : NULL;
+
     // delete queue
     status = queue_delete(&(*message_queue)->qcb);
     if (status != QUEUE_SUCCESS) {
@@ -122,12 +267,16 @@ size_t message_queue_delete(message_queue_t **message_queue) {
         return ERROR_INFO(status, MESSAGE_QUEUE_SENDING_LINKED_LIST_ERROR_REGISTER, MESSAGE_QUEUE_UNABLE_TO_DELETE);
     }
 
-    // delete identifier
-    free(&(*message_queue)->message_queue_identifier);
+    // identifier and lists are stored in the same block as the message queue
     (*message_queue)->message_queue_identifier = NULL;
 
-    // delete message queue
-    free(*message_queue);
+    // delete message queue, caller supplied storage stays untouched
+    if ((*message_queue)->allocated) {
+        allocator_free(blocks);
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free(*message_queue);
+    }
     *message_queue = NULL;
 
     return MESSAGE_QUEUE_SUCCESS;
@@ -158,12 +307,19 @@ size_t message_queue_send(
         return status;
     }
 
+    // a loaned block is filled in place already, only its pointer is sent
+    void *block = message;
+    if ((*message_queue)->blocks != NULL) {
+        message = &block;
+        element_size = sizeof(void *);
+    }
+
     // before a message is queued, check for available tasks
     if ((*message_queue)->receiving_task_list->size > 0) {
 
         // assign return values
         (*element) = (*message_queue)->receiving_task_list->tail;
-        (*task) = (task_t*) (*element)->data;
+        (*task) = TASK_FROM_LIST_ELEMENT(*element);
 
         // check task for irregular structure
         status = task_checking(task);
@@ -269,27 +425,33 @@ size_t message_queue_receive(
         return ERROR_INFO(status, MESSAGE_QUEUE_TASK_ERROR_REGISTER, MESSAGE_QUEUE_UNABLE_TO_RECEIVE);
     }
 
+    // a loaning message queue receives the pointer of a block instead of its content
+    bool loan = (*message_queue)->blocks != NULL;
+    void *destination = loan ? (void *) message : (*message);
+
     // check if a message was stored at a task
     if ((*receiver_task)->message_set) {
         // parked message can be used
         // reset signal mechanic
         (*receiver_task)->message_set = false;
-        (*message) = (*receiver_task)->message;
+        if (!loan) {
+            (*message) = (*receiver_task)->message;
+        }
         (*receiver_task)->message = NULL;
         // try to obtain blocked sending task
         if ((*message_queue)->sending_task_list->size > 0) {
             (*sender_element) = (*message_queue)->sending_task_list->tail;
-            (*sender_task) = (task_t*) (*sender_element)->data;
+            (*sender_task) = TASK_FROM_LIST_ELEMENT(*sender_element);
         }
 
         return MESSAGE_QUEUE_SUCCESS;
     }
 
     // a message was not parked to a task
-    status = queue_read(&(*message_queue)->qcb, message);
+    status = queue_read(&(*message_queue)->qcb, &destination);
     if (status == QUEUE_NO_ELEMENT) {
         // no message found and the task about to block
-        (*receiver_task)->message = (*message);
+        (*receiver_task)->message = destination;
         status = linked_list_transfer(&(*message_queue)->receiving_task_list, running_task_list, running_task_element);
         if (status != LINKED_LIST_SUCCESS) {
             return ERROR_INFO(status, MESSAGE_QUEUE_LINKED_LIST_ERROR_REGISTER, MESSAGE_QUEUE_UNABLE_TO_RECEIVE);
@@ -302,7 +464,65 @@ size_t message_queue_receive(
     // try to obtain blocked sending task
     if ((*message_queue)->sending_task_list->size > 0) {
         (*sender_element) = (*message_queue)->sending_task_list->tail;
-        (*sender_task) = (task_t*) (*sender_element)->data;
+        (*sender_task) = TASK_FROM_LIST_ELEMENT(*sender_element);
+    }
+
+    return MESSAGE_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Loans a free block, which is filled in place and sent by message_queue_send.
+ * @param message_queue is a message_queue_t pointer of pointer to a loaning message queue
+ * @param block is a void pointer of pointer, which receives the block
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     MESSAGE_QUEUE_NO_LOAN: the message queue copies its messages
+ *  MESSAGE_QUEUE_NO_FREE_BLOCK: every block is loaned or queued
+ */
+size_t message_queue_alloc(message_queue_t **message_queue, void **block) {
+
+    // check message queue for irregular structure
+    size_t status = message_queue_checking(message_queue);
+    if (status != MESSAGE_QUEUE_SUCCESS) {
+        return status;
+    }
+
+    if ((*message_queue)->blocks == NULL) {
+        return MESSAGE_QUEUE_NO_LOAN;
+    }
+
+    (*block) = pool_allocate(&(*message_queue)->blocks);
+    if ((*block) == NULL) {
+        return MESSAGE_QUEUE_NO_FREE_BLOCK;
+    }
+
+    return MESSAGE_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Returns a received or an unsent block to a loaning message queue.
+ * @param message_queue is a message_queue_t pointer of pointer to a loaning message queue
+ * @param block is a void pointer to the block, which must not be used afterwards
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     MESSAGE_QUEUE_NO_LOAN: the message queue copies its messages
+ *  MESSAGE_QUEUE_UNABLE_TO_RELEASE: the block does not belong to the message queue
+ */
+size_t message_queue_release(message_queue_t **message_queue, void *block) {
+
+    // check message queue for irregular structure
+    size_t status = message_queue_checking(message_queue);
+    if (status != MESSAGE_QUEUE_SUCCESS) {
+        return status;
+    }
+
+    if ((*message_queue)->blocks == NULL) {
+        return MESSAGE_QUEUE_NO_LOAN;
+    }
+
+    status = pool_free(&(*message_queue)->blocks, block);
+    if (status != POOL_SUCCESS) {
+        return ERROR_INFO(status, MESSAGE_QUEUE_LENGTH, MESSAGE_QUEUE_UNABLE_TO_RELEASE);
     }
 
     return MESSAGE_QUEUE_SUCCESS;
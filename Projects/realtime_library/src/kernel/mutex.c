@@ -17,6 +17,18 @@
   (#) Call 'mutex_release' to release an acquired mutex
   (#) Call 'mutex_acquire_non_blocking' to acquire a mutex
   (#) Call 'mutex_release_non_blocking' to release an acquired mutex
+  (#) Call 'mutex_get_waiting_priority' to get the highest priority
+      of the tasks waiting for a mutex, which its owner inherits
+  (#) Call 'mutex_set_ceiling' to turn a mutex into a priority
+      ceiling mutex
+  (#) Call 'mutex_acquire_ceiling' to acquire a ceiling mutex
+      without a token of the binary semaphore
+  (#) Call 'mutex_release_ceiling' to release an acquired
+      ceiling mutex
+  (#) Call 'mutex_acquire_atomic' to acquire a mutex
+      without a critical section
+  (#) Call 'mutex_release_atomic' to release a mutex
+      without a critical section
 ==================================================
 @endverbatim
 **************************************************
@@ -25,12 +37,15 @@
 #include <stdlib.h>
 #include "kernel/mutex.h"
 #include "kernel/semaphore.h"
+#include "utils/pool.h"
 #include "utils/support.h"
+#include "utils/atomic.h"
 
 /* Preprocessor defines */
 /* Preprocessor macros */
 /* Module intern type definitions */
 /* Static module variables */
+POOL_DEFINE(g_mutex_pool, mutex_t, KERNEL_POOL_MUTEXES);
 /* Static module functions (prototypes) */
 
 size_t mutex_checking(mutex_t **mutex);
@@ -46,20 +61,23 @@ size_t mutex_checking(mutex_t **mutex);
  *  MUTEX_NO_SEMAPHORE: unable to initialize binary semaphore
  */
 size_t mutex_create(mutex_t **mutex, size_t id) {
-    *mutex = (mutex_t*) malloc(sizeof(mutex_t));
+    *mutex = POOL_ALLOCATE(g_mutex_pool, mutex_t);
 
-    if (mutex == NULL) {
+    if (*mutex == NULL) {
         return MUTEX_NO_MEMORY;
     }
 
-    // mutex only contains binary semaphore
+    // the owner is the lock, the binary semaphore keeps the waiting tasks
     size_t status = semaphore_create(&((*mutex)->binary_semaphore), id, SEMAPHORE_BINARY_TOKEN);
     if (status != SEMAPHORE_SUCCESS) {
+        POOL_FREE(g_mutex_pool, *mutex);
+        *mutex = NULL;
         return ERROR_INFO(status, MUTEX_LENGTH, MUTEX_NO_SEMAPHORE);
     }
 
     (*mutex)->owner = NULL;
     (*mutex)->lock_count = 0;
+    (*mutex)->ceiling_priority = MUTEX_NO_CEILING;
 
     return MUTEX_SUCCESS;
 }
@@ -87,21 +105,21 @@ size_t mutex_delete(mutex_t **mutex) {
         return MUTEX_UNABLE_TO_DELETE;
     }
 
-    free(*mutex);
+    POOL_FREE(g_mutex_pool, *mutex);
     *mutex = NULL;
 
     return MUTEX_SUCCESS;
 }
 
 /**
- * @brief Attempts to a acquire a mutex. Waiting list is managed by semaphore_acquire if needed.
+ * @brief Attempts to a acquire a mutex. Moves the running task to the waiting list of the binary semaphore on failure.
  * @param mutex is a pointer of pointer to the mutex to be acquired
  * @param running_task_list is a pointer of pointer to the linked list of ready or running tasks
  * @param running_task_element is a pointer of pointer to the linked list element containing the current running task
  * @param task is a pointer of pointer to the current running task attempting to acquire the mutex
  * @return MUTEX_SUCCESS on success, MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex or unequal for an error
  * @info On error check for these errors and component errors:
- *  MUTEX_UNABLE_TO_ACQUIRE: unable to acquire due to semaphore error
+ *  MUTEX_UNABLE_TO_ACQUIRE: unable to acquire due to linked list error
  */
 size_t mutex_acquire(mutex_t **mutex, linked_list_t **running_task_list, linked_list_element_t **running_task_element, task_t **task) {
     size_t status = mutex_checking(mutex);
@@ -112,33 +130,26 @@ size_t mutex_acquire(mutex_t **mutex, linked_list_t **running_task_list, linked_
     // Mutex can only be acquired if either:
     // - it is not currently acquired (owner == NULL)
     // - the owner tries to acquire it consecutively (recursive locking) (task == owner)
-    if (*task == (*mutex)->owner) {
-        (*mutex)->lock_count++;
-    }
-    else {
-        // semaphore_acquire catches the owner handling by design:
-        // If owner is NULL, we can just normally acquire the semaphore.
-        // If calling task is not the owner, semaphore returns NO_TOKENS and exits.
-        status = semaphore_acquire(&((*mutex)->binary_semaphore), running_task_list, running_task_element, task);
-        if (status == SEMAPHORE_NO_TOKENS) {
-            return MUTEX_OWNED_BY_OTHER_TASK;
-        }
-        else if (status != SEMAPHORE_SUCCESS) {
+    // The owner is exchanged atomically, because the fast path acquires without a critical section.
+    status = mutex_acquire_atomic(mutex, task);
+    if (status == MUTEX_OWNED_BY_OTHER_TASK) {
+        // the binary semaphore keeps the tasks waiting for the owner
+        status = linked_list_transfer(&((*mutex)->binary_semaphore->task_waiting_list), running_task_list, running_task_element);
+        if (status != LINKED_LIST_SUCCESS) {
             return ERROR_INFO(status, MUTEX_SEMAPHORE_ERROR_REGISTER, MUTEX_UNABLE_TO_ACQUIRE);
         }
 
-        (*mutex)->owner = *task;
-        (*mutex)->lock_count++;
+        return MUTEX_OWNED_BY_OTHER_TASK;
     }
 
-    return MUTEX_SUCCESS;
+    return status;
 }
 
 /**
- * @brief Attempts to a release a mutex. Task supply is managed by semaphore_release if needed.
+ * @brief Attempts to a release a mutex. Supplies the first task in the waiting list, when the mutex is released completely.
  * @param mutex is a pointer of pointer to the mutex to be released
  * @param element is a pointer of pointer to a linked list element expecting the first element of the waiting list
- * @param task is a pointer of pointer to a task expecting the data of the first element of the waiting list
+ * @param task is a pointer of pointer to a task expecting the task, which embeds the first element of the waiting list
  * @return MUTEX_SUCCESS on success, MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex or unequal for an error
  * @info On error check for these errors and component errors:
  *  MUTEX_UNABLE_TO_RELEASE: unable to release due to semaphore error
@@ -149,21 +160,21 @@ size_t mutex_release(mutex_t **mutex, linked_list_element_t **element, task_t **
         return status;
     }
 
-    if (*task != (*mutex)->owner) {
-        return MUTEX_OWNED_BY_OTHER_TASK;
+    bool task_waiting = false;
+    status = mutex_release_atomic(mutex, task, &task_waiting);
+    if (status != MUTEX_SUCCESS) {
+        return status;
     }
 
-    if ((*mutex)->lock_count == 1) {
-        status = semaphore_release(&((*mutex)->binary_semaphore), element, task);
+    // a recursive release keeps the mutex and does not supply a waiting task
+    *task = NULL;
+    if (task_waiting) {
+        status = semaphore_get_waiting_task(&((*mutex)->binary_semaphore), element, task);
         if (status != SEMAPHORE_SUCCESS) {
             return ERROR_INFO(status, MUTEX_SEMAPHORE_ERROR_REGISTER, MUTEX_UNABLE_TO_RELEASE);
         }
-
-        (*mutex)->owner = NULL;
     }
 
-    (*mutex)->lock_count--;
-
     return MUTEX_SUCCESS;
 }
 
@@ -181,53 +192,177 @@ size_t mutex_acquire_non_blocking(mutex_t **mutex, task_t **task) {
         return status;
     }
 
-    if ((*mutex)->owner == NULL) {
-        status = semaphore_acquire_non_blocking(&((*mutex)->binary_semaphore));
-        if (status != SEMAPHORE_SUCCESS) {
-            return ERROR_INFO(status, MUTEX_SEMAPHORE_ERROR_REGISTER, MUTEX_UNABLE_TO_ACQUIRE);
-        }
+    return mutex_acquire_atomic(mutex, task);
+}
 
-        (*mutex)->owner = *task;
-        (*mutex)->lock_count++;
+/**
+ * @brief Attempts to a release a mutex. Does not check the waiting list on success.
+ * @param mutex is a pointer of pointer to the semaphore to be released
+ * @param task is a pointer of pointer to a task attempting to release the mutex
+ * @return MUTEX_SUCCESS on success, MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex or unequal for an error
+ */
+size_t mutex_release_non_blocking(mutex_t **mutex, task_t **task) {
+    size_t status = mutex_checking(mutex);
+    if (status != MUTEX_SUCCESS) {
+        return status;
     }
-    else if (*task == (*mutex)->owner) {
+
+    bool task_waiting = false;
+    return mutex_release_atomic(mutex, task, &task_waiting);
+}
+
+/**
+ * @brief Acquires a mutex by an atomic exchange of its owner, so it can be called without a critical section.
+ *        The mutex is not checked and the running task is not moved to the waiting list.
+ * @param mutex is a pointer of pointer to the mutex to be acquired
+ * @param task is a pointer of pointer to the current running task attempting to acquire the mutex
+ * @return MUTEX_SUCCESS on success or MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex
+ */
+size_t mutex_acquire_atomic(mutex_t **mutex, task_t **task) {
+    // the lock count is only modified by the owner
+    if ((*mutex)->owner == *task) {
         (*mutex)->lock_count++;
+        return MUTEX_SUCCESS;
     }
-    else {
+
+    if (!atomic_compare_exchange_pointer((void * volatile *) &(*mutex)->owner, NULL, *task)) {
         return MUTEX_OWNED_BY_OTHER_TASK;
     }
 
+    (*mutex)->lock_count = 1;
+
     return MUTEX_SUCCESS;
 }
 
 /**
- * @brief Attempts to a release a mutex. Does not check the waiting list on success.
- * @param mutex is a pointer of pointer to the semaphore to be released
+ * @brief Releases a mutex by an atomic exchange of its owner, so it can be called without a critical section.
+ *        The owner is cleared before the waiting list is checked. A task, which is inserted in the waiting list
+ *        in a critical section afterwards, already sees the released mutex, so no task misses the release.
+ * @param mutex is a pointer of pointer to the mutex to be released
  * @param task is a pointer of pointer to a task attempting to release the mutex
+ * @param task_waiting is a pointer to a bool, which is true if a waiting task has to be reinserted by the caller
+ * @return MUTEX_SUCCESS on success or MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex
+ */
+size_t mutex_release_atomic(mutex_t **mutex, task_t **task, bool *task_waiting) {
+    if (*task != (*mutex)->owner) {
+        return MUTEX_OWNED_BY_OTHER_TASK;
+    }
+
+    *task_waiting = false;
+    if ((*mutex)->lock_count > 1) {
+        (*mutex)->lock_count--;
+        return MUTEX_SUCCESS;
+    }
+
+    // the lock count is cleared first, a mutex without owner never has a lock count
+    (*mutex)->lock_count = 0;
+    atomic_compare_exchange_pointer((void * volatile *) &(*mutex)->owner, *task, NULL);
+
+    *task_waiting = (*mutex)->binary_semaphore->task_waiting_list->size != 0;
+
+    return MUTEX_SUCCESS;
+}
+
+/**
+ * @brief Gets the highest priority of all tasks waiting for the mutex. Note that a lower value signifies a higher priority.
+ * @param mutex is a pointer of pointer to the mutex
+ * @param priority is a pointer to a priority, which is only lowered by a waiting task of a higher priority
+ * @return MUTEX_SUCCESS on success or unequal MUTEX_SUCCESS for an error
+ */
+size_t mutex_get_waiting_priority(mutex_t **mutex, uint8_t *priority) {
+    size_t status = mutex_checking(mutex);
+    if (status != MUTEX_SUCCESS) {
+        return status;
+    }
+
+    // waiting tasks are not sorted, the waiting list only contains the tasks blocked on this mutex
+    linked_list_element_t *iterator = (*mutex)->binary_semaphore->task_waiting_list->tail;
+    while (iterator != NULL) {
+        task_t *task = TASK_FROM_LIST_ELEMENT(iterator);
+        if (task->task_data->u8TaskPrio < *priority) {
+            *priority = task->task_data->u8TaskPrio;
+        }
+        iterator = iterator->next;
+    }
+
+    return MUTEX_SUCCESS;
+}
+
+/**
+ * @brief Sets the ceiling priority of a mutex. Note that a lower value signifies a higher priority.
+ * @param mutex is a pointer of pointer to the mutex
+ * @param ceiling_priority is the highest priority of all tasks using the mutex or MUTEX_NO_CEILING
+ * @return MUTEX_SUCCESS on success or unequal MUTEX_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  MUTEX_UNABLE_TO_ACQUIRE: the mutex is currently acquired
+ */
+size_t mutex_set_ceiling(mutex_t **mutex, uint8_t ceiling_priority) {
+    size_t status = mutex_checking(mutex);
+    if (status != MUTEX_SUCCESS) {
+        return status;
+    }
+
+    if ((*mutex)->owner != NULL) {
+        return MUTEX_UNABLE_TO_ACQUIRE;
+    }
+
+    (*mutex)->ceiling_priority = ceiling_priority;
+
+    return MUTEX_SUCCESS;
+}
+
+/**
+ * @brief Acquires a ceiling mutex. The owner runs with the ceiling priority, so no other task using the mutex
+ *        can run until it is released and neither the binary semaphore nor its waiting list is needed.
+ * @param mutex is a pointer of pointer to the mutex to be acquired
+ * @param task is a pointer of pointer to the current running task attempting to acquire the mutex
  * @return MUTEX_SUCCESS on success, MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex or unequal for an error
  * @info On error check for these errors and component errors:
- *  MUTEX_UNABLE_TO_RELEASE: unable to acquire due to semaphore error
+ *  MUTEX_CEILING_VIOLATED: the tasks priority is higher than the ceiling priority
+ *  MUTEX_OWNED_BY_OTHER_TASK: the owner blocked while holding the mutex
  */
-size_t mutex_release_non_blocking(mutex_t **mutex, task_t **task) {
+size_t mutex_acquire_ceiling(mutex_t **mutex, task_t **task) {
     size_t status = mutex_checking(mutex);
     if (status != MUTEX_SUCCESS) {
         return status;
     }
 
-    if (*task != (*mutex)->owner) {
+    if ((*task)->base_priority < (*mutex)->ceiling_priority) {
+        return MUTEX_CEILING_VIOLATED;
+    }
+
+    if ((*mutex)->owner == NULL) {
+        (*mutex)->owner = *task;
+    }
+    else if ((*mutex)->owner != *task) {
         return MUTEX_OWNED_BY_OTHER_TASK;
     }
 
-    if ((*mutex)->lock_count == 1) {
-        status = semaphore_release_non_blocking(&((*mutex)->binary_semaphore));
-        if (status != SEMAPHORE_SUCCESS) {
-            return ERROR_INFO(status, MUTEX_SEMAPHORE_ERROR_REGISTER, MUTEX_UNABLE_TO_RELEASE);
-        }
+    (*mutex)->lock_count++;
 
-        (*mutex)->owner = NULL;
+    return MUTEX_SUCCESS;
+}
+
+/**
+ * @brief Releases a ceiling mutex, the owner is cleared with the last recursive release.
+ * @param mutex is a pointer of pointer to the mutex to be released
+ * @param task is a pointer of pointer to the task attempting to release the mutex
+ * @return MUTEX_SUCCESS on success, MUTEX_OWNED_BY_OTHER_TASK for unavailable mutex or unequal for an error
+ */
+size_t mutex_release_ceiling(mutex_t **mutex, task_t **task) {
+    size_t status = mutex_checking(mutex);
+    if (status != MUTEX_SUCCESS) {
+        return status;
+    }
+
+    if (*task != (*mutex)->owner) {
+        return MUTEX_OWNED_BY_OTHER_TASK;
     }
 
     (*mutex)->lock_count--;
+    if ((*mutex)->lock_count == 0) {
+        (*mutex)->owner = NULL;
+    }
 
     return MUTEX_SUCCESS;
 }
@@ -254,8 +389,8 @@ size_t mutex_checking(mutex_t **mutex) {
         return ERROR_INFO(status, MUTEX_SEMAPHORE_ERROR_REGISTER, MUTEX_NO_SEMAPHORE);
     }
 
-    if (( (*mutex)->owner == NULL && (*mutex)->lock_count != 0 )
-        || ( (*mutex)->owner != NULL && (*mutex)->lock_count == 0) ) {
+    // an owner without lock count is valid for the moment between the atomic exchange and the lock count update
+    if ((*mutex)->owner == NULL && (*mutex)->lock_count != 0) {
         return MUTEX_IRREGULAR_STRUCTURE;
     }
 
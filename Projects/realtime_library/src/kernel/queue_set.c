@@ -0,0 +1,308 @@
+/**
+**************************************************
+* @file queue_set.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for waiting on several message queues and semaphores at once
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'queue_set_create' to create a queue set
+  (#) Call 'queue_set_create_static' to create a queue set in
+      caller supplied storage
+  (#) Call 'queue_set_delete' to delete a queue set
+  (#) Call 'queue_set_reserve' to reserve the entries of a
+      new member, a member announces each stored message or
+      token by one entry
+  (#) Call 'queue_set_post' to announce a ready member and
+      to get the first waiting task
+  (#) Call 'queue_set_read' to get the member, which became
+      ready first
+  (#) Call 'queue_set_wait' to block a task until a member
+      becomes ready
+  (#) All functions call 'queue_set_checking' to validate
+      proper queue set structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "kernel/queue_set.h"
+#include "kernel/kernel_config.h"
+#include "utils/support.h"
+#include "utils/allocator.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+/* Public functions */
+/**
+ * @brief Creates a queue set with a ready queue of size entries.
+ *        In static allocation mode the ready queue has to be supplied with queue_set_create_static.
+ * @param queue_set is a pointer of pointer to be initialized as a queue set
+ * @param id is the unique id of the queue set with which it is accessed
+ * @param size is the amount of entries, which has to cover the size of every member queue and the tokens of every member semaphore
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  QUEUE_SET_NO_MEMORY: unable to allocate memory for the queue set, always in static allocation mode
+ *  QUEUE_SET_NO_READY_QUEUE: unable to initialize the ready queue
+ *  QUEUE_SET_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t queue_set_create(queue_set_t **queue_set, size_t id, size_t size) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the ready queue size is only known at runtime, supply it with queue_set_create_static
+    (void) id;
+    (void) size;
+    (*queue_set) = NULL;
+    return QUEUE_SET_NO_MEMORY;
+#else
+    queue_set_static_t *storage = (queue_set_static_t *) allocator_allocate(sizeof(queue_set_static_t));
+    void **data = (void **) allocator_allocate(size * sizeof(void *));
+    queue_set_member_t *buffer = (queue_set_member_t *) allocator_allocate(size * sizeof(queue_set_member_t));
+    if (storage == NULL || data == NULL || buffer == NULL) {
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free(storage);
+        return QUEUE_SET_NO_MEMORY;
+    }
+
+    size_t status = queue_set_create_static(queue_set, storage, data, buffer, id, size);
+    if (status != QUEUE_SET_SUCCESS) {
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free(storage);
+        (*queue_set) = NULL;
+        return status;
+    }
+    (*queue_set)->allocated = true;
+
+    return QUEUE_SET_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Creates a queue set in caller supplied storage, which is never released.
+ * @param queue_set is a pointer of pointer to be initialized as a queue set
+ * @param storage is the memory of the queue set and its components, which must outlive it
+ * @param data is an array of size entries
+ * @param buffer is an array of size members
+ * @param id is the unique id of the queue set with which it is accessed
+ * @param size is the amount of entries, which has to cover the size of every member queue and the tokens of every member semaphore
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  QUEUE_SET_NO_MEMORY: storage is NULL
+ *  QUEUE_SET_NO_READY_QUEUE: unable to initialize the ready queue, data or buffer is NULL
+ *  QUEUE_SET_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t queue_set_create_static(queue_set_t **queue_set, queue_set_static_t *storage, void **data, queue_set_member_t *buffer, size_t id, size_t size) {
+
+    if (storage == NULL) {
+        return QUEUE_SET_NO_MEMORY;
+    }
+
+    (*queue_set) = &storage->queue_set;
+    (*queue_set)->id = id;
+    (*queue_set)->reserved = 0;
+    (*queue_set)->allocated = false;
+
+    // the ready queue is never full, because every member reserved its entries
+    size_t status = queue_create_static(&(*queue_set)->ready, &storage->ready, data, buffer, size, sizeof(queue_set_member_t));
+    if (status != QUEUE_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_QUEUE_ERROR_REGISTER, QUEUE_SET_NO_READY_QUEUE);
+    }
+
+    // waiting tasks are linked by their embedded element
+    status = linked_list_create_intrusive_static(&(*queue_set)->waiting_task_list, &storage->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_LINKED_LIST_ERROR_REGISTER, QUEUE_SET_NO_WAITING_LIST);
+    }
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/**
+ * @brief Deletes a queue set, the waiting tasks have to be released and the members detached before.
+ * @param queue_set is a pointer of pointer to be deleted
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  QUEUE_SET_NO_READY_QUEUE: unable to delete the ready queue
+ *  QUEUE_SET_NO_WAITING_LIST: unable to delete waiting list
+ */
+size_t queue_set_delete(queue_set_t **queue_set) {
+
+    size_t status = queue_set_checking(queue_set);
+    if (status != QUEUE_SET_SUCCESS) {
+        return status;
+    }
+
+    // data and buffer are only owned, when the queue set was created by queue_set_create
+    void **data = (*queue_set)->ready->data;
+    void *buffer = (*queue_set)->ready->data[0];
+
+    status = queue_delete(&(*queue_set)->ready);
+    if (status != QUEUE_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_QUEUE_ERROR_REGISTER, QUEUE_SET_NO_READY_QUEUE);
+    }
+
+    status = linked_list_delete(&(*queue_set)->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_LINKED_LIST_ERROR_REGISTER, QUEUE_SET_NO_WAITING_LIST);
+    }
+
+    // caller supplied storage stays untouched
+    if ((*queue_set)->allocated) {
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free((*queue_set));
+    }
+    (*queue_set) = NULL;
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/**
+ * @brief Reserves the entries of a new member, so posting a stored message or token never fails.
+ * @param queue_set is a pointer of pointer to the queue set
+ * @param entries is the size of a member queue or the maximum tokens of a member semaphore
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for this error:
+ *  QUEUE_SET_FULL: the ready queue is too small for the member
+ */
+size_t queue_set_reserve(queue_set_t **queue_set, size_t entries) {
+
+    size_t status = queue_set_checking(queue_set);
+    if (status != QUEUE_SET_SUCCESS) {
+        return status;
+    }
+
+    if (entries > (*queue_set)->ready->size - (*queue_set)->reserved) {
+        return QUEUE_SET_FULL;
+    }
+
+    (*queue_set)->reserved += entries;
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/**
+ * @brief Announces a member, which stored a message or a token. Supplies the first waiting task, if any.
+ * @param queue_set is a pointer of pointer to the queue set
+ * @param type is the kind of the member
+ * @param id is the id of the member
+ * @param element is a pointer of pointer to a linked list element expecting the first element of the waiting list
+ * @param task is a pointer of pointer to a task expecting the waiting task or NULL, if no task is waiting
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  QUEUE_SET_UNABLE_TO_POST: unable to store the member in the ready queue
+ */
+size_t queue_set_post(queue_set_t **queue_set, queue_set_member_type_e type, size_t id, linked_list_element_t **element, task_t **task) {
+
+    size_t status = queue_set_checking(queue_set);
+    if (status != QUEUE_SET_SUCCESS) {
+        return status;
+    }
+
+    // members become ready in first in first out order
+    queue_set_member_t member = { .type = type, .id = id };
+    status = queue_push_front(&(*queue_set)->ready, &member, sizeof(queue_set_member_t));
+    if (status != QUEUE_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_QUEUE_ERROR_REGISTER, QUEUE_SET_UNABLE_TO_POST);
+    }
+
+    (*task) = NULL;
+    if ((*queue_set)->waiting_task_list->size > 0) {
+        (*element) = (*queue_set)->waiting_task_list->tail;
+        (*task) = TASK_FROM_LIST_ELEMENT(*element);
+    }
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/**
+ * @brief Gets the member, which became ready first. The caller takes its message or token afterwards.
+ * @param queue_set is a pointer of pointer to the queue set
+ * @param member is a queue_set_member_t pointer, which receives the member
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for this error:
+ *  QUEUE_SET_NO_MEMBER: no member is ready
+ */
+size_t queue_set_read(queue_set_t **queue_set, queue_set_member_t *member) {
+
+    size_t status = queue_set_checking(queue_set);
+    if (status != QUEUE_SET_SUCCESS) {
+        return status;
+    }
+
+    void *destination = member;
+    status = queue_read(&(*queue_set)->ready, &destination);
+    if (status == QUEUE_NO_ELEMENT) {
+        return QUEUE_SET_NO_MEMBER;
+    }
+    else if (status != QUEUE_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_QUEUE_ERROR_REGISTER, QUEUE_SET_NO_READY_QUEUE);
+    }
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/**
+ * @brief Moves the running task into the waiting list of the queue set.
+ * @param queue_set is a pointer of pointer to the queue set
+ * @param running_task_list is a linked_list_t pointer of pointer to the priority group of the running task
+ * @param running_task_element is a linked_list_element_t pointer of pointer to the running task
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  QUEUE_SET_UNABLE_TO_WAIT: unable to move the task
+ */
+size_t queue_set_wait(queue_set_t **queue_set, linked_list_t **running_task_list, linked_list_element_t **running_task_element) {
+
+    size_t status = queue_set_checking(queue_set);
+    if (status != QUEUE_SET_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_transfer(&(*queue_set)->waiting_task_list, running_task_list, running_task_element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, QUEUE_SET_LINKED_LIST_ERROR_REGISTER, QUEUE_SET_UNABLE_TO_WAIT);
+    }
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/**
+ * @brief Validates a queue set
+ * @param queue_set is a pointer of pointer to the queue set
+ * @return QUEUE_SET_SUCCESS on success or unequal QUEUE_SET_SUCCESS for an error
+ * @info On error check for these errors:
+ *  QUEUE_SET_IS_NULL: queue set is not initialized
+ *  QUEUE_SET_NO_READY_QUEUE: ready queue is not initialized
+ *  QUEUE_SET_NO_WAITING_LIST: waiting list is not initialized
+ */
+size_t queue_set_checking(queue_set_t **queue_set) {
+
+    if (queue_set == NULL || (*queue_set) == NULL) {
+        return QUEUE_SET_IS_NULL;
+    }
+
+    if ((*queue_set)->ready == NULL) {
+        return QUEUE_SET_NO_READY_QUEUE;
+    }
+
+    if ((*queue_set)->waiting_task_list == NULL) {
+        return QUEUE_SET_NO_WAITING_LIST;
+    }
+
+    return QUEUE_SET_SUCCESS;
+}
+
+/* Static module functions (implementation) */
@@ -12,6 +12,8 @@
 ==================================================
   ### Usage ###
   (#) Call 'semaphore_create' to create a semaphore
+  (#) Call 'semaphore_create_static' to create a semaphore
+      in caller supplied storage
   (#) Call 'semaphore_delete' to delete a semaphore
   (#) Call 'semaphore_acquire' to acquire a semaphore
   (#) Call 'semaphore_release' to release an acquired
@@ -24,10 +26,17 @@
       semaphore is available
   (#) Call 'semaphore_flush' to flush all waiting list
       entries of a semaphore
+  (#) Call 'semaphore_acquire_atomic' to take a token
+      without a critical section
+  (#) Call 'semaphore_release_atomic' to return a token
+      without a critical section
+  (#) Call 'semaphore_get_waiting_task' to get the first
+      task of the waiting list
   (#) All functions call 'semaphore_checking' to validate
       proper semaphore structure. Refer to this function
       for potential error codes not documented in each
-      function.
+      function. The atomic functions skip the check to
+      keep the uncontended path short.
 ==================================================
 @endverbatim
 **************************************************
@@ -35,7 +44,9 @@
 /* Includes */
 #include <stdlib.h>
 #include "kernel/semaphore.h"
+#include "utils/pool.h"
 #include "utils/support.h"
+#include "utils/atomic.h"
 
 /* Preprocessor defines */
 
@@ -44,6 +55,7 @@
 /* Module intern type definitions */
 
 /* Static module variables */
+POOL_DEFINE(g_semaphore_pool, semaphore_static_t, KERNEL_POOL_SEMAPHORES);
 
 /* Static module functions (prototypes) */
 
@@ -60,16 +72,47 @@
  *  SEMAPHORE_NO_WAITING_LIST: unable to initialize waiting list
  */
 size_t semaphore_create(semaphore_t **semaphore, size_t id, size_t token) {
-    *semaphore = (semaphore_t *) malloc(sizeof(semaphore_t));
+    semaphore_static_t *storage = POOL_ALLOCATE(g_semaphore_pool, semaphore_static_t);
 
-    if (semaphore == NULL)
+    if (storage == NULL)
         return SEMAPHORE_NO_MEMORY;
 
+    size_t status = semaphore_create_static(semaphore, storage, id, token);
+    if (status != SEMAPHORE_SUCCESS) {
+        POOL_FREE(g_semaphore_pool, storage);
+        *semaphore = NULL;
+        return status;
+    }
+    (*semaphore)->allocated = true;
+
+    return SEMAPHORE_SUCCESS;
+}
+
+/**
+ * @brief Creates a semaphore in caller supplied storage, which is never released.
+ * @param semaphore is a pointer of pointer to be initialized as a semaphore
+ * @param storage is the memory of the semaphore and its waiting list, which must outlive it
+ * @param id is the unique id of the semaphore with which it is accessed
+ * @param token is maximum amount of tokens, specifying how many times
+ *        the semaphore can be acquired
+ * @return SEMAPHORE_SUCCESS on success or unequal SEMAPHORE_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  SEMAPHORE_NO_MEMORY: storage is NULL
+ *  SEMAPHORE_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t semaphore_create_static(semaphore_t **semaphore, semaphore_static_t *storage, size_t id, size_t token) {
+    if (storage == NULL)
+        return SEMAPHORE_NO_MEMORY;
+
+    *semaphore = &storage->semaphore;
     (*semaphore)->id = id;
     (*semaphore)->token = token;
     (*semaphore)->max_token = token;
+    (*semaphore)->queue_set = NULL;
+    (*semaphore)->allocated = false;
 
-    size_t status = linked_list_create(&(*semaphore)->task_waiting_list);
+    // waiting tasks are linked by their embedded element
+    size_t status = linked_list_create_intrusive_static(&(*semaphore)->task_waiting_list, &storage->task_waiting_list);
     if (status != LINKED_LIST_SUCCESS)
         return ERROR_INFO(status, SEMAPHORE_LENGTH, SEMAPHORE_NO_WAITING_LIST);
 
@@ -92,7 +135,9 @@ size_t semaphore_delete(semaphore_t **semaphore) {
     if (status != LINKED_LIST_SUCCESS)
         return ERROR_INFO(status, SEMAPHORE_LENGTH, SEMAPHORE_NO_WAITING_LIST);
 
-    free(*semaphore);
+    // the waiting list is stored in the same block
+    if ((*semaphore)->allocated)
+        POOL_FREE(g_semaphore_pool, *semaphore);
     *semaphore = NULL;
 
     return SEMAPHORE_SUCCESS;
@@ -133,7 +178,7 @@ size_t semaphore_acquire(semaphore_t **semaphore, linked_list_t **running_task_l
  * @brief Attempts to a release a semaphore. Supplies the first task in the waiting list on success.
  * @param semaphore is a pointer of pointer to the semaphore to be released
  * @param element is a pointer of pointer to a linked list element expecting the first element of the waiting list
- * @param task is a pointer of pointer to a task expecting the data of the first element of the waiting list
+ * @param task is a pointer of pointer to a task expecting the task, which embeds the first element of the waiting list
  * @return SEMAPHORE_SUCCESS on success, SEMAPHORE_REACHED_MAX_TOKENS for fully available semaphore or unequal for an error
  * @info On error check for these errors and component errors:
  *  SEMAPHORE_UNABLE_TO_RELEASE: unable to release due to linked list error
@@ -148,20 +193,9 @@ size_t semaphore_release(semaphore_t **semaphore, linked_list_element_t **elemen
         return SEMAPHORE_REACHED_MAX_TOKENS;
     }
 
-    if ((*semaphore)->task_waiting_list->size != 0) {
-
-        *element = (*semaphore)->task_waiting_list->head;
-        status = linked_list_element_checking(element);
-
-        if (status != LINKED_LIST_SUCCESS) {
-            return ERROR_INFO(status, SEMAPHORE_LINKED_LIST_ERROR_REGISTER, SEMAPHORE_UNABLE_TO_RELEASE);
-        }
-
-        *task = (*element)->data;
-    }
-    else {
-        // mutex binary semaphore return task must be null
-        *task = NULL;
+    status = semaphore_get_waiting_task(semaphore, element, task);
+    if (status != SEMAPHORE_SUCCESS) {
+        return status;
     }
 
     (*semaphore)->token++;
@@ -243,6 +277,65 @@ size_t semaphore_flush(semaphore_t **semaphore) {
     return SEMAPHORE_SUCCESS;
 }
 
+/**
+ * @brief Takes a token by an atomic exchange, so it can be called without a critical section.
+ *        The semaphore is not checked and the running task is not moved to the waiting list.
+ * @param semaphore is a pointer of pointer to the semaphore to be acquired
+ * @return SEMAPHORE_SUCCESS on success or SEMAPHORE_NO_TOKENS for unavailable semaphore
+ */
+size_t semaphore_acquire_atomic(semaphore_t **semaphore) {
+    if (!atomic_decrement_if_positive(&(*semaphore)->token)) {
+        return SEMAPHORE_NO_TOKENS;
+    }
+
+    return SEMAPHORE_SUCCESS;
+}
+
+/**
+ * @brief Returns a token by an atomic exchange, so it can be called without a critical section.
+ *        The token is returned before the waiting list is checked. A task, which is inserted in the waiting list
+ *        in a critical section afterwards, already sees the token, so no task misses the release.
+ * @param semaphore is a pointer of pointer to the semaphore to be released
+ * @param task_waiting is a pointer to a bool, which is true if a waiting task has to be reinserted by the caller
+ * @return SEMAPHORE_SUCCESS on success or SEMAPHORE_REACHED_MAX_TOKENS for fully available semaphore
+ */
+size_t semaphore_release_atomic(semaphore_t **semaphore, bool *task_waiting) {
+    if (!atomic_increment_if_below(&(*semaphore)->token, (*semaphore)->max_token)) {
+        return SEMAPHORE_REACHED_MAX_TOKENS;
+    }
+
+    *task_waiting = (*semaphore)->task_waiting_list->size != 0;
+
+    return SEMAPHORE_SUCCESS;
+}
+
+/**
+ * @brief Gets the first task of the waiting list without removing it.
+ * @param semaphore is a pointer of pointer to the semaphore
+ * @param element is a pointer of pointer to a linked list element expecting the first element of the waiting list
+ * @param task is a pointer of pointer to a task expecting the waiting task or NULL, if no task is waiting
+ * @return SEMAPHORE_SUCCESS on success or unequal for an error
+ * @info On error check for these errors and component errors:
+ *  SEMAPHORE_UNABLE_TO_RELEASE: unable to get the task due to linked list error
+ */
+size_t semaphore_get_waiting_task(semaphore_t **semaphore, linked_list_element_t **element, task_t **task) {
+    if ((*semaphore)->task_waiting_list->size == 0) {
+        // mutex binary semaphore return task must be null
+        *task = NULL;
+        return SEMAPHORE_SUCCESS;
+    }
+
+    *element = (*semaphore)->task_waiting_list->head;
+    size_t status = linked_list_element_checking(element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, SEMAPHORE_LINKED_LIST_ERROR_REGISTER, SEMAPHORE_UNABLE_TO_RELEASE);
+    }
+
+    *task = TASK_FROM_LIST_ELEMENT(*element);
+
+    return SEMAPHORE_SUCCESS;
+}
+
 /**
  * @brief Checks whether a semaphore is valid.
  * @param semaphore is a pointer of pointer to the semaphore to be checked
@@ -0,0 +1,359 @@
+/**
+**************************************************
+* @file software_timer.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using software timers
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'software_timer_create' to create a one shot
+      or auto reload software timer
+  (#) Call 'software_timer_delete' to delete a software
+      timer
+  (#) Call 'software_timer_list_create' to create a list
+      of active software timers sorted by deadline
+  (#) Call 'software_timer_list_delete' to delete a list
+      of active software timers
+  (#) Call 'software_timer_start' to (re)arm a software
+      timer relative to a start tick
+  (#) Call 'software_timer_stop' to disarm a software timer
+  (#) Call 'software_timer_get_next_ticks' to get the ticks
+      until the earliest deadline
+  (#) Call 'software_timer_process' to run the callbacks
+      of all due software timers in deadline order
+  (#) All functions call 'software_timer_checking' to
+      validate proper software timer structure. Refer to
+      this function for potential error codes not
+      documented in each function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "kernel/software_timer.h"
+#include "utils/pool.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+// compares ticks relative to each other, hence an overflow of the tick counter is irrelevant
+#define SOFTWARE_TIMER_IS_BEFORE(a, b)      ((ptrdiff_t) ((a) - (b)) < 0)
+
+/* Module intern type definitions */
+/* Static module variables */
+POOL_DEFINE(g_software_timer_pool, software_timer_t, KERNEL_POOL_TIMERS);
+POOL_DEFINE(g_software_timer_list_pool, software_timer_list_t, KERNEL_POOL_SOFTWARE_TIMER_LISTS);
+/* Static module functions (prototypes) */
+static void software_timer_link(software_timer_list_t **software_timer_list, software_timer_t *software_timer);
+static void software_timer_unlink(software_timer_list_t **software_timer_list, software_timer_t *software_timer);
+
+/* Public functions */
+/**
+ * @brief Creates an inactive software timer.
+ * @param software_timer is a pointer of pointer to be initialized as software timer
+ * @param id is the timers id, which is passed to the callback
+ * @param callback is a function pointer executed on every expiration
+ * @param period is the amount of ticks between start and expiration
+ * @param auto_reload is a bool, if set to true, the timer is rearmed after every expiration
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for these errors:
+ *  SOFTWARE_TIMER_NO_MEMORY: unable to allocate memory for software timer
+ *  SOFTWARE_TIMER_NO_CALLBACK: callback is missing
+ *  SOFTWARE_TIMER_NO_PERIOD: period is 0
+ */
+size_t software_timer_create(software_timer_t **software_timer, size_t id, void (*callback)(size_t id), size_t period, bool auto_reload) {
+
+    if (callback == NULL) {
+        return SOFTWARE_TIMER_NO_CALLBACK;
+    }
+
+    if (period == 0) {
+        return SOFTWARE_TIMER_NO_PERIOD;
+    }
+
+    (*software_timer) = POOL_ALLOCATE(g_software_timer_pool, software_timer_t);
+    if ((*software_timer) == NULL) {
+        return SOFTWARE_TIMER_NO_MEMORY;
+    }
+
+    (*software_timer)->previous = NULL;
+    (*software_timer)->next = NULL;
+    (*software_timer)->callback = callback;
+    (*software_timer)->id = id;
+    (*software_timer)->period = period;
+    (*software_timer)->deadline = 0;
+    (*software_timer)->auto_reload = auto_reload;
+    (*software_timer)->active = false;
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Deletes a software timer, which has to be stopped before.
+ * @param software_timer is a pointer of pointer to the software timer, which will be set to NULL
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ */
+size_t software_timer_delete(software_timer_t **software_timer) {
+
+    size_t status = software_timer_checking(software_timer);
+    if (status != SOFTWARE_TIMER_SUCCESS) {
+        return status;
+    }
+
+    POOL_FREE(g_software_timer_pool, (*software_timer));
+    (*software_timer) = NULL;
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Creates an empty list of active software timers.
+ * @param software_timer_list is a pointer of pointer to be initialized as list of active software timers
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for this error:
+ *  SOFTWARE_TIMER_NO_LIST: unable to allocate memory for the list
+ */
+size_t software_timer_list_create(software_timer_list_t **software_timer_list) {
+
+    (*software_timer_list) = POOL_ALLOCATE(g_software_timer_list_pool, software_timer_list_t);
+    if ((*software_timer_list) == NULL) {
+        return SOFTWARE_TIMER_NO_LIST;
+    }
+
+    (*software_timer_list)->first = NULL;
+    (*software_timer_list)->size = 0;
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Deletes a list of active software timers, the timers become inactive, but are not deleted.
+ * @param software_timer_list is a pointer of pointer to the list, which will be set to NULL
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for this error:
+ *  SOFTWARE_TIMER_NO_LIST: list is not initialized
+ */
+size_t software_timer_list_delete(software_timer_list_t **software_timer_list) {
+
+    if ((*software_timer_list) == NULL) {
+        return SOFTWARE_TIMER_NO_LIST;
+    }
+
+    while ((*software_timer_list)->first != NULL) {
+        software_timer_unlink(software_timer_list, (*software_timer_list)->first);
+    }
+
+    POOL_FREE(g_software_timer_list_pool, (*software_timer_list));
+    (*software_timer_list) = NULL;
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Arms a software timer, which expires one period after the start tick.
+ *        An active timer is rearmed.
+ * @param software_timer_list is a pointer of pointer to the list of active software timers
+ * @param software_timer is a pointer of pointer to the software timer
+ * @param start_tick is the tick the period starts with
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for this error:
+ *  SOFTWARE_TIMER_NO_LIST: list is not initialized
+ */
+size_t software_timer_start(software_timer_list_t **software_timer_list, software_timer_t **software_timer, size_t start_tick) {
+
+    size_t status = software_timer_checking(software_timer);
+    if (status != SOFTWARE_TIMER_SUCCESS) {
+        return status;
+    }
+
+    if ((*software_timer_list) == NULL) {
+        return SOFTWARE_TIMER_NO_LIST;
+    }
+
+    if ((*software_timer)->active) {
+        software_timer_unlink(software_timer_list, *software_timer);
+    }
+
+    (*software_timer)->deadline = start_tick + (*software_timer)->period;
+    software_timer_link(software_timer_list, *software_timer);
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Disarms a software timer in constant time, an inactive timer stays untouched.
+ * @param software_timer_list is a pointer of pointer to the list of active software timers
+ * @param software_timer is a pointer of pointer to the software timer
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for this error:
+ *  SOFTWARE_TIMER_NO_LIST: list is not initialized
+ */
+size_t software_timer_stop(software_timer_list_t **software_timer_list, software_timer_t **software_timer) {
+
+    size_t status = software_timer_checking(software_timer);
+    if (status != SOFTWARE_TIMER_SUCCESS) {
+        return status;
+    }
+
+    if ((*software_timer_list) == NULL) {
+        return SOFTWARE_TIMER_NO_LIST;
+    }
+
+    if ((*software_timer)->active) {
+        software_timer_unlink(software_timer_list, *software_timer);
+    }
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Determines the ticks until the earliest deadline.
+ * @param software_timer_list is a pointer of pointer to the list of active software timers
+ * @param now is the current tick
+ * @param ticks is a size_t pointer, which returns the ticks until the earliest deadline or 0 if already due
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for these errors:
+ *  SOFTWARE_TIMER_NO_LIST: list is not initialized
+ *  SOFTWARE_TIMER_IS_EMPTY: no timer is active, ticks stay untouched
+ */
+size_t software_timer_get_next_ticks(software_timer_list_t **software_timer_list, size_t now, size_t *ticks) {
+
+    if ((*software_timer_list) == NULL) {
+        return SOFTWARE_TIMER_NO_LIST;
+    }
+
+    software_timer_t *first = (*software_timer_list)->first;
+    if (first == NULL) {
+        return SOFTWARE_TIMER_IS_EMPTY;
+    }
+
+    if (SOFTWARE_TIMER_IS_BEFORE(now, first->deadline)) {
+        *ticks = first->deadline - now;
+    }
+    else {
+        *ticks = 0;
+    }
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Executes the callbacks of all due software timers in deadline order.
+ *        One shot timers become inactive, auto reload timers are rearmed by their period
+ *        relative to their deadline, hence a delayed processing does not accumulate a drift.
+ * @param software_timer_list is a pointer of pointer to the list of active software timers
+ * @param now is the current tick
+ * @param expired_timers is a size_t pointer, which returns the amount of executed callbacks
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for this error:
+ *  SOFTWARE_TIMER_NO_LIST: list is not initialized
+ * @note The callbacks may start or stop any timer of the list.
+ */
+size_t software_timer_process(software_timer_list_t **software_timer_list, size_t now, size_t *expired_timers) {
+
+    if ((*software_timer_list) == NULL) {
+        return SOFTWARE_TIMER_NO_LIST;
+    }
+
+    *expired_timers = 0;
+    software_timer_t *software_timer = (*software_timer_list)->first;
+    while (software_timer != NULL && !SOFTWARE_TIMER_IS_BEFORE(now, software_timer->deadline)) {
+
+        software_timer_unlink(software_timer_list, software_timer);
+
+        if (software_timer->auto_reload) {
+            // missed periods are skipped instead of executing the callback repeatedly, but the phase is kept
+            do {
+                software_timer->deadline += software_timer->period;
+            } while (!SOFTWARE_TIMER_IS_BEFORE(now, software_timer->deadline));
+            software_timer_link(software_timer_list, software_timer);
+        }
+
+        software_timer->callback(software_timer->id);
+        (*expired_timers)++;
+
+        software_timer = (*software_timer_list)->first;
+    }
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/**
+ * @brief Validates the software timer structure.
+ * @param software_timer is a pointer of pointer to the software timer
+ * @return SOFTWARE_TIMER_SUCCESS on success or unequal SOFTWARE_TIMER_SUCCESS for an error
+ * @info On error check for these errors:
+ *  SOFTWARE_TIMER_NO_MEMORY: software timer is not initialized
+ *  SOFTWARE_TIMER_NO_CALLBACK: software timer has no callback
+ */
+size_t software_timer_checking(software_timer_t **software_timer) {
+
+    if ((*software_timer) == NULL) {
+        return SOFTWARE_TIMER_NO_MEMORY;
+    }
+    else if ((*software_timer)->callback == NULL) {
+        return SOFTWARE_TIMER_NO_CALLBACK;
+    }
+
+    return SOFTWARE_TIMER_SUCCESS;
+}
+
+/* Static module functions (implementation) */
+
+/**
+ * @brief Inserts a software timer behind all timers with an earlier or equal deadline.
+ * @param software_timer_list is a pointer of pointer to the list of active software timers
+ * @param software_timer is a pointer to the inactive software timer
+ */
+static void software_timer_link(software_timer_list_t **software_timer_list, software_timer_t *software_timer) {
+
+    software_timer_t *previous = NULL;
+    software_timer_t *iterator = (*software_timer_list)->first;
+    while (iterator != NULL && !SOFTWARE_TIMER_IS_BEFORE(software_timer->deadline, iterator->deadline)) {
+        previous = iterator;
+        iterator = iterator->next;
+    }
+
+    software_timer->previous = previous;
+    software_timer->next = iterator;
+    if (previous == NULL) {
+        (*software_timer_list)->first = software_timer;
+    }
+    else {
+        previous->next = software_timer;
+    }
+    if (iterator != NULL) {
+        iterator->previous = software_timer;
+    }
+
+    software_timer->active = true;
+    (*software_timer_list)->size++;
+}
+
+/**
+ * @brief Removes an active software timer.
+ * @param software_timer_list is a pointer of pointer to the list of active software timers
+ * @param software_timer is a pointer to the active software timer
+ */
+static void software_timer_unlink(software_timer_list_t **software_timer_list, software_timer_t *software_timer) {
+
+    if (software_timer->previous == NULL) {
+        (*software_timer_list)->first = software_timer->next;
+    }
+    else {
+        software_timer->previous->next = software_timer->next;
+    }
+    if (software_timer->next != NULL) {
+        software_timer->next->previous = software_timer->previous;
+    }
+
+    software_timer->previous = NULL;
+    software_timer->next = NULL;
+    software_timer->active = false;
+    (*software_timer_list)->size--;
+}
@@ -0,0 +1,391 @@
+/**
+**************************************************
+* @file stream_buffer.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for streams of bytes and messages of variable size
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'stream_buffer_create' to create a stream buffer
+  (#) Call 'stream_buffer_create_static' to create a stream
+      buffer in caller supplied storage
+  (#) Call 'stream_buffer_delete' to delete a stream buffer
+  (#) Call 'stream_buffer_write' to copy bytes or a message
+      into the ring
+  (#) Call 'stream_buffer_read' to copy bytes or a message
+      out of the ring
+  (#) Call 'stream_buffer_is_readable' to check whether a
+      receiver has to be woken up
+  (#) Call 'stream_buffer_get_waiting_task' to get the first
+      task of a waiting list
+  (#) Call 'stream_buffer_wait' to block a task in a
+      waiting list
+  (#) All functions call 'stream_buffer_checking' to validate
+      proper stream buffer structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include <string.h>
+#include "kernel/stream_buffer.h"
+#include "kernel/kernel_config.h"
+#include "utils/support.h"
+#include "utils/allocator.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+static void stream_buffer_copy_in(stream_buffer_t *stream_buffer, const uint8_t *data, size_t length);
+static void stream_buffer_copy_out(stream_buffer_t *stream_buffer, size_t position, uint8_t *data, size_t length);
+
+/* Public functions */
+/**
+ * @brief Creates a stream buffer with a ring of size bytes.
+ *        In static allocation mode the ring has to be supplied with stream_buffer_create_static.
+ * @param stream_buffer is a pointer of pointer to be initialized as a stream buffer
+ * @param id is the unique id of the stream buffer with which it is accessed
+ * @param size is the capacity of the ring in bytes, message headers included
+ * @param trigger_level is the amount of stored bytes, which wakes up a receiver, it is ignored for messages
+ * @param message_mode is a bool, if set to true, every write stores a message, which is read as a whole
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  STREAM_BUFFER_NO_MEMORY: unable to allocate memory for the stream buffer, always in static allocation mode
+ *  STREAM_BUFFER_INVALID_SIZE: size is 0, smaller than the trigger level or too small for a message header
+ *  STREAM_BUFFER_NO_WAITING_LIST: unable to initialize a waiting list
+ */
+size_t stream_buffer_create(stream_buffer_t **stream_buffer, size_t id, size_t size, size_t trigger_level, bool message_mode) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the ring size is only known at runtime, supply it with stream_buffer_create_static
+    (void) id;
+    (void) size;
+    (void) trigger_level;
+    (void) message_mode;
+    (*stream_buffer) = NULL;
+    return STREAM_BUFFER_NO_MEMORY;
+#else
+    stream_buffer_static_t *storage = (stream_buffer_static_t *) allocator_allocate(sizeof(stream_buffer_static_t));
+    uint8_t *buffer = (uint8_t *) allocator_allocate(size);
+    if (storage == NULL || buffer == NULL) {
+        allocator_free(buffer);
+        allocator_free(storage);
+        return STREAM_BUFFER_NO_MEMORY;
+    }
+
+    size_t status = stream_buffer_create_static(stream_buffer, storage, buffer, id, size, trigger_level, message_mode);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        allocator_free(buffer);
+        allocator_free(storage);
+        (*stream_buffer) = NULL;
+        return status;
+    }
+    (*stream_buffer)->allocated = true;
+
+    return STREAM_BUFFER_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Creates a stream buffer in caller supplied storage, which is never released.
+ * @param stream_buffer is a pointer of pointer to be initialized as a stream buffer
+ * @param storage is the memory of the stream buffer and its waiting lists, which must outlive it
+ * @param buffer is continuous memory of size bytes
+ * @param id is the unique id of the stream buffer with which it is accessed
+ * @param size is the capacity of the ring in bytes, message headers included
+ * @param trigger_level is the amount of stored bytes, which wakes up a receiver, it is ignored for messages
+ * @param message_mode is a bool, if set to true, every write stores a message, which is read as a whole
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  STREAM_BUFFER_NO_MEMORY: storage or buffer is NULL
+ *  STREAM_BUFFER_INVALID_SIZE: size is 0, smaller than the trigger level or too small for a message header
+ *  STREAM_BUFFER_NO_WAITING_LIST: unable to initialize a waiting list
+ */
+size_t stream_buffer_create_static(stream_buffer_t **stream_buffer, stream_buffer_static_t *storage, uint8_t *buffer, size_t id, size_t size, size_t trigger_level, bool message_mode) {
+
+    if (storage == NULL || buffer == NULL) {
+        return STREAM_BUFFER_NO_MEMORY;
+    }
+
+    // a receiver waits for at least one byte and a full ring has to wake it up
+    if (message_mode || trigger_level == 0) {
+        trigger_level = 1;
+    }
+    if (size == 0 || trigger_level > size || (message_mode && size <= STREAM_BUFFER_MESSAGE_HEADER_SIZE)) {
+        return STREAM_BUFFER_INVALID_SIZE;
+    }
+
+    (*stream_buffer) = &storage->stream_buffer;
+    (*stream_buffer)->id = id;
+    (*stream_buffer)->buffer = buffer;
+    (*stream_buffer)->size = size;
+    (*stream_buffer)->head = 0;
+    (*stream_buffer)->tail = 0;
+    (*stream_buffer)->length = 0;
+    (*stream_buffer)->trigger_level = trigger_level;
+    (*stream_buffer)->message_mode = message_mode;
+    (*stream_buffer)->allocated = false;
+
+    // waiting tasks are linked by their embedded element
+    size_t status = linked_list_create_intrusive_static(&(*stream_buffer)->receiving_task_list, &storage->receiving_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, STREAM_BUFFER_LINKED_LIST_ERROR_REGISTER, STREAM_BUFFER_NO_WAITING_LIST);
+    }
+
+    status = linked_list_create_intrusive_static(&(*stream_buffer)->sending_task_list, &storage->sending_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, STREAM_BUFFER_LINKED_LIST_ERROR_REGISTER, STREAM_BUFFER_NO_WAITING_LIST);
+    }
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/**
+ * @brief Deletes a stream buffer, the waiting tasks have to be released before.
+ * @param stream_buffer is a pointer of pointer to be deleted
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  STREAM_BUFFER_NO_WAITING_LIST: unable to delete a waiting list
+ */
+size_t stream_buffer_delete(stream_buffer_t **stream_buffer) {
+
+    size_t status = stream_buffer_checking(stream_buffer);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_delete(&(*stream_buffer)->receiving_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, STREAM_BUFFER_LINKED_LIST_ERROR_REGISTER, STREAM_BUFFER_NO_WAITING_LIST);
+    }
+
+    status = linked_list_delete(&(*stream_buffer)->sending_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, STREAM_BUFFER_LINKED_LIST_ERROR_REGISTER, STREAM_BUFFER_NO_WAITING_LIST);
+    }
+
+    // caller supplied storage stays untouched
+    if ((*stream_buffer)->allocated) {
+        allocator_free((*stream_buffer)->buffer);
+        allocator_free((*stream_buffer));
+    }
+    (*stream_buffer) = NULL;
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/**
+ * @brief Copies bytes into the ring. A stream takes as many bytes as fit, a message is stored as a whole or not at all.
+ * @param stream_buffer is a pointer of pointer to the stream buffer
+ * @param data is the memory to copy from
+ * @param length is the amount of bytes to write
+ * @param written is a size_t pointer, which receives the amount of written bytes without the message header
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors:
+ *  STREAM_BUFFER_FULL: no byte fits into the ring or the message does not fit yet
+ *  STREAM_BUFFER_MESSAGE_TOO_LARGE: the message and its header exceed the capacity of the ring
+ */
+size_t stream_buffer_write(stream_buffer_t **stream_buffer, const void *data, size_t length, size_t *written) {
+
+    size_t status = stream_buffer_checking(stream_buffer);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        return status;
+    }
+
+    (*written) = 0;
+    size_t space = (*stream_buffer)->size - (*stream_buffer)->length;
+    if ((*stream_buffer)->message_mode) {
+        if (length > (*stream_buffer)->size - STREAM_BUFFER_MESSAGE_HEADER_SIZE) {
+            return STREAM_BUFFER_MESSAGE_TOO_LARGE;
+        }
+        if (length + STREAM_BUFFER_MESSAGE_HEADER_SIZE > space) {
+            return STREAM_BUFFER_FULL;
+        }
+
+        stream_buffer_copy_in(*stream_buffer, (const uint8_t *) &length, STREAM_BUFFER_MESSAGE_HEADER_SIZE);
+    }
+    else {
+        if (space == 0 && length > 0) {
+            return STREAM_BUFFER_FULL;
+        }
+        length = length < space ? length : space;
+    }
+
+    stream_buffer_copy_in(*stream_buffer, (const uint8_t *) data, length);
+    (*written) = length;
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/**
+ * @brief Copies bytes out of the ring. A stream returns all stored bytes up to max_length, a message is read as a whole.
+ * @param stream_buffer is a pointer of pointer to the stream buffer
+ * @param data is the memory to copy to
+ * @param max_length is the size of data in bytes
+ * @param read is a size_t pointer, which receives the amount of read bytes without the message header
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors:
+ *  STREAM_BUFFER_EMPTY: no byte is stored
+ *  STREAM_BUFFER_MESSAGE_TOO_LARGE: the next message exceeds max_length, it stays stored
+ */
+size_t stream_buffer_read(stream_buffer_t **stream_buffer, void *data, size_t max_length, size_t *read) {
+
+    size_t status = stream_buffer_checking(stream_buffer);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        return status;
+    }
+
+    (*read) = 0;
+    if ((*stream_buffer)->length == 0) {
+        return STREAM_BUFFER_EMPTY;
+    }
+
+    size_t length = (*stream_buffer)->length;
+    if ((*stream_buffer)->message_mode) {
+        // the header is only consumed together with its message
+        stream_buffer_copy_out(*stream_buffer, (*stream_buffer)->tail, (uint8_t *) &length, STREAM_BUFFER_MESSAGE_HEADER_SIZE);
+        if (length > max_length) {
+            return STREAM_BUFFER_MESSAGE_TOO_LARGE;
+        }
+
+        (*stream_buffer)->tail = ((*stream_buffer)->tail + STREAM_BUFFER_MESSAGE_HEADER_SIZE) % (*stream_buffer)->size;
+        (*stream_buffer)->length -= STREAM_BUFFER_MESSAGE_HEADER_SIZE;
+    }
+    else {
+        length = length < max_length ? length : max_length;
+    }
+
+    stream_buffer_copy_out(*stream_buffer, (*stream_buffer)->tail, (uint8_t *) data, length);
+    (*stream_buffer)->tail = ((*stream_buffer)->tail + length) % (*stream_buffer)->size;
+    (*stream_buffer)->length -= length;
+    (*read) = length;
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/**
+ * @brief Checks, whether a receiver has to be woken up, because the trigger level or a message was reached.
+ * @param stream_buffer is a pointer of pointer to the stream buffer
+ * @return true, if enough bytes are stored, false otherwise or for an invalid stream buffer
+ */
+bool stream_buffer_is_readable(stream_buffer_t **stream_buffer) {
+
+    if (stream_buffer_checking(stream_buffer) != STREAM_BUFFER_SUCCESS) {
+        return false;
+    }
+
+    return (*stream_buffer)->length >= (*stream_buffer)->trigger_level;
+}
+
+/**
+ * @brief Supplies the first task of a waiting list, which waits longest.
+ * @param waiting_task_list is a linked_list_t pointer of pointer to the receiving or the sending list
+ * @param element is a pointer of pointer to a linked list element expecting the first element of the waiting list
+ * @param task is a pointer of pointer to a task expecting the waiting task or NULL, if no task is waiting
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for this error:
+ *  STREAM_BUFFER_NO_WAITING_LIST: waiting list is not initialized
+ */
+size_t stream_buffer_get_waiting_task(linked_list_t **waiting_task_list, linked_list_element_t **element, task_t **task) {
+
+    if (waiting_task_list == NULL || (*waiting_task_list) == NULL) {
+        return STREAM_BUFFER_NO_WAITING_LIST;
+    }
+
+    (*task) = NULL;
+    if ((*waiting_task_list)->size > 0) {
+        (*element) = (*waiting_task_list)->tail;
+        (*task) = TASK_FROM_LIST_ELEMENT(*element);
+    }
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/**
+ * @brief Moves the running task into the receiving or the sending list of the stream buffer.
+ * @param stream_buffer is a pointer of pointer to the stream buffer
+ * @param waiting_task_list is a linked_list_t pointer of pointer to the receiving or the sending list
+ * @param running_task_list is a linked_list_t pointer of pointer to the priority group of the running task
+ * @param running_task_element is a linked_list_element_t pointer of pointer to the running task
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  STREAM_BUFFER_UNABLE_TO_WAIT: unable to move the task
+ */
+size_t stream_buffer_wait(stream_buffer_t **stream_buffer, linked_list_t **waiting_task_list, linked_list_t **running_task_list, linked_list_element_t **running_task_element) {
+
+    size_t status = stream_buffer_checking(stream_buffer);
+    if (status != STREAM_BUFFER_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_transfer(waiting_task_list, running_task_list, running_task_element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, STREAM_BUFFER_LINKED_LIST_ERROR_REGISTER, STREAM_BUFFER_UNABLE_TO_WAIT);
+    }
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/**
+ * @brief Validates a stream buffer
+ * @param stream_buffer is a pointer of pointer to the stream buffer
+ * @return STREAM_BUFFER_SUCCESS on success or unequal STREAM_BUFFER_SUCCESS for an error
+ * @info On error check for these errors:
+ *  STREAM_BUFFER_IS_NULL: stream buffer or its ring is not initialized
+ *  STREAM_BUFFER_NO_WAITING_LIST: a waiting list is not initialized
+ */
+size_t stream_buffer_checking(stream_buffer_t **stream_buffer) {
+
+    if (stream_buffer == NULL || (*stream_buffer) == NULL || (*stream_buffer)->buffer == NULL) {
+        return STREAM_BUFFER_IS_NULL;
+    }
+
+    if ((*stream_buffer)->receiving_task_list == NULL || (*stream_buffer)->sending_task_list == NULL) {
+        return STREAM_BUFFER_NO_WAITING_LIST;
+    }
+
+    return STREAM_BUFFER_SUCCESS;
+}
+
+/* Static module functions (implementation) */
+/**
+ * @brief Copies bytes to the head of the ring by at most two spans, the caller checked the free space.
+ * @param stream_buffer is a pointer to the stream buffer
+ * @param data is the memory to copy from
+ * @param length is the amount of bytes
+ */
+static void stream_buffer_copy_in(stream_buffer_t *stream_buffer, const uint8_t *data, size_t length) {
+    size_t first = stream_buffer->size - stream_buffer->head;
+    first = length < first ? length : first;
+
+    memcpy(&stream_buffer->buffer[stream_buffer->head], data, first);
+    memcpy(stream_buffer->buffer, &data[first], length - first);
+
+    stream_buffer->head = (stream_buffer->head + length) % stream_buffer->size;
+    stream_buffer->length += length;
+}
+
+/**
+ * @brief Copies bytes from a position of the ring by at most two spans, the positions are left untouched.
+ * @param stream_buffer is a pointer to the stream buffer
+ * @param position is the position of the first byte
+ * @param data is the memory to copy to
+ * @param length is the amount of bytes
+ */
+static void stream_buffer_copy_out(stream_buffer_t *stream_buffer, size_t position, uint8_t *data, size_t length) {
+    size_t first = stream_buffer->size - position;
+    first = length < first ? length : first;
+
+    memcpy(data, &stream_buffer->buffer[position], first);
+    memcpy(&data[first], stream_buffer->buffer, length - first);
+}
@@ -12,12 +12,18 @@
 ==================================================
   ### Usage ###
   (#) Call 'task_create' to create a task
+  (#) Call 'task_create_static' to create a task in caller
+      supplied storage
   (#) Call 'task_set_state' to set a tasks state
   (#) Call 'task_set_time_quantum_remaining' to set the
       remaining time quantum of a task
   (#) Call 'task_set_priority' to set a tasks priority
+  (#) Call 'task_set_inherited_priority' to set a tasks
+      effective priority without changing its base priority
   (#) Call 'task_set_blocked_info' to set a tasks current
       blocked information of which list it belongs to
+  (#) Call 'task_notify' to update the notification value
+      of a task by a notification action
   (#) All functions call 'task_checking' to validate
       proper task structure. Refer to this function
       for potential error codes not documented in each
@@ -28,6 +34,7 @@
 */
 /* Includes */
 #include "kernel/task.h"
+#include "utils/pool.h"
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -35,7 +42,12 @@
 #define DEFAULT_PSR    0x01000000
 /* Preprocessor macros */
 /* Module intern type definitions */
+typedef uint32_t task_stack_t[TCB_TASK_STACK_SIZE];
+
 /* Static module variables */
+POOL_DEFINE(g_task_pool, task_static_t, KERNEL_POOL_TASKS);
+// only stacks of the default size are pooled, other sizes are supplied by the caller
+POOL_DEFINE(g_task_stack_pool, task_stack_t, KERNEL_POOL_STACKS);
 /* Static module functions (prototypes) */
 
 /* Public functions */
@@ -52,35 +64,115 @@
  * @param notification_conditions is a function pointer with 2 arguments, a size_t pointer and a size_t, and no return.
  *        It references an optional function which can contain additional control of wanted events
  * @param timeout is a size_t, which defines the tasks timeout in millisecond when waiting for wanted events
+ * @param stack_size is a size_t, which defines the tasks stack size in 32 bit words. It has to be even and at least TCB_TASK_MINIMUM_STACK_SIZE
+ * @param stack is an optional uint32_t pointer to an 8 byte aligned buffer of stack_size words, if NULL the stack is allocated.
+ *        In static allocation mode only stacks of TCB_TASK_STACK_SIZE words are allocated.
  * @return TASK_SUCCESS on success or unequal TASK_SUCCESS for an error
  * @info On error check for these errors:
  *  TASK_NO_MEMORY: unable to allocate memory for task
- *  TASK_DATA_NO_MEMORY: unable to allocate memory for task_data
+ *  TASK_STACK_NO_MEMORY: unable to allocate memory for the stack
+ *  TASK_INVALID_STACK: stack size is too small, odd or the provided stack is not 8 byte aligned
  */
-size_t task_create(task_t **task, size_t (*task_main)(void), void (*kernel_task_terminate)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout) {
-    (*task) = (task_t *) malloc(sizeof(task_t));
+size_t task_create(task_t **task, size_t (*task_main)(void), void (*kernel_task_terminate)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack) {
+    // the initial stack frame needs room and the stack pointer has to stay 8 byte aligned
+    if (stack_size < TCB_TASK_MINIMUM_STACK_SIZE
+            || stack_size % 2 != 0
+            || ((uintptr_t) stack) % 8 != 0) {
+        return TASK_INVALID_STACK;
+    }
 
-    if ((*task)==NULL) {
+    task_static_t *storage = POOL_ALLOCATE(g_task_pool, task_static_t);
+    if (storage==NULL) {
         return TASK_NO_MEMORY;
     }
 
-    (*task)->task_main = task_main;
-    (*task)->task_data = (TCB_sctTCB_t *) malloc(sizeof(TCB_sctTCB_t));
+    // tasks only pay for the stack they require
+    bool stack_owned = stack == NULL;
+    if (stack_owned) {
+#if KERNEL_STATIC_ALLOCATION
+        if (stack_size == TCB_TASK_STACK_SIZE) {
+            stack = (uint32_t *) POOL_ALLOCATE(g_task_stack_pool, task_stack_t);
+        }
+#else
+        stack = (uint32_t *) allocator_allocate(stack_size * sizeof(uint32_t));
+#endif
+        if (stack == NULL) {
+            POOL_FREE(g_task_pool, storage);
+            return TASK_STACK_NO_MEMORY;
+        }
+    }
 
-    if ((*task)->task_data==NULL) {
-        return TASK_DATA_NO_MEMORY;
+    size_t status = task_create_static(task, storage, task_main, kernel_task_terminate, u8_task_id, task_name, u8_task_priority, time_quantum, wanted_events, notification_conditions, timeout, stack_size, stack);
+    (*task)->allocated = true;
+    (*task)->stack_owned = stack_owned;
+
+    return status;
+}
+
+/**
+ * @brief Creates a task in caller supplied storage, which is never released.
+ * @param task is a task_t pointer of pointer to the created task
+ * @param storage is the memory of the task and its task control block, which must outlive it
+ * @param task_main is a function pointer with no arguments and size_t return. It references the tasks main function.
+ * @param kernel_task_terminate is a function pointer with no arguments and no return. It references the tasks terminate function.
+ * @param u8_task_id is a uint8_t, which is used as a key for fast access.
+ * @param task_name is a const char pointer to the tasks name, which is displayed when recording in SEGGER SystemView
+ * @param u8_task_priority is a uint8_t, which defines the tasks priority. A lower number specifies a higher priority
+ * @param time_quantum is a size_t, which defines a tasks time quantum, its potential maximum consecutive runtime in milliseconds
+ * @param wanted_events is a size_t, which defines which events the task expects to receive
+ * @param notification_conditions is a function pointer with 2 arguments, a size_t pointer and a size_t, and no return.
+ *        It references an optional function which can contain additional control of wanted events
+ * @param timeout is a size_t, which defines the tasks timeout in millisecond when waiting for wanted events
+ * @param stack_size is a size_t, which defines the tasks stack size in 32 bit words. It has to be even and at least TCB_TASK_MINIMUM_STACK_SIZE
+ * @param stack is a uint32_t pointer to an 8 byte aligned buffer of stack_size words
+ * @return TASK_SUCCESS on success or unequal TASK_SUCCESS for an error
+ * @info On error check for these errors:
+ *  TASK_NO_MEMORY: storage is NULL
+ *  TASK_STACK_NO_MEMORY: stack is NULL
+ *  TASK_INVALID_STACK: stack size is too small, odd or the provided stack is not 8 byte aligned
+ */
+size_t task_create_static(task_t **task, task_static_t *storage, size_t (*task_main)(void), void (*kernel_task_terminate)(void), uint8_t u8_task_id, const char *task_name, uint8_t u8_task_priority, size_t time_quantum, size_t wanted_events, void (*notification_conditions)(size_t *, size_t), size_t timeout, size_t stack_size, uint32_t *stack) {
+    // the initial stack frame needs room and the stack pointer has to stay 8 byte aligned
+    if (stack_size < TCB_TASK_MINIMUM_STACK_SIZE
+            || stack_size % 2 != 0
+            || ((uintptr_t) stack) % 8 != 0) {
+        return TASK_INVALID_STACK;
     }
 
+    if (storage==NULL) {
+        return TASK_NO_MEMORY;
+    }
+
+    if (stack==NULL) {
+        return TASK_STACK_NO_MEMORY;
+    }
+
+    (*task) = &storage->task;
+    (*task)->task_main = task_main;
+    (*task)->task_data = &storage->task_data;
+    (*task)->allocated = false;
+    (*task)->stack_owned = false;
+
+    (*task)->task_data->pu32TaskStack = stack;
+    (*task)->task_data->u32TaskStackSize = stack_size;
+
     (*task)->task_data->u8TaskId = u8_task_id;
     (*task)->task_data->u8TaskPrio = u8_task_priority;
+    (*task)->base_priority = u8_task_priority;
+    (*task)->blocked_mutex = NULL;
+    (*task)->ceiling_locks = 0;
     (*task)->task_data->eTaskState = TaskState_Created;
     (*task)->time_quantum = time_quantum;
     (*task)->time_quantum_remaining = 0;
     (*task)->message = NULL;
     (*task)->message_set = false;
-    (*task)->delta_time = 0;
-    for (size_t task_register = 0; task_register < TCB_TASK_STACK_SIZE; task_register++) {
-        (*task)->task_data->au32TaskStack[task_register] = 0;//task_register;
+    // both nodes are embedded, so moving the task between lists never allocates
+    linked_list_element_init(&(*task)->list_element, (*task));
+    timer_wheel_node_init(&(*task)->timeout_node, (*task));
+    (*task)->blocked_timeout_list = NULL;
+    (*task)->blocked_timeout_list_element = NULL;
+    for (size_t task_register = 0; task_register < stack_size; task_register++) {
+        (*task)->task_data->pu32TaskStack[task_register] = 0;//task_register;
     }
     sprintf((*task)->task_name, "%d: %s", u8_task_id, task_name);
 
@@ -89,21 +181,34 @@ size_t task_create(task_t **task, size_t (*task_main)(void), void (*kernel_task_
     (*task)->event_register.notification_conditions = notification_conditions;
     (*task)->event_register.timeout = timeout;
 
+    (*task)->notification.value = 0;
+    (*task)->notification.pending = false;
+    (*task)->notification.waiting = false;
+
+    (*task)->cpu.cycles = 0;
+    (*task)->cpu.created = 0;
+    (*task)->cpu.activations = 0;
+
+    (*task)->event_group_wait.wanted_events = 0;
+    (*task)->event_group_wait.received_events = 0;
+    (*task)->event_group_wait.wait_all = false;
+    (*task)->event_group_wait.clear_on_exit = false;
+
     //#define __arm__
 #ifdef __arm__
     // Stack Frame defaults
     //uint32_t *psr;
     //__asm volatile ("mov %0, xpsr" : "=r" (psr));
-    (*task)->task_data->au32TaskStack[TCB_TASK_STACK_SIZE - 1] = DEFAULT_PSR;//(uint32_t) psr;        // xPSR
-    (*task)->task_data->au32TaskStack[TCB_TASK_STACK_SIZE - 2] = (uint32_t) task_main;  // PC
-    (*task)->task_data->au32TaskStack[TCB_TASK_STACK_SIZE - 3] = (uint32_t) kernel_task_terminate;//(uint32_t) 0xFFFFFFFF; // LR
+    (*task)->task_data->pu32TaskStack[stack_size - 1] = DEFAULT_PSR;//(uint32_t) psr;        // xPSR
+    (*task)->task_data->pu32TaskStack[stack_size - 2] = (uint32_t) task_main;  // PC
+    (*task)->task_data->pu32TaskStack[stack_size - 3] = (uint32_t) kernel_task_terminate;//(uint32_t) 0xFFFFFFFF; // LR
 
-    (*task)->task_data->u32TaskSP = (uint32_t) &(*task)->task_data->au32TaskStack[TCB_TASK_STACK_SIZE - 16];
+    (*task)->task_data->u32TaskSP = (uint32_t) &(*task)->task_data->pu32TaskStack[stack_size - 16];
 
-    /*(*task)->task_data->au32TaskStack[0] = DEFAULT_PSR;
-      (*task)->task_data->au32TaskStack[1] = (uint32_t) task_main;
-      (*task)->task_data->au32TaskStack[3] = (uint32_t) 0xFFFFFFFF;
-      (*task)->task_data->u32TaskSP = (uint32_t) &(*task)->task_data->au32TaskStack[0];*/
+    /*(*task)->task_data->pu32TaskStack[0] = DEFAULT_PSR;
+      (*task)->task_data->pu32TaskStack[1] = (uint32_t) task_main;
+      (*task)->task_data->pu32TaskStack[3] = (uint32_t) 0xFFFFFFFF;
+      (*task)->task_data->u32TaskSP = (uint32_t) &(*task)->task_data->pu32TaskStack[0];*/
 #else
     (*task)->task_data->u32TaskSP = 0;
 #endif
@@ -112,8 +217,8 @@ size_t task_create(task_t **task, size_t (*task_main)(void), void (*kernel_task_
     (*task)->info.TaskID        = u8_task_id;
     (*task)->info.sName         = (*task)->task_name;
     (*task)->info.Prio            = u8_task_priority;
-    (*task)->info.StackBase     = (uint32_t) &(*task)->task_data->au32TaskStack[TCB_TASK_STACK_SIZE];
-    (*task)->info.StackSize     = TCB_TASK_STACK_SIZE;
+    (*task)->info.StackBase     = (uint32_t) &(*task)->task_data->pu32TaskStack[stack_size];
+    (*task)->info.StackSize     = stack_size;
     SEGGER_SET_STACKPOINTER(*task);
 #endif
 
@@ -132,15 +237,27 @@ size_t task_delete(task_t **task) {
         return status;
     }
 
-    free((*task)->task_data);
+    // a provided stack belongs to the caller
+    if ((*task)->stack_owned) {
+#if KERNEL_STATIC_ALLOCATION
+        POOL_FREE(g_task_stack_pool, (*task)->task_data->pu32TaskStack);
+#else
+        allocator_free((*task)->task_data->pu32TaskStack);
+#endif
+    }
+    (*task)->task_data->pu32TaskStack = NULL;
+
+    // the task control block is stored in the same block as the task
     (*task)->task_data = NULL;
 
 #ifdef SEGGER
-    free((void *)(*task)->info.sName);
+    // the name is stored in the task itself
     (*task)->info.sName = NULL;
 #endif
 
-    free((*task));
+    if ((*task)->allocated) {
+        POOL_FREE(g_task_pool, (*task));
+    }
     (*task) = NULL;
 
 
@@ -210,6 +327,23 @@ size_t task_reset_time_quantum_remaining(task_t **task) {
  * @return TASK_SUCCESS on success or unequal TASK_SUCCESS for an error
  */
 size_t task_set_priority(task_t **task, uint8_t u8_task_priority) {
+    size_t status = task_set_inherited_priority(task, u8_task_priority);
+    if (status!=TASK_SUCCESS) {
+        return status;
+    }
+
+    (*task)->base_priority = u8_task_priority;
+
+    return TASK_SUCCESS;
+}
+
+/**
+ * @brief Sets a tasks effective priority, which is restored to the base priority once nothing is inherited anymore.
+ * @param task is a task_t pointer of pointer, which references the task of which to set the priority
+ * @param u8_task_priority is a uint8_t, which specifies the effective priority.
+ * @return TASK_SUCCESS on success or unequal TASK_SUCCESS for an error
+ */
+size_t task_set_inherited_priority(task_t **task, uint8_t u8_task_priority) {
     size_t status = task_checking(task);
     if (status!=TASK_SUCCESS) {
         return status;
@@ -243,6 +377,42 @@ size_t task_set_blocked_info(task_t **task, linked_list_t **blocked_timeout_list
     return TASK_SUCCESS;
 }
 
+/**
+ * @brief Applies a notification action to the notification value of a task and marks it as pending.
+ * @param task is a task_t pointer of pointer to the notified task
+ * @param value is size_t, which is set, or the bits to set, depending on the action
+ * @param action is task_notify_action_e, which is applied to the notification value
+ * @return TASK_SUCCESS on success or unequal TASK_SUCCESS for an error
+ * @info On error check for this error:
+ *  TASK_INVALID_ACTION: action is unknown
+ */
+size_t task_notify(task_t **task, size_t value, task_notify_action_e action) {
+    size_t status = task_checking(task);
+    if (status != TASK_SUCCESS) {
+        return status;
+    }
+
+    switch (action) {
+    case TASK_NOTIFY_NO_ACTION:
+        break;
+    case TASK_NOTIFY_SET_BITS:
+        (*task)->notification.value |= value;
+        break;
+    case TASK_NOTIFY_INCREMENT:
+        (*task)->notification.value++;
+        break;
+    case TASK_NOTIFY_OVERWRITE:
+        (*task)->notification.value = value;
+        break;
+    default:
+        return TASK_INVALID_ACTION;
+    }
+
+    (*task)->notification.pending = true;
+
+    return TASK_SUCCESS;
+}
+
 /**
  * @brief Checks whether a task is valid.
  * @param task is a task_t pointer of pointer to the task to be checked
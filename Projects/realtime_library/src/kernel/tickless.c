@@ -0,0 +1,198 @@
+/**
+**************************************************
+* @file tickless.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for suppressing the system tick during idle
+@verbatim
+==================================================
+  ### Resources used ###
+  A one shot timer provided by the port layer
+==================================================
+  ### Usage ###
+  (#) Provide a 'tickless_timer_t' with the port
+      specific timer functions
+  (#) Call 'tickless_create' to create a tickless
+      idle control
+  (#) Call 'tickless_delete' to delete a tickless
+      idle control
+  (#) Call 'tickless_idle' with interrupts disabled to
+      sleep until the next timeout of the timing wheel
+      is due or any other interrupt arrived
+  (#) Call 'tickless_get_skipped_ticks' to get the
+      amount of suppressed ticks
+  (#) All functions call 'tickless_checking' to validate
+      proper tickless structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "kernel/tickless.h"
+#include "utils/support.h"
+#include "utils/pool.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+POOL_DEFINE(g_tickless_pool, tickless_t, KERNEL_POOL_TICKLESS);
+/* Static module functions (prototypes) */
+
+/* Public functions */
+/**
+ * @brief Creates a tickless idle control for a port layer timer.
+ * @param tickless is a pointer of pointer to be initialized as tickless idle control
+ * @param timer is a pointer to the port layer timer functions
+ * @param minimum_ticks is the shortest idle period, which suppresses the tick
+ * @return TICKLESS_SUCCESS on success or unequal TICKLESS_SUCCESS for an error
+ * @info On error check for these errors:
+ *  TICKLESS_NO_MEMORY: unable to allocate memory for tickless idle control
+ *  TICKLESS_NO_TIMER: timer or one of its functions is missing
+ */
+size_t tickless_create(tickless_t **tickless, const tickless_timer_t *timer, size_t minimum_ticks) {
+
+    if (timer == NULL
+            || timer->start == NULL
+            || timer->sleep == NULL
+            || timer->stop == NULL
+            || timer->increment_tick == NULL) {
+        return TICKLESS_NO_TIMER;
+    }
+
+    (*tickless) = POOL_ALLOCATE(g_tickless_pool, tickless_t);
+    if ((*tickless) == NULL) {
+        return TICKLESS_NO_MEMORY;
+    }
+
+    (*tickless)->timer = timer;
+    (*tickless)->minimum_ticks = minimum_ticks;
+    (*tickless)->skipped_ticks = 0;
+    (*tickless)->sleeps = 0;
+
+    return TICKLESS_SUCCESS;
+}
+
+/**
+ * @brief Deletes a tickless idle control.
+ * @param tickless is a pointer of pointer to the tickless idle control, which will be set to NULL
+ * @return TICKLESS_SUCCESS on success or unequal TICKLESS_SUCCESS for an error
+ */
+size_t tickless_delete(tickless_t **tickless) {
+
+    size_t status = tickless_checking(tickless);
+    if (status != TICKLESS_SUCCESS) {
+        return status;
+    }
+
+    POOL_FREE(g_tickless_pool, (*tickless));
+    (*tickless) = NULL;
+
+    return TICKLESS_SUCCESS;
+}
+
+/**
+ * @brief Sleeps without tick until the next timeout is due or an interrupt woke the system up.
+ *        The elapsed ticks are credited to the timing wheel and the system tick,
+ *        hence the following tick releases the tasks as if the tick was never suppressed.
+ *        Has to be called with interrupts disabled, pending interrupts still end the sleep.
+ * @param tickless is a pointer of pointer to the tickless idle control
+ * @param timer_wheel is a timer_wheel_t pointer of pointer to the timing wheel of delayed tasks
+ * @param elapsed_ticks is a size_t pointer, which returns the suppressed ticks
+ * @return TICKLESS_SUCCESS on success or unequal TICKLESS_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  TICKLESS_IDLE_TOO_SHORT: the next timeout is due before the minimum ticks, nothing was suppressed
+ *  TICKLESS_UNABLE_TO_IDLE: unable to idle due to subcomponents
+ */
+size_t tickless_idle(tickless_t **tickless, timer_wheel_t **timer_wheel, size_t *elapsed_ticks) {
+
+    size_t status = tickless_checking(tickless);
+    if (status != TICKLESS_SUCCESS) {
+        return status;
+    }
+
+    *elapsed_ticks = 0;
+
+    // the timing wheel knows the ticks until its next timeout, an empty wheel allows to sleep forever
+    size_t expected_ticks = TICKLESS_WAIT_FOREVER;
+    status = timer_wheel_get_idle_ticks(timer_wheel, &expected_ticks);
+    if (status != TIMER_WHEEL_SUCCESS && status != TIMER_WHEEL_IS_EMPTY) {
+        return ERROR_INFO(status, TICKLESS_TIMER_WHEEL_ERROR_REGISTER, TICKLESS_UNABLE_TO_IDLE);
+    }
+
+    if (expected_ticks < (*tickless)->minimum_ticks) {
+        return TICKLESS_IDLE_TOO_SHORT;
+    }
+
+    // the timer might not be able to cover the whole period, it is restarted on the next idle
+    const tickless_timer_t *timer = (*tickless)->timer;
+    size_t programmed_ticks = timer->start(expected_ticks);
+    if (programmed_ticks > expected_ticks) {
+        programmed_ticks = expected_ticks;
+    }
+
+    timer->sleep();
+
+    // an early interrupt stops the timer before the programmed ticks elapsed
+    size_t ticks = timer->stop();
+    if (ticks > programmed_ticks) {
+        ticks = programmed_ticks;
+    }
+
+    // the elapsed ticks never exceed the idle ticks, hence no timeout is skipped
+    status = timer_wheel_skip(timer_wheel, ticks);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return ERROR_INFO(status, TICKLESS_TIMER_WHEEL_ERROR_REGISTER, TICKLESS_UNABLE_TO_IDLE);
+    }
+    timer->increment_tick(ticks);
+
+    (*tickless)->skipped_ticks += ticks;
+    (*tickless)->sleeps++;
+    *elapsed_ticks = ticks;
+
+    return TICKLESS_SUCCESS;
+}
+
+/**
+ * @brief Returns the total amount of suppressed ticks.
+ * @param tickless is a pointer of pointer to the tickless idle control
+ * @param skipped_ticks is a size_t pointer, which returns the suppressed ticks
+ * @return TICKLESS_SUCCESS on success or unequal TICKLESS_SUCCESS for an error
+ */
+size_t tickless_get_skipped_ticks(tickless_t **tickless, size_t *skipped_ticks) {
+
+    size_t status = tickless_checking(tickless);
+    if (status != TICKLESS_SUCCESS) {
+        return status;
+    }
+
+    *skipped_ticks = (*tickless)->skipped_ticks;
+
+    return TICKLESS_SUCCESS;
+}
+
+/**
+ * @brief Validates the tickless idle control.
+ * @param tickless is a pointer of pointer to the tickless idle control
+ * @return TICKLESS_SUCCESS on success or unequal TICKLESS_SUCCESS for an error
+ * @info On error check for these errors:
+ *  TICKLESS_NO_MEMORY: tickless idle control is not initialized
+ *  TICKLESS_NO_TIMER: tickless idle control has no timer
+ */
+size_t tickless_checking(tickless_t **tickless) {
+
+    if ((*tickless) == NULL) {
+        return TICKLESS_NO_MEMORY;
+    }
+    else if ((*tickless)->timer == NULL) {
+        return TICKLESS_NO_TIMER;
+    }
+
+    return TICKLESS_SUCCESS;
+}
+
+/* Static module functions (implementation) */
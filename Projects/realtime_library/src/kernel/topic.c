@@ -0,0 +1,336 @@
+/**
+**************************************************
+* @file topic.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for publishing samples to any amount of subscribers
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'topic_create' to create a topic
+  (#) Call 'topic_create_static' to create a topic in caller
+      supplied storage
+  (#) Call 'topic_delete' to delete a topic
+  (#) Call 'topic_subscribe' to add a subscriber, which reads
+      the samples published afterwards
+  (#) Call 'topic_publish' to write a sample once into the
+      ring, its costs do not depend on the subscribers
+  (#) Call 'topic_read' to copy the next sample of a
+      subscriber. A subscriber, which fell behind by more
+      than the ring size, skips the overwritten samples and
+      counts them as overruns.
+  (#) Call 'topic_wait' to block a task until the next sample
+  (#) Call 'topic_get_overruns' to get the overruns of a
+      subscriber
+  (#) All functions call 'topic_checking' to validate
+      proper topic structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include <string.h>
+#include "kernel/topic.h"
+#include "kernel/kernel_config.h"
+#include "utils/support.h"
+#include "utils/allocator.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+/* Public functions */
+/**
+ * @brief Creates a topic with a ring of size samples.
+ *        In static allocation mode the ring has to be supplied with topic_create_static.
+ * @param topic is a pointer of pointer to be initialized as a topic
+ * @param id is the unique id of the topic with which it is accessed
+ * @param size is the amount of samples kept for slow subscribers, which has to be a power of 2
+ * @param sample_size is the size of a single sample
+ * @param max_subscribers is the amount of subscribers
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  TOPIC_NO_MEMORY: unable to allocate memory for the topic, always in static allocation mode
+ *  TOPIC_INVALID_SIZE: size is not a power of 2 or sample_size is 0
+ *  TOPIC_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t topic_create(topic_t **topic, size_t id, size_t size, size_t sample_size, size_t max_subscribers) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the ring size is only known at runtime, supply it with topic_create_static
+    (void) id;
+    (void) size;
+    (void) sample_size;
+    (void) max_subscribers;
+    (*topic) = NULL;
+    return TOPIC_NO_MEMORY;
+#else
+    topic_static_t *storage = (topic_static_t *) allocator_allocate(sizeof(topic_static_t));
+    void *samples = allocator_allocate(size * sample_size);
+    topic_subscriber_t *subscribers = (topic_subscriber_t *) allocator_allocate(max_subscribers * sizeof(topic_subscriber_t));
+    if (storage == NULL || samples == NULL || subscribers == NULL) {
+        allocator_free(subscribers);
+        allocator_free(samples);
+        allocator_free(storage);
+        return TOPIC_NO_MEMORY;
+    }
+
+    size_t status = topic_create_static(topic, storage, samples, subscribers, id, size, sample_size, max_subscribers);
+    if (status != TOPIC_SUCCESS) {
+        allocator_free(subscribers);
+        allocator_free(samples);
+        allocator_free(storage);
+        (*topic) = NULL;
+        return status;
+    }
+    (*topic)->allocated = true;
+
+    return TOPIC_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Creates a topic in caller supplied storage, which is never released.
+ * @param topic is a pointer of pointer to be initialized as a topic
+ * @param storage is the memory of the topic and its waiting list, which must outlive it
+ * @param samples is continuous memory of size * sample_size bytes
+ * @param subscribers is an array of max_subscribers read positions
+ * @param id is the unique id of the topic with which it is accessed
+ * @param size is the amount of samples kept for slow subscribers, which has to be a power of 2
+ * @param sample_size is the size of a single sample
+ * @param max_subscribers is the amount of subscribers
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  TOPIC_NO_MEMORY: storage, samples or subscribers is NULL
+ *  TOPIC_INVALID_SIZE: size is not a power of 2 or sample_size is 0
+ *  TOPIC_NO_WAITING_LIST: unable to initialize waiting list
+ */
+size_t topic_create_static(topic_t **topic, topic_static_t *storage, void *samples, topic_subscriber_t *subscribers, size_t id, size_t size, size_t sample_size, size_t max_subscribers) {
+
+    if (storage == NULL || samples == NULL || subscribers == NULL) {
+        return TOPIC_NO_MEMORY;
+    }
+
+    // positions are masked instead of wrapped by a modulo
+    if (size == 0 || (size & (size - 1)) != 0 || sample_size == 0) {
+        return TOPIC_INVALID_SIZE;
+    }
+
+    (*topic) = &storage->topic;
+    (*topic)->id = id;
+    (*topic)->samples = (uint8_t *) samples;
+    (*topic)->sample_size = sample_size;
+    (*topic)->size = size;
+    (*topic)->sequence = 0;
+    (*topic)->subscribers = subscribers;
+    (*topic)->max_subscribers = max_subscribers;
+    (*topic)->subscriber_count = 0;
+    (*topic)->allocated = false;
+
+    // waiting tasks are linked by their embedded element
+    size_t status = linked_list_create_intrusive_static(&(*topic)->waiting_task_list, &storage->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, TOPIC_LINKED_LIST_ERROR_REGISTER, TOPIC_NO_WAITING_LIST);
+    }
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Deletes a topic, the waiting tasks have to be released before.
+ * @param topic is a pointer of pointer to be deleted
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  TOPIC_NO_WAITING_LIST: unable to delete waiting list
+ */
+size_t topic_delete(topic_t **topic) {
+
+    size_t status = topic_checking(topic);
+    if (status != TOPIC_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_delete(&(*topic)->waiting_task_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, TOPIC_LINKED_LIST_ERROR_REGISTER, TOPIC_NO_WAITING_LIST);
+    }
+
+    // caller supplied storage stays untouched
+    if ((*topic)->allocated) {
+        allocator_free((*topic)->subscribers);
+        allocator_free((*topic)->samples);
+        allocator_free((*topic));
+    }
+    (*topic) = NULL;
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Adds a subscriber, which reads the samples published after the subscription.
+ * @param topic is a pointer of pointer to the topic
+ * @param subscriber is a size_t pointer, which receives the key of the subscriber
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for this error:
+ *  TOPIC_NO_SUBSCRIBER: the topic has no storage for another subscriber
+ */
+size_t topic_subscribe(topic_t **topic, size_t *subscriber) {
+
+    size_t status = topic_checking(topic);
+    if (status != TOPIC_SUCCESS) {
+        return status;
+    }
+
+    if ((*topic)->subscriber_count >= (*topic)->max_subscribers) {
+        return TOPIC_NO_SUBSCRIBER;
+    }
+
+    (*subscriber) = (*topic)->subscriber_count;
+    (*topic)->subscribers[*subscriber].cursor = (*topic)->sequence;
+    (*topic)->subscribers[*subscriber].overruns = 0;
+    (*topic)->subscriber_count++;
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Writes a sample into the ring. It is copied once and shared by all subscribers,
+ *        a subscriber, which has not read the oldest sample, is never waited for.
+ * @param topic is a pointer of pointer to the topic
+ * @param sample is a pointer to sample_size bytes
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ */
+size_t topic_publish(topic_t **topic, void *sample) {
+
+    size_t status = topic_checking(topic);
+    if (status != TOPIC_SUCCESS) {
+        return status;
+    }
+
+    size_t slot = (*topic)->sequence & ((*topic)->size - 1);
+    memcpy(&(*topic)->samples[slot * (*topic)->sample_size], sample, (*topic)->sample_size);
+    (*topic)->sequence++;
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Copies the next sample of a subscriber. The overwritten samples of a subscriber,
+ *        which fell behind by more than the ring size, are skipped and counted as overruns.
+ * @param topic is a pointer of pointer to the topic
+ * @param subscriber is the key of the subscriber
+ * @param sample is a pointer to sample_size bytes, which receives the sample
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for these errors:
+ *  TOPIC_NO_SUBSCRIBER: the subscriber does not exist
+ *  TOPIC_NO_SAMPLE: the subscriber has read all published samples
+ */
+size_t topic_read(topic_t **topic, size_t subscriber, void *sample) {
+
+    size_t status = topic_checking(topic);
+    if (status != TOPIC_SUCCESS) {
+        return status;
+    }
+
+    if (subscriber >= (*topic)->subscriber_count) {
+        return TOPIC_NO_SUBSCRIBER;
+    }
+
+    topic_subscriber_t *reader = &(*topic)->subscribers[subscriber];
+    size_t unread = (*topic)->sequence - reader->cursor;
+    if (unread == 0) {
+        return TOPIC_NO_SAMPLE;
+    }
+
+    // continue with the oldest sample, which was not overwritten yet
+    if (unread > (*topic)->size) {
+        reader->overruns += unread - (*topic)->size;
+        reader->cursor = (*topic)->sequence - (*topic)->size;
+    }
+
+    size_t slot = reader->cursor & ((*topic)->size - 1);
+    memcpy(sample, &(*topic)->samples[slot * (*topic)->sample_size], (*topic)->sample_size);
+    reader->cursor++;
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Moves the running task into the waiting list of the topic.
+ * @param topic is a pointer of pointer to the topic
+ * @param running_task_list is a linked_list_t pointer of pointer to the priority group of the running task
+ * @param running_task_element is a linked_list_element_t pointer of pointer to the running task
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for these errors and component errors:
+ *  TOPIC_UNABLE_TO_WAIT: unable to move the task
+ */
+size_t topic_wait(topic_t **topic, linked_list_t **running_task_list, linked_list_element_t **running_task_element) {
+
+    size_t status = topic_checking(topic);
+    if (status != TOPIC_SUCCESS) {
+        return status;
+    }
+
+    status = linked_list_transfer(&(*topic)->waiting_task_list, running_task_list, running_task_element);
+    if (status != LINKED_LIST_SUCCESS) {
+        return ERROR_INFO(status, TOPIC_LINKED_LIST_ERROR_REGISTER, TOPIC_UNABLE_TO_WAIT);
+    }
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Gets the amount of samples a subscriber missed, because they were overwritten.
+ * @param topic is a pointer of pointer to the topic
+ * @param subscriber is the key of the subscriber
+ * @param overruns is a size_t pointer, which receives the amount of missed samples
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for this error:
+ *  TOPIC_NO_SUBSCRIBER: the subscriber does not exist
+ */
+size_t topic_get_overruns(topic_t **topic, size_t subscriber, size_t *overruns) {
+
+    size_t status = topic_checking(topic);
+    if (status != TOPIC_SUCCESS) {
+        return status;
+    }
+
+    if (subscriber >= (*topic)->subscriber_count) {
+        return TOPIC_NO_SUBSCRIBER;
+    }
+
+    (*overruns) = (*topic)->subscribers[subscriber].overruns;
+
+    return TOPIC_SUCCESS;
+}
+
+/**
+ * @brief Validates a topic
+ * @param topic is a pointer of pointer to the topic
+ * @return TOPIC_SUCCESS on success or unequal TOPIC_SUCCESS for an error
+ * @info On error check for these errors:
+ *  TOPIC_IS_NULL: topic is not initialized
+ *  TOPIC_NO_WAITING_LIST: waiting list is not initialized
+ */
+size_t topic_checking(topic_t **topic) {
+
+    if (topic == NULL || (*topic) == NULL) {
+        return TOPIC_IS_NULL;
+    }
+
+    if ((*topic)->waiting_task_list == NULL) {
+        return TOPIC_NO_WAITING_LIST;
+    }
+
+    return TOPIC_SUCCESS;
+}
+
+/* Static module functions (implementation) */
@@ -0,0 +1,103 @@
+/**
+**************************************************
+* @file allocator.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for the exchangeable heap of all dynamically created objects
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'allocator_set' to replace malloc and free by
+      another heap before any object is created, e.g. by
+      a TLSF heap with a bounded worst case
+  (#) Call 'allocator_allocate' instead of malloc
+  (#) Call 'allocator_free' instead of free, NULL is
+      ignored
+  (#) A block has to be freed by the heap, which allocated
+      it. Replace the heap only while no block is in use.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "utils/allocator.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module functions (prototypes) */
+static void *allocator_default_allocate(void *context, size_t size);
+static void allocator_default_free(void *context, void *block);
+
+/* Static module variables */
+static allocator_t g_allocator = { allocator_default_allocate, allocator_default_free, NULL };
+
+/* Public functions */
+/**
+ * @brief Replaces the heap of all dynamically created objects
+ * @param allocator is the new heap, which is copied, or NULL to restore malloc and free
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     ALLOCATOR_IS_NULL: a function of the heap is NULL
+ */
+size_t allocator_set(const allocator_t *allocator) {
+
+    if (allocator == NULL) {
+        g_allocator = (allocator_t) { allocator_default_allocate, allocator_default_free, NULL };
+        return ALLOCATOR_SUCCESS;
+    }
+
+    if (allocator->allocate == NULL || allocator->free == NULL) {
+        return ALLOCATOR_IS_NULL;
+    }
+
+    g_allocator = *allocator;
+
+    return ALLOCATOR_SUCCESS;
+}
+
+/**
+ * @brief Takes a block from the heap
+ * @param size is the amount of bytes
+ * @return pointer to the 8 byte aligned block or NULL, when the heap is exhausted
+ */
+void *allocator_allocate(size_t size) {
+    return g_allocator.allocate(g_allocator.context, size);
+}
+
+/**
+ * @brief Returns a block to the heap, which allocated it
+ * @param block is the block to return, NULL is ignored like by free
+ */
+void allocator_free(void *block) {
+    if (block != NULL) {
+        g_allocator.free(g_allocator.context, block);
+    }
+}
+
+/* Static module functions (implementation) */
+/**
+ * @brief Takes a block from the C library heap
+ * @param context is unused
+ * @param size is the amount of bytes
+ * @return pointer to the block or NULL
+ */
+static void *allocator_default_allocate(void *context, size_t size) {
+    (void) context;
+    return malloc(size);
+}
+
+/**
+ * @brief Returns a block to the C library heap
+ * @param context is unused
+ * @param block is the block to return
+ */
+static void allocator_default_free(void *context, void *block) {
+    (void) context;
+    free(block);
+}
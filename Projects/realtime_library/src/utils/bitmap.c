@@ -0,0 +1,273 @@
+/**
+**************************************************
+* @file bitmap.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using two level bitmaps
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'bitmap_create' to create a bitmap
+  (#) Call 'bitmap_create_static' to create a bitmap in
+      caller supplied storage of BITMAP_WORDS words
+  (#) Call 'bitmap_set' to set a bit in the bitmap
+  (#) Call 'bitmap_clear' to clear a bit in the bitmap
+  (#) Call 'bitmap_is_set' to check a single bit
+  (#) Call 'bitmap_get_first' to get the lowest set bit
+      in constant time
+  (#) Call 'bitmap_delete' to delete a bitmap
+  (#) All functions call 'bitmap_checking' to validate
+      proper bitmap structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include "utils/bitmap.h"
+#include "utils/pool.h"
+/* Preprocessor defines */
+#define BITMAP_MOST_SIGNIFICANT_BIT     ((uint32_t) 1 << (BITMAP_WORD_BITS - 1))
+
+/* Preprocessor macros */
+#define BITMAP_WORD(index)              ((index) / BITMAP_WORD_BITS)
+#define BITMAP_MASK(index)              (BITMAP_MOST_SIGNIFICANT_BIT >> ((index) % BITMAP_WORD_BITS))
+
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+
+/* Public functions */
+/**
+ * @brief Creates an empty bitmap with the given amount of bits
+ * @param bitmap is a pointer to the newly created bitmap
+ * @param size is the amount of bits, limited by BITMAP_MAX_SIZE
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     BITMAP_NO_MEMORY: unable to allocate memory for bitmap
+ *     BITMAP_DATA_NO_MEMORY: unable to allocate memory for the bit fields
+ *     BITMAP_OVERFLOW: size is 0 or exceeds BITMAP_MAX_SIZE
+ */
+size_t bitmap_create(bitmap_t **bitmap, size_t size) {
+
+    if (size == 0 || size > BITMAP_MAX_SIZE) {
+        return BITMAP_OVERFLOW;
+    }
+
+#if KERNEL_STATIC_ALLOCATION
+    // the word count is only known at runtime, supply it with bitmap_create_static
+    (*bitmap) = NULL;
+    return BITMAP_NO_MEMORY;
+#else
+    bitmap_t *storage = allocator_allocate(sizeof(bitmap_t));
+    if (storage == NULL) {
+        return BITMAP_NO_MEMORY;
+    }
+
+    // allocate enough words to cover the last bit
+    uint32_t *words = allocator_allocate(BITMAP_WORDS(size) * sizeof(uint32_t));
+    if (words == NULL) {
+        allocator_free(storage);
+        return BITMAP_DATA_NO_MEMORY;
+    }
+
+    size_t status = bitmap_create_static(bitmap, storage, words, size);
+    (*bitmap)->allocated = true;
+
+    return status;
+#endif
+}
+
+/**
+ * @brief Creates an empty bitmap in caller supplied storage, which is never released
+ * @param bitmap is a pointer to the newly created bitmap
+ * @param storage is the memory of the bitmap, which must outlive it
+ * @param words is an array of BITMAP_WORDS(size) words
+ * @param size is the amount of bits, limited by BITMAP_MAX_SIZE
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     BITMAP_NO_MEMORY: storage is NULL
+ *     BITMAP_DATA_NO_MEMORY: words is NULL
+ *     BITMAP_OVERFLOW: size is 0 or exceeds BITMAP_MAX_SIZE
+ */
+size_t bitmap_create_static(bitmap_t **bitmap, bitmap_t *storage, uint32_t *words, size_t size) {
+
+    if (size == 0 || size > BITMAP_MAX_SIZE) {
+        return BITMAP_OVERFLOW;
+    }
+
+    (*bitmap) = storage;
+    if ((*bitmap) == NULL) {
+        return BITMAP_NO_MEMORY;
+    }
+
+    (*bitmap)->words = words;
+    if ((*bitmap)->words == NULL) {
+        return BITMAP_DATA_NO_MEMORY;
+    }
+
+    for (size_t word = 0; word < BITMAP_WORDS(size); word++) {
+        (*bitmap)->words[word] = 0;
+    }
+    (*bitmap)->summary = 0;
+    (*bitmap)->size = size;
+    (*bitmap)->allocated = false;
+
+    return BITMAP_SUCCESS;
+}
+
+/**
+ * @brief Deletes a bitmap
+ * @param bitmap is a pointer to the bitmap which will be set to NULL
+ * @return 0 on success or greater 0 on error
+ * @info Currently no error cases.
+ */
+size_t bitmap_delete(bitmap_t **bitmap) {
+
+    size_t status = bitmap_checking(bitmap);
+    if (status != BITMAP_SUCCESS) {
+        return status;
+    }
+
+    // caller supplied storage stays untouched
+    if ((*bitmap)->allocated) {
+        allocator_free((*bitmap)->words);
+        (*bitmap)->words = NULL;
+        allocator_free((*bitmap));
+    }
+    (*bitmap) = NULL;
+
+    return BITMAP_SUCCESS;
+}
+
+/**
+ * @brief Sets a bit and marks its word in the summary
+ * @param bitmap is a pointer to the bitmap to be modified
+ * @param index is the position of the bit
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     BITMAP_OVERFLOW: index is out of bounds
+ */
+size_t bitmap_set(bitmap_t **bitmap, size_t index) {
+
+    size_t status = bitmap_checking(bitmap);
+    if (status != BITMAP_SUCCESS) {
+        return status;
+    }
+
+    if (index >= (*bitmap)->size) {
+        return BITMAP_OVERFLOW;
+    }
+
+    (*bitmap)->words[BITMAP_WORD(index)] |= BITMAP_MASK(index);
+    (*bitmap)->summary |= BITMAP_MASK(BITMAP_WORD(index));
+
+    return BITMAP_SUCCESS;
+}
+
+/**
+ * @brief Clears a bit and removes its word from the summary, if the word became empty
+ * @param bitmap is a pointer to the bitmap to be modified
+ * @param index is the position of the bit
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     BITMAP_OVERFLOW: index is out of bounds
+ */
+size_t bitmap_clear(bitmap_t **bitmap, size_t index) {
+
+    size_t status = bitmap_checking(bitmap);
+    if (status != BITMAP_SUCCESS) {
+        return status;
+    }
+
+    if (index >= (*bitmap)->size) {
+        return BITMAP_OVERFLOW;
+    }
+
+    (*bitmap)->words[BITMAP_WORD(index)] &= ~BITMAP_MASK(index);
+    if ((*bitmap)->words[BITMAP_WORD(index)] == 0) {
+        (*bitmap)->summary &= ~BITMAP_MASK(BITMAP_WORD(index));
+    }
+
+    return BITMAP_SUCCESS;
+}
+
+/**
+ * @brief Reads a single bit
+ * @param bitmap is a pointer to the bitmap to be read from
+ * @param index is the position of the bit
+ * @param is_set is a pointer to a bool expecting the state of the bit
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     BITMAP_OVERFLOW: index is out of bounds
+ */
+size_t bitmap_is_set(bitmap_t **bitmap, size_t index, bool *is_set) {
+
+    size_t status = bitmap_checking(bitmap);
+    if (status != BITMAP_SUCCESS) {
+        return status;
+    }
+
+    if (index >= (*bitmap)->size) {
+        return BITMAP_OVERFLOW;
+    }
+
+    *is_set = ((*bitmap)->words[BITMAP_WORD(index)] & BITMAP_MASK(index)) != 0;
+
+    return BITMAP_SUCCESS;
+}
+
+/**
+ * @brief Determines the lowest set bit with two count leading zero operations,
+ *        independent of the amount of bits in the bitmap.
+ * @param bitmap is a pointer to the bitmap to be read from
+ * @param index is a pointer to memory expecting the position of the lowest set bit
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     BITMAP_IS_EMPTY: no bit is set, index stays untouched
+ */
+size_t bitmap_get_first(bitmap_t **bitmap, size_t *index) {
+
+    size_t status = bitmap_checking(bitmap);
+    if (status != BITMAP_SUCCESS) {
+        return status;
+    }
+
+    if ((*bitmap)->summary == 0) {
+        return BITMAP_IS_EMPTY;
+    }
+
+    // the summary points to the first non empty word and the word to the bit
+    size_t word = BITMAP_COUNT_LEADING_ZEROS((*bitmap)->summary);
+    *index = word * BITMAP_WORD_BITS + BITMAP_COUNT_LEADING_ZEROS((*bitmap)->words[word]);
+
+    return BITMAP_SUCCESS;
+}
+
+/**
+ * @brief Validates the bitmap structure
+ * @param bitmap is a pointer to the bitmap to be checked
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     BITMAP_NO_MEMORY: bitmap is not initialized
+ *     BITMAP_DATA_NO_MEMORY: bit fields are not initialized
+ */
+size_t bitmap_checking(bitmap_t **bitmap) {
+
+    if ((*bitmap) == NULL) {
+        return BITMAP_NO_MEMORY;
+    }
+    else if ((*bitmap)->words == NULL) {
+        return BITMAP_DATA_NO_MEMORY;
+    }
+
+    return BITMAP_SUCCESS;
+}
+
+/* Static module functions (implementation) */
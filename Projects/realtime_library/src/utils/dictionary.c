@@ -12,6 +12,8 @@
 ==================================================
   ### Usage ###
   (#) Call 'dictionary_create' to create a dictionary
+  (#) Call 'dictionary_create_static' to create a dictionary
+      in caller supplied storage
   (#) Call 'dictionary_add' to add an entry to the dictionary
   (#) Call 'dictionary_get' to get an entry from the dictionary
   (#) Call 'dictionary_delete' to delete a dictionary
@@ -26,6 +28,7 @@
 /* Includes */
 #include <stdlib.h>
 #include "utils/dictionary.h"
+#include "utils/pool.h"
 /* Preprocessor defines */
 /* Preprocessor macros */
 /* Module intern type definitions */
@@ -39,24 +42,62 @@ size_t dictionary_checking(dictionary_t **dictionary);
  * @param dictionary is a pointer to the newly created dictionary
  * @param size is the maximum permitted size of the dictionary
  * @return 0 on success or greater 0 on error
- * @info On error check for this error:
- *     DICTIONARY_NO_MEMORY: unable to allocate memory for dictionary
+ * @info On error check for these errors:
+ *     DICTIONARY_NO_MEMORY: unable to allocate memory for dictionary, always in static allocation mode
+ *     DICTIONARY_DATA_NO_MEMORY: unable to allocate memory for the data fields
  */
 size_t dictionary_create(dictionary_t **dictionary, size_t size) {
-    (*dictionary) = malloc(sizeof(dictionary_t));
-    if (dictionary == NULL) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the data size is only known at runtime, supply it with dictionary_create_static
+    (void) size;
+    (*dictionary) = NULL;
+    return DICTIONARY_NO_MEMORY;
+#else
+    dictionary_t *storage = allocator_allocate(sizeof(dictionary_t));
+    if (storage == NULL) {
         return DICTIONARY_NO_MEMORY;
     }
 
+    void **data = allocator_allocate(size*sizeof(void *));
+    if (data == NULL) {
+        allocator_free(storage);
+        return DICTIONARY_DATA_NO_MEMORY;
+    }
+
+    size_t status = dictionary_create_static(dictionary, storage, data, size);
+    (*dictionary)->allocated = true;
+
+    return status;
+#endif
+}
+
+/**
+ * @brief Creates an empty dictionary in caller supplied storage, which is never released
+ * @param dictionary is a pointer to the newly created dictionary
+ * @param storage is the memory of the dictionary, which must outlive it
+ * @param data is an array of size entries
+ * @param size is the maximum permitted size of the dictionary
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     DICTIONARY_NO_MEMORY: storage is NULL
+ *     DICTIONARY_DATA_NO_MEMORY: data is NULL
+ */
+size_t dictionary_create_static(dictionary_t **dictionary, dictionary_t *storage, void **data, size_t size) {
+
+    (*dictionary) = storage;
+    if ((*dictionary) == NULL) {
+        return DICTIONARY_NO_MEMORY;
+    }
 
-    (*dictionary)->size  = size;
-    (*dictionary)->data = malloc((*dictionary)->size*sizeof(void *));
+    (*dictionary)->size = size;
+    (*dictionary)->data = data;
+    (*dictionary)->allocated = false;
 
     if ((*dictionary)->data==NULL) {
         return DICTIONARY_DATA_NO_MEMORY;
     }
 
-
     for (size_t i = 0; i<(*dictionary)->size; i++) {
         (*dictionary)->data[i] = NULL;
     }
@@ -73,9 +114,12 @@ size_t dictionary_delete(dictionary_t **dictionary) {
         return status;
     }
 
-    free((*dictionary)->data);
-    (*dictionary)->data = NULL;
-    free((*dictionary));
+    // caller supplied storage stays untouched
+    if ((*dictionary)->allocated) {
+        allocator_free((*dictionary)->data);
+        (*dictionary)->data = NULL;
+        allocator_free((*dictionary));
+    }
     (*dictionary) = NULL;
 
 
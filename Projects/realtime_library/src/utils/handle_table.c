@@ -0,0 +1,354 @@
+/**
+**************************************************
+* @file handle_table.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for tables of objects accessed by generation checked handles
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'handle_table_create' to create a handle table,
+      which optionally grows up to a maximum size
+  (#) Call 'handle_table_create_static' to create a handle
+      table of a fixed size in caller supplied storage
+  (#) Call 'handle_table_delete' to delete a handle table
+  (#) Call 'handle_table_reserve' to take a free slot and
+      get its handle before the object is created
+  (#) Call 'handle_table_set' to store the object of a
+      reserved handle
+  (#) Call 'handle_table_release' to free the slot of a
+      handle, the handle and all its copies become stale
+      and the slot is reused by the next reservation
+  (#) Call 'handle_table_get' to get the object of a handle
+      with a status for stale handles
+  (#) Use 'handle_table_lookup' in fast paths, it returns
+      the object with a single indexed load or NULL
+  (#) All functions call 'handle_table_checking' to validate
+      proper handle table structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+  (#) The handle table is not locked, the caller has to
+      serialize reservations and releases.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <string.h>
+#include "utils/handle_table.h"
+#include "utils/pool.h"
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+static void handle_table_link_free_slots(handle_table_t **handle_table, size_t first);
+static size_t handle_table_grow(handle_table_t **handle_table);
+
+/* Public functions */
+/**
+ * @brief Creates a handle table, whose slots are allocated. The table grows by doubling, when all slots are taken.
+ * @param handle_table is a pointer of pointer to be initialized as a handle table
+ * @param size is the initial amount of slots
+ * @param max_size is the amount of slots the table may grow to, equal size for a fixed table
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_NO_MEMORY: unable to allocate memory for the handle table, always in static allocation mode
+ *  HANDLE_TABLE_SLOTS_NO_MEMORY: unable to allocate memory for the slots
+ *  HANDLE_TABLE_INVALID_SIZE: size is 0, max_size is below size or above HANDLE_TABLE_MAX_SIZE
+ */
+size_t handle_table_create(handle_table_t **handle_table, size_t size, size_t max_size) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the slots are only known at runtime, supply them with handle_table_create_static
+    (void) size;
+    (void) max_size;
+    (*handle_table) = NULL;
+    return HANDLE_TABLE_NO_MEMORY;
+#else
+    if (max_size < size || max_size > HANDLE_TABLE_MAX_SIZE) {
+        return HANDLE_TABLE_INVALID_SIZE;
+    }
+
+    handle_table_t *storage = allocator_allocate(sizeof(handle_table_t));
+    if (storage == NULL) {
+        return HANDLE_TABLE_NO_MEMORY;
+    }
+
+    handle_table_slot_t *slots = allocator_allocate(size * sizeof(handle_table_slot_t));
+    if (slots == NULL) {
+        allocator_free(storage);
+        return HANDLE_TABLE_SLOTS_NO_MEMORY;
+    }
+
+    size_t status = handle_table_create_static(handle_table, storage, slots, size);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        allocator_free(slots);
+        allocator_free(storage);
+        (*handle_table) = NULL;
+        return status;
+    }
+    (*handle_table)->max_size = max_size;
+    (*handle_table)->allocated = true;
+
+    return HANDLE_TABLE_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Creates a handle table of a fixed size in caller supplied storage, which is never released.
+ *        The first handles of a new table are equal to their slot index.
+ * @param handle_table is a pointer of pointer to be initialized as a handle table
+ * @param storage is the memory of the handle table, which must outlive it
+ * @param slots is an array of size slots
+ * @param size is the amount of slots
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_NO_MEMORY: storage is NULL
+ *  HANDLE_TABLE_SLOTS_NO_MEMORY: slots is NULL
+ *  HANDLE_TABLE_INVALID_SIZE: size is 0 or above HANDLE_TABLE_MAX_SIZE
+ */
+size_t handle_table_create_static(handle_table_t **handle_table, handle_table_t *storage, handle_table_slot_t *slots, size_t size) {
+
+    (*handle_table) = storage;
+    if ((*handle_table) == NULL) {
+        return HANDLE_TABLE_NO_MEMORY;
+    }
+
+    (*handle_table)->slots = slots;
+    (*handle_table)->size = size;
+    (*handle_table)->max_size = size;
+    (*handle_table)->free_head = 0;
+    (*handle_table)->used = 0;
+    (*handle_table)->allocated = false;
+
+    if (slots == NULL) {
+        return HANDLE_TABLE_SLOTS_NO_MEMORY;
+    }
+
+    if (size == 0 || size > HANDLE_TABLE_MAX_SIZE) {
+        return HANDLE_TABLE_INVALID_SIZE;
+    }
+
+    for (size_t index = 0; index < size; index++) {
+        (*handle_table)->slots[index].handle = index;
+    }
+    handle_table_link_free_slots(handle_table, 0);
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/**
+ * @brief Deletes a handle table, the objects stay with the caller.
+ * @param handle_table is a pointer of pointer to be deleted
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ */
+size_t handle_table_delete(handle_table_t **handle_table) {
+
+    size_t status = handle_table_checking(handle_table);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return status;
+    }
+
+    // caller supplied storage stays untouched
+    if ((*handle_table)->allocated) {
+        allocator_free((*handle_table)->slots);
+        (*handle_table)->slots = NULL;
+        allocator_free((*handle_table));
+    }
+    (*handle_table) = NULL;
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/**
+ * @brief Takes a free slot in constant time, a growing table doubles its slots, when all are taken.
+ *        The slot holds no object until handle_table_set, so lookups of the handle return NULL.
+ * @param handle_table is a pointer of pointer to the handle table
+ * @param handle is a pointer of size_t, which receives the handle of the slot
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_FULL: all slots are taken and the table can not grow, handle is set to HANDLE_TABLE_INVALID_HANDLE
+ */
+size_t handle_table_reserve(handle_table_t **handle_table, size_t *handle) {
+
+    size_t status = handle_table_checking(handle_table);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return status;
+    }
+
+    (*handle) = HANDLE_TABLE_INVALID_HANDLE;
+    if ((*handle_table)->free_head == (*handle_table)->size) {
+        status = handle_table_grow(handle_table);
+        if (status != HANDLE_TABLE_SUCCESS) {
+            return status;
+        }
+    }
+
+    handle_table_slot_t *slot = &(*handle_table)->slots[(*handle_table)->free_head];
+    (*handle_table)->free_head = slot->next_free;
+    (*handle_table)->used++;
+
+    slot->value = NULL;
+    (*handle) = slot->handle;
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/**
+ * @brief Stores the object of a reserved handle.
+ * @param handle_table is a pointer of pointer to the handle table
+ * @param handle is a reserved handle
+ * @param value is the object, which is returned for the handle
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_STALE_HANDLE: the handle was released or never reserved
+ */
+size_t handle_table_set(handle_table_t **handle_table, size_t handle, void *value) {
+
+    size_t status = handle_table_checking(handle_table);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return status;
+    }
+
+    size_t index = HANDLE_TABLE_INDEX(handle);
+    if (index >= (*handle_table)->size || (*handle_table)->slots[index].handle != handle) {
+        return HANDLE_TABLE_STALE_HANDLE;
+    }
+
+    (*handle_table)->slots[index].value = value;
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/**
+ * @brief Frees the slot of a handle in constant time. The generation of the slot is advanced,
+ *        so the handle becomes stale and the next reservation of the slot returns a new handle.
+ * @param handle_table is a pointer of pointer to the handle table
+ * @param handle is a reserved handle
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_STALE_HANDLE: the handle was already released or never reserved
+ *  The generation wraps after 2^(bits of size_t - HANDLE_TABLE_INDEX_BITS) releases of the same slot.
+ */
+size_t handle_table_release(handle_table_t **handle_table, size_t handle) {
+
+    size_t status = handle_table_checking(handle_table);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        return status;
+    }
+
+    size_t index = HANDLE_TABLE_INDEX(handle);
+    if (index >= (*handle_table)->size || (*handle_table)->slots[index].handle != handle) {
+        return HANDLE_TABLE_STALE_HANDLE;
+    }
+
+    handle_table_slot_t *slot = &(*handle_table)->slots[index];
+    slot->value = NULL;
+    slot->handle += HANDLE_TABLE_GENERATION_STEP;
+    slot->next_free = (*handle_table)->free_head;
+    (*handle_table)->free_head = index;
+    (*handle_table)->used--;
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/**
+ * @brief Gets the object of a handle.
+ * @param handle_table is a pointer of pointer to the handle table
+ * @param handle is the handle of the object
+ * @param value is a pointer of pointer, which receives the object or NULL
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_STALE_HANDLE: the handle was released, never reserved or holds no object yet
+ */
+size_t handle_table_get(handle_table_t **handle_table, size_t handle, void **value) {
+
+    size_t status = handle_table_checking(handle_table);
+    if (status != HANDLE_TABLE_SUCCESS) {
+        (*value) = NULL;
+        return status;
+    }
+
+    (*value) = handle_table_lookup(*handle_table, handle);
+    if ((*value) == NULL) {
+        return HANDLE_TABLE_STALE_HANDLE;
+    }
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/**
+ * @brief Validates a handle table
+ * @param handle_table is a pointer of pointer to the handle table
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_IS_NULL: handle table is not initialized
+ *  HANDLE_TABLE_SLOTS_NO_MEMORY: slots are not initialized
+ */
+size_t handle_table_checking(handle_table_t **handle_table) {
+
+    if (handle_table == NULL || (*handle_table) == NULL) {
+        return HANDLE_TABLE_IS_NULL;
+    }
+
+    if ((*handle_table)->slots == NULL) {
+        return HANDLE_TABLE_SLOTS_NO_MEMORY;
+    }
+
+    return HANDLE_TABLE_SUCCESS;
+}
+
+/* Static module functions (implementation) */
+
+/**
+ * @brief Clears the slots from first to the end of the table and links them as the free list in ascending order.
+ * @param handle_table is a pointer of pointer to the handle table
+ * @param first is the index of the first slot to link, the free list has to be empty before
+ */
+static void handle_table_link_free_slots(handle_table_t **handle_table, size_t first) {
+
+    for (size_t index = first; index < (*handle_table)->size; index++) {
+        (*handle_table)->slots[index].value = NULL;
+        (*handle_table)->slots[index].next_free = index + 1;
+    }
+    (*handle_table)->free_head = first;
+}
+
+/**
+ * @brief Doubles the slots of a growing table up to its maximum size. The handles of the old slots stay valid.
+ * @param handle_table is a pointer of pointer to the handle table
+ * @return HANDLE_TABLE_SUCCESS on success or unequal HANDLE_TABLE_SUCCESS for an error
+ * @info On error check for these errors:
+ *  HANDLE_TABLE_FULL: the table reached its maximum size or the slots could not be allocated
+ */
+static size_t handle_table_grow(handle_table_t **handle_table) {
+
+    size_t size = (*handle_table)->size;
+    if (!(*handle_table)->allocated || size >= (*handle_table)->max_size) {
+        return HANDLE_TABLE_FULL;
+    }
+
+    size_t new_size = size * 2 < (*handle_table)->max_size ? size * 2 : (*handle_table)->max_size;
+    handle_table_slot_t *slots = allocator_allocate(new_size * sizeof(handle_table_slot_t));
+    if (slots == NULL) {
+        return HANDLE_TABLE_FULL;
+    }
+
+    memcpy(slots, (*handle_table)->slots, size * sizeof(handle_table_slot_t));
+    allocator_free((*handle_table)->slots);
+    (*handle_table)->slots = slots;
+    (*handle_table)->size = new_size;
+
+    for (size_t index = size; index < new_size; index++) {
+        (*handle_table)->slots[index].handle = index;
+    }
+    handle_table_link_free_slots(handle_table, size);
+
+    return HANDLE_TABLE_SUCCESS;
+}
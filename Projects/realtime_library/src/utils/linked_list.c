@@ -12,6 +12,18 @@
 ==================================================
   ### Usage ###
   (#) Call 'linked_list_create' to create a linked list
+  (#) Call 'linked_list_create_static' to create a linked
+      list in caller supplied storage
+  (#) Call 'linked_list_create_intrusive' or
+      'linked_list_create_intrusive_static' to create a
+      linked list, whose elements are embedded in the
+      stored data. Such a list never allocates or releases
+      elements, use LINKED_LIST_CONTAINER_OF to get the
+      data of an element.
+  (#) Call 'linked_list_element_init' to initialize an
+      embedded element
+  (#) Call 'linked_list_push_front_element' to push an
+      embedded element to the start of an intrusive list
   (#) Call 'linked_list_delete' to delete a linked list
   (#) Call 'linked_list_push_back' to push an element to
       the end of a linked list
@@ -47,15 +59,20 @@
 /* Includes */
 #include <stdlib.h>
 #include "utils/linked_list.h"
+#include "utils/pool.h"
 
 /* Preprocessor defines */
 /* Preprocessor macros */
 /* Module intern type definitions */
 /* Static module variables */
+POOL_DEFINE(g_linked_list_pool, linked_list_t, KERNEL_POOL_LINKED_LISTS);
+POOL_DEFINE(g_linked_list_element_pool, linked_list_element_t, KERNEL_POOL_LINKED_LIST_ELEMENTS);
 /* Static module functions (prototypes) */
 size_t linked_list_checking(linked_list_t **linked_list);
 size_t linked_list_element_checking(linked_list_element_t **linked_list_element);
 size_t linked_list_element_create(linked_list_element_t **linked_list_element, void **data);
+void linked_list_element_release(linked_list_t **linked_list, linked_list_element_t *linked_list_element);
+void linked_list_link_front(linked_list_t **linked_list, linked_list_element_t *linked_list_element);
 /* Public functions */
 
 /**
@@ -68,7 +85,28 @@ size_t linked_list_element_create(linked_list_element_t **linked_list_element, v
 size_t linked_list_create(linked_list_t **linked_list) {
 
     // allocate memory and check for error
-    (*linked_list) = (linked_list_t* ) malloc(sizeof(linked_list_t));
+    linked_list_t *storage = POOL_ALLOCATE(g_linked_list_pool, linked_list_t);
+    if (storage == NULL) {
+        return LINKED_LIST_NO_MEMORY;
+    }
+
+    size_t status = linked_list_create_static(linked_list, storage);
+    (*linked_list)->allocated = true;
+
+    return status;
+}
+
+/**
+ * @brief Creates an empty linked list in caller supplied storage, which is never released.
+ * @param linked_list is a linked_list_t pointer of pointer to assign the new linked list
+ * @param storage is the memory of the linked list, which must outlive it
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *    LINKED_LIST_NO_MEMORY: storage is NULL
+ */
+size_t linked_list_create_static(linked_list_t **linked_list, linked_list_t *storage) {
+
+    (*linked_list) = storage;
     if ((*linked_list) == NULL) {
         return LINKED_LIST_NO_MEMORY;
     }
@@ -77,12 +115,54 @@ size_t linked_list_create(linked_list_t **linked_list) {
     (*linked_list)->size = 0;
     (*linked_list)->head = NULL;
     (*linked_list)->tail = NULL;
+    (*linked_list)->allocated = false;
+    (*linked_list)->intrusive = false;
 
     return LINKED_LIST_SUCCESS;
 }
 
 /**
- * @brief Deletes a linked list including all of its elements
+ * @brief Creates an empty intrusive linked list. The elements are embedded in the stored data,
+ *        so pushing, popping and transferring never allocates or releases memory.
+ * @param linked_list is a linked_list_t pointer of pointer to assign the new linked list
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *    LINKED_LIST_NO_MEMORY: unable to allocate memory for linked list
+ */
+size_t linked_list_create_intrusive(linked_list_t **linked_list) {
+
+    size_t status = linked_list_create(linked_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return status;
+    }
+
+    (*linked_list)->intrusive = true;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+/**
+ * @brief Creates an empty intrusive linked list in caller supplied storage, which is never released.
+ * @param linked_list is a linked_list_t pointer of pointer to assign the new linked list
+ * @param storage is the memory of the linked list, which must outlive it
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *    LINKED_LIST_NO_MEMORY: storage is NULL
+ */
+size_t linked_list_create_intrusive_static(linked_list_t **linked_list, linked_list_t *storage) {
+
+    size_t status = linked_list_create_static(linked_list, storage);
+    if (status != LINKED_LIST_SUCCESS) {
+        return status;
+    }
+
+    (*linked_list)->intrusive = true;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+/**
+ * @brief Deletes a linked list including all of its elements, the elements of an intrusive list are only unlinked
  * @param linked_list is a linked_list_t pointer of pointer, which shall be deleted
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
@@ -100,8 +180,7 @@ size_t linked_list_delete(linked_list_t **linked_list) {
     while ((*linked_list)->tail != NULL) {
         linked_list_element_t *tail = (*linked_list)->tail;
         (*linked_list)->tail = (*linked_list)->tail->next;
-        tail->previous = NULL;
-        free(tail);
+        linked_list_element_release(linked_list, tail);
         tail = NULL;
         (*linked_list)->size--;
     }
@@ -111,8 +190,10 @@ size_t linked_list_delete(linked_list_t **linked_list) {
         return LINKED_LIST_IRREGULAR_STRUCTURE;
     }
 
-    // delete linked list
-    free((*linked_list));
+    // delete linked list, caller supplied storage stays untouched
+    if ((*linked_list)->allocated) {
+        POOL_FREE(g_linked_list_pool, (*linked_list));
+    }
     (*linked_list) = NULL;
 
     return LINKED_LIST_SUCCESS;
@@ -125,6 +206,7 @@ size_t linked_list_delete(linked_list_t **linked_list) {
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
  *     LINKED_LIST_ELEMENT_NO_MEMORY: unable to allocate memory for new linked list element
+ *     LINKED_LIST_IS_INTRUSIVE: use 'linked_list_push_front_element' instead
  */
 size_t linked_list_push_back(linked_list_t **linked_list, void **data) {
 
@@ -134,6 +216,11 @@ size_t linked_list_push_back(linked_list_t **linked_list, void **data) {
         return status;
     }
 
+    // the elements of an intrusive list are embedded in the data
+    if ((*linked_list)->intrusive) {
+        return LINKED_LIST_IS_INTRUSIVE;
+    }
+
     // create a new carrier and add data
     linked_list_element_t *new = NULL;
     status = linked_list_element_create(&new, data);
@@ -163,7 +250,7 @@ size_t linked_list_push_back(linked_list_t **linked_list, void **data) {
 /**
  * @brief Pops data from the beginning of the linked list.
  * @param linked_list is a linked_list_t pointer of pointer, where a data element is being removed
- * @param data is a void pointer of pointer to the data, which shall be removed from a linked list
+ * @param data is a void pointer of pointer to the data, which shall be removed from a linked list, may be NULL
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
  *     LINKED_LIST_NO_ELEMENT: unable to pop a data element
@@ -181,7 +268,9 @@ size_t linked_list_pop_front(linked_list_t **linked_list, void **data) {
     if (pop == NULL) {
         return LINKED_LIST_NO_ELEMENT;
     }
-    (*data) = pop->data;
+    if (data != NULL) {
+        (*data) = pop->data;
+    }
 
     // remove data element
     (*linked_list)->size--;
@@ -195,12 +284,13 @@ size_t linked_list_pop_front(linked_list_t **linked_list, void **data) {
         return LINKED_LIST_IRREGULAR_STRUCTURE;
     }
     else {
-        // remove head
+        // remove head, the new head must not link to the popped element
         (*linked_list)->head = (*linked_list)->head->previous;
+        (*linked_list)->head->next = NULL;
     }
 
     // delete linked list element
-    free(pop);
+    linked_list_element_release(linked_list, pop);
     pop = NULL;
 
     return LINKED_LIST_SUCCESS;
@@ -209,7 +299,7 @@ size_t linked_list_pop_front(linked_list_t **linked_list, void **data) {
 /**
  * @brief Pops data from the end of the linked list.
  * @param linked_list is a linked_list_t pointer of pointer, where a data element is being removed
- * @param data is a void pointer of pointer to the data, which shall be removed from a linked list
+ * @param data is a void pointer of pointer to the data, which shall be removed from a linked list, may be NULL
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
  *     LINKED_LIST_NO_ELEMENT: unable to pop a requested element
@@ -227,7 +317,9 @@ size_t linked_list_pop_back(linked_list_t **linked_list, void **data) {
     if (pop == NULL) {
         return LINKED_LIST_NO_ELEMENT;
     }
-    (*data) = pop->data;
+    if (data != NULL) {
+        (*data) = pop->data;
+    }
 
     // remove data element
     (*linked_list)->size--;
@@ -240,11 +332,13 @@ size_t linked_list_pop_back(linked_list_t **linked_list, void **data) {
         return LINKED_LIST_IRREGULAR_STRUCTURE;
     }
     else {
+        // remove tail, the new tail must not link to the popped element
         (*linked_list)->tail = (*linked_list)->tail->next;
+        (*linked_list)->tail->previous = NULL;
     }
 
     // delete linked list element
-    free(pop);
+    linked_list_element_release(linked_list, pop);
     pop = NULL;
 
     return LINKED_LIST_SUCCESS;
@@ -257,6 +351,7 @@ size_t linked_list_pop_back(linked_list_t **linked_list, void **data) {
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
  *     LINKED_LIST_ELEMENT_NO_MEMORY: unable to allocate memory for new linked list element
+ *     LINKED_LIST_IS_INTRUSIVE: use 'linked_list_push_front_element' instead
  */
 size_t linked_list_push_front(linked_list_t **linked_list, void **data) {
 
@@ -266,6 +361,11 @@ size_t linked_list_push_front(linked_list_t **linked_list, void **data) {
         return status;
     }
 
+    // the elements of an intrusive list are embedded in the data
+    if ((*linked_list)->intrusive) {
+        return LINKED_LIST_IS_INTRUSIVE;
+    }
+
     // create a new carrier and add data
     linked_list_element_t *new = NULL;
     status = linked_list_element_create(&new, data);
@@ -273,21 +373,62 @@ size_t linked_list_push_front(linked_list_t **linked_list, void **data) {
         return status;
     }
 
-    // insert the linked list element
-    if ((*linked_list)->size == 0) {
-        // first element
-        (*linked_list)->head = new;
-        (*linked_list)->tail = new;
+    linked_list_link_front(linked_list, new);
+
+    return LINKED_LIST_SUCCESS;
+}
+
+/**
+ * @brief Initializes an element, which is embedded in its data, before it is pushed to an intrusive linked list.
+ * @param linked_list_element is a pointer to the embedded element
+ * @param data is a void pointer to the data, which embeds the element
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     LINKED_LIST_ELEMENT_NO_MEMORY: element is NULL
+ */
+size_t linked_list_element_init(linked_list_element_t *linked_list_element, void *data) {
+
+    size_t status = linked_list_element_checking(&linked_list_element);
+    if (status != LINKED_LIST_ELEMENT_SUCCESS) {
+        return status;
     }
-    else {
-        // next element
-        new->previous = (*linked_list)->head;
-        (*linked_list)->head->next = new;
-        (*linked_list)->head = new;
+
+    linked_list_element->data = data;
+    linked_list_element->previous = NULL;
+    linked_list_element->next = NULL;
+
+    return LINKED_LIST_ELEMENT_SUCCESS;
+}
+
+/**
+ * @brief Pushes an embedded element to the beginning of an intrusive linked list without allocating memory.
+ * @param linked_list is a linked_list pointer of pointer, where the element is added
+ * @param linked_list_element is a pointer to the embedded element, which must not be part of another list
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     LINKED_LIST_NOT_INTRUSIVE: elements of the linked list are allocated, use 'linked_list_push_front' instead
+ */
+size_t linked_list_push_front_element(linked_list_t **linked_list, linked_list_element_t *linked_list_element) {
+
+    // check linked list for irregular structure
+    size_t status = linked_list_checking(linked_list);
+    if (status != LINKED_LIST_SUCCESS) {
+        return status;
     }
 
-    // always increase the linked list size
-    (*linked_list)->size++;
+    status = linked_list_element_checking(&linked_list_element);
+    if (status != LINKED_LIST_ELEMENT_SUCCESS) {
+        return status;
+    }
+
+    // a released list would otherwise free the embedded element
+    if (!(*linked_list)->intrusive) {
+        return LINKED_LIST_NOT_INTRUSIVE;
+    }
+
+    linked_list_element->previous = NULL;
+    linked_list_element->next = NULL;
+    linked_list_link_front(linked_list, linked_list_element);
 
     return LINKED_LIST_SUCCESS;
 }
@@ -300,6 +441,7 @@ size_t linked_list_push_front(linked_list_t **linked_list, void **data) {
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
  *     LINKED_LIST_ELEMENT_NO_MEMORY: unable to allocate memory for new linked list element
+ *     LINKED_LIST_IS_INTRUSIVE: elements cannot be allocated for an intrusive list
  */
 size_t linked_list_insert_after(linked_list_t **linked_list, linked_list_element_t **linked_list_element, void **data) {
 
@@ -309,6 +451,11 @@ size_t linked_list_insert_after(linked_list_t **linked_list, linked_list_element
         return status;
     }
 
+    // the elements of an intrusive list are embedded in the data
+    if ((*linked_list)->intrusive) {
+        return LINKED_LIST_IS_INTRUSIVE;
+    }
+
     // check if linked list is empty and use push front instead
     if ((*linked_list)->head == NULL || (*linked_list)->head->next == NULL) {
         return linked_list_push_front(linked_list, data);
@@ -335,7 +482,7 @@ size_t linked_list_insert_after(linked_list_t **linked_list, linked_list_element
  * @brief Removes an element from a linked list.
  * @param linked_list is a linked_list_t pointer of pointer where an element is being removed
  * @param linked_list_element is a linked_list_element_t pointer of pointer, which shall be removed
- * @param data is a void pointer of pointer to the data, which shall be removed from a linked list
+ * @param data is a void pointer of pointer to the data, which shall be removed from a linked list, may be NULL
  * @return 0 on success or greater 0 on error
  * @info On error check for this error:
  *     LINKED_LIST_NO_ELEMENT: unable to pop a requested element
@@ -354,7 +501,9 @@ size_t linked_list_pop_inner(linked_list_t **linked_list, linked_list_element_t
     if (pop == NULL) {
         return LINKED_LIST_NO_ELEMENT;
     }
-    (*data) = pop->data;
+    if (data != NULL) {
+        (*data) = pop->data;
+    }
 
     // remove data
     if ((*linked_list)->size == 0 && (*linked_list)->tail == (*linked_list)->head) {
@@ -386,7 +535,7 @@ size_t linked_list_pop_inner(linked_list_t **linked_list, linked_list_element_t
     (*linked_list)->size--;
 
     // delete linked list element
-    free(pop);
+    linked_list_element_release(linked_list, pop);
     pop = NULL;
 
     return LINKED_LIST_SUCCESS;
@@ -710,7 +859,7 @@ size_t linked_list_element_create(linked_list_element_t **linked_list_element,
         void **data) {
 
     // allocate memory
-    *linked_list_element = (linked_list_element_t* ) malloc(sizeof(linked_list_element_t));
+    *linked_list_element = POOL_ALLOCATE(g_linked_list_element_pool, linked_list_element_t);
     if (*linked_list_element == NULL) {
         return LINKED_LIST_ELEMENT_NO_MEMORY;
     }
@@ -722,3 +871,42 @@ size_t linked_list_element_create(linked_list_element_t **linked_list_element,
 
     return LINKED_LIST_ELEMENT_SUCCESS;
 }
+
+/**
+ * @brief Releases a removed linked list element. Embedded elements of an intrusive list are only unlinked.
+ * @param linked_list is a linked_list_t pointer of pointer, where the element was removed
+ * @param linked_list_element is the removed linked list element
+ */
+void linked_list_element_release(linked_list_t **linked_list, linked_list_element_t *linked_list_element) {
+
+    linked_list_element->previous = NULL;
+    linked_list_element->next = NULL;
+
+    if (!(*linked_list)->intrusive) {
+        POOL_FREE(g_linked_list_element_pool, linked_list_element);
+    }
+}
+
+/**
+ * @brief Links an unlinked element at the beginning of the linked list.
+ * @param linked_list is a linked_list_t pointer of pointer, where the element is added
+ * @param linked_list_element is the unlinked linked list element
+ */
+void linked_list_link_front(linked_list_t **linked_list, linked_list_element_t *linked_list_element) {
+
+    // insert the linked list element
+    if ((*linked_list)->size == 0) {
+        // first element
+        (*linked_list)->head = linked_list_element;
+        (*linked_list)->tail = linked_list_element;
+    }
+    else {
+        // next element
+        linked_list_element->previous = (*linked_list)->head;
+        (*linked_list)->head->next = linked_list_element;
+        (*linked_list)->head = linked_list_element;
+    }
+
+    // always increase the linked list size
+    (*linked_list)->size++;
+}
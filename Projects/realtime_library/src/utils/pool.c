@@ -0,0 +1,174 @@
+/**
+**************************************************
+* @file pool.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for fixed-size block pools
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Use POOL_DEFINE to define a pool of a type with
+      static storage for a fixed amount of blocks
+  (#) Use POOL_ALLOCATE and POOL_FREE to take and return
+      a block. Without KERNEL_STATIC_ALLOCATION both map
+      to the allocator and POOL_DEFINE reserves nothing.
+  (#) Call 'pool_create_static' to create a pool of a block
+      size only known at runtime in caller supplied storage
+  (#) Call 'pool_allocate' to take a block in constant time
+  (#) Call 'pool_free' to return a block in constant time
+  (#) Call 'pool_get_free_blocks' to get the amount of
+      blocks left
+  (#) All functions call 'pool_checking' to validate
+      proper pool structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include "utils/pool.h"
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+
+/* Public functions */
+/**
+ * @brief Creates a pool in caller supplied storage, whose block size is only known at runtime
+ * @param pool is a pointer to the newly created pool
+ * @param storage is the control information of the pool, which must outlive it
+ * @param blocks is continuous 8 byte aligned memory of count * block_size bytes
+ * @param block_size is the size of a single block, created by POOL_BLOCK_SIZE
+ * @param count is the amount of blocks
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     POOL_IS_NULL: storage or blocks is NULL
+ *     POOL_INVALID_BLOCK_SIZE: a block is unable to hold the link of the returned blocks
+ */
+size_t pool_create_static(pool_t **pool, pool_t *storage, void *blocks, size_t block_size, size_t count) {
+
+    (*pool) = storage;
+    if ((*pool) == NULL || blocks == NULL) {
+        return POOL_IS_NULL;
+    }
+
+    // returned blocks are linked through their first word
+    if (block_size < sizeof(void *) || block_size != POOL_BLOCK_SIZE(block_size)) {
+        return POOL_INVALID_BLOCK_SIZE;
+    }
+
+    (*pool)->storage = (uint8_t *) blocks;
+    (*pool)->block_size = block_size;
+    (*pool)->count = count;
+    (*pool)->used = 0;
+    (*pool)->free_blocks = NULL;
+    (*pool)->in_use = 0;
+
+    return POOL_SUCCESS;
+}
+
+/**
+ * @brief Takes a block from the pool. Returned blocks are reused first, afterwards
+ *        the untouched blocks are handed out in order, so the pool needs no initialization.
+ * @param pool is a pointer to the pool to allocate from
+ * @return pointer to the block or NULL, when the pool is exhausted or invalid
+ */
+void *pool_allocate(pool_t **pool) {
+
+    if (pool_checking(pool) != POOL_SUCCESS) {
+        return NULL;
+    }
+
+    void *block = (*pool)->free_blocks;
+    if (block != NULL) {
+        // unlink the first returned block
+        (*pool)->free_blocks = *((void **) block);
+    }
+    else if ((*pool)->used < (*pool)->count) {
+        block = (*pool)->storage + (*pool)->used * (*pool)->block_size;
+        (*pool)->used++;
+    }
+    else {
+        return NULL;
+    }
+
+    (*pool)->in_use++;
+
+    return block;
+}
+
+/**
+ * @brief Returns a block to the pool
+ * @param pool is a pointer to the pool the block was allocated from
+ * @param block is the block to return, NULL is ignored like by free
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     POOL_FOREIGN_BLOCK: block was not handed out by this pool
+ */
+size_t pool_free(pool_t **pool, void *block) {
+
+    size_t status = pool_checking(pool);
+    if (status != POOL_SUCCESS) {
+        return status;
+    }
+
+    if (block == NULL) {
+        return POOL_SUCCESS;
+    }
+
+    // only the start of a handed out block is accepted
+    uint8_t *address = (uint8_t *) block;
+    if (address < (*pool)->storage || address >= (*pool)->storage + (*pool)->used * (*pool)->block_size
+            || (size_t) (address - (*pool)->storage) % (*pool)->block_size != 0 || (*pool)->in_use == 0) {
+        return POOL_FOREIGN_BLOCK;
+    }
+
+    // link the block in front of the returned blocks
+    *((void **) block) = (*pool)->free_blocks;
+    (*pool)->free_blocks = block;
+    (*pool)->in_use--;
+
+    return POOL_SUCCESS;
+}
+
+/**
+ * @brief Gets the amount of blocks, which can still be allocated
+ * @param pool is a pointer to the pool
+ * @param free_blocks is a pointer to store the amount of blocks
+ * @return 0 on success or greater 0 on error
+ */
+size_t pool_get_free_blocks(pool_t **pool, size_t *free_blocks) {
+
+    size_t status = pool_checking(pool);
+    if (status != POOL_SUCCESS) {
+        return status;
+    }
+
+    *free_blocks = (*pool)->count - (*pool)->in_use;
+
+    return POOL_SUCCESS;
+}
+
+/**
+ * @brief Validates the pool structure
+ * @param pool is a pointer to the pool to be checked
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     POOL_IS_NULL: pool or its storage is not initialized
+ */
+size_t pool_checking(pool_t **pool) {
+
+    if (pool == NULL || (*pool) == NULL || (*pool)->storage == NULL) {
+        return POOL_IS_NULL;
+    }
+
+    return POOL_SUCCESS;
+}
+
+/* Static module functions (implementation) */
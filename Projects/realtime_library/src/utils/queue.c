@@ -12,6 +12,8 @@
 ==================================================
   ### Usage ###
   (#) Call 'queue_create' to create a queue.
+  (#) Call 'queue_create_static' to create a queue in caller
+        supplied storage.
   (#) Call 'queue_delete' to delete a queue.
   (#) Call 'queue_push_front' to store a new element at the head
         and to use a queue as a fifo.
@@ -27,6 +29,7 @@
 #include "utils/queue.h"
 #include <string.h>
 #include <stdlib.h>
+#include "utils/pool.h"
 /* Preprocessor defines */
 
 /* Preprocessor macros */
@@ -41,13 +44,57 @@
  * @param element_size is the expected data size of an element
  * @return 0 on success or greater 0 on error
  * @info On error check for these errors:
- *     QUEUE_NO_MEMORY: unable to allocate memory for queue
+ *     QUEUE_NO_MEMORY: unable to allocate memory for queue, always in static allocation mode
  *    QUEUE_DATA_NO_MEMORY: unable to allocate  memory for data array
  */
 size_t queue_create(queue_t **queue, size_t queue_size, size_t element_size) {
 
+#if KERNEL_STATIC_ALLOCATION
+    // the data size is only known at runtime, supply it with queue_create_static
+    (void) queue_size;
+    (void) element_size;
+    (*queue) = NULL;
+    return QUEUE_NO_MEMORY;
+#else
     // allocate memory and return on error
-    *queue = (queue_t *) malloc(sizeof(queue_t));
+    queue_t *storage = (queue_t *) allocator_allocate(sizeof(queue_t));
+    if (storage==NULL) {
+        return QUEUE_NO_MEMORY;
+    }
+
+    // create data entries and continuous memory space
+    void **data = (void **) allocator_allocate(queue_size*sizeof(void *));
+    void *buffer = allocator_allocate(queue_size*element_size);
+    if (data==NULL || buffer==NULL) {
+        allocator_free(buffer);
+        allocator_free(data);
+        allocator_free(storage);
+        return QUEUE_DATA_NO_MEMORY;
+    }
+
+    size_t status = queue_create_static(queue, storage, data, buffer, queue_size, element_size);
+    (*queue)->allocated = true;
+
+    return status;
+#endif
+}
+
+/**
+ * @brief Creates a queue in caller supplied storage, which is never released.
+ * @param queue is a queue_t pointer of pointer to be initialized as a queue
+ * @param storage is the memory of the queue, which must outlive it
+ * @param data is an array of queue_size entries
+ * @param buffer is continuous memory of queue_size * element_size bytes
+ * @param queue_size is the amount of data to be stored
+ * @param element_size is the expected data size of an element
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     QUEUE_NO_MEMORY: storage is NULL
+ *    QUEUE_DATA_NO_MEMORY: data or buffer is NULL
+ */
+size_t queue_create_static(queue_t **queue, queue_t *storage, void **data, void *buffer, size_t queue_size, size_t element_size) {
+
+    *queue = storage;
     if ((*queue)==NULL) {
         return QUEUE_NO_MEMORY;
     }
@@ -58,22 +105,17 @@ size_t queue_create(queue_t **queue, size_t queue_size, size_t element_size) {
     (*queue)->head = (*queue)->size-1;
     (*queue)->tail = 0;
     (*queue)->element_size = element_size;
+    (*queue)->data = data;
+    (*queue)->allocated = false;
 
-    // create data entries
-    (*queue)->data = (void **) malloc((*queue)->size*sizeof(void *));
-    if ((*queue)->data==NULL) {
+    if ((*queue)->data==NULL || buffer==NULL) {
         return QUEUE_DATA_NO_MEMORY;
     }
 
     // assign continuous memory space
-    (*queue)->data[0] = malloc((*queue)->size*(*queue)->element_size);
-    for (size_t i = 1; i<(*queue)->size; i++) {
+    for (size_t i = 0; i<(*queue)->size; i++) {
         // allow pointer arithmetic
-        (*queue)->data[i] = (char *)(*queue)->data[0] + i * (*queue)->element_size;
-
-        if ((*queue)->data[i]==NULL) {
-            return QUEUE_DATA_NO_MEMORY;
-        }
+        (*queue)->data[i] = (char *)buffer + i * (*queue)->element_size;
     }
 
     return QUEUE_SUCCESS;
@@ -95,16 +137,19 @@ size_t queue_delete(queue_t **queue) {
         return status;
     }
 
-    // delete queue content
-    free((*queue)->data[0]);
-    (*queue)->data[0] = NULL;
+    // caller supplied storage stays untouched
+    if ((*queue)->allocated) {
+        // delete queue content
+        allocator_free((*queue)->data[0]);
+        (*queue)->data[0] = NULL;
 
-    // delete queue entries
-    free((*queue)->data);
-    (*queue)->data = NULL;
+        // delete queue entries
+        allocator_free((*queue)->data);
+        (*queue)->data = NULL;
 
-    // finish deleting queue
-    free((*queue));
+        // finish deleting queue
+        allocator_free((*queue));
+    }
     (*queue) = NULL;
 
     return QUEUE_SUCCESS;
@@ -0,0 +1,400 @@
+/**
+**************************************************
+* @file timer_wheel.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using hierarchical timing wheels
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'timer_wheel_create' to create a timing wheel
+  (#) Call 'timer_wheel_delete' to delete a timing wheel
+  (#) Call 'timer_wheel_node_init' to prepare a node,
+      which is usually embedded in the timed structure
+  (#) Call 'timer_wheel_insert' to start a node in
+      constant time
+  (#) Call 'timer_wheel_cancel' to stop a node in
+      constant time
+  (#) Call 'timer_wheel_tick' to advance the timing wheel
+      by one tick and to obtain all expired nodes at once
+  (#) Call 'timer_wheel_get_idle_ticks' to get the amount
+      of ticks without any expiration
+  (#) Call 'timer_wheel_skip' to advance the timing wheel
+      by ticks without any expiration
+  (#) All functions call 'timer_wheel_checking' to validate
+      proper timing wheel structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include <stdlib.h>
+#include <string.h>
+#include "utils/timer_wheel.h"
+#include "utils/pool.h"
+/* Preprocessor defines */
+#define TIMER_WHEEL_SLOT_MASK           (TIMER_WHEEL_SLOTS - 1)
+
+/* Preprocessor macros */
+#define TIMER_WHEEL_SHIFT(level)        ((level) * TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_INDEX(tick, level)  (((tick) >> TIMER_WHEEL_SHIFT(level)) & TIMER_WHEEL_SLOT_MASK)
+
+/* Module intern type definitions */
+/* Static module variables */
+POOL_DEFINE(g_timer_wheel_pool, timer_wheel_t, KERNEL_POOL_TIMER_WHEELS);
+/* Static module functions (prototypes) */
+static void timer_wheel_link(timer_wheel_t **timer_wheel, timer_wheel_node_t *node);
+static timer_wheel_node_t *timer_wheel_unlink_slot(timer_wheel_t **timer_wheel, size_t level, size_t index);
+
+/* Public functions */
+/**
+ * @brief Creates an empty timing wheel starting at tick 0
+ * @param timer_wheel is a pointer to the newly created timing wheel
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_NO_MEMORY: unable to allocate memory for timing wheel
+ */
+size_t timer_wheel_create(timer_wheel_t **timer_wheel) {
+
+    (*timer_wheel) = POOL_ALLOCATE(g_timer_wheel_pool, timer_wheel_t);
+    if ((*timer_wheel) == NULL) {
+        return TIMER_WHEEL_NO_MEMORY;
+    }
+    memset((*timer_wheel), 0, sizeof(timer_wheel_t));
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Deletes a timing wheel, the nodes are owned by the caller and stay untouched
+ * @param timer_wheel is a pointer to the timing wheel which will be set to NULL
+ * @return 0 on success or greater 0 on error
+ */
+size_t timer_wheel_delete(timer_wheel_t **timer_wheel) {
+
+    size_t status = timer_wheel_checking(timer_wheel);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return status;
+    }
+
+    POOL_FREE(g_timer_wheel_pool, (*timer_wheel));
+    (*timer_wheel) = NULL;
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Prepares an inactive node
+ * @param node is a pointer to the node, usually embedded in the timed structure
+ * @param data is the timed data returned on expiration
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_NODE_IS_NULL: node is not initialized
+ */
+size_t timer_wheel_node_init(timer_wheel_node_t *node, void *data) {
+
+    if (node == NULL) {
+        return TIMER_WHEEL_NODE_IS_NULL;
+    }
+
+    node->previous = NULL;
+    node->next = NULL;
+    node->slot = NULL;
+    node->expiry = 0;
+    node->data = data;
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Checks if a node is inserted in a timing wheel
+ * @param node is a pointer to the node
+ * @return true if the node will expire
+ */
+bool timer_wheel_node_is_active(timer_wheel_node_t *node) {
+    return node != NULL && node->slot != NULL;
+}
+
+/**
+ * @brief Inserts a node, which expires after the given ticks
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param node is a pointer to an inactive node
+ * @param ticks is the amount of ticks until expiration, 0 expires on the next tick as well
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_NODE_IS_NULL: node is not initialized
+ *     TIMER_WHEEL_NODE_IS_ACTIVE: node is already inserted
+ */
+size_t timer_wheel_insert(timer_wheel_t **timer_wheel, timer_wheel_node_t *node, size_t ticks) {
+
+    size_t status = timer_wheel_checking(timer_wheel);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return status;
+    }
+
+    if (node == NULL) {
+        return TIMER_WHEEL_NODE_IS_NULL;
+    }
+
+    if (node->slot != NULL) {
+        return TIMER_WHEEL_NODE_IS_ACTIVE;
+    }
+
+    // the current tick was already handled
+    if (ticks == 0) {
+        ticks = 1;
+    }
+
+    node->expiry = (*timer_wheel)->now + ticks;
+    timer_wheel_link(timer_wheel, node);
+    (*timer_wheel)->size++;
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Removes an active node before its expiration
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param node is a pointer to an active node
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_NODE_IS_NULL: node is not initialized
+ *     TIMER_WHEEL_NODE_IS_INACTIVE: node is not inserted
+ */
+size_t timer_wheel_cancel(timer_wheel_t **timer_wheel, timer_wheel_node_t *node) {
+
+    size_t status = timer_wheel_checking(timer_wheel);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return status;
+    }
+
+    if (node == NULL) {
+        return TIMER_WHEEL_NODE_IS_NULL;
+    }
+
+    if (node->slot == NULL) {
+        return TIMER_WHEEL_NODE_IS_INACTIVE;
+    }
+
+    // unlink the node from its slot
+    if (node->previous != NULL) {
+        node->previous->next = node->next;
+    }
+    else {
+        *node->slot = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->previous = node->previous;
+    }
+
+    // the slot position is derived from its address
+    if (*node->slot == NULL) {
+        size_t position = (size_t) (node->slot - &(*timer_wheel)->slots[0][0]);
+        (*timer_wheel)->occupied[position / TIMER_WHEEL_SLOTS] &= ~((uint64_t) 1 << (position % TIMER_WHEEL_SLOTS));
+    }
+
+    node->previous = NULL;
+    node->next = NULL;
+    node->slot = NULL;
+    (*timer_wheel)->size--;
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Advances the timing wheel by one tick and returns all nodes expiring on this tick.
+ *        Higher levels are cascaded down, when their period started.
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param expired is a pointer to the first expired node, further nodes are chained by next or NULL if none expired
+ * @return 0 on success or greater 0 on error
+ * @info Expired nodes are inactive and can be inserted again,
+ *       but the next node has to be read before.
+ */
+size_t timer_wheel_tick(timer_wheel_t **timer_wheel, timer_wheel_node_t **expired) {
+
+    size_t status = timer_wheel_checking(timer_wheel);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return status;
+    }
+
+    *expired = NULL;
+    (*timer_wheel)->now++;
+    size_t now = (*timer_wheel)->now;
+
+    // determine the highest level whose period starts with this tick
+    size_t cascade_level = 0;
+    while (cascade_level + 1 < TIMER_WHEEL_LEVELS
+            && (now & (((size_t) 1 << TIMER_WHEEL_SHIFT(cascade_level + 1)) - 1)) == 0) {
+        cascade_level++;
+    }
+
+    // cascade from the highest level down, because nodes might move to a lower level slot of this period
+    for (size_t level = cascade_level; level > 0; level--) {
+        timer_wheel_node_t *node = timer_wheel_unlink_slot(timer_wheel, level, TIMER_WHEEL_INDEX(now, level));
+        while (node != NULL) {
+            timer_wheel_node_t *next = node->next;
+            timer_wheel_link(timer_wheel, node);
+            node = next;
+        }
+    }
+
+    // all nodes of the current slot expire at once
+    timer_wheel_node_t *node = timer_wheel_unlink_slot(timer_wheel, 0, TIMER_WHEEL_INDEX(now, 0));
+    *expired = node;
+    while (node != NULL) {
+        node->slot = NULL;
+        node->previous = NULL;
+        (*timer_wheel)->size--;
+        node = node->next;
+    }
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Determines the amount of ticks, which can pass without any expiration or cascade
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param ticks is a pointer to memory expecting the amount of idle ticks
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_IS_EMPTY: no node is active, ticks stay untouched
+ */
+size_t timer_wheel_get_idle_ticks(timer_wheel_t **timer_wheel, size_t *ticks) {
+
+    size_t status = timer_wheel_checking(timer_wheel);
+    if (status != TIMER_WHEEL_SUCCESS) {
+        return status;
+    }
+
+    if ((*timer_wheel)->size == 0) {
+        return TIMER_WHEEL_IS_EMPTY;
+    }
+
+    size_t now = (*timer_wheel)->now;
+    size_t next_event = SIZE_MAX;
+    for (size_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        uint64_t occupied = (*timer_wheel)->occupied[level];
+        if (occupied == 0) {
+            continue;
+        }
+
+        // rotate the slots, so that bit 0 is the slot of the next period
+        size_t rotation = (TIMER_WHEEL_INDEX(now, level) + 1) & TIMER_WHEEL_SLOT_MASK;
+        if (rotation != 0) {
+            occupied = (occupied >> rotation) | (occupied << (TIMER_WHEEL_SLOTS - rotation));
+        }
+        size_t periods = (size_t) __builtin_ctzll(occupied) + 1;
+
+        // relative ticks until the slot is handled
+        size_t shift = TIMER_WHEEL_SHIFT(level);
+        size_t event = ((((now >> shift) + periods) << shift) - now);
+        if (event < next_event) {
+            next_event = event;
+        }
+    }
+
+    *ticks = next_event - 1;
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Advances the timing wheel by ticks, which were suppressed
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param ticks is the amount of ticks to advance, limited by timer_wheel_get_idle_ticks
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_OVERFLOW: an expiration or cascade would be skipped, nothing was advanced
+ */
+size_t timer_wheel_skip(timer_wheel_t **timer_wheel, size_t ticks) {
+
+    size_t idle_ticks = 0;
+    size_t status = timer_wheel_get_idle_ticks(timer_wheel, &idle_ticks);
+    if (status == TIMER_WHEEL_SUCCESS && ticks > idle_ticks) {
+        return TIMER_WHEEL_OVERFLOW;
+    }
+    else if (status != TIMER_WHEEL_SUCCESS && status != TIMER_WHEEL_IS_EMPTY) {
+        return status;
+    }
+
+    (*timer_wheel)->now += ticks;
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/**
+ * @brief Validates the timing wheel structure
+ * @param timer_wheel is a pointer to the timing wheel to be checked
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TIMER_WHEEL_NO_MEMORY: timing wheel is not initialized
+ */
+size_t timer_wheel_checking(timer_wheel_t **timer_wheel) {
+
+    if ((*timer_wheel) == NULL) {
+        return TIMER_WHEEL_NO_MEMORY;
+    }
+
+    return TIMER_WHEEL_SUCCESS;
+}
+
+/* Static module functions (implementation) */
+
+/**
+ * @brief Links a node in the slot matching its remaining ticks
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param node is a pointer to the node with a set expiry
+ */
+static void timer_wheel_link(timer_wheel_t **timer_wheel, timer_wheel_node_t *node) {
+
+    size_t now = (*timer_wheel)->now;
+    size_t remaining = node->expiry - now;
+    size_t placement = node->expiry;
+
+    // periods exceeding the range are placed in the last slot and cascaded again
+    if (remaining >= TIMER_WHEEL_RANGE) {
+        remaining = TIMER_WHEEL_RANGE - 1;
+        placement = now + remaining;
+    }
+
+    // every level covers the remaining ticks below its period
+    size_t level = 0;
+    while (level + 1 < TIMER_WHEEL_LEVELS && remaining >= ((size_t) 1 << TIMER_WHEEL_SHIFT(level + 1))) {
+        level++;
+    }
+
+    size_t index = TIMER_WHEEL_INDEX(placement, level);
+    timer_wheel_node_t **slot = &(*timer_wheel)->slots[level][index];
+
+    node->previous = NULL;
+    node->next = *slot;
+    if (*slot != NULL) {
+        (*slot)->previous = node;
+    }
+    *slot = node;
+    node->slot = slot;
+
+    (*timer_wheel)->occupied[level] |= (uint64_t) 1 << index;
+}
+
+/**
+ * @brief Detaches all nodes of a slot
+ * @param timer_wheel is a pointer to the timing wheel
+ * @param level is the level of the slot
+ * @param index is the index of the slot
+ * @return the first node of the slot, further nodes are chained by next
+ */
+static timer_wheel_node_t *timer_wheel_unlink_slot(timer_wheel_t **timer_wheel, size_t level, size_t index) {
+
+    timer_wheel_node_t *node = (*timer_wheel)->slots[level][index];
+    (*timer_wheel)->slots[level][index] = NULL;
+    (*timer_wheel)->occupied[level] &= ~((uint64_t) 1 << index);
+
+    return node;
+}
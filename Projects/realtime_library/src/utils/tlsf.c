@@ -0,0 +1,450 @@
+/**
+**************************************************
+* @file tlsf.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for a two level segregated fit heap with constant time allocation
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'tlsf_create_static' to create a heap over a
+      caller supplied memory region
+  (#) Call 'tlsf_allocate' to take a block in constant time
+  (#) Call 'tlsf_free' to return a block in constant time,
+      it is merged with its free neighbours immediately
+  (#) Call 'tlsf_get_statistics' to get the free space and
+      the fragmentation of the heap
+  (#) Use 'tlsf_allocator_allocate' and 'tlsf_allocator_free'
+      with the heap as context to plug it into allocator_set
+  (#) All functions call 'tlsf_checking' to validate
+      proper heap structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+  (#) The heap is not locked, the caller has to serialize
+      the access, e.g. by a critical section.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include "utils/tlsf.h"
+
+/* Preprocessor defines */
+#define TLSF_BLOCK_FREE             ((size_t) 1)
+#define TLSF_BLOCK_HEADER_SIZE      sizeof(tlsf_block_t)
+// a free block has to hold its list links
+#define TLSF_BLOCK_SIZE_MIN         TLSF_ALIGN_UP(sizeof(tlsf_links_t))
+#define TLSF_BLOCK_SIZE_MAX         (((size_t) 1 << TLSF_FL_INDEX_MAX) - TLSF_ALIGN_SIZE)
+#define TLSF_SMALL_BLOCK_SIZE       ((size_t) 1 << TLSF_FL_INDEX_SHIFT)
+
+/* Preprocessor macros */
+#define TLSF_ALIGN_UP(size)         (((size) + TLSF_ALIGN_SIZE - 1) & ~((size_t) TLSF_ALIGN_SIZE - 1))
+#define TLSF_ALIGN_DOWN(size)       ((size) & ~((size_t) TLSF_ALIGN_SIZE - 1))
+#define TLSF_BLOCK_SIZE(block)      ((block)->size & ~TLSF_BLOCK_FREE)
+#define TLSF_BLOCK_IS_FREE(block)   (((block)->size & TLSF_BLOCK_FREE) != 0)
+#define TLSF_BLOCK_PAYLOAD(block)   ((void *) ((uint8_t *) (block) + TLSF_BLOCK_HEADER_SIZE))
+#define TLSF_BLOCK_FROM_PAYLOAD(payload) ((tlsf_block_t *) ((uint8_t *) (payload) - TLSF_BLOCK_HEADER_SIZE))
+#define TLSF_BLOCK_NEXT(block)      ((tlsf_block_t *) ((uint8_t *) TLSF_BLOCK_PAYLOAD(block) + TLSF_BLOCK_SIZE(block)))
+#define TLSF_BLOCK_LINKS(block)     ((tlsf_links_t *) TLSF_BLOCK_PAYLOAD(block))
+
+/* Module intern type definitions */
+
+/// Links of a free block in the list of its size class, stored in its payload
+typedef struct {
+    tlsf_block_t *next;     ///< next free block of the same size class
+    tlsf_block_t *prev;     ///< previous free block of the same size class
+} tlsf_links_t;
+
+/* Static module variables */
+/* Static module functions (prototypes) */
+static size_t tlsf_find_last_set(size_t word);
+static size_t tlsf_find_first_set(size_t word);
+static void tlsf_mapping_insert(size_t size, size_t *fl, size_t *sl);
+static bool tlsf_mapping_search(size_t size, size_t *fl, size_t *sl);
+static tlsf_block_t *tlsf_search_suitable_block(tlsf_t *tlsf, size_t *fl, size_t *sl);
+static void tlsf_insert_free_block(tlsf_t *tlsf, tlsf_block_t *block);
+static void tlsf_remove_free_block(tlsf_t *tlsf, tlsf_block_t *block);
+
+/* Public functions */
+/**
+ * @brief Creates a heap over a caller supplied memory region, which is a single free block afterwards.
+ *        The region is ended by a used block of size 0, so the last block has no free neighbour behind it.
+ * @param tlsf is a pointer to the newly created heap
+ * @param storage is the control information of the heap, which must outlive it
+ * @param memory is the memory region of the heap, it is aligned to 8 bytes internally
+ * @param size is the size of the memory region in bytes
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     TLSF_IS_NULL: storage or memory is NULL
+ *     TLSF_INVALID_SIZE: the region is too small for a block or too large for the size classes
+ */
+size_t tlsf_create_static(tlsf_t **tlsf, tlsf_t *storage, void *memory, size_t size) {
+
+    (*tlsf) = storage;
+    if ((*tlsf) == NULL || memory == NULL) {
+        return TLSF_IS_NULL;
+    }
+
+    // align the start of the region and cut off the unaligned end
+    uintptr_t start = TLSF_ALIGN_UP((uintptr_t) memory);
+    size_t offset = (size_t) (start - (uintptr_t) memory);
+    if (size < offset + 2 * TLSF_BLOCK_HEADER_SIZE + TLSF_BLOCK_SIZE_MIN) {
+        (*tlsf) = NULL;
+        return TLSF_INVALID_SIZE;
+    }
+
+    size_t block_size = TLSF_ALIGN_DOWN(size - offset) - 2 * TLSF_BLOCK_HEADER_SIZE;
+    if (block_size > TLSF_BLOCK_SIZE_MAX) {
+        (*tlsf) = NULL;
+        return TLSF_INVALID_SIZE;
+    }
+
+    (*tlsf)->first = (tlsf_block_t *) start;
+    (*tlsf)->heap_size = block_size;
+    (*tlsf)->used_size = 0;
+    (*tlsf)->used_size_max = 0;
+    (*tlsf)->failures = 0;
+    (*tlsf)->fl_bitmap = 0;
+    for (size_t fl = 0; fl < TLSF_FL_INDEX_COUNT; fl++) {
+        (*tlsf)->sl_bitmap[fl] = 0;
+        for (size_t sl = 0; sl < TLSF_SL_INDEX_COUNT; sl++) {
+            (*tlsf)->free_blocks[fl][sl] = NULL;
+        }
+    }
+
+    tlsf_block_t *block = (*tlsf)->first;
+    block->prev_physical = NULL;
+    block->size = block_size;
+
+    // the sentinel is never free and never merged
+    tlsf_block_t *sentinel = TLSF_BLOCK_NEXT(block);
+    sentinel->prev_physical = block;
+    sentinel->size = 0;
+
+    tlsf_insert_free_block((*tlsf), block);
+
+    return TLSF_SUCCESS;
+}
+
+/**
+ * @brief Takes a block of the smallest size class, which is guaranteed to fit, in constant time.
+ *        The remainder of a larger block is split off and stays free.
+ * @param tlsf is a pointer to the heap to allocate from
+ * @param size is the amount of bytes
+ * @return pointer to the 8 byte aligned block or NULL, when no free block fits or the heap is invalid
+ */
+void *tlsf_allocate(tlsf_t **tlsf, size_t size) {
+
+    if (tlsf_checking(tlsf) != TLSF_SUCCESS) {
+        return NULL;
+    }
+
+    size_t fl = 0;
+    size_t sl = 0;
+    tlsf_block_t *block = NULL;
+    if (size <= TLSF_BLOCK_SIZE_MAX) {
+        size = (size < TLSF_BLOCK_SIZE_MIN) ? TLSF_BLOCK_SIZE_MIN : TLSF_ALIGN_UP(size);
+        if (tlsf_mapping_search(size, &fl, &sl)) {
+            block = tlsf_search_suitable_block((*tlsf), &fl, &sl);
+        }
+    }
+
+    if (block == NULL) {
+        (*tlsf)->failures++;
+        return NULL;
+    }
+
+    tlsf_remove_free_block((*tlsf), block);
+
+    // split off the remainder, if it is able to hold a free block
+    size_t block_size = TLSF_BLOCK_SIZE(block);
+    if (block_size >= size + TLSF_BLOCK_HEADER_SIZE + TLSF_BLOCK_SIZE_MIN) {
+        tlsf_block_t *next = TLSF_BLOCK_NEXT(block);
+
+        block->size = size;
+        tlsf_block_t *remainder = TLSF_BLOCK_NEXT(block);
+        remainder->prev_physical = block;
+        remainder->size = block_size - size - TLSF_BLOCK_HEADER_SIZE;
+        next->prev_physical = remainder;
+
+        tlsf_insert_free_block((*tlsf), remainder);
+    }
+
+    (*tlsf)->used_size += TLSF_BLOCK_SIZE(block);
+    if ((*tlsf)->used_size > (*tlsf)->used_size_max) {
+        (*tlsf)->used_size_max = (*tlsf)->used_size;
+    }
+
+    return TLSF_BLOCK_PAYLOAD(block);
+}
+
+/**
+ * @brief Returns a block to the heap in constant time and merges it with its free neighbours
+ * @param tlsf is a pointer to the heap the block was allocated from
+ * @param block is the block to return, NULL is ignored like by free
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TLSF_INVALID_BLOCK: block was not handed out by this heap or is already free
+ */
+size_t tlsf_free(tlsf_t **tlsf, void *block) {
+
+    size_t status = tlsf_checking(tlsf);
+    if (status != TLSF_SUCCESS) {
+        return status;
+    }
+
+    if (block == NULL) {
+        return TLSF_SUCCESS;
+    }
+
+    // only the start of an allocated block inside the region is accepted
+    uint8_t *start = (uint8_t *) TLSF_BLOCK_PAYLOAD((*tlsf)->first);
+    uint8_t *end = start + (*tlsf)->heap_size;
+    uint8_t *address = (uint8_t *) block;
+    if (address < start || address >= end || ((uintptr_t) address & (TLSF_ALIGN_SIZE - 1)) != 0) {
+        return TLSF_INVALID_BLOCK;
+    }
+
+    tlsf_block_t *current = TLSF_BLOCK_FROM_PAYLOAD(block);
+    if (TLSF_BLOCK_IS_FREE(current) || TLSF_BLOCK_SIZE(current) == 0 || TLSF_BLOCK_SIZE(current) > (size_t) (end - address)
+            || TLSF_BLOCK_NEXT(current)->prev_physical != current) {
+        return TLSF_INVALID_BLOCK;
+    }
+
+    (*tlsf)->used_size -= TLSF_BLOCK_SIZE(current);
+
+    // merge with the free block in front
+    tlsf_block_t *prev = current->prev_physical;
+    if (prev != NULL && TLSF_BLOCK_IS_FREE(prev)) {
+        tlsf_remove_free_block((*tlsf), prev);
+        prev->size = TLSF_BLOCK_SIZE(prev) + TLSF_BLOCK_HEADER_SIZE + TLSF_BLOCK_SIZE(current);
+        current = prev;
+        TLSF_BLOCK_NEXT(current)->prev_physical = current;
+    }
+
+    // merge with the free block behind, the sentinel is never free
+    tlsf_block_t *next = TLSF_BLOCK_NEXT(current);
+    if (TLSF_BLOCK_IS_FREE(next)) {
+        tlsf_remove_free_block((*tlsf), next);
+        current->size = TLSF_BLOCK_SIZE(current) + TLSF_BLOCK_HEADER_SIZE + TLSF_BLOCK_SIZE(next);
+        TLSF_BLOCK_NEXT(current)->prev_physical = current;
+    }
+
+    tlsf_insert_free_block((*tlsf), current);
+
+    return TLSF_SUCCESS;
+}
+
+/**
+ * @brief Gets the statistics of the heap. The blocks are counted by walking the whole region,
+ *        this takes linear time and is meant for diagnostics only.
+ * @param tlsf is a pointer to the heap
+ * @param statistics is a pointer of tlsf_statistics_t, which receives the statistics
+ * @return 0 on success or greater 0 on error
+ */
+size_t tlsf_get_statistics(tlsf_t **tlsf, tlsf_statistics_t *statistics) {
+
+    size_t status = tlsf_checking(tlsf);
+    if (status != TLSF_SUCCESS) {
+        return status;
+    }
+
+    *statistics = (tlsf_statistics_t) { 0 };
+    statistics->heap_size = (*tlsf)->heap_size;
+    statistics->used_size = (*tlsf)->used_size;
+    statistics->used_size_max = (*tlsf)->used_size_max;
+    statistics->failures = (*tlsf)->failures;
+
+    for (tlsf_block_t *block = (*tlsf)->first; TLSF_BLOCK_SIZE(block) != 0; block = TLSF_BLOCK_NEXT(block)) {
+        if (TLSF_BLOCK_IS_FREE(block)) {
+            statistics->free_blocks++;
+            statistics->free_size += TLSF_BLOCK_SIZE(block);
+            if (TLSF_BLOCK_SIZE(block) > statistics->largest_free_block) {
+                statistics->largest_free_block = TLSF_BLOCK_SIZE(block);
+            }
+        }
+        else {
+            statistics->used_blocks++;
+        }
+    }
+
+    if (statistics->free_size > 0) {
+        statistics->fragmentation = 100 - (statistics->largest_free_block * 100) / statistics->free_size;
+    }
+
+    return TLSF_SUCCESS;
+}
+
+/**
+ * @brief Takes a block from a heap, which is passed as context, to be used as allocate function of allocator_t
+ * @param context is a tlsf_t pointer to the heap
+ * @param size is the amount of bytes
+ * @return pointer to the block or NULL
+ */
+void *tlsf_allocator_allocate(void *context, size_t size) {
+    tlsf_t *tlsf = (tlsf_t *) context;
+    return tlsf_allocate(&tlsf, size);
+}
+
+/**
+ * @brief Returns a block to a heap, which is passed as context, to be used as free function of allocator_t
+ * @param context is a tlsf_t pointer to the heap
+ * @param block is the block to return
+ */
+void tlsf_allocator_free(void *context, void *block) {
+    tlsf_t *tlsf = (tlsf_t *) context;
+    tlsf_free(&tlsf, block);
+}
+
+/**
+ * @brief Validates the heap structure
+ * @param tlsf is a pointer to the heap to be checked
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     TLSF_IS_NULL: heap or its memory region is not initialized
+ */
+size_t tlsf_checking(tlsf_t **tlsf) {
+
+    if (tlsf == NULL || (*tlsf) == NULL || (*tlsf)->first == NULL) {
+        return TLSF_IS_NULL;
+    }
+
+    return TLSF_SUCCESS;
+}
+
+/* Static module functions (implementation) */
+/**
+ * @brief Gets the index of the most significant set bit
+ * @param word is the word to search, it must not be 0
+ * @return index of the bit counted from the least significant bit
+ */
+static size_t tlsf_find_last_set(size_t word) {
+    return sizeof(unsigned long) * 8 - 1 - (size_t) __builtin_clzl((unsigned long) word);
+}
+
+/**
+ * @brief Gets the index of the least significant set bit
+ * @param word is the word to search, it must not be 0
+ * @return index of the bit counted from the least significant bit
+ */
+static size_t tlsf_find_first_set(size_t word) {
+    return (size_t) __builtin_ctzl((unsigned long) word);
+}
+
+/**
+ * @brief Maps a block size to the size class, which contains it
+ * @param size is the payload size of the block
+ * @param fl is a pointer, which receives the first level index
+ * @param sl is a pointer, which receives the second level index
+ */
+static void tlsf_mapping_insert(size_t size, size_t *fl, size_t *sl) {
+    if (size < TLSF_SMALL_BLOCK_SIZE) {
+        // small blocks are split linearly
+        *fl = 0;
+        *sl = size / (TLSF_SMALL_BLOCK_SIZE / TLSF_SL_INDEX_COUNT);
+    }
+    else {
+        size_t last = tlsf_find_last_set(size);
+        *sl = (size >> (last - TLSF_SL_INDEX_COUNT_LOG2)) ^ ((size_t) 1 << TLSF_SL_INDEX_COUNT_LOG2);
+        *fl = last - (TLSF_FL_INDEX_SHIFT - 1);
+    }
+}
+
+/**
+ * @brief Maps a requested size to the smallest size class, whose blocks all fit it
+ * @param size is the aligned requested size
+ * @param fl is a pointer, which receives the first level index
+ * @param sl is a pointer, which receives the second level index
+ * @return true, if the size class exists
+ */
+static bool tlsf_mapping_search(size_t size, size_t *fl, size_t *sl) {
+    if (size >= TLSF_SMALL_BLOCK_SIZE) {
+        // round up to the next size class, so every block of the class fits
+        size += ((size_t) 1 << (tlsf_find_last_set(size) - TLSF_SL_INDEX_COUNT_LOG2)) - 1;
+    }
+    tlsf_mapping_insert(size, fl, sl);
+
+    return *fl < TLSF_FL_INDEX_COUNT;
+}
+
+/**
+ * @brief Finds the first free block of the given or the next larger non empty size class by the bitmaps
+ * @param tlsf is the heap
+ * @param fl is a pointer to the first level index, which receives the index of the found class
+ * @param sl is a pointer to the second level index, which receives the index of the found class
+ * @return the free block or NULL, if no class is large enough
+ */
+static tlsf_block_t *tlsf_search_suitable_block(tlsf_t *tlsf, size_t *fl, size_t *sl) {
+    size_t sl_map = tlsf->sl_bitmap[*fl] & (~(size_t) 0 << *sl);
+    if (sl_map == 0) {
+        // no block in this first level, take the next larger one
+        size_t fl_map = (*fl + 1 < sizeof(size_t) * 8) ? tlsf->fl_bitmap & (~(size_t) 0 << (*fl + 1)) : 0;
+        if (fl_map == 0) {
+            return NULL;
+        }
+
+        *fl = tlsf_find_first_set(fl_map);
+        sl_map = tlsf->sl_bitmap[*fl];
+    }
+    *sl = tlsf_find_first_set(sl_map);
+
+    return tlsf->free_blocks[*fl][*sl];
+}
+
+/**
+ * @brief Marks a block as free and links it in front of the list of its size class
+ * @param tlsf is the heap
+ * @param block is the block with its final size
+ */
+static void tlsf_insert_free_block(tlsf_t *tlsf, tlsf_block_t *block) {
+    size_t fl = 0;
+    size_t sl = 0;
+    tlsf_mapping_insert(TLSF_BLOCK_SIZE(block), &fl, &sl);
+
+    tlsf_block_t *head = tlsf->free_blocks[fl][sl];
+    TLSF_BLOCK_LINKS(block)->next = head;
+    TLSF_BLOCK_LINKS(block)->prev = NULL;
+    if (head != NULL) {
+        TLSF_BLOCK_LINKS(head)->prev = block;
+    }
+    tlsf->free_blocks[fl][sl] = block;
+    block->size |= TLSF_BLOCK_FREE;
+
+    tlsf->fl_bitmap |= (size_t) 1 << fl;
+    tlsf->sl_bitmap[fl] |= (size_t) 1 << sl;
+}
+
+/**
+ * @brief Unlinks a free block from the list of its size class and marks it as used
+ * @param tlsf is the heap
+ * @param block is the free block
+ */
+static void tlsf_remove_free_block(tlsf_t *tlsf, tlsf_block_t *block) {
+    size_t fl = 0;
+    size_t sl = 0;
+    tlsf_mapping_insert(TLSF_BLOCK_SIZE(block), &fl, &sl);
+
+    tlsf_block_t *next = TLSF_BLOCK_LINKS(block)->next;
+    tlsf_block_t *prev = TLSF_BLOCK_LINKS(block)->prev;
+    if (next != NULL) {
+        TLSF_BLOCK_LINKS(next)->prev = prev;
+    }
+    if (prev != NULL) {
+        TLSF_BLOCK_LINKS(prev)->next = next;
+    }
+    else {
+        tlsf->free_blocks[fl][sl] = next;
+        if (next == NULL) {
+            // the size class is empty
+            tlsf->sl_bitmap[fl] &= ~((size_t) 1 << sl);
+            if (tlsf->sl_bitmap[fl] == 0) {
+                tlsf->fl_bitmap &= ~((size_t) 1 << fl);
+            }
+        }
+    }
+    block->size &= ~TLSF_BLOCK_FREE;
+}
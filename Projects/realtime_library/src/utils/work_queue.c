@@ -0,0 +1,262 @@
+/**
+**************************************************
+* @file work_queue.c
+* @author Christopher-Marcel Klein, Ameline Seba
+* @version v1.0
+* @date Oct 16, 2026
+* @brief Module for creating and using lock free work queues
+@verbatim
+==================================================
+  ### Resources used ###
+  None
+==================================================
+  ### Usage ###
+  (#) Call 'work_queue_create' to create a work queue
+  (#) Call 'work_queue_create_static' to create a work
+      queue in caller supplied storage
+  (#) Call 'work_queue_delete' to delete a work queue
+  (#) Call 'work_queue_post' to store a function and its
+      argument. Any amount of interrupts and tasks may post
+      concurrently without masking interrupts.
+  (#) Call 'work_queue_read' to take the oldest work item.
+      Only a single consumer may read.
+  (#) Every slot carries a sequence number, which tells
+      the producers whether it is free and the consumer
+      whether it is published. The size has to be a power
+      of 2.
+  (#) All functions call 'work_queue_checking' to validate
+      proper work queue structure. Refer to this function
+      for potential error codes not documented in each
+      function.
+==================================================
+@endverbatim
+**************************************************
+*/
+/* Includes */
+#include "utils/work_queue.h"
+#include "utils/atomic.h"
+#include "utils/allocator.h"
+#include <stdlib.h>
+
+/* Preprocessor defines */
+/* Preprocessor macros */
+/* Module intern type definitions */
+/* Static module variables */
+/* Static module functions (prototypes) */
+/* Public functions */
+/**
+ * @brief Creates an empty work queue
+ * @param work_queue is a pointer to the newly created work queue
+ * @param size is the amount of work items, which has to be a power of 2
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     WORK_QUEUE_NO_MEMORY: unable to allocate memory for the work queue, always in static allocation mode
+ *     WORK_QUEUE_INVALID_SIZE: size is not a power of 2
+ */
+size_t work_queue_create(work_queue_t **work_queue, size_t size) {
+
+#if KERNEL_STATIC_ALLOCATION
+    // the item count is only known at runtime, supply it with work_queue_create_static
+    (void) size;
+    (*work_queue) = NULL;
+    return WORK_QUEUE_NO_MEMORY;
+#else
+    work_queue_t *storage = (work_queue_t *) allocator_allocate(sizeof(work_queue_t));
+    work_item_t *items = (work_item_t *) allocator_allocate(size * sizeof(work_item_t));
+    if (storage == NULL || items == NULL) {
+        allocator_free(items);
+        allocator_free(storage);
+        return WORK_QUEUE_NO_MEMORY;
+    }
+
+    size_t status = work_queue_create_static(work_queue, storage, items, size);
+    if (status != WORK_QUEUE_SUCCESS) {
+        allocator_free(items);
+        allocator_free(storage);
+        (*work_queue) = NULL;
+        return status;
+    }
+    (*work_queue)->allocated = true;
+
+    return WORK_QUEUE_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Creates an empty work queue in caller supplied storage, which is never released
+ * @param work_queue is a pointer to the newly created work queue
+ * @param storage is the memory of the work queue, which must outlive it
+ * @param items is an array of size work items
+ * @param size is the amount of work items, which has to be a power of 2
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     WORK_QUEUE_NO_MEMORY: storage or items is NULL
+ *     WORK_QUEUE_INVALID_SIZE: size is not a power of 2
+ */
+size_t work_queue_create_static(work_queue_t **work_queue, work_queue_t *storage, work_item_t *items, size_t size) {
+
+    (*work_queue) = storage;
+    if ((*work_queue) == NULL || items == NULL) {
+        return WORK_QUEUE_NO_MEMORY;
+    }
+
+    // positions are masked instead of wrapped by a modulo
+    if (size == 0 || (size & (size - 1)) != 0) {
+        return WORK_QUEUE_INVALID_SIZE;
+    }
+
+    (*work_queue)->items = items;
+    (*work_queue)->size = size;
+    (*work_queue)->head = 0;
+    (*work_queue)->tail = 0;
+    (*work_queue)->overflows = 0;
+    (*work_queue)->allocated = false;
+
+    // every slot is free for its first position
+    for (size_t position = 0; position < size; position++) {
+        items[position].function = NULL;
+        items[position].argument = NULL;
+        items[position].timestamp = 0;
+        items[position].sequence = position;
+    }
+
+    return WORK_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Deletes a work queue, pending work items are dropped
+ * @param work_queue is a pointer to the work queue which will be set to NULL
+ * @return 0 on success or greater 0 on error
+ */
+size_t work_queue_delete(work_queue_t **work_queue) {
+
+    size_t status = work_queue_checking(work_queue);
+    if (status != WORK_QUEUE_SUCCESS) {
+        return status;
+    }
+
+    // caller supplied storage stays untouched
+    if ((*work_queue)->allocated) {
+        allocator_free((*work_queue)->items);
+        allocator_free((*work_queue));
+    }
+    (*work_queue) = NULL;
+
+    return WORK_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Posts a function call to the work queue without masking interrupts.
+ *        A position is claimed by a compare exchange on the head, the item
+ *        is published by its sequence number afterwards.
+ * @param work_queue is a pointer to the work queue
+ * @param function is executed by the consumer
+ * @param argument is passed to the function
+ * @param timestamp is stored with the work item, e.g. to measure its latency
+ * @return 0 on success or greater 0 on error
+ * @info On error check for these errors:
+ *     WORK_QUEUE_NO_FUNCTION: function is NULL
+ *     WORK_QUEUE_IS_FULL: every slot is in use, the overflow is counted
+ * @note Safe to call from interrupts of any priority.
+ */
+size_t work_queue_post(work_queue_t **work_queue, void (*function)(void *argument), void *argument, size_t timestamp) {
+
+    size_t status = work_queue_checking(work_queue);
+    if (status != WORK_QUEUE_SUCCESS) {
+        return status;
+    }
+
+    if (function == NULL) {
+        return WORK_QUEUE_NO_FUNCTION;
+    }
+
+    size_t mask = (*work_queue)->size - 1;
+    size_t position = (*work_queue)->head;
+    work_item_t *work_item = NULL;
+
+    while (true) {
+        work_item = &(*work_queue)->items[position & mask];
+
+        // the difference stays valid, when the positions overflow
+        intptr_t difference = (intptr_t) (work_item->sequence - position);
+        if (difference == 0) {
+            if (atomic_compare_exchange(&(*work_queue)->head, position, position + 1)) {
+                break;
+            }
+        }
+        else if (difference < 0) {
+            // the slot still holds the item posted one round before
+            atomic_increment_if_below(&(*work_queue)->overflows, SIZE_MAX);
+            return WORK_QUEUE_IS_FULL;
+        }
+
+        // another producer claimed the position first
+        position = (*work_queue)->head;
+    }
+
+    work_item->function = function;
+    work_item->argument = argument;
+    work_item->timestamp = timestamp;
+
+    // publish the content before the sequence number
+    atomic_fence();
+    work_item->sequence = position + 1;
+
+    return WORK_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Takes the oldest published work item and frees its slot
+ * @param work_queue is a pointer to the work queue
+ * @param work_item is a pointer to a work item the content is copied to
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     WORK_QUEUE_IS_EMPTY: no published work item
+ * @note A work item, whose position is claimed but not yet published,
+ *       ends the read until it is published.
+ */
+size_t work_queue_read(work_queue_t **work_queue, work_item_t *work_item) {
+
+    size_t status = work_queue_checking(work_queue);
+    if (status != WORK_QUEUE_SUCCESS) {
+        return status;
+    }
+
+    size_t position = (*work_queue)->tail;
+    work_item_t *slot = &(*work_queue)->items[position & ((*work_queue)->size - 1)];
+    if (slot->sequence != position + 1) {
+        return WORK_QUEUE_IS_EMPTY;
+    }
+
+    // read the content after the sequence number
+    atomic_fence();
+    work_item->function = slot->function;
+    work_item->argument = slot->argument;
+    work_item->timestamp = slot->timestamp;
+    work_item->sequence = position;
+
+    // free the slot for the next round, after its content was read
+    atomic_fence();
+    slot->sequence = position + (*work_queue)->size;
+    (*work_queue)->tail = position + 1;
+
+    return WORK_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Validates a work queue
+ * @param work_queue is a pointer to the work queue
+ * @return 0 on success or greater 0 on error
+ * @info On error check for this error:
+ *     WORK_QUEUE_IS_NULL: work queue is not initialized
+ */
+size_t work_queue_checking(work_queue_t **work_queue) {
+
+    if (work_queue == NULL || (*work_queue) == NULL) {
+        return WORK_QUEUE_IS_NULL;
+    }
+
+    return WORK_QUEUE_SUCCESS;
+}
+
+/* Static module functions (implementation) */
@@ -22,13 +22,24 @@
   (#) Call 'kernel_delay_blocking' to delay the running task without
       context switch
   (#) Call 'kernel_get_tick' to get the STM tick count
+  (#) Call 'kernel_get_cycles' to get the DWT cycle count, which
+      are the cycles of the cpu accounting
+  (#) Call 'kernel_get_skipped_ticks' to get the amount of ticks
+      suppressed by tickless idle
 
   (#) Call 'kernel_enter_idle' to enter Idle mode
   (#) Call 'kernel_exit_idle' to exit Idle mode
   (#) Call 'kernel_disable_interrupts' to disable interrupts
   (#) Call 'kernel_enable_interrupts' to enable interrupts
+  (#) Call 'kernel_mask_interrupts' to mask interrupts up to
+      KERNEL_MAX_SYSCALL_PRIORITY by BASEPRI
+  (#) Call 'kernel_unmask_interrupts' to unmask interrupts
+  (#) Call 'kernel_validate_interrupt_priority' to halt an interrupt,
+      which calls the kernel above KERNEL_MAX_SYSCALL_PRIORITY
 
   (#) Call 'kernel_task_terminate' as return function from a task
+  (#) Call 'kernel_reset_task_context' to forget the context of
+      a reaped task, so its id can be used by a new task
   (#) Call 'kernel_shutdown' shutdown the system
 ==================================================
 @endverbatim
@@ -38,7 +49,9 @@
 
 #include "kernel/kernel.h"
 #include "kernel/semaphore.h"
+#include "kernel/tickless.h"
 #include "utils/dictionary.h"
+#include "utils/bitmap.h"
 #include "utils/support.h"
 #include "stm32l4xx_hal.h"
 #include "cmsis_gcc.h"
@@ -46,13 +59,18 @@
 
 #define MSP_PSP
 
+// LPTIM1 is clocked by the 32 kHz LSI and divided by 32 to count in milliseconds
+#define KERNEL_TICKLESS_TIMER_MAX_TICKS     0xFFFF
+
+// PendSV and SysTick run with the lowest priority and are masked by every critical section
+#define KERNEL_INTERRUPT_PRIORITY           ((1u << __NVIC_PRIO_BITS) - 1u)
+#define KERNEL_BASEPRI                      (KERNEL_MAX_SYSCALL_PRIORITY << (8u - __NVIC_PRIO_BITS))
+
 size_t kernel_start_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task);
 size_t kernel_swap_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task);
 size_t kernel_set_status(Kernel_Status_e status);
 size_t kernel_set_stack_pointer(void);
 
-extern void kernel_toggle_critical_section(void);
-
 
 task_t                  *g_running_task_current             = NULL;
 task_t                  *g_running_task_next                = NULL;
@@ -62,8 +80,6 @@ uint32_t                g_task_start_time                   = 0;
 
 size_t                  g_dictionary_priority               = 0;
 size_t                  g_dictionary_priority_next          = 1;
-extern  size_t          g_task_lower_priority;
-extern  size_t          g_task_lowest_priority;
 
 linked_list_element_t   *g_linked_list_task_iterator        = NULL;
 linked_list_element_t   *g_linked_list_task_iterator_next   = NULL;
@@ -74,15 +90,40 @@ linked_list_t           *g_priority_group_current           = NULL;
 linked_list_t           *g_priority_group_next              = NULL;
 
 extern  linked_list_t   *g_terminated_tasks_list;
+extern  bitmap_t        *g_ready_priorities;
 
 
-extern  bool            g_kernel_critical_section_active;
+extern  size_t          g_kernel_critical_nesting;
 extern  linked_list_t   *g_delayed_tasks;
+extern  timer_wheel_t   *g_timer_wheel;
 
 
 extern size_t g_available_tasks;
 extern size_t kernel_reinsert_task(linked_list_t **source, linked_list_element_t **element, task_t **task);
+extern size_t kernel_update_ready_priority(size_t priority);
+extern size_t kernel_reap_terminated_tasks(void);
+extern void kernel_cpu_switch(task_t *task);
+extern void kernel_cpu_enter_idle(void);
+extern void kernel_cpu_tick(void);
 void kernel_task_terminate(void);
+void kernel_reset_task_context(uint8_t task_id);
+
+#if KERNEL_TICKLESS_IDLE
+static size_t kernel_tickless_timer_start(size_t ticks);
+static void kernel_tickless_timer_sleep(void);
+static size_t kernel_tickless_timer_stop(void);
+static void kernel_tickless_timer_increment_tick(size_t ticks);
+static void kernel_tickless_timer_handler(void);
+
+static const tickless_timer_t g_tickless_timer = {
+    .start = kernel_tickless_timer_start,
+    .sleep = kernel_tickless_timer_sleep,
+    .stop = kernel_tickless_timer_stop,
+    .increment_tick = kernel_tickless_timer_increment_tick,
+};
+tickless_t              *g_tickless                         = NULL;
+static size_t           g_tickless_programmed_ticks         = 0;
+#endif
 
 /**
  * @brief Update the kernel and its components.
@@ -101,37 +142,47 @@ void kernel_update(void) {
 
     // inform segger systick interrupt aka kernel_update was entered
     SEGGER_SYSVIEW_RECORD_ENTER_ISR();
+    kernel_cpu_isr_enter();
 
-    // Return during critical section, but only after recording for SEGGER
-    if (g_kernel_critical_section_active) {
-        SEGGER_SYSVIEW_RECORD_EXIT_ISR();
-        return;
-    }
+    // the running task is only preempted on its time quantum, if it is outside of a critical section
+    bool preemptible = g_kernel_critical_nesting == 0;
 
-    // handle delta times in delayed task list
+    // ------------------- critical section start -------------------------
+    // the tick has the lowest priority, so '_from_isr' calls of other interrupts must not change
+    // the timing wheel, the priority groups or the waiting lists in the middle of the expiry
+    kernel_enter_critical();
+
+    // release every delayed task, whose timeout expired on this tick, in one pass
     size_t status = -1;
-    task_t *task = NULL;
-    if (g_delayed_tasks->size>0) {
-        task = (task_t *) g_delayed_tasks->tail->data;
-        if (task->delta_time==0) {
-            // reinsert task from delay list to its priority group
-            status = kernel_reinsert_task(&g_delayed_tasks, &g_delayed_tasks->tail, &task);
-        }
-        else {
-            // decrement delta time
-            task->delta_time--;
-        }
+    size_t ready_priority = 0;
+    timer_wheel_node_t *expired = NULL;
+    timer_wheel_tick(&g_timer_wheel, &expired);
+    while (expired != NULL) {
+        // expired nodes are chained by next, which has to be read before the task is reinserted
+        timer_wheel_node_t *next = expired->next;
+        task_t *task = (task_t *) expired->data;
+        linked_list_element_t *element = &task->list_element;
+
+        // reinsert task from the delay list or from the waiting list of an object to its priority group
+        linked_list_t *source = task->blocked_timeout_list != NULL ? task->blocked_timeout_list : g_delayed_tasks;
+        status = kernel_reinsert_task(&source, &element, &task);
+        expired = next;
     }
 
 
-    // check if time quantum has elapsed and update kernel state
+    // check if time quantum has elapsed and update kernel state,
+    // the owner of a ceiling mutex is only preempted by a higher priority
     if (g_running_task_current->time_quantum_remaining == 0
-            && !g_kernel_critical_section_active
-            && g_kernel_status != EN_KERNEL_IDLE) {
+            && preemptible
+            && g_kernel_status != EN_KERNEL_IDLE
+            && (g_running_task_current->ceiling_locks == 0
+                || g_running_task_next->task_data->u8TaskPrio < g_running_task_current->task_data->u8TaskPrio)) {
+        // starting the next task ends the critical section
         kernel_start_task(&g_priority_group_next, &g_linked_list_task_iterator_next, &g_running_task_next);
     }
-    else if (g_kernel_status == EN_KERNEL_IDLE && status == KERNEL_SUCCESS) {
-        // exit idle
+    else if (g_kernel_status == EN_KERNEL_IDLE
+            && (status == KERNEL_SUCCESS || bitmap_get_first(&g_ready_priorities, &ready_priority) == BITMAP_SUCCESS)) {
+        // exit idle, a delayed task was released or an interrupt made a task ready
         kernel_exit_idle();
     }
     else if (g_running_task_current->time_quantum_remaining > 0) {
@@ -139,6 +190,11 @@ void kernel_update(void) {
         g_running_task_current->time_quantum_remaining--;
     }
 
+    kernel_exit_critical();
+    // ------------------- critical section end ----------------------------
+
+    kernel_cpu_tick();
+    kernel_cpu_isr_exit();
     // inform segger systick interrupt aka kernel_update is about to exit
     SEGGER_SYSVIEW_RECORD_EXIT_ISR();
 }
@@ -189,15 +245,15 @@ void kernel_schedule_task(void) {
     // get tasks psp and prepare for reentry
     psp = g_running_task_current->task_data->u32TaskSP;
     task_set_state(&g_running_task_current, TaskState_Running);
+    // charge the previous task with the cycles since the last switch
+    kernel_cpu_switch(g_running_task_current);
 
 
 
     __set_PSP(psp);
 
-    // check if critical section is still set
-    if (g_kernel_critical_section_active) {
-        kernel_toggle_critical_section();
-    }
+    // a task always resumes outside of a critical section
+    g_kernel_critical_nesting = 0;
 
     // pop R4-R11 from Stack in reverse order
 
@@ -230,9 +286,12 @@ void kernel_schedule_task(void) {
  */
 size_t kernel_swap_task(linked_list_t** priority_group, linked_list_element_t **linked_list_element, task_t **task) {
 
-    // set task to blocked and check for errors
+    // set task to blocked and check for errors, a terminated task stays deleted
     task_t *task_blocked = (*task);
-    size_t status = task_set_state(task, TaskState_Blocked);
+    size_t status = TASK_SUCCESS;
+    if (task_blocked->task_data->eTaskState != TaskState_Deleted) {
+        status = task_set_state(task, TaskState_Blocked);
+    }
     if (status != TASK_SUCCESS) {
         kernel_set_status(EN_KERNEL_ERROR);
         return ERROR_INFO(status, KERNEL_TASK_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
@@ -243,29 +302,31 @@ size_t kernel_swap_task(linked_list_t** priority_group, linked_list_element_t **
             || g_linked_list_task_iterator == NULL
             || g_running_task_next == NULL) {
 
-        // determine next task
+        // determine next task by the highest ready priority group
         linked_list_t *next_priority_group = NULL;
-        do {
-            status = dictionary_get(&g_prioritized_tasks, g_dictionary_priority_next, (void **) &next_priority_group);
-            g_dictionary_priority_next++;
-        } while (next_priority_group->size == 0 && g_dictionary_priority_next < KERNEL_MAX_TASK);
+        size_t next_priority = 0;
+        status = bitmap_get_first(&g_ready_priorities, &next_priority);
+        if (status == BITMAP_SUCCESS) {
+            status = dictionary_get(&g_prioritized_tasks, next_priority, (void **) &next_priority_group);
+        }
 
-        if (next_priority_group->size == 0 && g_dictionary_priority_next == KERNEL_MAX_TASK) {
+        if (status != BITMAP_SUCCESS) {
             // unable to find executable task in any priority, enter idle mode
             kernel_enter_idle();
             // assume next task was set by reinsert
         }
         else {
             // Make sure we are in a critical section
-            if (!g_kernel_critical_section_active) {
-                kernel_toggle_critical_section();
+            if (g_kernel_critical_nesting == 0) {
+                kernel_enter_critical();
             }
 
             // update next task information
-            g_dictionary_priority = g_dictionary_priority_next;
+            g_dictionary_priority = next_priority;
+            g_dictionary_priority_next = next_priority + 1;
             g_priority_group_next = next_priority_group;
             g_linked_list_task_iterator_next = g_priority_group_next->tail;
-            g_running_task_next = (task_t *) g_linked_list_task_iterator_next->data;
+            g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
         }
     }
 
@@ -305,9 +366,11 @@ size_t kernel_start_task(linked_list_t** priority_group, linked_list_element_t *
     }
 
 
-    // set previous task and set it to ready if not blocked
+    // set previous task and set it to ready if neither blocked nor terminated
     g_running_task_previous = g_running_task_current;
-    if (g_running_task_previous != NULL && g_running_task_previous->task_data->eTaskState != TaskState_Blocked) {
+    if (g_running_task_previous != NULL
+            && g_running_task_previous->task_data->eTaskState != TaskState_Blocked
+            && g_running_task_previous->task_data->eTaskState != TaskState_Deleted) {
         status = task_set_state(&g_running_task_previous, TaskState_Ready);
         if (status != TASK_SUCCESS && status != TASK_NO_MEMORY) {
             kernel_set_status(EN_KERNEL_ERROR);
@@ -316,51 +379,6 @@ size_t kernel_start_task(linked_list_t** priority_group, linked_list_element_t *
     }
 
 
-    // implements priority inheritance
-    /*
-     * Inheritance starts with lowest priority group
-     * and all tasks are moved higher at the same time.
-     * To prevent starvation for higher task a cool down is needed,
-     * because there can be more lower prioritized tasks.
-     */
-    static size_t inheritance_cooldown = 0;
-
-    // lower_priority might point to the last used priority group
-    // it needs to be prevented that the new priority group is being moved to a higher priority group by inheritance
-    if (g_task_lower_priority <= g_dictionary_priority) {
-        g_task_lower_priority = g_task_lowest_priority;
-    }
-
-    // move priority groups, if the current priority group is lower
-    if (inheritance_cooldown == 0 && g_task_lower_priority > g_dictionary_priority) {
-
-        // obtain priority group and check for errors
-        linked_list_t *lower_priority_group = NULL;
-        status = dictionary_get(&g_prioritized_tasks, g_task_lower_priority, (void **) &lower_priority_group);
-        if (status != DICTIONARY_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
-        }
-
-        // obtain higher priority group and check for errors
-        g_task_lower_priority--;
-        linked_list_t *higher_priority_group = NULL;
-        status = dictionary_get(&g_prioritized_tasks, g_task_lower_priority, (void **) &higher_priority_group);
-        if (status != DICTIONARY_SUCCESS) {
-            return ERROR_INFO(status, KERNEL_DICTIONARY_ERROR_REGISTER, KERNEL_UNABLE_TO_SCHEDULE_TASK);
-        }
-
-        // check if current priority group was reached and move priority group
-        size_t moved_elements = lower_priority_group->size;
-
-        linked_list_move_linked_list_after(&higher_priority_group, &lower_priority_group);
-
-        if (g_dictionary_priority == g_task_lower_priority) {
-            // reset inheritance and set cool down
-            g_task_lower_priority = g_task_lowest_priority;
-            inheritance_cooldown = moved_elements;
-        }
-    }
-
     // set current task information and preset next task
     g_running_task_current = *task;
     g_linked_list_task_iterator = *linked_list_element;
@@ -374,30 +392,34 @@ size_t kernel_start_task(linked_list_t** priority_group, linked_list_element_t *
             // end of priority group and restart with first element
             g_linked_list_task_iterator_next = g_priority_group_current->tail;
         }
-        g_running_task_next = (task_t *) g_linked_list_task_iterator_next->data;
+        g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
         g_dictionary_priority_next = g_dictionary_priority + 1;
     }
     else if (g_priority_group_current->size == 0) {
-        // jump to next priority group
-        dictionary_get(&g_prioritized_tasks, g_dictionary_priority_next, (void **) &g_priority_group_current);
+        // jump to the highest ready priority group
+        size_t next_priority = g_dictionary_priority_next;
+        bitmap_get_first(&g_ready_priorities, &next_priority);
+        dictionary_get(&g_prioritized_tasks, next_priority, (void **) &g_priority_group_current);
         g_priority_group_next = g_priority_group_current;
         g_linked_list_task_iterator = g_priority_group_current->tail;
-        g_running_task_current = (task_t *) g_linked_list_task_iterator;
-        g_dictionary_priority = g_dictionary_priority_next;
+        g_running_task_current = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator);
+        g_dictionary_priority = next_priority;
     }
     else {
         // end of priority group and restart with first element
         g_linked_list_task_iterator = g_priority_group_current->tail;
-        g_running_task_current = (task_t *) g_linked_list_task_iterator->data;
+        g_running_task_current = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator);
         g_linked_list_task_iterator_next = g_linked_list_task_iterator->next;
-        g_running_task_next = (task_t *) g_linked_list_task_iterator_next->data;
+        g_running_task_next = TASK_FROM_LIST_ELEMENT(g_linked_list_task_iterator_next);
         g_dictionary_priority_next = g_dictionary_priority + 1;
     }
 
     // ------------------- critical section end ----------------------------
     SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk; // set PendSV-Flag
 
-    kernel_enable_interrupts();
+    // PendSV is served once unmasked, a blocked task leaves all its critical sections
+    g_kernel_critical_nesting = 0;
+    kernel_unmask_interrupts();
 
     return KERNEL_SUCCESS;
 }
@@ -470,10 +492,10 @@ void kernel_set_system_functions(void) {
     SCB->VTOR = (uint32_t) vector_table;
 
     // lower number means higher interrupt priority
-    // change priority if necessary
-    NVIC_SetPriority(PendSV_IRQn, 0xFF);
+    // the kernel interrupts are masked by BASEPRI, interrupts above KERNEL_MAX_SYSCALL_PRIORITY never are
+    NVIC_SetPriority(PendSV_IRQn, KERNEL_INTERRUPT_PRIORITY);
     // ensures same priority and makes use of interrupt tail chaining
-    NVIC_SetPriority(SysTick_IRQn, 0);
+    NVIC_SetPriority(SysTick_IRQn, KERNEL_INTERRUPT_PRIORITY);
 
     // replace functions and update memory
     __NVIC_SetVector(PendSV_IRQn, (uint32_t) kernel_schedule_task);
@@ -481,6 +503,32 @@ void kernel_set_system_functions(void) {
     __DSB();
     __ISB();
 
+    // count core cycles to measure the latency of deferred work and the cpu time
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if KERNEL_TICKLESS_IDLE
+    // clock LPTIM1 by LSI, which keeps running while the system tick is suppressed
+    RCC->CSR |= RCC_CSR_LSION;
+    while ((RCC->CSR & RCC_CSR_LSIRDY) == 0);
+    RCC->CCIPR = (RCC->CCIPR & ~RCC_CCIPR_LPTIM1SEL) | RCC_CCIPR_LPTIM1SEL_0;
+    RCC->APB1ENR1 |= RCC_APB1ENR1_LPTIM1EN;
+
+    // prescaler and interrupts can only be configured while LPTIM1 is disabled
+    LPTIM1->CR = 0;
+    LPTIM1->CFGR = LPTIM_CFGR_PRESC_2 | LPTIM_CFGR_PRESC_0;
+    LPTIM1->IER = LPTIM_IER_ARRMIE;
+
+    NVIC_SetPriority(LPTIM1_IRQn, 0);
+    __NVIC_SetVector(LPTIM1_IRQn, (uint32_t) kernel_tickless_timer_handler);
+    NVIC_EnableIRQ(LPTIM1_IRQn);
+
+    if (tickless_create(&g_tickless, &g_tickless_timer, KERNEL_TICKLESS_MINIMUM_TICKS) != TICKLESS_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+    }
+#endif
+
     kernel_enable_interrupts();
 }
 
@@ -502,6 +550,27 @@ size_t kernel_get_tick(void) {
     return HAL_GetTick();
 }
 
+/**
+ * @brief Returns the core cycles counted by the DWT, which wrap after 2^32 cycles.
+ *        Cycles, in which a sleep gates the core clock, are not counted and are missing in idle.
+ * @return current cycle count
+ * */
+size_t kernel_get_cycles(void) {
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Returns the amount of ticks, which were suppressed by tickless idle.
+ * @return suppressed ticks or 0 if tickless idle is disabled
+ * */
+size_t kernel_get_skipped_ticks(void) {
+    size_t skipped_ticks = 0;
+#if KERNEL_TICKLESS_IDLE
+    tickless_get_skipped_ticks(&g_tickless, &skipped_ticks);
+#endif
+    return skipped_ticks;
+}
+
 /**
  * @brief Enters idle state.
  * @return None
@@ -511,12 +580,35 @@ void kernel_enter_idle(void) {
     // set kernel to idle state to active block in debug session
     kernel_set_status(EN_KERNEL_IDLE);
     SEGGER_SYSVIEW_TASK_SYSTEM_IDLE();
+    kernel_cpu_enter_idle();
 
     // critical section cannot be active when idle
-    if (g_kernel_critical_section_active) {
-        kernel_toggle_critical_section();
+    g_kernel_critical_nesting = 0;
+    kernel_unmask_interrupts();
+
+    // no task is ready, so terminated tasks are freed now
+    if (kernel_reap_terminated_tasks() != KERNEL_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
     }
 
+#if KERNEL_TICKLESS_IDLE
+    // sleep without tick until the next timeout is due
+    // pending interrupts end the sleep and are handled once interrupts are enabled again
+    size_t elapsed_ticks = 0;
+    while (g_kernel_status == EN_KERNEL_IDLE) {
+        kernel_disable_interrupts();
+        size_t status = tickless_idle(&g_tickless, &g_timer_wheel, &elapsed_ticks);
+        kernel_enable_interrupts();
+
+        if (status == TICKLESS_IDLE_TOO_SHORT) {
+            // sleep until the next tick
+            HAL_PWR_EnterSLEEPMode(PWR_LOWPOWERREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+        }
+        else if (status != TICKLESS_SUCCESS) {
+            kernel_set_status(EN_KERNEL_ERROR);
+        }
+    }
+#else
     // Make sure interrupts are enabled to be able to recover from idle
     kernel_enable_interrupts();
 
@@ -530,6 +622,7 @@ void kernel_enter_idle(void) {
 
     // catch kernel in idle
     while (g_kernel_status == EN_KERNEL_IDLE);
+#endif
 }
 
 /**
@@ -563,6 +656,44 @@ void kernel_enable_interrupts(void) {
     __enable_irq();
 }
 
+/**
+ * @brief Masks every interrupt with a priority at or below KERNEL_MAX_SYSCALL_PRIORITY.
+ * @return None
+ * */
+void kernel_mask_interrupts(void) {
+    __set_BASEPRI(KERNEL_BASEPRI);
+    __DSB();
+    __ISB();
+}
+
+/**
+ * @brief Unmasks all interrupts masked by kernel_mask_interrupts.
+ * @return None
+ * */
+void kernel_unmask_interrupts(void) {
+    __set_BASEPRI(0);
+    __ISB();
+}
+
+/**
+ * @brief Halts an interrupt, whose priority is never masked by BASEPRI, so it must not call the kernel.
+ *        All priority bits are preemption bits, so the NVIC priority is compared as it is.
+ * @return None
+ * */
+void kernel_validate_interrupt_priority(void) {
+    // exceptions below 16 are system exceptions, which are either the kernel itself or faults
+    uint32_t exception = __get_IPSR();
+    if (exception < 16u) {
+        return;
+    }
+
+    if (NVIC_GetPriority((IRQn_Type) (exception - 16u)) < KERNEL_MAX_SYSCALL_PRIORITY) {
+        // the interrupt can corrupt any critical section, catch it in the debug session
+        __disable_irq();
+        while (1);
+    }
+}
+
 /**
  * @brief Terminates tasks by moving the task to a terminated task list.
  * @return None
@@ -575,10 +706,21 @@ void kernel_task_terminate(void) {
 
     __asm volatile ("SUB SP, SP, #8");
 
+    // the terminated task leaves the critical section on the switch
+    kernel_enter_critical();
+
     size_t status = linked_list_transfer(&g_terminated_tasks_list, &g_priority_group_current, &g_linked_list_task_iterator);
     if (status != LINKED_LIST_SUCCESS) {
         kernel_set_status(EN_KERNEL_ERROR);
     }
+    // the idle loop frees the task, once it was switched out
+    task_set_state(&g_running_task_current, TaskState_Deleted);
+
+    // the priority group might not be runnable anymore
+    status = kernel_update_ready_priority(g_running_task_current->task_data->u8TaskPrio);
+    if (status != KERNEL_SUCCESS) {
+        kernel_set_status(EN_KERNEL_ERROR);
+    }
 
     // check if all tasks terminated
     if (g_available_tasks==g_terminated_tasks_list->size) {
@@ -594,6 +736,15 @@ void kernel_task_terminate(void) {
     while (true);
 }
 
+/**
+ * @brief The initial stack frame of a task is prepared by task_create, so no context is kept per task id.
+ * @param task_id is uint8_t of the reaped task
+ * @return None
+ * */
+void kernel_reset_task_context(uint8_t task_id) {
+    (void) task_id;
+}
+
 /**
  * @briefs System is going to be turned off.
  * @return None
@@ -601,3 +752,88 @@ void kernel_task_terminate(void) {
 void kernel_shutdown(void) {
     HAL_PWREx_EnterSHUTDOWNMode();
 }
+
+#if KERNEL_TICKLESS_IDLE
+/**
+ * @brief Suppresses the system tick and starts LPTIM1 as one shot wakeup.
+ * @param ticks is size_t, which is the amount of ticks until the wakeup.
+ * @return programmed ticks, limited by the 16 bit counter
+ * */
+static size_t kernel_tickless_timer_start(size_t ticks) {
+    if (ticks > KERNEL_TICKLESS_TIMER_MAX_TICKS) {
+        ticks = KERNEL_TICKLESS_TIMER_MAX_TICKS;
+    }
+    g_tickless_programmed_ticks = ticks;
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    // the auto reload register can only be written while LPTIM1 is enabled
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+    LPTIM1->ICR = LPTIM_ICR_ARRMCF | LPTIM_ICR_ARROKCF;
+    LPTIM1->ARR = (uint32_t) ticks;
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0);
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+    LPTIM1->CR |= LPTIM_CR_SNGSTRT;
+
+    return ticks;
+}
+
+/**
+ * @brief Puts the core to sleep until the wakeup or any other interrupt.
+ * @return None
+ * */
+static void kernel_tickless_timer_sleep(void) {
+    // when in debug session it can lead to unexpected behavior after sleep
+#ifndef DEBUG
+    HAL_PWR_EnterSLEEPMode(PWR_LOWPOWERREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+#endif
+}
+
+/**
+ * @brief Stops LPTIM1 and resumes the system tick.
+ * @return elapsed ticks since kernel_tickless_timer_start
+ * */
+static size_t kernel_tickless_timer_stop(void) {
+    size_t elapsed_ticks = 0;
+
+    if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0) {
+        // wakeup by LPTIM1
+        elapsed_ticks = g_tickless_programmed_ticks;
+    }
+    else {
+        // woken up early, the counter is asynchronous and needs two equal reads
+        uint32_t counter = 0;
+        do {
+            counter = LPTIM1->CNT;
+        } while (counter != LPTIM1->CNT);
+        elapsed_ticks = counter;
+    }
+
+    LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+    LPTIM1->CR = 0;
+    NVIC_ClearPendingIRQ(LPTIM1_IRQn);
+
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    return elapsed_ticks;
+}
+
+/**
+ * @brief Credits suppressed ticks to the HAL tick.
+ * @param ticks is size_t, which is the amount of suppressed ticks.
+ * @return None
+ * */
+static void kernel_tickless_timer_increment_tick(size_t ticks) {
+    // equals calling HAL_IncTick for every suppressed tick
+    uwTick += (uint32_t) ticks * (uint32_t) uwTickFreq;
+}
+
+/**
+ * @brief Acknowledges the LPTIM1 wakeup, the elapsed ticks are handled by kernel_tickless_timer_stop.
+ * @return None
+ * */
+static void kernel_tickless_timer_handler(void) {
+    LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+}
+#endif
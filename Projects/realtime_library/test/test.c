@@ -1,23 +1,61 @@
 #include <string.h>
 #include <criterion/criterion.h>
+#include <criterion/logging.h>
 #include "utils/queue.h"
 #include "utils/dictionary.h"
+#include "utils/handle_table.h"
 #include "utils/linked_list.h"
+#include "utils/bitmap.h"
+#include "utils/timer_wheel.h"
+#include "utils/work_queue.h"
+#include "utils/tlsf.h"
 #include "kernel/task.h"
 #include "kernel/kernel.h"
+#include "kernel/tickless.h"
+#include "kernel/software_timer.h"
 #include <pthread.h>
 #include <stdio.h>
 #include <stdbool.h>
 #include <unistd.h>
+#include <time.h>
+#include <signal.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 
 #define GET_FUNCTION_NAME(x) (#x)
 
 #define SKIP_TEST_QUEUE         0
 #define SKIP_TEST_DICTIONARY    0
+#define SKIP_TEST_HANDLE_TABLE  0
 #define SKIP_TEST_LINKED_LIST   0
 #define SKIP_TEST_QUEUE         0
 #define SKIP_TEST_KERNEL        0
+#define SKIP_TEST_BITMAP        0
+#define SKIP_TEST_TICKLESS      0
+#define SKIP_TEST_TIMER_WHEEL   0
+#define SKIP_TEST_SOFTWARE_TIMER 0
+#define SKIP_TEST_WORK_QUEUE    0
+#define SKIP_TEST_TLSF          0
+#define SKIP_TEST_BENCHMARK     0
+
+#define BENCHMARK_ITERATIONS    1000000
+
+static uint64_t benchmark_get_time_ns(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec;
+}
+
+static uint64_t benchmark_get_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    // without a cycle counter the time in ns is reported
+    return benchmark_get_time_ns();
+#endif
+}
 
 Test(queue, null_operations, .disabled = SKIP_TEST_QUEUE) {
     int i = 42;
@@ -185,6 +223,76 @@ Test(dictionary, iteration, .disabled = SKIP_TEST_DICTIONARY) {
 
 }
 
+Test(handle_table, null_operations, .disabled = SKIP_TEST_HANDLE_TABLE) {
+    handle_table_t *handle_table = NULL;
+    size_t handle = 0;
+    void *value = NULL;
+
+    size_t status = handle_table_reserve(&handle_table, &handle);
+    cr_expect_eq(status, HANDLE_TABLE_IS_NULL, "handle table shall be uninitialized on %s: %zu", GET_FUNCTION_NAME(handle_table_reserve), status);
+
+    status = handle_table_get(&handle_table, 0, &value);
+    cr_expect_eq(status, HANDLE_TABLE_IS_NULL, "handle table shall be uninitialized on %s: %zu", GET_FUNCTION_NAME(handle_table_get), status);
+
+    status = handle_table_release(&handle_table, 0);
+    cr_expect_eq(status, HANDLE_TABLE_IS_NULL, "handle table shall be uninitialized on %s: %zu", GET_FUNCTION_NAME(handle_table_release), status);
+
+    status = handle_table_delete(&handle_table);
+    cr_expect_eq(status, HANDLE_TABLE_IS_NULL, "handle table shall be uninitialized on %s: %zu", GET_FUNCTION_NAME(handle_table_delete), status);
+
+    status = handle_table_create(&handle_table, 4, 2);
+    cr_expect_eq(status, HANDLE_TABLE_INVALID_SIZE, "expected a maximum below the size to be rejected: %zu", status);
+}
+
+Test(handle_table, reuse_and_stale_handles, .disabled = SKIP_TEST_HANDLE_TABLE) {
+    handle_table_t *handle_table = NULL;
+    int values[4] = { 0, 1, 2, 3 };
+    size_t handles[4] = { 0 };
+    void *value = NULL;
+
+    size_t status = handle_table_create(&handle_table, 2, 4);
+    cr_assert_eq(status, HANDLE_TABLE_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(handle_table_create), status);
+
+    // the table grows from 2 to 4 slots, the first handles are the slot indices
+    for (size_t i = 0; i < 4; i++) {
+        status = handle_table_reserve(&handle_table, &handles[i]);
+        status |= handle_table_set(&handle_table, handles[i], &values[i]);
+        cr_expect_eq(status, HANDLE_TABLE_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(handle_table_reserve), status);
+        cr_expect_eq(handles[i], i, "expected the slot index as first handle: %zu", handles[i]);
+    }
+    cr_expect_eq(handle_table->size, 4, "expected the table to grow: %zu", handle_table->size);
+
+    size_t handle = 0;
+    status = handle_table_reserve(&handle_table, &handle);
+    cr_expect_eq(status, HANDLE_TABLE_FULL, "expected the table to be full: %zu", status);
+    cr_expect_eq(handle, HANDLE_TABLE_INVALID_HANDLE, "expected an invalid handle: %zu", handle);
+
+    for (size_t i = 0; i < 4; i++) {
+        cr_expect_eq(handle_table_lookup(handle_table, handles[i]), &values[i], "expected the stored value for handle %zu", handles[i]);
+    }
+
+    // a released slot is reused by a new generation, the old handle stays stale
+    status = handle_table_release(&handle_table, handles[1]);
+    cr_expect_eq(status, HANDLE_TABLE_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(handle_table_release), status);
+    status = handle_table_release(&handle_table, handles[1]);
+    cr_expect_eq(status, HANDLE_TABLE_STALE_HANDLE, "expected a second release to be rejected: %zu", status);
+
+    status = handle_table_reserve(&handle_table, &handle);
+    status |= handle_table_set(&handle_table, handle, &values[0]);
+    cr_expect_eq(status, HANDLE_TABLE_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(handle_table_reserve), status);
+    cr_expect_eq(HANDLE_TABLE_INDEX(handle), HANDLE_TABLE_INDEX(handles[1]), "expected the released slot to be reused");
+    cr_expect_neq(handle, handles[1], "expected a new handle for the reused slot");
+
+    status = handle_table_get(&handle_table, handles[1], &value);
+    cr_expect_eq(status, HANDLE_TABLE_STALE_HANDLE, "expected the old handle to be stale: %zu", status);
+    cr_expect_null(value, "expected no value for a stale handle");
+    cr_expect_null(handle_table_lookup(handle_table, HANDLE_TABLE_INVALID_HANDLE), "expected no value for the invalid handle");
+    cr_expect_eq(handle_table_lookup(handle_table, handle), &values[0], "expected the new value for the new handle");
+
+    status = handle_table_delete(&handle_table);
+    cr_expect_eq(status, HANDLE_TABLE_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(handle_table_delete), status);
+}
+
 Test(linked_list, null_operations, .disabled = SKIP_TEST_LINKED_LIST) {
     linked_list_t *linked_list = NULL;
     linked_list_element_t *linked_list_element = NULL;
@@ -486,4 +594,3328 @@ Test(linked_list, specified_element, .disabled = SKIP_TEST_LINKED_LIST) {
 
     status = linked_list_delete(&linked_list);
     cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_delete), status);
-}
\ No newline at end of file
+}
+
+typedef struct {
+    int value;
+    linked_list_element_t element;
+} linked_list_item_t;
+
+Test(linked_list, intrusive, .disabled = SKIP_TEST_LINKED_LIST) {
+    linked_list_t *linked_list_destination = NULL;
+    linked_list_t *linked_list_source = NULL;
+    linked_list_item_t items[3] = {{1}, {2}, {3}};
+
+    int status = linked_list_create_intrusive(&linked_list_destination);
+    cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_create_intrusive), status);
+
+    status = linked_list_create_intrusive(&linked_list_source);
+    cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_create_intrusive), status);
+
+    // intrusive lists cannot allocate elements
+    int a = 42;
+    int *b = &a;
+    status = linked_list_push_front(&linked_list_source, (void **) &b);
+    cr_expect_eq(status, LINKED_LIST_IS_INTRUSIVE, "expected intrusive list on %s: %i", GET_FUNCTION_NAME(linked_list_push_front), status);
+
+    for (int i = 0; i < 3; i++) {
+        status = linked_list_element_init(&items[i].element, &items[i]);
+        cr_expect_eq(status, LINKED_LIST_ELEMENT_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_element_init), status);
+        status = linked_list_push_front_element(&linked_list_source, &items[i].element);
+        cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_push_front_element), status);
+    }
+
+    // the tail is the first pushed element
+    linked_list_item_t *item = LINKED_LIST_CONTAINER_OF(linked_list_source->tail, linked_list_item_t, element);
+    cr_expect_eq(item, &items[0], "expected first item at the tail: %p==%p", (void *) item, (void *) &items[0]);
+
+    linked_list_element_t *element = &items[1].element;
+    status = linked_list_transfer(&linked_list_destination, &linked_list_source, &element);
+    cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_transfer), status);
+    item = LINKED_LIST_CONTAINER_OF(linked_list_destination->head, linked_list_item_t, element);
+    cr_expect_eq(item->value, 2, "expected transferred item: %i==%i", item->value, 2);
+
+    linked_list_item_t *popped = NULL;
+    status = linked_list_pop_back(&linked_list_source, (void **) &popped);
+    cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_pop_back), status);
+    cr_expect_eq(popped, &items[0], "expected popped item: %p==%p", (void *) popped, (void *) &items[0]);
+    cr_expect_null(items[0].element.next, "expected popped element to be unlinked");
+
+    // deleting only unlinks the embedded elements
+    status = linked_list_delete(&linked_list_source);
+    cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_delete), status);
+    status = linked_list_delete(&linked_list_destination);
+    cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_delete), status);
+    cr_expect_null(items[1].element.previous, "expected deleted element to be unlinked");
+
+    // allocated elements cannot be mixed with embedded ones
+    linked_list_t *linked_list = NULL;
+    linked_list_create(&linked_list);
+    status = linked_list_push_front_element(&linked_list, &items[0].element);
+    cr_expect_eq(status, LINKED_LIST_NOT_INTRUSIVE, "expected allocating list on %s: %i", GET_FUNCTION_NAME(linked_list_push_front_element), status);
+    linked_list_delete(&linked_list);
+}
+
+
+Test(bitmap, null_operations, .disabled = SKIP_TEST_BITMAP) {
+    bitmap_t *bitmap = NULL;
+    size_t index = 0;
+
+    int status = bitmap_set(&bitmap, 0);
+    cr_expect_eq(status, BITMAP_NO_MEMORY, "bitmap shall be uninitialized on %s: %i", GET_FUNCTION_NAME(bitmap_set), status);
+    status = bitmap_clear(&bitmap, 0);
+    cr_expect_eq(status, BITMAP_NO_MEMORY, "bitmap shall be uninitialized on %s: %i", GET_FUNCTION_NAME(bitmap_clear), status);
+    status = bitmap_get_first(&bitmap, &index);
+    cr_expect_eq(status, BITMAP_NO_MEMORY, "bitmap shall be uninitialized on %s: %i", GET_FUNCTION_NAME(bitmap_get_first), status);
+    status = bitmap_delete(&bitmap);
+    cr_expect_eq(status, BITMAP_NO_MEMORY, "bitmap shall be uninitialized on %s: %i", GET_FUNCTION_NAME(bitmap_delete), status);
+
+    status = bitmap_create(&bitmap, 0);
+    cr_expect_eq(status, BITMAP_OVERFLOW, "bitmap shall not be created on %s: %i", GET_FUNCTION_NAME(bitmap_create), status);
+    status = bitmap_create(&bitmap, BITMAP_MAX_SIZE + 1);
+    cr_expect_eq(status, BITMAP_OVERFLOW, "bitmap shall not be created on %s: %i", GET_FUNCTION_NAME(bitmap_create), status);
+
+    status = bitmap_create(&bitmap, 4);
+    cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_create), status);
+    status = bitmap_set(&bitmap, 4);
+    cr_expect_eq(status, BITMAP_OVERFLOW, "index shall be out of bounds on %s: %i", GET_FUNCTION_NAME(bitmap_set), status);
+    status = bitmap_get_first(&bitmap, &index);
+    cr_expect_eq(status, BITMAP_IS_EMPTY, "bitmap shall be empty on %s: %i", GET_FUNCTION_NAME(bitmap_get_first), status);
+
+    free(bitmap->words);
+    bitmap->words = NULL;
+
+    status = bitmap_set(&bitmap, 0);
+    cr_expect_eq(status, BITMAP_DATA_NO_MEMORY, "bitmap shall be uninitialized on %s: %i", GET_FUNCTION_NAME(bitmap_set), status);
+    status = bitmap_delete(&bitmap);
+    cr_expect_eq(status, BITMAP_DATA_NO_MEMORY, "bitmap shall be uninitialized on %s: %i", GET_FUNCTION_NAME(bitmap_delete), status);
+
+    free(bitmap);
+}
+
+Test(bitmap, get_first, .disabled = SKIP_TEST_BITMAP) {
+    bitmap_t *bitmap = NULL;
+    size_t size = BITMAP_MAX_SIZE;
+    size_t index = 0;
+    bool is_set = false;
+
+    int status = bitmap_create(&bitmap, size);
+    cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_create), status);
+
+    // set bits from the highest to the lowest index, the lowest set index shall always be found
+    for (size_t i = size; i > 0; i--) {
+        status = bitmap_set(&bitmap, i - 1);
+        cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_set), status);
+        status = bitmap_get_first(&bitmap, &index);
+        cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_get_first), status);
+        cr_expect_eq(index, i - 1, "expected lowest set index: %zu==%zu", index, i - 1);
+    }
+
+    // clear bits from the lowest to the highest index
+    for (size_t i = 0; i < size - 1; i++) {
+        status = bitmap_clear(&bitmap, i);
+        cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_clear), status);
+        status = bitmap_is_set(&bitmap, i, &is_set);
+        cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_is_set), status);
+        cr_expect_eq(is_set, false, "expected cleared bit at %zu", i);
+        status = bitmap_get_first(&bitmap, &index);
+        cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_get_first), status);
+        cr_expect_eq(index, i + 1, "expected lowest set index: %zu==%zu", index, i + 1);
+    }
+
+    status = bitmap_clear(&bitmap, size - 1);
+    cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_clear), status);
+    status = bitmap_get_first(&bitmap, &index);
+    cr_expect_eq(status, BITMAP_IS_EMPTY, "bitmap shall be empty on %s: %i", GET_FUNCTION_NAME(bitmap_get_first), status);
+
+    status = bitmap_delete(&bitmap);
+    cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_delete), status);
+}
+
+Test(benchmark, ready_priority_lookup, .disabled = SKIP_TEST_BENCHMARK) {
+    // worst case for the scheduler: only the lowest priority group is runnable
+    size_t priorities[] = {2, 4, 8, 16, 32, 64};
+    bitmap_t *bitmap = NULL;
+    dictionary_t *dictionary = NULL;
+    linked_list_t *priority_group = NULL;
+    int a = 42;
+    int *b = &a;
+
+    for (size_t p = 0; p < sizeof(priorities) / sizeof(priorities[0]); p++) {
+        size_t lowest_priority = priorities[p] - 1;
+
+        int status = bitmap_create(&bitmap, KERNEL_MAX_TASK);
+        cr_expect_eq(status, BITMAP_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(bitmap_create), status);
+        status = dictionary_create(&dictionary, KERNEL_MAX_TASK);
+        cr_expect_eq(status, DICTIONARY_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(dictionary_create), status);
+
+        for (size_t priority = 0; priority < KERNEL_MAX_TASK; priority++) {
+            status = linked_list_create(&priority_group);
+            cr_expect_eq(status, LINKED_LIST_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(linked_list_create), status);
+            if (priority == lowest_priority) {
+                linked_list_push_front(&priority_group, (void **) &b);
+            }
+            dictionary_add(&dictionary, priority, (void **) &priority_group);
+        }
+        bitmap_set(&bitmap, lowest_priority);
+
+        // previous lookup by scanning every priority group
+        volatile size_t found = 0;
+        uint64_t start = benchmark_get_time_ns();
+        for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            size_t priority = 0;
+            do {
+                dictionary_get(&dictionary, priority, (void **) &priority_group);
+                priority++;
+            } while (priority_group->size == 0 && priority < KERNEL_MAX_TASK);
+            found = priority - 1;
+        }
+        uint64_t scan_time = benchmark_get_time_ns() - start;
+        cr_expect_eq(found, lowest_priority, "expected lowest priority: %zu==%zu", (size_t) found, lowest_priority);
+
+        // lookup by the ready priorities
+        start = benchmark_get_time_ns();
+        for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            size_t priority = 0;
+            bitmap_get_first(&bitmap, &priority);
+            found = priority;
+        }
+        uint64_t bitmap_time = benchmark_get_time_ns() - start;
+        cr_expect_eq(found, lowest_priority, "expected lowest priority: %zu==%zu", (size_t) found, lowest_priority);
+
+        cr_log_info("%2zu priorities: scan %6.2f ns, bitmap %6.2f ns per lookup", priorities[p],
+                (double) scan_time / BENCHMARK_ITERATIONS, (double) bitmap_time / BENCHMARK_ITERATIONS);
+
+        for (size_t priority = 0; priority < KERNEL_MAX_TASK; priority++) {
+            dictionary_get(&dictionary, priority, (void **) &priority_group);
+            linked_list_delete(&priority_group);
+        }
+        dictionary_delete(&dictionary);
+        bitmap_delete(&bitmap);
+    }
+}
+
+
+// virtual clock, which replaces the port layer timer for tickless idle
+static size_t virtual_clock_now = 0;
+static size_t virtual_clock_start = 0;
+static size_t virtual_clock_wakeup = 0;
+static size_t virtual_clock_interrupt = SIZE_MAX;
+static size_t virtual_clock_tick = 0;
+static size_t virtual_clock_max_ticks = SIZE_MAX;
+
+static size_t virtual_clock_timer_start(size_t ticks) {
+    if (ticks > virtual_clock_max_ticks) {
+        ticks = virtual_clock_max_ticks;
+    }
+    virtual_clock_start = virtual_clock_now;
+    virtual_clock_wakeup = virtual_clock_now + ticks;
+    return ticks;
+}
+
+static void virtual_clock_timer_sleep(void) {
+    // wake up by the timer or by an earlier interrupt
+    virtual_clock_now = virtual_clock_wakeup < virtual_clock_interrupt ? virtual_clock_wakeup : virtual_clock_interrupt;
+}
+
+static size_t virtual_clock_timer_stop(void) {
+    return virtual_clock_now - virtual_clock_start;
+}
+
+static void virtual_clock_timer_increment_tick(size_t ticks) {
+    virtual_clock_tick += ticks;
+}
+
+static const tickless_timer_t virtual_clock_timer = {
+    .start = virtual_clock_timer_start,
+    .sleep = virtual_clock_timer_sleep,
+    .stop = virtual_clock_timer_stop,
+    .increment_tick = virtual_clock_timer_increment_tick,
+};
+
+static void virtual_clock_reset(size_t interrupt, size_t max_ticks) {
+    virtual_clock_now = 0;
+    virtual_clock_start = 0;
+    virtual_clock_wakeup = 0;
+    virtual_clock_interrupt = interrupt;
+    virtual_clock_tick = 0;
+    virtual_clock_max_ticks = max_ticks;
+}
+
+Test(tickless, null_operations, .disabled = SKIP_TEST_TICKLESS) {
+    tickless_t *tickless = NULL;
+    timer_wheel_t *timer_wheel = NULL;
+    size_t ticks = 0;
+    tickless_timer_t timer = virtual_clock_timer;
+
+    int status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_eq(status, TICKLESS_NO_MEMORY, "tickless shall be uninitialized on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+    status = tickless_delete(&tickless);
+    cr_expect_eq(status, TICKLESS_NO_MEMORY, "tickless shall be uninitialized on %s: %i", GET_FUNCTION_NAME(tickless_delete), status);
+
+    timer.sleep = NULL;
+    status = tickless_create(&tickless, &timer, 2);
+    cr_expect_eq(status, TICKLESS_NO_TIMER, "tickless shall require a complete timer on %s: %i", GET_FUNCTION_NAME(tickless_create), status);
+
+    status = tickless_create(&tickless, &virtual_clock_timer, 2);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_create), status);
+    status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_neq(status, TICKLESS_SUCCESS, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+
+    status = tickless_delete(&tickless);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_delete), status);
+}
+
+Test(tickless, virtual_clock, .disabled = SKIP_TEST_TICKLESS) {
+    tickless_t *tickless = NULL;
+    timer_wheel_t *timer_wheel = NULL;
+    timer_wheel_node_t *expired = NULL;
+    size_t ticks = 0;
+    size_t skipped_ticks = 0;
+
+    int status = tickless_create(&tickless, &virtual_clock_timer, 2);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_create), status);
+    status = timer_wheel_create(&timer_wheel);
+    cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_create), status);
+
+    // three timeouts due on tick 11, 17 and 17
+    timer_wheel_node_t nodes[3];
+    size_t timeouts[3] = {11, 17, 17};
+    for (size_t i = 0; i < 3; i++) {
+        timer_wheel_node_init(&nodes[i], NULL);
+        status = timer_wheel_insert(&timer_wheel, &nodes[i], timeouts[i]);
+        cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_insert), status);
+    }
+
+    // sleep until the first timeout is due
+    virtual_clock_reset(SIZE_MAX, SIZE_MAX);
+    status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+    cr_expect_eq(ticks, 10, "expected suppressed ticks until the first timeout: %zu==10", ticks);
+    cr_expect_eq(virtual_clock_tick, 10, "expected credited system ticks: %zu==10", virtual_clock_tick);
+    cr_expect_eq(timer_wheel->now, 10, "expected credited timing wheel: %zu==10", timer_wheel->now);
+
+    // a due timeout is released by the next tick, which shall not be suppressed
+    status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_eq(status, TICKLESS_IDLE_TOO_SHORT, "expected no sleep on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+    timer_wheel_tick(&timer_wheel, &expired);
+    cr_expect_eq(expired, &nodes[0], "expected the first timeout to expire");
+    cr_expect_null(expired->next, "expected a single expired timeout");
+
+    // an interrupt wakes up early and only the elapsed ticks are credited
+    virtual_clock_reset(3, SIZE_MAX);
+    status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+    cr_expect_eq(ticks, 3, "expected suppressed ticks until the interrupt: %zu==3", ticks);
+    cr_expect_eq(virtual_clock_tick, 3, "expected credited system ticks: %zu==3", virtual_clock_tick);
+    cr_expect_eq(timer_wheel->now, 14, "expected credited timing wheel: %zu==14", timer_wheel->now);
+
+    // the timer range is limited and the remaining ticks are handled by the next idle
+    virtual_clock_reset(SIZE_MAX, 1);
+    status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+    cr_expect_eq(ticks, 1, "expected suppressed ticks limited by the timer: %zu==1", ticks);
+    cr_expect_eq(timer_wheel->now, 15, "expected credited timing wheel: %zu==15", timer_wheel->now);
+
+    status = tickless_get_skipped_ticks(&tickless, &skipped_ticks);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_get_skipped_ticks), status);
+    cr_expect_eq(skipped_ticks, 14, "expected total suppressed ticks: %zu==14", skipped_ticks);
+
+    // both remaining timeouts expire on the same tick
+    timer_wheel_tick(&timer_wheel, &expired);
+    cr_expect_null(expired, "expected no expired timeout before tick 17");
+    timer_wheel_tick(&timer_wheel, &expired);
+    size_t expired_nodes = 0;
+    for (; expired != NULL; expired = expired->next) {
+        expired_nodes++;
+    }
+    cr_expect_eq(expired_nodes, 2, "expected a batch of expired timeouts: %zu==2", expired_nodes);
+
+    // without timeouts the timer sleeps as long as possible
+    virtual_clock_reset(SIZE_MAX, 1000);
+    status = tickless_idle(&tickless, &timer_wheel, &ticks);
+    cr_expect_eq(status, TICKLESS_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(tickless_idle), status);
+    cr_expect_eq(ticks, 1000, "expected suppressed ticks limited by the timer: %zu==1000", ticks);
+
+    timer_wheel_delete(&timer_wheel);
+    tickless_delete(&tickless);
+}
+
+Test(timer_wheel, null_operations, .disabled = SKIP_TEST_TIMER_WHEEL) {
+    timer_wheel_t *timer_wheel = NULL;
+    timer_wheel_node_t node;
+    timer_wheel_node_t *expired = NULL;
+    size_t ticks = 0;
+
+    int status = timer_wheel_delete(&timer_wheel);
+    cr_expect_eq(status, TIMER_WHEEL_NO_MEMORY, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_delete), status);
+    status = timer_wheel_insert(&timer_wheel, &node, 1);
+    cr_expect_eq(status, TIMER_WHEEL_NO_MEMORY, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_insert), status);
+    status = timer_wheel_cancel(&timer_wheel, &node);
+    cr_expect_eq(status, TIMER_WHEEL_NO_MEMORY, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_cancel), status);
+    status = timer_wheel_tick(&timer_wheel, &expired);
+    cr_expect_eq(status, TIMER_WHEEL_NO_MEMORY, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_tick), status);
+    status = timer_wheel_get_idle_ticks(&timer_wheel, &ticks);
+    cr_expect_eq(status, TIMER_WHEEL_NO_MEMORY, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_get_idle_ticks), status);
+    status = timer_wheel_skip(&timer_wheel, 1);
+    cr_expect_eq(status, TIMER_WHEEL_NO_MEMORY, "timing wheel shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_skip), status);
+    status = timer_wheel_node_init(NULL, NULL);
+    cr_expect_eq(status, TIMER_WHEEL_NODE_IS_NULL, "node shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_node_init), status);
+
+    status = timer_wheel_create(&timer_wheel);
+    cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_create), status);
+    status = timer_wheel_insert(&timer_wheel, NULL, 1);
+    cr_expect_eq(status, TIMER_WHEEL_NODE_IS_NULL, "node shall be uninitialized on %s: %i", GET_FUNCTION_NAME(timer_wheel_insert), status);
+    status = timer_wheel_get_idle_ticks(&timer_wheel, &ticks);
+    cr_expect_eq(status, TIMER_WHEEL_IS_EMPTY, "timing wheel shall be empty on %s: %i", GET_FUNCTION_NAME(timer_wheel_get_idle_ticks), status);
+
+    timer_wheel_node_init(&node, NULL);
+    status = timer_wheel_cancel(&timer_wheel, &node);
+    cr_expect_eq(status, TIMER_WHEEL_NODE_IS_INACTIVE, "node shall be inactive on %s: %i", GET_FUNCTION_NAME(timer_wheel_cancel), status);
+    status = timer_wheel_insert(&timer_wheel, &node, 5);
+    cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_insert), status);
+    status = timer_wheel_insert(&timer_wheel, &node, 5);
+    cr_expect_eq(status, TIMER_WHEEL_NODE_IS_ACTIVE, "node shall be active on %s: %i", GET_FUNCTION_NAME(timer_wheel_insert), status);
+    status = timer_wheel_skip(&timer_wheel, 5);
+    cr_expect_eq(status, TIMER_WHEEL_OVERFLOW, "expected a skipped timeout on %s: %i", GET_FUNCTION_NAME(timer_wheel_skip), status);
+
+    status = timer_wheel_delete(&timer_wheel);
+    cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_delete), status);
+}
+
+Test(timer_wheel, expiration, .disabled = SKIP_TEST_TIMER_WHEEL) {
+    timer_wheel_t *timer_wheel = NULL;
+    timer_wheel_node_t *expired = NULL;
+
+    // timeouts on every level, beyond the range and several on the same tick
+    size_t timeouts[] = {1, 2, 2, 63, 64, 65, 100, 4095, 4096, 4097, 300000, TIMER_WHEEL_RANGE + 3, 2};
+    size_t n = sizeof(timeouts) / sizeof(timeouts[0]);
+    timer_wheel_node_t nodes[sizeof(timeouts) / sizeof(timeouts[0])];
+    size_t expirations[sizeof(timeouts) / sizeof(timeouts[0])] = {0};
+
+    int status = timer_wheel_create(&timer_wheel);
+    cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_create), status);
+
+    // start somewhere in the middle of every level
+    timer_wheel->now = 12345;
+    for (size_t i = 0; i < n; i++) {
+        timer_wheel_node_init(&nodes[i], &expirations[i]);
+        status = timer_wheel_insert(&timer_wheel, &nodes[i], timeouts[i]);
+        cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_insert), status);
+    }
+
+    // a cancelled node never expires and leaves its neighbours untouched
+    status = timer_wheel_cancel(&timer_wheel, &nodes[n - 1]);
+    cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_cancel), status);
+    cr_expect_not(timer_wheel_node_is_active(&nodes[n - 1]), "expected an inactive node");
+
+    // advance tick by tick or by idle ticks and record the expiration of each node
+    size_t ticks = 0;
+    size_t batch = 0;
+    while (timer_wheel_get_idle_ticks(&timer_wheel, &ticks) == TIMER_WHEEL_SUCCESS) {
+        status = timer_wheel_skip(&timer_wheel, ticks);
+        cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_skip), status);
+        status = timer_wheel_tick(&timer_wheel, &expired);
+        cr_expect_eq(status, TIMER_WHEEL_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(timer_wheel_tick), status);
+
+        size_t expired_nodes = 0;
+        for (; expired != NULL; expired = expired->next) {
+            *(size_t *) expired->data = timer_wheel->now - 12345;
+            expired_nodes++;
+        }
+        if (timer_wheel->now - 12345 == 2) {
+            batch = expired_nodes;
+        }
+    }
+
+    for (size_t i = 0; i < n - 1; i++) {
+        cr_expect_eq(expirations[i], timeouts[i], "expected expiration after the timeout: %zu==%zu", expirations[i], timeouts[i]);
+    }
+    cr_expect_eq(expirations[n - 1], 0, "expected no expiration of the cancelled node: %zu==0", expirations[n - 1]);
+    cr_expect_eq(batch, 2, "expected both nodes of the same tick in one pass: %zu==2", batch);
+    cr_expect_eq(timer_wheel->size, 0, "expected an empty timing wheel: %zu==0", timer_wheel->size);
+
+    timer_wheel_delete(&timer_wheel);
+}
+
+// records the order of executed software timer callbacks
+static size_t software_timer_calls[16];
+static size_t software_timer_call_count = 0;
+
+static void software_timer_record(size_t id) {
+    if (software_timer_call_count < sizeof(software_timer_calls) / sizeof(software_timer_calls[0])) {
+        software_timer_calls[software_timer_call_count] = id;
+    }
+    software_timer_call_count++;
+}
+
+Test(software_timer, null_operations, .disabled = SKIP_TEST_SOFTWARE_TIMER) {
+    software_timer_t *timer = NULL;
+    software_timer_list_t *list = NULL;
+    size_t ticks = 0;
+
+    int status = software_timer_delete(&timer);
+    cr_expect_eq(status, SOFTWARE_TIMER_NO_MEMORY, "timer shall be uninitialized on %s: %i", GET_FUNCTION_NAME(software_timer_delete), status);
+    status = software_timer_start(&list, &timer, 0);
+    cr_expect_eq(status, SOFTWARE_TIMER_NO_MEMORY, "timer shall be uninitialized on %s: %i", GET_FUNCTION_NAME(software_timer_start), status);
+    status = software_timer_get_next_ticks(&list, 0, &ticks);
+    cr_expect_eq(status, SOFTWARE_TIMER_NO_LIST, "list shall be uninitialized on %s: %i", GET_FUNCTION_NAME(software_timer_get_next_ticks), status);
+    status = software_timer_create(&timer, 0, NULL, 1, false);
+    cr_expect_eq(status, SOFTWARE_TIMER_NO_CALLBACK, "timer shall require a callback on %s: %i", GET_FUNCTION_NAME(software_timer_create), status);
+    status = software_timer_create(&timer, 0, software_timer_record, 0, false);
+    cr_expect_eq(status, SOFTWARE_TIMER_NO_PERIOD, "timer shall require a period on %s: %i", GET_FUNCTION_NAME(software_timer_create), status);
+
+    status = software_timer_create(&timer, 0, software_timer_record, 1, false);
+    cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_create), status);
+    status = software_timer_start(&list, &timer, 0);
+    cr_expect_eq(status, SOFTWARE_TIMER_NO_LIST, "list shall be uninitialized on %s: %i", GET_FUNCTION_NAME(software_timer_start), status);
+
+    status = software_timer_list_create(&list);
+    cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_list_create), status);
+    status = software_timer_get_next_ticks(&list, 0, &ticks);
+    cr_expect_eq(status, SOFTWARE_TIMER_IS_EMPTY, "list shall be empty on %s: %i", GET_FUNCTION_NAME(software_timer_get_next_ticks), status);
+
+    software_timer_list_delete(&list);
+    software_timer_delete(&timer);
+}
+
+Test(software_timer, deadline_order, .disabled = SKIP_TEST_SOFTWARE_TIMER) {
+    software_timer_list_t *list = NULL;
+    software_timer_t *timers[4] = {NULL};
+    size_t periods[4] = {30, 10, 20, 10};
+    size_t ticks = 0;
+    size_t expired_timers = 0;
+    software_timer_call_count = 0;
+
+    int status = software_timer_list_create(&list);
+    cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_list_create), status);
+
+    // timer 1 reloads automatically, the others are one shot timers
+    for (size_t i = 0; i < 4; i++) {
+        status = software_timer_create(&timers[i], i, software_timer_record, periods[i], i == 1);
+        cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_create), status);
+        status = software_timer_start(&list, &timers[i], 100);
+        cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_start), status);
+    }
+
+    status = software_timer_get_next_ticks(&list, 100, &ticks);
+    cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_get_next_ticks), status);
+    cr_expect_eq(ticks, 10, "expected ticks until the earliest deadline: %zu==10", ticks);
+
+    // a late processing executes all due timers at once in deadline order, equal deadlines in start order
+    status = software_timer_process(&list, 125, &expired_timers);
+    cr_expect_eq(status, SOFTWARE_TIMER_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(software_timer_process), status);
+    cr_expect_eq(expired_timers, 3, "expected expired timers: %zu==3", expired_timers);
+    size_t expected_calls[3] = {1, 3, 2};
+    for (size_t i = 0; i < 3; i++) {
+        cr_expect_eq(software_timer_calls[i], expected_calls[i], "expected callback order: %zu==%zu", software_timer_calls[i], expected_calls[i]);
+    }
+
+    // the auto reload timer skips the missed period but keeps its phase, one shot timers become inactive
+    cr_expect(timers[1]->active, "expected an active auto reload timer");
+    cr_expect_not(timers[3]->active, "expected an inactive one shot timer");
+    cr_expect_eq(timers[1]->deadline, 130, "expected a deadline without drift: %zu==130", timers[1]->deadline);
+
+    // a stopped timer never expires and a restarted timer begins a new period
+    software_timer_stop(&list, &timers[0]);
+    software_timer_start(&list, &timers[2], 125);
+    software_timer_process(&list, 145, &expired_timers);
+    cr_expect_eq(expired_timers, 2, "expected expired timers: %zu==2", expired_timers);
+    cr_expect_eq(software_timer_calls[3], 1, "expected callback order: %zu==1", software_timer_calls[3]);
+    cr_expect_eq(software_timer_calls[4], 2, "expected callback order: %zu==2", software_timer_calls[4]);
+    cr_expect_eq(timers[1]->deadline, 150, "expected a deadline without drift: %zu==150", timers[1]->deadline);
+    cr_expect_eq(list->size, 1, "expected only the auto reload timer: %zu==1", list->size);
+
+    software_timer_list_delete(&list);
+    for (size_t i = 0; i < 4; i++) {
+        software_timer_delete(&timers[i]);
+    }
+}
+
+Test(benchmark, delayed_task_insertion, .disabled = SKIP_TEST_BENCHMARK) {
+    // previous delta list of delayed tasks against the timing wheel for an increasing amount of sleepers
+    size_t sleepers[] = {16, 256, 1024, 4096};
+
+    for (size_t s = 0; s < sizeof(sleepers) / sizeof(sleepers[0]); s++) {
+        size_t n = sleepers[s];
+        size_t *delays = malloc(n * sizeof(size_t));
+        task_t *tasks = calloc(n, sizeof(task_t));
+        srand(42);
+        for (size_t i = 0; i < n; i++) {
+            delays[i] = 1 + (size_t) rand() % 10000;
+        }
+
+        // delta list insertion as previously done by kernel_delay
+        linked_list_t *delayed_tasks = NULL;
+        linked_list_create(&delayed_tasks);
+        uint64_t start = benchmark_get_time_ns();
+        for (size_t i = 0; i < n; i++) {
+            task_t *task = &tasks[i];
+            linked_list_element_t *iterator = delayed_tasks->tail;
+            size_t delta_sum = 0;
+            while (iterator != NULL) {
+                task_t *delayed_task = (task_t *) iterator->data;
+                delta_sum += delayed_task->return_value;
+                if (delta_sum > delays[i]) {
+                    delta_sum -= delayed_task->return_value;
+                    delayed_task->return_value -= delays[i] - delta_sum;
+                    iterator = iterator->previous;
+                    break;
+                }
+                else if (iterator->next == NULL) {
+                    break;
+                }
+                iterator = iterator->next;
+            }
+            // the delta is stored in an otherwise unused field
+            task->return_value = delays[i] - delta_sum;
+            if (iterator == NULL) {
+                linked_list_push_back(&delayed_tasks, (void **) &task);
+            }
+            else {
+                linked_list_insert_after(&delayed_tasks, &iterator, (void **) &task);
+            }
+        }
+        uint64_t list_insert_time = benchmark_get_time_ns() - start;
+
+        // releasing one task per tick until the delta list is empty
+        start = benchmark_get_time_ns();
+        size_t list_ticks = 0;
+        while (delayed_tasks->size > 0) {
+            list_ticks++;
+            while (delayed_tasks->size > 0 && ((task_t *) delayed_tasks->tail->data)->return_value == 0) {
+                linked_list_element_t *element = delayed_tasks->tail;
+                task_t *released = NULL;
+                linked_list_pop_inner(&delayed_tasks, &element, (void **) &released);
+            }
+            if (delayed_tasks->size > 0) {
+                ((task_t *) delayed_tasks->tail->data)->return_value--;
+            }
+        }
+        uint64_t list_expire_time = benchmark_get_time_ns() - start;
+        linked_list_delete(&delayed_tasks);
+
+        // timing wheel insertion
+        timer_wheel_t *timer_wheel = NULL;
+        timer_wheel_create(&timer_wheel);
+        start = benchmark_get_time_ns();
+        for (size_t i = 0; i < n; i++) {
+            timer_wheel_node_init(&tasks[i].timeout_node, &tasks[i]);
+            timer_wheel_insert(&timer_wheel, &tasks[i].timeout_node, delays[i]);
+        }
+        uint64_t wheel_insert_time = benchmark_get_time_ns() - start;
+
+        // expiring all tasks due on a tick in one pass
+        start = benchmark_get_time_ns();
+        size_t released = 0;
+        size_t timer_wheel_ticks = 0;
+        timer_wheel_node_t *expired = NULL;
+        while (timer_wheel->size > 0) {
+            timer_wheel_ticks++;
+            timer_wheel_tick(&timer_wheel, &expired);
+            for (; expired != NULL; expired = expired->next) {
+                released++;
+            }
+        }
+        uint64_t wheel_expire_time = benchmark_get_time_ns() - start;
+        cr_expect_eq(released, n, "expected all sleepers released: %zu==%zu", released, n);
+        timer_wheel_delete(&timer_wheel);
+
+        cr_log_info("%4zu sleepers: delta list insert %8.2f ns tick %6.2f ns, timing wheel insert %6.2f ns tick %6.2f ns",
+                n, (double) list_insert_time / n, (double) list_expire_time / list_ticks,
+                (double) wheel_insert_time / n, (double) wheel_expire_time / timer_wheel_ticks);
+
+        free(tasks);
+        free(delays);
+    }
+}
+
+// kernel internals, which are used to measure the task migration without a context switch
+extern task_t                   *g_running_task_current;
+extern task_t                   *g_running_task_next;
+extern linked_list_t            *g_delayed_tasks;
+extern timer_wheel_t            *g_timer_wheel;
+extern linked_list_element_t    *g_linked_list_task_iterator;
+extern size_t kernel_reinsert_task(linked_list_t **source, linked_list_element_t **element, task_t **task);
+extern size_t kernel_insert_delayed_task(size_t ticks, size_t error_code);
+
+#define BENCHMARK_TASK_MIGRATIONS   1000000
+#define BENCHMARK_TASK_DELAYS       100000
+
+static uint64_t task_migration_time = 0;
+static uint64_t task_delay_time = 0;
+static size_t task_migration_status = KERNEL_SUCCESS;
+
+static size_t benchmark_task_migration(void) {
+    task_t *task = g_running_task_current;
+
+    // park the running task in the delayed task list and reinsert it at once, like an early wake up
+    uint64_t start = benchmark_get_time_ns();
+    for (size_t i = 0; i < BENCHMARK_TASK_MIGRATIONS; i++) {
+        task_migration_status |= kernel_insert_delayed_task(1, KERNEL_UNABLE_TO_DELAY_TASK);
+        task_migration_status |= timer_wheel_cancel(&g_timer_wheel, &task->timeout_node);
+        linked_list_element_t *element = g_linked_list_task_iterator;
+        task_migration_status |= kernel_reinsert_task(&g_delayed_tasks, &element, &task);
+    }
+    task_migration_time = benchmark_get_time_ns() - start;
+
+    // complete delays including the release by the tick and both context switches of the host port
+    start = benchmark_get_time_ns();
+    for (size_t i = 0; i < BENCHMARK_TASK_DELAYS; i++) {
+        task_migration_status |= kernel_delay(1);
+    }
+    task_delay_time = benchmark_get_time_ns() - start;
+
+    return 0;
+}
+
+Test(benchmark, task_migration, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(benchmark_task_migration, 1, "migration", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(task_migration_status, KERNEL_SUCCESS, "expected no error on task migration: %zu", task_migration_status);
+
+    cr_log_info("delayed task list round trip %6.2f ns, kernel_delay(1) %8.2f ns",
+            (double) task_migration_time / BENCHMARK_TASK_MIGRATIONS, (double) task_delay_time / BENCHMARK_TASK_DELAYS);
+
+    kernel_deinit();
+}
+
+#define INVERSION_CRITICAL_TICKS    5
+#define INVERSION_MEDIUM_TICKS      20
+#define INVERSION_SLACK_TICKS       2
+
+static size_t inversion_mutex = 0;
+static size_t inversion_blocking_ticks = 0;
+static size_t inversion_high_priority = 0;
+static size_t inversion_low_priority = 0;
+static size_t inversion_boosted_priority = 0;
+static size_t inversion_restored_priority = 0;
+static size_t inversion_medium_end = 0;
+static size_t inversion_high_end = 0;
+static size_t inversion_status = KERNEL_SUCCESS;
+
+static size_t inversion_low(void) {
+    inversion_low_priority = g_running_task_current->task_data->u8TaskPrio;
+    inversion_status |= kernel_mutex_acquire(inversion_mutex);
+    kernel_delay(1);
+    // the high task blocks on the mutex, while the low task is busy in its critical section
+    kernel_delay_blocking(INVERSION_CRITICAL_TICKS);
+    inversion_boosted_priority = g_running_task_current->task_data->u8TaskPrio;
+    inversion_status |= kernel_mutex_release(inversion_mutex);
+    inversion_restored_priority = g_running_task_current->task_data->u8TaskPrio;
+
+    return 0;
+}
+
+static size_t inversion_medium(void) {
+    kernel_delay(3);
+    // without inheritance the low task and with it the high task would wait for this task
+    kernel_delay_blocking(INVERSION_MEDIUM_TICKS);
+    inversion_medium_end = kernel_get_tick();
+
+    return 0;
+}
+
+static size_t inversion_high(void) {
+    inversion_high_priority = g_running_task_current->task_data->u8TaskPrio;
+    kernel_delay(2);
+    size_t start = kernel_get_tick();
+    inversion_status |= kernel_mutex_acquire(inversion_mutex);
+    inversion_blocking_ticks = kernel_get_tick() - start;
+    inversion_status |= kernel_mutex_release(inversion_mutex);
+    inversion_high_end = kernel_get_tick();
+
+    return 0;
+}
+
+Test(kernel, priority_inheritance, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_mutex_create(&inversion_mutex);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mutex_create), status);
+
+    status = kernel_add_task(inversion_high, 1, "high", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(inversion_medium, 2, "medium", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(inversion_low, 3, "low", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(inversion_status, KERNEL_SUCCESS, "expected no error on the mutex: %zu", inversion_status);
+
+    // the blocking time is bounded by the critical section of the low task
+    cr_expect_leq(inversion_blocking_ticks, INVERSION_CRITICAL_TICKS + INVERSION_SLACK_TICKS, "expected bounded blocking: %zu ticks", inversion_blocking_ticks);
+    cr_expect_lt(inversion_high_end, inversion_medium_end, "expected the high task to finish before the medium task");
+    cr_expect_eq(inversion_boosted_priority, inversion_high_priority, "expected the low task to inherit the high priority: %zu", inversion_boosted_priority);
+    cr_expect_eq(inversion_restored_priority, inversion_low_priority, "expected the low task to restore its priority: %zu", inversion_restored_priority);
+
+    cr_log_info("high task blocked for %zu ticks (critical section %d ticks, medium task %d ticks)",
+            inversion_blocking_ticks, INVERSION_CRITICAL_TICKS, INVERSION_MEDIUM_TICKS);
+
+    kernel_deinit();
+}
+
+static size_t chain_outer_mutex = 0;
+static size_t chain_inner_mutex = 0;
+static size_t chain_high_priority = 0;
+static size_t chain_low_priority = 0;
+static size_t chain_middle_priority = 0;
+static size_t chain_status = KERNEL_SUCCESS;
+
+static size_t chain_low(void) {
+    chain_status |= kernel_mutex_acquire(chain_inner_mutex);
+    kernel_delay(3);
+    kernel_delay_blocking(INVERSION_CRITICAL_TICKS);
+    chain_low_priority = g_running_task_current->task_data->u8TaskPrio;
+    chain_status |= kernel_mutex_release(chain_inner_mutex);
+
+    return 0;
+}
+
+static size_t chain_middle(void) {
+    chain_status |= kernel_mutex_acquire(chain_outer_mutex);
+    kernel_delay(1);
+    // the low task owns the inner mutex, so this task waits while owning the outer mutex
+    chain_status |= kernel_mutex_acquire(chain_inner_mutex);
+    chain_middle_priority = g_running_task_current->task_data->u8TaskPrio;
+    chain_status |= kernel_mutex_release(chain_inner_mutex);
+    chain_status |= kernel_mutex_release(chain_outer_mutex);
+
+    return 0;
+}
+
+static size_t chain_high(void) {
+    chain_high_priority = g_running_task_current->task_data->u8TaskPrio;
+    kernel_delay(2);
+    chain_status |= kernel_mutex_acquire(chain_outer_mutex);
+    chain_status |= kernel_mutex_release(chain_outer_mutex);
+
+    return 0;
+}
+
+Test(kernel, transitive_priority_inheritance, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_mutex_create(&chain_outer_mutex);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mutex_create), status);
+    status = kernel_mutex_create(&chain_inner_mutex);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mutex_create), status);
+
+    status = kernel_add_task(chain_high, 1, "high", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(chain_middle, 2, "middle", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(chain_low, 3, "low", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(chain_status, KERNEL_SUCCESS, "expected no error on the mutexes: %zu", chain_status);
+
+    // the high task waits for the middle task, which waits for the low task
+    cr_expect_eq(chain_low_priority, chain_high_priority, "expected the low task to inherit the high priority through the chain: %zu", chain_low_priority);
+    cr_expect_eq(chain_middle_priority, chain_high_priority, "expected the middle task to keep the high priority while the high task waits: %zu", chain_middle_priority);
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_MUTEX_CYCLES      1000000
+
+static size_t ceiling_mutex = 0;
+static size_t ceiling_medium_priority = 0;
+static size_t ceiling_low_priority = 0;
+static size_t ceiling_raised_priority = 0;
+static size_t ceiling_restored_priority = 0;
+static size_t ceiling_violation_status = KERNEL_SUCCESS;
+static size_t ceiling_status = KERNEL_SUCCESS;
+
+static size_t ceiling_high(void) {
+    // the ceiling is below the priority of this task
+    ceiling_violation_status = kernel_mutex_acquire(ceiling_mutex);
+
+    return 0;
+}
+
+static size_t ceiling_medium(void) {
+    ceiling_medium_priority = g_running_task_current->task_data->u8TaskPrio;
+    kernel_delay(1);
+    ceiling_status |= kernel_mutex_acquire(ceiling_mutex);
+    ceiling_status |= kernel_mutex_release(ceiling_mutex);
+
+    return 0;
+}
+
+static size_t ceiling_low(void) {
+    ceiling_low_priority = g_running_task_current->task_data->u8TaskPrio;
+    ceiling_status |= kernel_mutex_acquire(ceiling_mutex);
+    ceiling_status |= kernel_mutex_acquire(ceiling_mutex);
+    ceiling_raised_priority = g_running_task_current->task_data->u8TaskPrio;
+    kernel_delay_blocking(INVERSION_CRITICAL_TICKS);
+    ceiling_status |= kernel_mutex_release(ceiling_mutex);
+    ceiling_status |= kernel_mutex_release(ceiling_mutex);
+    ceiling_restored_priority = g_running_task_current->task_data->u8TaskPrio;
+
+    return 0;
+}
+
+Test(kernel, priority_ceiling, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_mutex_create_ceiling(&ceiling_mutex, 2);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mutex_create_ceiling), status);
+
+    status = kernel_add_task(ceiling_high, 1, "high", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(ceiling_medium, 2, "medium", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(ceiling_low, 3, "low", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(ceiling_status, KERNEL_SUCCESS, "expected no error on the ceiling mutex: %zu", ceiling_status);
+    cr_expect_neq(ceiling_violation_status, KERNEL_SUCCESS, "expected a task above the ceiling to be rejected");
+
+    // the ceiling is the priority of the medium task
+    cr_expect_eq(ceiling_raised_priority, ceiling_medium_priority, "expected the low task to run with the ceiling priority: %zu", ceiling_raised_priority);
+    cr_expect_eq(ceiling_restored_priority, ceiling_low_priority, "expected the low task to restore its priority: %zu", ceiling_restored_priority);
+
+    kernel_deinit();
+}
+
+static uint64_t mutex_inheritance_time = 0;
+static uint64_t mutex_ceiling_time = 0;
+static uint64_t mutex_raising_ceiling_time = 0;
+static size_t mutex_benchmark_status = KERNEL_SUCCESS;
+
+static size_t benchmark_mutex_cycle(void) {
+    size_t inheritance_mutex = 0;
+    size_t ceiling = 0;
+    size_t raising_ceiling = 0;
+    mutex_benchmark_status |= kernel_mutex_create(&inheritance_mutex);
+    mutex_benchmark_status |= kernel_mutex_create_ceiling(&ceiling, g_running_task_current->task_data->u8TaskPrio);
+    // the timer daemon has a higher priority, so the task moves between priority groups
+    mutex_benchmark_status |= kernel_mutex_create_ceiling(&raising_ceiling, KERNEL_TIMER_DAEMON_PRIORITY);
+
+    uint64_t start = benchmark_get_time_ns();
+    for (size_t i = 0; i < BENCHMARK_MUTEX_CYCLES; i++) {
+        mutex_benchmark_status |= kernel_mutex_acquire(inheritance_mutex);
+        mutex_benchmark_status |= kernel_mutex_release(inheritance_mutex);
+    }
+    mutex_inheritance_time = benchmark_get_time_ns() - start;
+
+    start = benchmark_get_time_ns();
+    for (size_t i = 0; i < BENCHMARK_MUTEX_CYCLES; i++) {
+        mutex_benchmark_status |= kernel_mutex_acquire(ceiling);
+        mutex_benchmark_status |= kernel_mutex_release(ceiling);
+    }
+    mutex_ceiling_time = benchmark_get_time_ns() - start;
+
+    start = benchmark_get_time_ns();
+    for (size_t i = 0; i < BENCHMARK_MUTEX_CYCLES; i++) {
+        mutex_benchmark_status |= kernel_mutex_acquire(raising_ceiling);
+        mutex_benchmark_status |= kernel_mutex_release(raising_ceiling);
+    }
+    mutex_raising_ceiling_time = benchmark_get_time_ns() - start;
+
+    return 0;
+}
+
+Test(benchmark, mutex_cycle, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(benchmark_mutex_cycle, 1, "mutex", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(mutex_benchmark_status, KERNEL_SUCCESS, "expected no error on the mutexes: %zu", mutex_benchmark_status);
+
+    cr_log_info("lock/unlock cycle with priority inheritance %6.2f ns, with priority ceiling %6.2f ns, raising to the ceiling %6.2f ns",
+            (double) mutex_inheritance_time / BENCHMARK_MUTEX_CYCLES, (double) mutex_ceiling_time / BENCHMARK_MUTEX_CYCLES,
+            (double) mutex_raising_ceiling_time / BENCHMARK_MUTEX_CYCLES);
+
+    kernel_deinit();
+}
+
+static uint64_t semaphore_fast_path_cycles = 0;
+static uint64_t mutex_fast_path_cycles = 0;
+static size_t fast_path_benchmark_status = KERNEL_SUCCESS;
+
+static size_t benchmark_fast_path(void) {
+    size_t semaphore = 0;
+    size_t mutex = 0;
+    fast_path_benchmark_status |= kernel_semaphore_create(&semaphore, 1);
+    fast_path_benchmark_status |= kernel_mutex_create(&mutex);
+
+    uint64_t start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_MUTEX_CYCLES; i++) {
+        fast_path_benchmark_status |= kernel_semaphore_acquire(semaphore);
+        fast_path_benchmark_status |= kernel_semaphore_release(semaphore);
+    }
+    semaphore_fast_path_cycles = benchmark_get_cycles() - start;
+
+    start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_MUTEX_CYCLES; i++) {
+        fast_path_benchmark_status |= kernel_mutex_acquire(mutex);
+        fast_path_benchmark_status |= kernel_mutex_release(mutex);
+    }
+    mutex_fast_path_cycles = benchmark_get_cycles() - start;
+
+    return 0;
+}
+
+Test(benchmark, uncontended_fast_path, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(benchmark_fast_path, 1, "fast", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(fast_path_benchmark_status, KERNEL_SUCCESS, "expected no error on the fast path: %zu", fast_path_benchmark_status);
+
+    cr_log_info("uncontended acquire/release semaphore %6.2f cycles, mutex %6.2f cycles",
+            (double) semaphore_fast_path_cycles / BENCHMARK_MUTEX_CYCLES, (double) mutex_fast_path_cycles / BENCHMARK_MUTEX_CYCLES);
+
+    kernel_deinit();
+}
+
+static size_t served_interrupts = 0;
+
+static void count_interrupt(void) {
+    served_interrupts++;
+}
+
+Test(kernel, critical_section_nesting, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+    served_interrupts = 0;
+
+    kernel_enter_critical();
+    kernel_enter_critical();
+
+    // an interrupt above the kernel is served at once, a kernel interrupt waits for the outermost exit
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY - 1, count_interrupt);
+    cr_expect_eq(served_interrupts, 1, "expected the interrupt above the kernel to be served: %zu", served_interrupts);
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, count_interrupt);
+    cr_expect_eq(served_interrupts, 1, "expected the kernel interrupt to be masked: %zu", served_interrupts);
+
+    kernel_exit_critical();
+    cr_expect_eq(served_interrupts, 1, "expected the nested exit to keep the mask: %zu", served_interrupts);
+
+    kernel_exit_critical();
+    cr_expect_eq(served_interrupts, 2, "expected the outermost exit to serve the kernel interrupt: %zu", served_interrupts);
+
+    // an unbalanced exit must not unmask anything twice
+    kernel_exit_critical();
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, count_interrupt);
+    cr_expect_eq(served_interrupts, 3, "expected interrupts to stay unmasked: %zu", served_interrupts);
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_LATENCY_SAMPLES       10000
+#define BENCHMARK_LATENCY_KERNEL_CALLS  16
+
+static uint64_t latency_raised = 0;
+static uint64_t latency_served = 0;
+static uint64_t hard_realtime_latency = 0;
+static uint64_t kernel_aware_latency = 0;
+static size_t latency_benchmark_status = KERNEL_SUCCESS;
+
+static void latency_interrupt(void) {
+    latency_served = benchmark_get_time_ns();
+}
+
+static uint64_t benchmark_interrupt_latency(uint8_t priority, size_t mutex) {
+    uint64_t latency = 0;
+    for (size_t sample = 0; sample < BENCHMARK_LATENCY_SAMPLES; sample++) {
+        // the interrupt arrives as the kernel enters a critical section of several kernel calls
+        kernel_enter_critical();
+        latency_raised = benchmark_get_time_ns();
+        kernel_host_raise_interrupt(priority, latency_interrupt);
+        for (size_t call = 0; call < BENCHMARK_LATENCY_KERNEL_CALLS; call++) {
+            latency_benchmark_status |= kernel_mutex_acquire(mutex);
+            latency_benchmark_status |= kernel_mutex_release(mutex);
+        }
+        kernel_exit_critical();
+        latency += latency_served - latency_raised;
+    }
+    return latency;
+}
+
+static size_t benchmark_latency(void) {
+    size_t mutex = 0;
+    // a ceiling mutex always takes the nested critical section
+    latency_benchmark_status |= kernel_mutex_create_ceiling(&mutex, g_running_task_current->task_data->u8TaskPrio);
+
+    hard_realtime_latency = benchmark_interrupt_latency(KERNEL_MAX_SYSCALL_PRIORITY - 1, mutex);
+    // a kernel interrupt sees the latency, which every interrupt had, while the kernel disabled all interrupts
+    kernel_aware_latency = benchmark_interrupt_latency(KERNEL_MAX_SYSCALL_PRIORITY, mutex);
+
+    return 0;
+}
+
+Test(benchmark, interrupt_latency, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(benchmark_latency, 1, "latency", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(latency_benchmark_status, KERNEL_SUCCESS, "expected no error on the mutex: %zu", latency_benchmark_status);
+    cr_expect_lt(hard_realtime_latency, kernel_aware_latency, "expected the interrupt above the kernel to be served earlier");
+
+    cr_log_info("interrupt latency in a critical section of %d kernel calls: above the kernel %6.2f ns, masked by the kernel %6.2f ns",
+            2 * BENCHMARK_LATENCY_KERNEL_CALLS, (double) hard_realtime_latency / BENCHMARK_LATENCY_SAMPLES,
+            (double) kernel_aware_latency / BENCHMARK_LATENCY_SAMPLES);
+
+    kernel_deinit();
+}
+
+static size_t isr_semaphore = 0;
+static size_t isr_status = KERNEL_SUCCESS;
+static bool isr_higher_priority_task_woken = false;
+static bool isr_lower_priority_task_woken = false;
+static size_t isr_order[3] = {0};
+static size_t isr_order_count = 0;
+
+static void isr_release(void) {
+    bool higher_priority_task_woken = false;
+    isr_status |= kernel_semaphore_release_from_isr(isr_semaphore, &higher_priority_task_woken);
+    isr_higher_priority_task_woken = higher_priority_task_woken;
+
+    // the low task is not waiting for events, hence it is not woken
+    bool lower_priority_task_woken = false;
+    isr_status |= kernel_event_send_from_isr(3, 1, &lower_priority_task_woken);
+    isr_lower_priority_task_woken = lower_priority_task_woken;
+
+    kernel_yield_from_isr(higher_priority_task_woken);
+    // the switch is pended until the interrupt returned
+    isr_order[isr_order_count++] = 1;
+}
+
+static size_t isr_waiting_task(void) {
+    isr_status |= kernel_semaphore_acquire(isr_semaphore);
+    // blocks until the interrupt releases the semaphore
+    isr_status |= kernel_semaphore_acquire(isr_semaphore);
+    isr_order[isr_order_count++] = 2;
+
+    return 0;
+}
+
+static size_t isr_raising_task(void) {
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, isr_release);
+    isr_order[isr_order_count++] = 3;
+
+    return 0;
+}
+
+static size_t isr_low_task(void) {
+    return 0;
+}
+
+Test(kernel, from_isr, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_semaphore_create(&isr_semaphore, 1);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+
+    status = kernel_add_task(isr_waiting_task, 1, "waiting", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(isr_raising_task, 2, "raising", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(isr_low_task, 3, "low", 3, 1, 1 << 1, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(isr_status, KERNEL_SUCCESS, "expected no error in the interrupt: %zu", isr_status);
+    cr_expect(isr_higher_priority_task_woken, "expected the release to wake the waiting task");
+    cr_expect(!isr_lower_priority_task_woken, "expected the event to wake no task");
+
+    // interrupt returns, the woken task preempts the interrupted task at once
+    cr_expect_eq(isr_order_count, 3, "expected every step to run: %zu", isr_order_count);
+    cr_expect_eq(isr_order[0], 1, "expected the interrupt to finish first: %zu", isr_order[0]);
+    cr_expect_eq(isr_order[1], 2, "expected the woken task to run next: %zu", isr_order[1]);
+    cr_expect_eq(isr_order[2], 3, "expected the interrupted task to resume last: %zu", isr_order[2]);
+
+    kernel_deinit();
+}
+
+static void isr_above_kernel(void) {
+    bool higher_priority_task_woken = false;
+    isr_status |= kernel_semaphore_release_from_isr(isr_semaphore, &higher_priority_task_woken);
+}
+
+Test(kernel, from_isr_above_kernel, .signal = SIGABRT, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_semaphore_create(&isr_semaphore, 1);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+
+    // an interrupt, which is never masked by the kernel, must not call it
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY - 1, isr_above_kernel);
+
+    kernel_deinit();
+}
+
+#define SAME_TICK_DELAY     3
+
+static size_t same_tick_order[5] = {0};
+static size_t same_tick_order_count = 0;
+static size_t same_tick_preemption = 0;
+
+static size_t same_tick_high_task(void) {
+    // the low priority task is delayed first, hence the high priority task is released first
+    kernel_delay(1);
+    kernel_delay(SAME_TICK_DELAY - 1);
+    same_tick_order[same_tick_order_count++] = 1;
+
+    // both expire again, while the middle priority task is running
+    kernel_delay(1);
+    kernel_delay(SAME_TICK_DELAY - 1);
+    same_tick_order[same_tick_order_count++] = 1;
+    same_tick_preemption = kernel_get_tick();
+
+    return 0;
+}
+
+static size_t same_tick_middle_task(void) {
+    kernel_delay(2 * SAME_TICK_DELAY - 1);
+    kernel_delay_blocking(2 * SAME_TICK_DELAY);
+    same_tick_order[same_tick_order_count++] = 2;
+
+    return 0;
+}
+
+static size_t same_tick_low_task(void) {
+    kernel_delay(SAME_TICK_DELAY);
+    same_tick_order[same_tick_order_count++] = 3;
+    kernel_delay(SAME_TICK_DELAY);
+    same_tick_order[same_tick_order_count++] = 3;
+
+    return 0;
+}
+
+Test(kernel, same_tick_expiry, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(same_tick_high_task, 1, "high", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(same_tick_middle_task, 2, "middle", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(same_tick_low_task, 3, "low", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+
+    // the highest priority of a batch wakes up the kernel from idle and preempts the running task
+    size_t expected_order[5] = {1, 3, 1, 2, 3};
+    cr_expect_eq(same_tick_order_count, 5, "expected every step to run: %zu", same_tick_order_count);
+    for (size_t i = 0; i < 5; i++) {
+        cr_expect_eq(same_tick_order[i], expected_order[i], "expected task %zu at step %zu: %zu", expected_order[i], i, same_tick_order[i]);
+    }
+    // the time quantum of the running task elapses on the tick after the expiry
+    cr_expect_leq(same_tick_preemption, 2 * SAME_TICK_DELAY + 1, "expected the preemption at the end of the time quantum: %zu", same_tick_preemption);
+
+    kernel_deinit();
+}
+
+#define EXPIRY_TICKS    3
+
+static size_t expiry_semaphore = 0;
+static size_t expiry_status = KERNEL_SUCCESS;
+static size_t expiry_releases = 0;
+static bool expiry_raised = false;
+static bool expiry_served = false;
+static bool expiry_served_in_batch = false;
+static size_t expiry_order[3] = {0};
+static size_t expiry_order_count = 0;
+
+static void expiry_isr_release(void) {
+    bool higher_priority_task_woken = false;
+    expiry_status |= kernel_semaphore_release_from_isr(expiry_semaphore, &higher_priority_task_woken);
+    kernel_yield_from_isr(higher_priority_task_woken);
+    expiry_served = true;
+}
+
+static void expiry_raise_interrupt(void) {
+    // the interrupt arrives after the first task of the batch was released
+    expiry_releases++;
+    if (!expiry_raised) {
+        expiry_raised = true;
+        kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, expiry_isr_release);
+    }
+    // the kernel interrupt must wait until the expiry left its critical section
+    expiry_served_in_batch |= expiry_served;
+}
+
+static size_t expiry_high_task(void) {
+    kernel_delay(EXPIRY_TICKS);
+    expiry_order[expiry_order_count++] = 1;
+
+    return 0;
+}
+
+static size_t expiry_middle_task(void) {
+    kernel_delay(EXPIRY_TICKS);
+    expiry_order[expiry_order_count++] = 2;
+
+    return 0;
+}
+
+static size_t expiry_waiting_task(void) {
+    expiry_status |= kernel_semaphore_acquire(expiry_semaphore);
+    // blocks until the interrupt releases the semaphore
+    expiry_status |= kernel_semaphore_acquire(expiry_semaphore);
+    expiry_order[expiry_order_count++] = 3;
+
+    return 0;
+}
+
+Test(kernel, interrupt_during_expiry, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_semaphore_create(&expiry_semaphore, 1);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+
+    status = kernel_add_task(expiry_high_task, 1, "high", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(expiry_middle_task, 2, "middle", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(expiry_waiting_task, 3, "waiting", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    kernel_host_set_expiry_hook(expiry_raise_interrupt);
+    status = kernel_start();
+    kernel_host_set_expiry_hook(NULL);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(expiry_status, KERNEL_SUCCESS, "expected no error on the semaphore: %zu", expiry_status);
+
+    // both delays expire on the same tick, the interrupt is served after the batch
+    cr_expect_eq(expiry_releases, 2, "expected both tasks to be released by the tick: %zu", expiry_releases);
+    cr_expect(expiry_served, "expected the interrupt to be served");
+    cr_expect(!expiry_served_in_batch, "expected the interrupt to wait for the expiry");
+    cr_expect_eq(expiry_order_count, 3, "expected every task to run: %zu", expiry_order_count);
+    for (size_t i = 0; i < expiry_order_count; i++) {
+        cr_expect_eq(expiry_order[i], i + 1, "expected the tasks to run by their priority: %zu", expiry_order[i]);
+    }
+
+    kernel_deinit();
+}
+
+static size_t work_order[32] = {0};
+static size_t work_order_count = 0;
+
+static void record_work(void *argument) {
+    work_order[work_order_count++] = (size_t) argument;
+}
+
+Test(work_queue, post_and_read, .disabled = SKIP_TEST_WORK_QUEUE) {
+    work_queue_t *work_queue = NULL;
+    work_item_t work_item;
+
+    int status = work_queue_post(&work_queue, record_work, NULL, 0);
+    cr_expect_eq(status, WORK_QUEUE_IS_NULL, "work queue shall be uninitialized on %s: %i", GET_FUNCTION_NAME(work_queue_post), status);
+    status = work_queue_read(&work_queue, &work_item);
+    cr_expect_eq(status, WORK_QUEUE_IS_NULL, "work queue shall be uninitialized on %s: %i", GET_FUNCTION_NAME(work_queue_read), status);
+    status = work_queue_create(&work_queue, 6);
+    cr_expect_eq(status, WORK_QUEUE_INVALID_SIZE, "expected a power of 2 on %s: %i", GET_FUNCTION_NAME(work_queue_create), status);
+
+    status = work_queue_create(&work_queue, 4);
+    cr_assert_eq(status, WORK_QUEUE_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(work_queue_create), status);
+    status = work_queue_read(&work_queue, &work_item);
+    cr_expect_eq(status, WORK_QUEUE_IS_EMPTY, "work queue shall be empty on %s: %i", GET_FUNCTION_NAME(work_queue_read), status);
+    status = work_queue_post(&work_queue, NULL, NULL, 0);
+    cr_expect_eq(status, WORK_QUEUE_NO_FUNCTION, "expected a function on %s: %i", GET_FUNCTION_NAME(work_queue_post), status);
+
+    // several rounds reuse every slot, a full round counts each rejected post
+    work_order_count = 0;
+    size_t posted = 0;
+    for (size_t round = 0; round < 3; round++) {
+        for (size_t i = 0; i < 5; i++) {
+            status = work_queue_post(&work_queue, record_work, (void *) posted, posted);
+            if (i < 4) {
+                cr_expect_eq(status, WORK_QUEUE_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(work_queue_post), status);
+                posted++;
+            }
+            else {
+                cr_expect_eq(status, WORK_QUEUE_IS_FULL, "work queue shall be full on %s: %i", GET_FUNCTION_NAME(work_queue_post), status);
+            }
+        }
+
+        while (work_queue_read(&work_queue, &work_item) == WORK_QUEUE_SUCCESS) {
+            cr_expect_eq(work_item.timestamp, (size_t) work_item.argument, "expected the timestamp of the post: %zu", work_item.timestamp);
+            work_item.function(work_item.argument);
+        }
+    }
+
+    cr_expect_eq(work_order_count, posted, "expected every posted item to be read: %zu==%zu", work_order_count, posted);
+    for (size_t i = 0; i < work_order_count; i++) {
+        cr_expect_eq(work_order[i], i, "expected the posting order: %zu==%zu", work_order[i], i);
+    }
+    cr_expect_eq(work_queue->overflows, 3, "expected an overflow each round: %zu==3", work_queue->overflows);
+
+    status = work_queue_delete(&work_queue);
+    cr_expect_eq(status, WORK_QUEUE_SUCCESS, "expected no error on %s: %i", GET_FUNCTION_NAME(work_queue_delete), status);
+}
+
+static size_t work_status = KERNEL_SUCCESS;
+static size_t work_rejected = 0;
+
+static void isr_post_work(void) {
+    bool higher_priority_task_woken = false;
+    for (size_t i = 0; i < 3; i++) {
+        work_status |= kernel_work_post_from_isr(record_work, (void *) (10 + i), &higher_priority_task_woken);
+    }
+    work_order[work_order_count++] = 1;
+    kernel_yield_from_isr(higher_priority_task_woken);
+}
+
+static void isr_flood_work(void) {
+    bool higher_priority_task_woken = false;
+    // the work daemon cannot drain, until the interrupt returned
+    for (size_t i = 0; i < KERNEL_WORK_QUEUE_SIZE + 2; i++) {
+        if (kernel_work_post_from_isr(record_work, (void *) 20, &higher_priority_task_woken) != KERNEL_SUCCESS) {
+            work_rejected++;
+        }
+    }
+    kernel_yield_from_isr(higher_priority_task_woken);
+}
+
+static size_t work_raising_task(void) {
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, isr_post_work);
+    work_order[work_order_count++] = 2;
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, isr_flood_work);
+
+    return 0;
+}
+
+Test(kernel, deferred_work, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_work_post_from_isr(record_work, NULL, NULL);
+    cr_expect_eq(status, KERNEL_NO_WORK_QUEUE, "expected no work queue on %s: %zu", GET_FUNCTION_NAME(kernel_work_post_from_isr), status);
+
+    status = kernel_work_queue_create();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_work_queue_create), status);
+    status = kernel_add_task(work_raising_task, 1, "raising", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    work_order_count = 0;
+    work_status = KERNEL_SUCCESS;
+    work_rejected = 0;
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(work_status, KERNEL_SUCCESS, "expected no error in the interrupt: %zu", work_status);
+
+    // the work daemon runs the whole batch, before the interrupted task resumes
+    size_t expected[] = {1, 10, 11, 12, 2};
+    cr_assert_eq(work_order_count, 5 + KERNEL_WORK_QUEUE_SIZE, "expected every work item to run: %zu", work_order_count);
+    for (size_t i = 0; i < 5; i++) {
+        cr_expect_eq(work_order[i], expected[i], "expected order %zu: %zu==%zu", i, work_order[i], expected[i]);
+    }
+    cr_expect_eq(work_rejected, 2, "expected the posts beyond the depth to be rejected: %zu==2", work_rejected);
+
+    kernel_work_statistics_t statistics;
+    status = kernel_work_get_statistics(&statistics);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_work_get_statistics), status);
+    cr_expect_eq(statistics.executed, 3 + KERNEL_WORK_QUEUE_SIZE, "expected every work item to be counted: %zu", statistics.executed);
+    cr_expect_eq(statistics.overflows, 2, "expected both rejected posts to be counted: %zu==2", statistics.overflows);
+    cr_expect_eq(statistics.batches, 2, "expected a single batch per interrupt: %zu==2", statistics.batches);
+    cr_expect_eq(statistics.batch_max, KERNEL_WORK_QUEUE_SIZE, "expected the full queue in one batch: %zu", statistics.batch_max);
+    cr_expect_geq(statistics.latency_max, statistics.latency_last, "expected the last latency to be bounded by the highest");
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_WORK_INTERRUPTS       10000
+#define BENCHMARK_WORK_ITEMS            8
+
+static uint64_t work_post_cycles = 0;
+static uint64_t work_message_cycles = 0;
+static size_t work_benchmark_status = KERNEL_SUCCESS;
+static message_queue_identifier_t *work_message_queue = NULL;
+
+static void benchmark_work(void *argument) {
+    (void) argument;
+}
+
+static void isr_benchmark_work(void) {
+    bool higher_priority_task_woken = false;
+
+    // without the work queue the function and its argument are sent as a message
+    work_item_t work_item = { .function = benchmark_work, .argument = NULL };
+    uint64_t start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_WORK_ITEMS; i++) {
+        work_benchmark_status |= kernel_message_queue_send_from_isr(&work_message_queue, &work_item, sizeof(work_item_t), false, &higher_priority_task_woken);
+    }
+    work_message_cycles += benchmark_get_cycles() - start;
+
+    start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_WORK_ITEMS; i++) {
+        work_benchmark_status |= kernel_work_post_from_isr(benchmark_work, NULL, &higher_priority_task_woken);
+    }
+    work_post_cycles += benchmark_get_cycles() - start;
+
+    kernel_yield_from_isr(higher_priority_task_woken);
+}
+
+static size_t benchmark_work_raising_task(void) {
+    work_item_t work_item;
+    void *message = &work_item;
+
+    for (size_t i = 0; i < BENCHMARK_WORK_INTERRUPTS; i++) {
+        kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, isr_benchmark_work);
+        for (size_t item = 0; item < BENCHMARK_WORK_ITEMS; item++) {
+            work_benchmark_status |= kernel_message_queue_receive(&work_message_queue, &message);
+        }
+    }
+
+    return 0;
+}
+
+Test(benchmark, deferred_work, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_work_queue_create();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_work_queue_create), status);
+    status = kernel_message_queue_create(&work_message_queue, "work items", BENCHMARK_WORK_ITEMS, sizeof(work_item_t));
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_message_queue_create), status);
+    status = kernel_add_task(benchmark_work_raising_task, 1, "raising", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(work_benchmark_status, KERNEL_SUCCESS, "expected no error in the interrupt: %zu", work_benchmark_status);
+
+    kernel_work_statistics_t statistics;
+    kernel_work_get_statistics(&statistics);
+    cr_expect_eq(statistics.executed, BENCHMARK_WORK_INTERRUPTS * BENCHMARK_WORK_ITEMS, "expected every work item to run: %zu", statistics.executed);
+    cr_expect_eq(statistics.overflows, 0, "expected no overflow: %zu", statistics.overflows);
+
+    // the host masks interrupts by a variable, only the target shows the saved critical sections
+    cr_log_info("hand over from an interrupt: message %6.2f cycles, work post %6.2f cycles, work latency average %6.2f cycles, max %zu cycles",
+            (double) work_message_cycles / (BENCHMARK_WORK_INTERRUPTS * BENCHMARK_WORK_ITEMS),
+            (double) work_post_cycles / (BENCHMARK_WORK_INTERRUPTS * BENCHMARK_WORK_ITEMS),
+            (double) statistics.latency_total / statistics.executed, statistics.latency_max);
+
+    kernel_deinit();
+}
+
+static task_t *notify_waiter = NULL;
+static size_t notify_values[5] = {0};
+static size_t notify_order[2] = {0};
+static size_t notify_order_count = 0;
+static size_t notify_status = KERNEL_SUCCESS;
+static bool notify_higher_priority_task_woken = false;
+
+static size_t notify_waiting_task(void) {
+    // both gives arrived before, a counting take decrements
+    notify_status |= kernel_notify_take(false, &notify_values[0]);
+    notify_status |= kernel_notify_take(false, &notify_values[1]);
+    notify_status |= kernel_notify_wait(SIZE_MAX, &notify_values[2]);
+    notify_status |= kernel_notify_wait(0, &notify_values[3]);
+    // the overwritten value is still set, a binary take clears it
+    notify_status |= kernel_notify_take(true, &notify_values[4]);
+    notify_status |= kernel_notify_take(true, &notify_values[4]);
+    notify_order[notify_order_count++] = 1;
+
+    return 0;
+}
+
+static void isr_notify(void) {
+    bool higher_priority_task_woken = false;
+    notify_status |= kernel_notify_from_isr(&notify_waiter, 0, TASK_NOTIFY_INCREMENT, &higher_priority_task_woken);
+    notify_higher_priority_task_woken = higher_priority_task_woken;
+    kernel_yield_from_isr(higher_priority_task_woken);
+}
+
+static size_t notify_notifying_task(void) {
+    notify_status |= kernel_notify_give(&notify_waiter);
+    notify_status |= kernel_notify_give(&notify_waiter);
+    kernel_delay(1);
+
+    notify_status |= kernel_notify(&notify_waiter, 0x5, TASK_NOTIFY_SET_BITS);
+    notify_status |= kernel_notify(&notify_waiter, 0x2, TASK_NOTIFY_SET_BITS);
+    kernel_delay(1);
+
+    notify_status |= kernel_notify(&notify_waiter, 42, TASK_NOTIFY_OVERWRITE);
+    kernel_delay(1);
+
+    // the interrupt wakes the waiter, which preempts this task
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, isr_notify);
+    notify_order[notify_order_count++] = 2;
+
+    return 0;
+}
+
+Test(kernel, notifications, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(notify_waiting_task, 1, "waiter", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_add_task(notify_notifying_task, 2, "notifier", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_task_get_handle(3, &notify_waiter);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected no task on %s: %zu", GET_FUNCTION_NAME(kernel_task_get_handle), status);
+    status = kernel_task_get_handle(1, &notify_waiter);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_task_get_handle), status);
+    status = kernel_notify(&notify_waiter, 0, TASK_NOTIFY_MAX_ACTION);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected an invalid action on %s: %zu", GET_FUNCTION_NAME(kernel_notify), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(notify_status, KERNEL_SUCCESS, "expected no error on the notifications: %zu", notify_status);
+
+    cr_expect_eq(notify_values[0], 2, "expected both gives to be counted: %zu==2", notify_values[0]);
+    cr_expect_eq(notify_values[1], 1, "expected the take to decrement: %zu==1", notify_values[1]);
+    cr_expect_eq(notify_values[2], 0x7, "expected the bits of both notifications: %zu==7", notify_values[2]);
+    cr_expect_eq(notify_values[3], 42, "expected the overwritten value: %zu==42", notify_values[3]);
+    cr_expect_eq(notify_values[4], 1, "expected the increment of the interrupt: %zu==1", notify_values[4]);
+    cr_expect(notify_higher_priority_task_woken, "expected the interrupt to wake the waiter");
+    cr_expect_eq(notify_order_count, 2, "expected both tasks to finish: %zu", notify_order_count);
+    cr_expect_eq(notify_order[0], 1, "expected the woken waiter to finish first: %zu", notify_order[0]);
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_PING_PONGS            100000
+
+static size_t ping_semaphore = 0;
+static size_t pong_semaphore = 0;
+static task_t *ping_task = NULL;
+static task_t *pong_task = NULL;
+static uint64_t ping_pong_semaphore_cycles = 0;
+static uint64_t ping_pong_notification_cycles = 0;
+static uint64_t signal_semaphore_cycles = 0;
+static uint64_t signal_notification_cycles = 0;
+static size_t ping_pong_status = KERNEL_SUCCESS;
+
+static size_t benchmark_ping(void) {
+    size_t value = 0;
+
+    // signal the own task, which shows the costs without the context switches of the ping pong
+    uint64_t start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_PING_PONGS; i++) {
+        ping_pong_status |= kernel_semaphore_release(ping_semaphore);
+        ping_pong_status |= kernel_semaphore_acquire(ping_semaphore);
+    }
+    signal_semaphore_cycles = benchmark_get_cycles() - start;
+
+    start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_PING_PONGS; i++) {
+        ping_pong_status |= kernel_notify_give(&ping_task);
+        ping_pong_status |= kernel_notify_take(true, &value);
+    }
+    signal_notification_cycles = benchmark_get_cycles() - start;
+
+    start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_PING_PONGS; i++) {
+        ping_pong_status |= kernel_semaphore_release(pong_semaphore);
+        ping_pong_status |= kernel_semaphore_acquire(ping_semaphore);
+    }
+    ping_pong_semaphore_cycles = benchmark_get_cycles() - start;
+
+    start = benchmark_get_cycles();
+    for (size_t i = 0; i < BENCHMARK_PING_PONGS; i++) {
+        ping_pong_status |= kernel_notify_give(&pong_task);
+        ping_pong_status |= kernel_notify_take(true, &value);
+    }
+    ping_pong_notification_cycles = benchmark_get_cycles() - start;
+
+    return 0;
+}
+
+static size_t benchmark_pong(void) {
+    size_t value = 0;
+
+    for (size_t i = 0; i < BENCHMARK_PING_PONGS; i++) {
+        ping_pong_status |= kernel_semaphore_acquire(pong_semaphore);
+        ping_pong_status |= kernel_semaphore_release(ping_semaphore);
+    }
+
+    for (size_t i = 0; i < BENCHMARK_PING_PONGS; i++) {
+        ping_pong_status |= kernel_notify_take(true, &value);
+        ping_pong_status |= kernel_notify_give(&ping_task);
+    }
+
+    return 0;
+}
+
+Test(benchmark, ping_pong, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    // both semaphores start without a token, so every acquire blocks until the other task released
+    status = kernel_semaphore_create(&ping_semaphore, 1);
+    status |= kernel_semaphore_create(&pong_semaphore, 1);
+    status |= kernel_semaphore_acquire_non_blocking(ping_semaphore);
+    status |= kernel_semaphore_acquire_non_blocking(pong_semaphore);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+
+    status = kernel_add_task(benchmark_ping, 1, "ping", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(benchmark_pong, 2, "pong", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_task_get_handle(1, &ping_task);
+    status |= kernel_task_get_handle(2, &pong_task);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_task_get_handle), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(ping_pong_status, KERNEL_SUCCESS, "expected no error on the ping pong: %zu", ping_pong_status);
+
+    cr_log_info("signal without a switch: semaphore %6.2f cycles, notification %6.2f cycles",
+            (double) signal_semaphore_cycles / BENCHMARK_PING_PONGS, (double) signal_notification_cycles / BENCHMARK_PING_PONGS);
+    cr_log_info("ping pong round trip between two tasks: semaphores %6.2f cycles, notifications %6.2f cycles",
+            (double) ping_pong_semaphore_cycles / BENCHMARK_PING_PONGS, (double) ping_pong_notification_cycles / BENCHMARK_PING_PONGS);
+
+    kernel_deinit();
+}
+
+#define LOAN_QUEUE_SIZE     2
+#define LOAN_MESSAGE_SIZE   32
+
+static message_queue_identifier_t *loan_queue = NULL;
+static message_queue_identifier_t *copy_queue = NULL;
+static size_t loan_status = KERNEL_SUCCESS;
+static size_t loan_alloc_exhausted_status = KERNEL_SUCCESS;
+static size_t loan_copy_alloc_status = KERNEL_SUCCESS;
+static size_t loan_foreign_release_status = KERNEL_SUCCESS;
+static char loan_received[LOAN_QUEUE_SIZE][LOAN_MESSAGE_SIZE];
+static void *loan_blocks[LOAN_QUEUE_SIZE];
+
+static size_t loan_receiving_task(void) {
+    // blocks first, so the first block is parked at the task and the second one is queued
+    for (size_t i = 0; i < LOAN_QUEUE_SIZE; i++) {
+        void *block = NULL;
+        loan_status |= kernel_message_queue_receive(&loan_queue, &block);
+        if (block == NULL) {
+            loan_status |= KERNEL_UNABLE_TO_RECEIVE_MESSAGE;
+            return 0;
+        }
+
+        // the receiver reads the block of the sender in place
+        memcpy(loan_received[i], block, LOAN_MESSAGE_SIZE);
+        loan_blocks[i] = block;
+        loan_status |= kernel_message_queue_release(&loan_queue, block);
+    }
+
+    char foreign[LOAN_MESSAGE_SIZE];
+    loan_foreign_release_status = kernel_message_queue_release(&loan_queue, foreign);
+
+    return 0;
+}
+
+static size_t loan_sending_task(void) {
+    for (size_t i = 0; i < LOAN_QUEUE_SIZE; i++) {
+        void *block = NULL;
+        loan_status |= kernel_message_queue_alloc(&loan_queue, &block);
+        if (block == NULL) {
+            return 0;
+        }
+
+        // the message is written into the block and only its pointer is sent
+        snprintf((char *) block, LOAN_MESSAGE_SIZE, "loaned block %zu", i);
+        loan_status |= kernel_message_queue_send(&loan_queue, block, LOAN_MESSAGE_SIZE, false);
+    }
+
+    // both blocks are owned by the queue and the receiver until they are released
+    void *block = NULL;
+    loan_alloc_exhausted_status = kernel_message_queue_alloc(&loan_queue, &block);
+    loan_copy_alloc_status = kernel_message_queue_alloc(&copy_queue, &block);
+
+    return 0;
+}
+
+Test(kernel, zero_copy_message_queue, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_message_queue_create_loan(&loan_queue, "loan", LOAN_QUEUE_SIZE, LOAN_MESSAGE_SIZE);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_message_queue_create_loan), status);
+    status = kernel_message_queue_create(&copy_queue, "copy", LOAN_QUEUE_SIZE, LOAN_MESSAGE_SIZE);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_message_queue_create), status);
+
+    status = kernel_add_task(loan_receiving_task, 1, "receiver", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(loan_sending_task, 2, "sender", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(loan_status, KERNEL_SUCCESS, "expected no error on the loaned messages: %zu", loan_status);
+
+    cr_expect_eq(strcmp(loan_received[0], "loaned block 0"), 0, "expected the parked block: %s", loan_received[0]);
+    cr_expect_eq(strcmp(loan_received[1], "loaned block 1"), 0, "expected the queued block: %s", loan_received[1]);
+    cr_expect_neq(loan_blocks[0], loan_blocks[1], "expected two different blocks");
+    cr_expect_neq(loan_alloc_exhausted_status, KERNEL_SUCCESS, "expected every block to be in use: %zu", loan_alloc_exhausted_status);
+    cr_expect_neq(loan_copy_alloc_status, KERNEL_SUCCESS, "expected a copying queue not to loan: %zu", loan_copy_alloc_status);
+    cr_expect_neq(loan_foreign_release_status, KERNEL_SUCCESS, "expected a foreign block to be rejected: %zu", loan_foreign_release_status);
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_ZERO_COPY_QUEUE_SIZE      8
+#define BENCHMARK_ZERO_COPY_MESSAGES        100000
+#define BENCHMARK_ZERO_COPY_PAYLOADS        3
+
+static const size_t zero_copy_payloads[BENCHMARK_ZERO_COPY_PAYLOADS] = { 16, 256, 2048 };
+static message_queue_identifier_t *zero_copy_queues[BENCHMARK_ZERO_COPY_PAYLOADS];
+static message_queue_identifier_t *zero_copy_loan_queues[BENCHMARK_ZERO_COPY_PAYLOADS];
+static uint64_t zero_copy_ns[BENCHMARK_ZERO_COPY_PAYLOADS];
+static uint64_t zero_copy_loan_ns[BENCHMARK_ZERO_COPY_PAYLOADS];
+static size_t zero_copy_status = KERNEL_SUCCESS;
+static volatile uint8_t zero_copy_sink = 0;
+
+static size_t benchmark_zero_copy(void) {
+    uint8_t frame[2048];
+    uint8_t received[2048];
+
+    for (size_t payload = 0; payload < BENCHMARK_ZERO_COPY_PAYLOADS; payload++) {
+        size_t size = zero_copy_payloads[payload];
+
+        // the producer builds the frame in a local buffer, which is copied into the queue and out of it again
+        uint64_t start = benchmark_get_time_ns();
+        for (size_t i = 0; i < BENCHMARK_ZERO_COPY_MESSAGES; i += BENCHMARK_ZERO_COPY_QUEUE_SIZE) {
+            for (size_t j = 0; j < BENCHMARK_ZERO_COPY_QUEUE_SIZE; j++) {
+                memset(frame, (int) j, size);
+                zero_copy_status |= kernel_message_queue_send(&zero_copy_queues[payload], frame, size, false);
+            }
+            for (size_t j = 0; j < BENCHMARK_ZERO_COPY_QUEUE_SIZE; j++) {
+                void *message = received;
+                zero_copy_status |= kernel_message_queue_receive(&zero_copy_queues[payload], &message);
+                zero_copy_sink += received[size - 1];
+            }
+        }
+        zero_copy_ns[payload] = benchmark_get_time_ns() - start;
+
+        // the producer builds the frame in a loaned block, which is read in place
+        start = benchmark_get_time_ns();
+        for (size_t i = 0; i < BENCHMARK_ZERO_COPY_MESSAGES; i += BENCHMARK_ZERO_COPY_QUEUE_SIZE) {
+            for (size_t j = 0; j < BENCHMARK_ZERO_COPY_QUEUE_SIZE; j++) {
+                void *block = NULL;
+                zero_copy_status |= kernel_message_queue_alloc(&zero_copy_loan_queues[payload], &block);
+                if (block == NULL) {
+                    return 0;
+                }
+                memset(block, (int) j, size);
+                zero_copy_status |= kernel_message_queue_send(&zero_copy_loan_queues[payload], block, size, false);
+            }
+            for (size_t j = 0; j < BENCHMARK_ZERO_COPY_QUEUE_SIZE; j++) {
+                void *block = NULL;
+                zero_copy_status |= kernel_message_queue_receive(&zero_copy_loan_queues[payload], &block);
+                zero_copy_sink += ((uint8_t *) block)[size - 1];
+                zero_copy_status |= kernel_message_queue_release(&zero_copy_loan_queues[payload], block);
+            }
+        }
+        zero_copy_loan_ns[payload] = benchmark_get_time_ns() - start;
+    }
+
+    return 0;
+}
+
+Test(benchmark, zero_copy, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    for (size_t payload = 0; payload < BENCHMARK_ZERO_COPY_PAYLOADS; payload++) {
+        status = kernel_message_queue_create(&zero_copy_queues[payload], "copy", BENCHMARK_ZERO_COPY_QUEUE_SIZE, zero_copy_payloads[payload]);
+        status |= kernel_message_queue_create_loan(&zero_copy_loan_queues[payload], "loan", BENCHMARK_ZERO_COPY_QUEUE_SIZE, zero_copy_payloads[payload]);
+        cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_message_queue_create), status);
+    }
+
+    status = kernel_add_task(benchmark_zero_copy, 1, "zero copy", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(zero_copy_status, KERNEL_SUCCESS, "expected no error on the messages: %zu", zero_copy_status);
+
+    for (size_t payload = 0; payload < BENCHMARK_ZERO_COPY_PAYLOADS; payload++) {
+        double megabytes = (double) (BENCHMARK_ZERO_COPY_MESSAGES * zero_copy_payloads[payload]) / 1e6;
+        cr_log_info("%4zu byte messages: copy %8.2f MB/s, loan %8.2f MB/s", zero_copy_payloads[payload],
+                megabytes / ((double) zero_copy_ns[payload] / 1e9), megabytes / ((double) zero_copy_loan_ns[payload] / 1e9));
+    }
+
+    kernel_deinit();
+}
+
+#define TOPIC_SIZE              4
+#define TOPIC_FAST_SAMPLES      3
+#define TOPIC_SAMPLES           10
+
+static size_t topic_id = 0;
+static size_t topic_subscribers[3];
+static size_t topic_received[2][TOPIC_FAST_SAMPLES];
+static size_t topic_slow_sample = 0;
+static size_t topic_slow_overruns = 0;
+static size_t topic_fast_overruns = 0;
+static size_t topic_status = KERNEL_SUCCESS;
+
+static size_t topic_fast_subscriber(size_t subscriber) {
+    for (size_t i = 0; i < TOPIC_FAST_SAMPLES; i++) {
+        topic_status |= kernel_topic_receive(topic_id, topic_subscribers[subscriber], &topic_received[subscriber][i]);
+    }
+    return 0;
+}
+
+static size_t topic_first_subscriber(void) {
+    return topic_fast_subscriber(0);
+}
+
+static size_t topic_second_subscriber(void) {
+    return topic_fast_subscriber(1);
+}
+
+static size_t topic_publisher(void) {
+    // both fast subscribers wait, a single publish wakes them together
+    size_t sample = 1;
+    for (; sample <= TOPIC_FAST_SAMPLES; sample++) {
+        topic_status |= kernel_topic_publish(topic_id, &sample);
+    }
+    kernel_delay(2);
+
+    // the slow subscriber has not read anything and the publisher never waits for it
+    for (; sample <= TOPIC_SAMPLES; sample++) {
+        topic_status |= kernel_topic_publish(topic_id, &sample);
+    }
+    topic_status |= kernel_topic_receive(topic_id, topic_subscribers[2], &topic_slow_sample);
+    topic_status |= kernel_topic_get_overruns(topic_id, topic_subscribers[2], &topic_slow_overruns);
+    topic_status |= kernel_topic_get_overruns(topic_id, topic_subscribers[0], &topic_fast_overruns);
+
+    return 0;
+}
+
+Test(kernel, topic, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_topic_create(&topic_id, TOPIC_SIZE, sizeof(size_t), 3);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_topic_create), status);
+    status = kernel_topic_create(&topic_id, 3, sizeof(size_t), 3);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected a ring size, which is not a power of 2, to fail: %zu", status);
+
+    for (size_t i = 0; i < 3; i++) {
+        status = kernel_topic_subscribe(topic_id, &topic_subscribers[i]);
+        cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_topic_subscribe), status);
+    }
+    size_t subscriber = 0;
+    status = kernel_topic_subscribe(topic_id, &subscriber);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected no storage for a fourth subscriber: %zu", status);
+
+    status = kernel_add_task(topic_first_subscriber, 1, "first", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(topic_second_subscriber, 2, "second", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(topic_publisher, 3, "publisher", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(topic_status, KERNEL_SUCCESS, "expected no error on the topic: %zu", topic_status);
+
+    for (size_t i = 0; i < TOPIC_FAST_SAMPLES; i++) {
+        cr_expect_eq(topic_received[0][i], i + 1, "expected the first subscriber to read every sample: %zu==%zu", topic_received[0][i], i + 1);
+        cr_expect_eq(topic_received[1][i], i + 1, "expected the second subscriber to read every sample: %zu==%zu", topic_received[1][i], i + 1);
+    }
+    cr_expect_eq(topic_fast_overruns, 0, "expected no overruns of a fast subscriber: %zu", topic_fast_overruns);
+    cr_expect_eq(topic_slow_overruns, TOPIC_SAMPLES - TOPIC_SIZE, "expected the overwritten samples as overruns: %zu", topic_slow_overruns);
+    cr_expect_eq(topic_slow_sample, TOPIC_SAMPLES - TOPIC_SIZE + 1, "expected the oldest kept sample: %zu", topic_slow_sample);
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_FAN_OUTS              100000
+#define BENCHMARK_FAN_OUT_SAMPLE_SIZE   16
+#define BENCHMARK_FAN_OUT_COUNTS        3
+
+static const size_t fan_out_counts[BENCHMARK_FAN_OUT_COUNTS] = { 1, 4, 8 };
+static size_t fan_out_topic = 0;
+static size_t fan_out_subscribers[KERNEL_MAX_MESSAGE_QUEUE];
+static message_queue_identifier_t *fan_out_queues[KERNEL_MAX_MESSAGE_QUEUE];
+static uint64_t fan_out_topic_cycles[BENCHMARK_FAN_OUT_COUNTS];
+static uint64_t fan_out_queue_cycles[BENCHMARK_FAN_OUT_COUNTS];
+static size_t fan_out_status = KERNEL_SUCCESS;
+
+static size_t benchmark_fan_out(void) {
+    uint8_t sample[BENCHMARK_FAN_OUT_SAMPLE_SIZE] = { 0 };
+    uint8_t received[BENCHMARK_FAN_OUT_SAMPLE_SIZE];
+
+    for (size_t count = 0; count < BENCHMARK_FAN_OUT_COUNTS; count++) {
+        size_t subscribers = fan_out_counts[count];
+
+        // only the publishing side is measured, the subscribers read outside of it
+        for (size_t i = 0; i < BENCHMARK_FAN_OUTS; i++) {
+            sample[0] = (uint8_t) i;
+            uint64_t start = benchmark_get_cycles();
+            fan_out_status |= kernel_topic_publish(fan_out_topic, sample);
+            fan_out_topic_cycles[count] += benchmark_get_cycles() - start;
+
+            for (size_t subscriber = 0; subscriber < subscribers; subscriber++) {
+                fan_out_status |= kernel_topic_receive(fan_out_topic, fan_out_subscribers[subscriber], received);
+            }
+        }
+
+        // a queue per consumer needs a copy per consumer
+        for (size_t i = 0; i < BENCHMARK_FAN_OUTS; i++) {
+            sample[0] = (uint8_t) i;
+            uint64_t start = benchmark_get_cycles();
+            for (size_t subscriber = 0; subscriber < subscribers; subscriber++) {
+                fan_out_status |= kernel_message_queue_send(&fan_out_queues[subscriber], sample, BENCHMARK_FAN_OUT_SAMPLE_SIZE, false);
+            }
+            fan_out_queue_cycles[count] += benchmark_get_cycles() - start;
+
+            for (size_t subscriber = 0; subscriber < subscribers; subscriber++) {
+                void *message = received;
+                fan_out_status |= kernel_message_queue_receive(&fan_out_queues[subscriber], &message);
+            }
+        }
+    }
+
+    return 0;
+}
+
+Test(benchmark, topic_fan_out, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_topic_create(&fan_out_topic, 8, BENCHMARK_FAN_OUT_SAMPLE_SIZE, KERNEL_MAX_MESSAGE_QUEUE);
+    for (size_t subscriber = 0; subscriber < KERNEL_MAX_MESSAGE_QUEUE; subscriber++) {
+        status |= kernel_topic_subscribe(fan_out_topic, &fan_out_subscribers[subscriber]);
+        status |= kernel_message_queue_create(&fan_out_queues[subscriber], "fan out", 8, BENCHMARK_FAN_OUT_SAMPLE_SIZE);
+    }
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_topic_create), status);
+
+    status = kernel_add_task(benchmark_fan_out, 1, "fan out", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(fan_out_status, KERNEL_SUCCESS, "expected no error on the fan out: %zu", fan_out_status);
+
+    for (size_t count = 0; count < BENCHMARK_FAN_OUT_COUNTS; count++) {
+        cr_log_info("publish to %zu subscribers: topic %7.2f cycles, a queue per subscriber %7.2f cycles", fan_out_counts[count],
+                (double) fan_out_topic_cycles[count] / BENCHMARK_FAN_OUTS, (double) fan_out_queue_cycles[count] / BENCHMARK_FAN_OUTS);
+    }
+
+    // the publish writes a single copy, regardless of the amount of subscribers
+    size_t last = BENCHMARK_FAN_OUT_COUNTS - 1;
+    cr_expect_lt(fan_out_topic_cycles[last], fan_out_queue_cycles[last], "expected a single publish to be cheaper than %zu sends", fan_out_counts[last]);
+
+    kernel_deinit();
+}
+
+#define TIMEOUT_TICKS               5
+#define TIMEOUT_RELEASE_TICKS       100
+#define TIMEOUT_CRITICAL_TICKS      20
+
+static size_t timeout_semaphore = 0;
+static size_t timeout_mutex = 0;
+static message_queue_identifier_t *timeout_queue = NULL;
+static volatile size_t timeout_phase = 0;
+static size_t timeout_results[8];
+static size_t timeout_ticks[4];
+static size_t timeout_owner_priorities[2];
+static size_t timeout_waiter_priority = 0;
+static size_t timeout_owner_base_priority = 0;
+static task_t *timeout_owner = NULL;
+static size_t timeout_status = KERNEL_SUCCESS;
+
+static size_t timeout_waiting_task(void) {
+    size_t message = 0;
+    void *destination = &message;
+
+    // polls return at once, timed waits return after their timeout
+    timeout_status |= kernel_semaphore_acquire(timeout_semaphore);
+    timeout_results[0] = kernel_semaphore_acquire_timeout(timeout_semaphore, 0);
+    size_t start = kernel_get_tick();
+    timeout_results[1] = kernel_semaphore_acquire_timeout(timeout_semaphore, TIMEOUT_TICKS);
+    timeout_ticks[0] = kernel_get_tick() - start;
+
+    start = kernel_get_tick();
+    timeout_results[2] = kernel_message_queue_receive_timeout(&timeout_queue, &destination, TIMEOUT_TICKS);
+    timeout_ticks[1] = kernel_get_tick() - start;
+
+    timeout_status |= kernel_message_queue_send(&timeout_queue, &message, sizeof(message), false);
+    timeout_results[3] = kernel_message_queue_send_timeout(&timeout_queue, &message, sizeof(message), false, 0);
+    start = kernel_get_tick();
+    timeout_results[4] = kernel_message_queue_send_timeout(&timeout_queue, &message, sizeof(message), false, TIMEOUT_TICKS);
+    timeout_ticks[2] = kernel_get_tick() - start;
+
+    // the release removes the timeout, which must not reinsert the task a second time
+    timeout_phase = 1;
+    start = kernel_get_tick();
+    timeout_results[5] = kernel_semaphore_acquire_timeout(timeout_semaphore, TIMEOUT_RELEASE_TICKS);
+    timeout_ticks[3] = kernel_get_tick() - start;
+    kernel_delay(TIMEOUT_RELEASE_TICKS + TIMEOUT_TICKS);
+
+    // the owner inherits the priority only until the timeout elapsed
+    timeout_phase = 2;
+    while (timeout_phase != 3) {
+        kernel_delay(1);
+    }
+    timeout_waiter_priority = g_running_task_current->task_data->u8TaskPrio;
+    timeout_results[6] = kernel_mutex_acquire_timeout(timeout_mutex, TIMEOUT_TICKS);
+    timeout_owner_priorities[1] = timeout_owner->task_data->u8TaskPrio;
+    timeout_results[7] = kernel_mutex_acquire(timeout_mutex);
+    timeout_status |= kernel_mutex_release(timeout_mutex);
+
+    return 0;
+}
+
+static size_t timeout_releasing_task(void) {
+    while (timeout_phase != 1) {
+        kernel_delay(1);
+    }
+    kernel_delay(1);
+    timeout_status |= kernel_semaphore_release(timeout_semaphore);
+
+    return 0;
+}
+
+static size_t timeout_owning_task(void) {
+    while (timeout_phase != 2) {
+        kernel_delay(1);
+    }
+    timeout_owner_base_priority = g_running_task_current->task_data->u8TaskPrio;
+    timeout_status |= kernel_mutex_acquire(timeout_mutex);
+    timeout_phase = 3;
+    kernel_delay_blocking(TIMEOUT_TICKS / 2 + 1);
+    timeout_owner_priorities[0] = g_running_task_current->task_data->u8TaskPrio;
+    kernel_delay_blocking(TIMEOUT_CRITICAL_TICKS);
+    timeout_status |= kernel_mutex_release(timeout_mutex);
+
+    return 0;
+}
+
+Test(kernel, blocking_timeout, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_semaphore_create(&timeout_semaphore, 1);
+    status |= kernel_mutex_create(&timeout_mutex);
+    status |= kernel_message_queue_create(&timeout_queue, "timeout", 1, sizeof(size_t));
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on creating the objects: %zu", status);
+
+    status = kernel_add_task(timeout_waiting_task, 1, "waiter", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(timeout_releasing_task, 2, "releaser", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(timeout_owning_task, 3, "owner", 3, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+    status = kernel_task_get_handle(3, &timeout_owner);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_task_get_handle), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(timeout_status, KERNEL_SUCCESS, "expected no error on the blocking calls: %zu", timeout_status);
+
+    cr_expect_eq(timeout_results[0], KERNEL_TIMEOUT, "expected a poll of the semaphore to time out: %zu", timeout_results[0]);
+    cr_expect_eq(timeout_results[1], KERNEL_TIMEOUT, "expected the semaphore to time out: %zu", timeout_results[1]);
+    cr_expect_eq(timeout_results[2], KERNEL_TIMEOUT, "expected the receive to time out: %zu", timeout_results[2]);
+    cr_expect_eq(timeout_results[3], KERNEL_TIMEOUT, "expected a poll of the full queue to time out: %zu", timeout_results[3]);
+    cr_expect_eq(timeout_results[4], KERNEL_TIMEOUT, "expected the send to time out: %zu", timeout_results[4]);
+    cr_expect_eq(timeout_results[5], KERNEL_SUCCESS, "expected the release before the timeout: %zu", timeout_results[5]);
+    cr_expect_eq(timeout_results[6], KERNEL_TIMEOUT, "expected the mutex to time out: %zu", timeout_results[6]);
+    cr_expect_eq(timeout_results[7], KERNEL_SUCCESS, "expected the mutex after its release: %zu", timeout_results[7]);
+
+    for (size_t i = 0; i < 3; i++) {
+        cr_expect_geq(timeout_ticks[i], TIMEOUT_TICKS, "expected to wait for the timeout: %zu ticks", timeout_ticks[i]);
+        cr_expect_leq(timeout_ticks[i], TIMEOUT_TICKS + 1, "expected to return on the timeout: %zu ticks", timeout_ticks[i]);
+    }
+    cr_expect_lt(timeout_ticks[3], TIMEOUT_RELEASE_TICKS, "expected to return on the release: %zu ticks", timeout_ticks[3]);
+    cr_expect_eq(timeout_owner_priorities[0], timeout_waiter_priority, "expected the owner to inherit the priority: %zu", timeout_owner_priorities[0]);
+    cr_expect_eq(timeout_owner_priorities[1], timeout_owner_base_priority, "expected the owner to restore its priority on the timeout: %zu", timeout_owner_priorities[1]);
+
+    kernel_deinit();
+}
+
+#define DELETED_WAIT_TICKS          (4 * TIMEOUT_TICKS)
+
+static size_t deleted_semaphore = 0;
+static size_t deleted_results[2];
+static size_t deleted_ticks = 0;
+static size_t deleted_status = KERNEL_SUCCESS;
+
+static size_t deleted_timed_waiter(void) {
+    // the only token is taken, so the next acquire blocks
+    deleted_status |= kernel_semaphore_acquire(deleted_semaphore);
+    size_t start = kernel_get_tick();
+    deleted_results[0] = kernel_semaphore_acquire_timeout(deleted_semaphore, DELETED_WAIT_TICKS);
+    deleted_ticks = kernel_get_tick() - start;
+
+    return 0;
+}
+
+static size_t deleted_forever_waiter(void) {
+    deleted_results[1] = kernel_semaphore_acquire(deleted_semaphore);
+
+    return 0;
+}
+
+static size_t deleting_task(void) {
+    // both waiters are blocked, before the lower priority task runs
+    kernel_delay(1);
+    deleted_status |= kernel_semaphore_delete(&deleted_semaphore);
+
+    return 0;
+}
+
+Test(kernel, delete_waited_semaphore, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_semaphore_create(&deleted_semaphore, 1);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+
+    status = kernel_add_task(deleted_timed_waiter, 1, "timed", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(deleted_forever_waiter, 2, "forever", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(deleting_task, 3, "deleter", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(deleted_status, KERNEL_SUCCESS, "expected no error on the semaphore: %zu", deleted_status);
+
+    // the released waiters find the key stale instead of the freed semaphore
+    for (size_t i = 0; i < 2; i++) {
+        cr_expect_neq(deleted_results[i], KERNEL_SUCCESS, "expected waiter %zu to fail on the deleted semaphore", i);
+        cr_expect_neq(deleted_results[i], KERNEL_TIMEOUT, "expected waiter %zu to be released by the delete", i);
+    }
+    cr_expect_lt(deleted_ticks, DELETED_WAIT_TICKS, "expected to return on the delete: %zu ticks", deleted_ticks);
+
+    kernel_deinit();
+}
+
+static size_t deleted_mutex = 0;
+static size_t deleted_mutex_results[3];
+static struct mutex *deleted_mutex_blocked = NULL;
+static size_t deleted_mutex_status = KERNEL_SUCCESS;
+
+static size_t deleted_mutex_owner(void) {
+    deleted_mutex_status |= kernel_mutex_acquire(deleted_mutex);
+    kernel_delay(1);
+
+    // the lower priority task waits for the owned mutex
+    size_t key = deleted_mutex;
+    deleted_mutex_results[0] = kernel_mutex_delete(&key);
+
+    // the released waiter is ready, but has not retried yet
+    deleted_mutex_status |= kernel_mutex_release(deleted_mutex);
+    deleted_mutex_results[1] = kernel_mutex_delete(&deleted_mutex);
+
+    return 0;
+}
+
+static size_t deleted_mutex_waiter(void) {
+    deleted_mutex_results[2] = kernel_mutex_acquire(deleted_mutex);
+    deleted_mutex_blocked = g_running_task_current->blocked_mutex;
+
+    return 0;
+}
+
+Test(kernel, delete_waited_mutex, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_mutex_create(&deleted_mutex);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mutex_create), status);
+
+    status = kernel_add_task(deleted_mutex_owner, 1, "owner", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(deleted_mutex_waiter, 2, "waiter", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(deleted_mutex_status, KERNEL_SUCCESS, "expected no error on the mutex: %zu", deleted_mutex_status);
+
+    cr_expect_neq(deleted_mutex_results[0], KERNEL_SUCCESS, "expected the owned mutex to be kept");
+    cr_expect_eq(deleted_mutex_results[1], KERNEL_SUCCESS, "expected the released mutex to be deleted: %zu", deleted_mutex_results[1]);
+    cr_expect_neq(deleted_mutex_results[2], KERNEL_SUCCESS, "expected the waiter to fail on the deleted mutex");
+    cr_expect_null(deleted_mutex_blocked, "expected the waiter not to point to the deleted mutex");
+
+    kernel_deinit();
+}
+
+#define QUEUE_SET_SELECTS           3
+
+static size_t queue_set_id = 0;
+static size_t queue_set_semaphore = 0;
+static message_queue_identifier_t *queue_set_queue = NULL;
+static volatile size_t queue_set_phase = 0;
+static queue_set_member_t queue_set_members[QUEUE_SET_SELECTS + 1];
+static size_t queue_set_messages[QUEUE_SET_SELECTS];
+static size_t queue_set_results[2];
+static size_t queue_set_ticks = 0;
+static size_t queue_set_status = KERNEL_SUCCESS;
+
+static size_t queue_set_consume(queue_set_member_t *member, size_t *message) {
+    // the selected member is read without blocking
+    if (member->type == QUEUE_SET_SEMAPHORE) {
+        *message = 0;
+        return kernel_semaphore_acquire_timeout(member->id, 0);
+    }
+    void *destination = message;
+    return kernel_message_queue_receive_timeout(&queue_set_queue, &destination, 0);
+}
+
+static size_t queue_set_selecting_task(void) {
+    size_t message = 0;
+
+    // the token of the semaphore was announced on adding the semaphore
+    queue_set_status |= kernel_queue_set_select(queue_set_id, &queue_set_members[0], 0);
+    queue_set_status |= queue_set_consume(&queue_set_members[0], &message);
+
+    queue_set_results[0] = kernel_queue_set_select(queue_set_id, &queue_set_members[1], 0);
+    size_t start = kernel_get_tick();
+    queue_set_results[1] = kernel_queue_set_select(queue_set_id, &queue_set_members[1], TIMEOUT_TICKS);
+    queue_set_ticks = kernel_get_tick() - start;
+
+    // a single task waits for both members
+    queue_set_phase = 1;
+    for (size_t select = 0; select < QUEUE_SET_SELECTS; select++) {
+        queue_set_status |= kernel_queue_set_select(queue_set_id, &queue_set_members[select + 1], KERNEL_WAIT_FOREVER);
+        queue_set_status |= queue_set_consume(&queue_set_members[select + 1], &queue_set_messages[select]);
+    }
+
+    // a deleted queue set detaches its members
+    queue_set_status |= kernel_queue_set_delete(&queue_set_id);
+    queue_set_status |= kernel_message_queue_send(&queue_set_queue, &message, sizeof(message), false);
+    queue_set_status |= kernel_semaphore_release(queue_set_semaphore);
+
+    return 0;
+}
+
+static size_t queue_set_feeding_task(void) {
+    while (queue_set_phase != 1) {
+        kernel_delay(1);
+    }
+
+    size_t message = 1;
+    queue_set_status |= kernel_message_queue_send(&queue_set_queue, &message, sizeof(message), false);
+    kernel_delay(1);
+    queue_set_status |= kernel_semaphore_release(queue_set_semaphore);
+    kernel_delay(1);
+    message = 2;
+    queue_set_status |= kernel_message_queue_send(&queue_set_queue, &message, sizeof(message), false);
+
+    return 0;
+}
+
+Test(kernel, queue_set, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    message_queue_identifier_t *too_large_queue = NULL;
+    status = kernel_queue_set_create(&queue_set_id, 3);
+    status |= kernel_semaphore_create(&queue_set_semaphore, 1);
+    status |= kernel_message_queue_create(&queue_set_queue, "queue set", 2, sizeof(size_t));
+    status |= kernel_message_queue_create(&too_large_queue, "too large", 1, sizeof(size_t));
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on creating the objects: %zu", status);
+
+    // members are registered once, the entries of a member never exceed the size of the queue set
+    status = kernel_queue_set_add_message_queue(queue_set_id, &queue_set_queue);
+    status |= kernel_queue_set_add_semaphore(queue_set_id, queue_set_semaphore);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on adding the members: %zu", status);
+    status = kernel_queue_set_add_message_queue(queue_set_id, &too_large_queue);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected the queue set to be too small for another member");
+    status = kernel_queue_set_add_semaphore(queue_set_id, queue_set_semaphore);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected a member to be added only once");
+
+    status = kernel_add_task(queue_set_selecting_task, 1, "selector", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(queue_set_feeding_task, 2, "feeder", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(queue_set_status, KERNEL_SUCCESS, "expected no error on the queue set: %zu", queue_set_status);
+
+    cr_expect_eq(queue_set_members[0].type, QUEUE_SET_SEMAPHORE, "expected the available token to be announced");
+    cr_expect_eq(queue_set_results[0], KERNEL_TIMEOUT, "expected a poll of the empty queue set to time out: %zu", queue_set_results[0]);
+    cr_expect_eq(queue_set_results[1], KERNEL_TIMEOUT, "expected the empty queue set to time out: %zu", queue_set_results[1]);
+    cr_expect_geq(queue_set_ticks, TIMEOUT_TICKS, "expected to wait for the timeout: %zu ticks", queue_set_ticks);
+    cr_expect_leq(queue_set_ticks, TIMEOUT_TICKS + 1, "expected to return on the timeout: %zu ticks", queue_set_ticks);
+
+    // members are returned in the order they became ready
+    queue_set_member_type_e types[QUEUE_SET_SELECTS] = { QUEUE_SET_MESSAGE_QUEUE, QUEUE_SET_SEMAPHORE, QUEUE_SET_MESSAGE_QUEUE };
+    size_t ids[QUEUE_SET_SELECTS] = { queue_set_queue->id, queue_set_semaphore, queue_set_queue->id };
+    size_t messages[QUEUE_SET_SELECTS] = { 1, 0, 2 };
+    for (size_t select = 0; select < QUEUE_SET_SELECTS; select++) {
+        cr_expect_eq(queue_set_members[select + 1].type, types[select], "expected member type %d on select %zu", types[select], select);
+        cr_expect_eq(queue_set_members[select + 1].id, ids[select], "expected member %zu on select %zu", ids[select], select);
+        cr_expect_eq(queue_set_messages[select], messages[select], "expected message %zu on select %zu", messages[select], select);
+    }
+
+    kernel_deinit();
+}
+
+#define EVENT_GROUP_BIT_A           (1 << 0)
+#define EVENT_GROUP_BIT_B           (1 << 1)
+#define EVENT_GROUP_BIT_UNSET       (1 << 2)
+#define EVENT_GROUP_BIT_PRESET      (1 << 3)
+
+static size_t event_group_id = 0;
+static volatile size_t event_group_phase = 0;
+static size_t event_group_received[5];
+static size_t event_group_phases[3];
+static size_t event_group_results[2];
+static size_t event_group_events = 0;
+static size_t event_group_ticks = 0;
+static size_t event_group_status = KERNEL_SUCCESS;
+
+static size_t event_group_any_task(void) {
+    // a satisfied wait returns at once and clears the bits on exit
+    event_group_status |= kernel_event_group_wait(event_group_id, EVENT_GROUP_BIT_PRESET, false, true, &event_group_received[3], 0);
+
+    event_group_status |= kernel_event_group_wait(event_group_id, EVENT_GROUP_BIT_A | EVENT_GROUP_BIT_B, false, false, &event_group_received[0], KERNEL_WAIT_FOREVER);
+    event_group_phases[0] = event_group_phase;
+
+    event_group_results[0] = kernel_event_group_wait(event_group_id, EVENT_GROUP_BIT_UNSET, false, false, &event_group_received[4], 0);
+    size_t start = kernel_get_tick();
+    event_group_results[1] = kernel_event_group_wait(event_group_id, EVENT_GROUP_BIT_UNSET, true, false, &event_group_received[4], TIMEOUT_TICKS);
+    event_group_ticks = kernel_get_tick() - start;
+
+    return 0;
+}
+
+static size_t event_group_all_clearing_task(void) {
+    event_group_status |= kernel_event_group_wait(event_group_id, EVENT_GROUP_BIT_A | EVENT_GROUP_BIT_B, true, true, &event_group_received[1], KERNEL_WAIT_FOREVER);
+    event_group_phases[1] = event_group_phase;
+
+    return 0;
+}
+
+static size_t event_group_all_task(void) {
+    event_group_status |= kernel_event_group_wait(event_group_id, EVENT_GROUP_BIT_A | EVENT_GROUP_BIT_B, true, false, &event_group_received[2], KERNEL_WAIT_FOREVER);
+    event_group_phases[2] = event_group_phase;
+
+    return 0;
+}
+
+static size_t event_group_setting_task(void) {
+    // the first bit satisfies only the any waiter
+    event_group_phase = 1;
+    event_group_status |= kernel_event_group_set(event_group_id, EVENT_GROUP_BIT_A);
+    kernel_delay(1);
+
+    // a single set releases both all waiters, which see the same bits
+    event_group_phase = 2;
+    event_group_status |= kernel_event_group_set(event_group_id, EVENT_GROUP_BIT_B);
+    kernel_delay(1);
+    event_group_status |= kernel_event_group_get(event_group_id, &event_group_events);
+
+    return 0;
+}
+
+Test(kernel, event_group, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_event_group_create(&event_group_id);
+    status |= kernel_event_group_set(event_group_id, EVENT_GROUP_BIT_PRESET);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_event_group_create), status);
+
+    status = kernel_add_task(event_group_any_task, 1, "any", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(event_group_all_clearing_task, 2, "all clearing", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(event_group_all_task, 3, "all", 3, 1, 0, NULL, 0);
+    status |= kernel_add_task(event_group_setting_task, 4, "setter", 4, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(event_group_status, KERNEL_SUCCESS, "expected no error on the event group: %zu", event_group_status);
+
+    cr_expect_eq(event_group_received[3], EVENT_GROUP_BIT_PRESET, "expected the preset bit: %zu", event_group_received[3]);
+    cr_expect_eq(event_group_received[0], EVENT_GROUP_BIT_A, "expected the any waiter to see the first bit: %zu", event_group_received[0]);
+    cr_expect_eq(event_group_phases[0], 1, "expected the any waiter on the first set: %zu", event_group_phases[0]);
+    for (size_t waiter = 1; waiter < 3; waiter++) {
+        cr_expect_eq(event_group_received[waiter], EVENT_GROUP_BIT_A | EVENT_GROUP_BIT_B, "expected all waiter %zu to see both bits: %zu", waiter, event_group_received[waiter]);
+        cr_expect_eq(event_group_phases[waiter], 2, "expected all waiter %zu on the second set: %zu", waiter, event_group_phases[waiter]);
+    }
+    cr_expect_eq(event_group_events, 0, "expected the bits to be cleared on exit: %zu", event_group_events);
+
+    cr_expect_eq(event_group_results[0], KERNEL_TIMEOUT, "expected a poll of an unset bit to time out: %zu", event_group_results[0]);
+    cr_expect_eq(event_group_results[1], KERNEL_TIMEOUT, "expected the wait for an unset bit to time out: %zu", event_group_results[1]);
+    cr_expect_geq(event_group_ticks, TIMEOUT_TICKS, "expected to wait for the timeout: %zu ticks", event_group_ticks);
+    cr_expect_leq(event_group_ticks, TIMEOUT_TICKS + 1, "expected to return on the timeout: %zu ticks", event_group_ticks);
+
+    status = kernel_event_group_delete(&event_group_id);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_event_group_delete), status);
+
+    kernel_deinit();
+}
+
+#define STREAM_SIZE                 16
+#define STREAM_TRIGGER_LEVEL        4
+#define STREAM_MESSAGE_SIZE         48
+
+static size_t stream_id = 0;
+static size_t stream_message_id = 0;
+static uint8_t stream_received[3][STREAM_SIZE];
+static size_t stream_lengths[3];
+static size_t stream_message_lengths[3];
+static uint8_t stream_messages[3][STREAM_SIZE];
+static size_t stream_results[5];
+static size_t stream_ticks[2];
+static size_t stream_full_written = 0;
+static bool stream_isr_task_woken = false;
+static size_t stream_status = KERNEL_SUCCESS;
+
+static void stream_isr_write(void) {
+    // bytes below the trigger level do not wake the receiver
+    size_t written = 0;
+    bool higher_priority_task_woken = false;
+    stream_status |= kernel_stream_buffer_write_from_isr(stream_id, "ab", 2, &written, &higher_priority_task_woken);
+    stream_isr_task_woken = higher_priority_task_woken;
+    kernel_yield_from_isr(higher_priority_task_woken);
+}
+
+static size_t stream_reading_task(void) {
+    uint8_t discard[STREAM_SIZE];
+    size_t length = 0;
+
+    stream_status |= kernel_stream_buffer_read(stream_id, stream_received[0], STREAM_SIZE, &stream_lengths[0], KERNEL_WAIT_FOREVER);
+    stream_results[0] = kernel_stream_buffer_read(stream_id, discard, STREAM_SIZE, &length, 0);
+
+    // the second write wraps around the end of the ring
+    stream_status |= kernel_stream_buffer_read(stream_id, stream_received[1], STREAM_SIZE, &stream_lengths[1], KERNEL_WAIT_FOREVER);
+
+    // bytes below the trigger level are returned on the timeout
+    size_t start = kernel_get_tick();
+    stream_results[1] = kernel_stream_buffer_read(stream_id, stream_received[2], STREAM_SIZE, &stream_lengths[2], TIMEOUT_TICKS);
+    stream_ticks[0] = kernel_get_tick() - start;
+
+    // a message is only read as a whole
+    stream_results[2] = kernel_stream_buffer_read(stream_message_id, discard, 2, &length, KERNEL_WAIT_FOREVER);
+    for (size_t message = 0; message < 3; message++) {
+        stream_status |= kernel_stream_buffer_read(stream_message_id, stream_messages[message], STREAM_SIZE, &stream_message_lengths[message], KERNEL_WAIT_FOREVER);
+    }
+
+    return 0;
+}
+
+static size_t stream_writing_task(void) {
+    uint8_t pattern[STREAM_SIZE];
+    size_t written = 0;
+
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, stream_isr_write);
+    kernel_delay(1);
+    stream_status |= kernel_stream_buffer_write(stream_id, "cde", 3, &written, 0);
+    kernel_delay(1);
+
+    for (size_t byte = 0; byte < 12; byte++) {
+        pattern[byte] = (uint8_t) byte;
+    }
+    stream_status |= kernel_stream_buffer_write(stream_id, pattern, 12, &written, 0);
+    kernel_delay(1);
+    stream_status |= kernel_stream_buffer_write(stream_id, "xy", 2, &written, 0);
+    kernel_delay(2 * TIMEOUT_TICKS);
+
+    // frames of variable size keep their boundaries
+    stream_status |= kernel_stream_buffer_write(stream_message_id, "abc", 3, &written, 0);
+    stream_status |= kernel_stream_buffer_write(stream_message_id, "defghij", 7, &written, 0);
+    stream_status |= kernel_stream_buffer_write(stream_message_id, "k", 1, &written, 0);
+    stream_results[3] = kernel_stream_buffer_write(stream_message_id, pattern, STREAM_MESSAGE_SIZE, &written, 0);
+
+    // a full ring blocks the writer until the timeout
+    stream_status |= kernel_stream_buffer_write(stream_id, pattern, STREAM_SIZE, &written, 0);
+    size_t start = kernel_get_tick();
+    stream_results[4] = kernel_stream_buffer_write(stream_id, pattern, 1, &stream_full_written, TIMEOUT_TICKS);
+    stream_ticks[1] = kernel_get_tick() - start;
+
+    return 0;
+}
+
+Test(kernel, stream_buffer, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_stream_buffer_create(&stream_id, STREAM_SIZE, STREAM_TRIGGER_LEVEL, false);
+    status |= kernel_stream_buffer_create(&stream_message_id, STREAM_MESSAGE_SIZE, 0, true);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_stream_buffer_create), status);
+
+    status = kernel_add_task(stream_reading_task, 1, "reader", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(stream_writing_task, 2, "writer", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(stream_status, KERNEL_SUCCESS, "expected no error on the stream buffers: %zu", stream_status);
+
+    cr_expect_eq(stream_isr_task_woken, false, "expected no receiver to be woken below the trigger level");
+    cr_expect_eq(stream_lengths[0], 5, "expected the bytes of the interrupt and the task at once: %zu", stream_lengths[0]);
+    cr_expect_eq(memcmp(stream_received[0], "abcde", 5), 0, "expected the bytes in order");
+    cr_expect_eq(stream_results[0], KERNEL_TIMEOUT, "expected a poll of the empty stream to time out: %zu", stream_results[0]);
+
+    cr_expect_eq(stream_lengths[1], 12, "expected the wrapped bytes at once: %zu", stream_lengths[1]);
+    for (size_t byte = 0; byte < 12; byte++) {
+        cr_expect_eq(stream_received[1][byte], byte, "expected byte %zu across the end of the ring", byte);
+    }
+
+    cr_expect_eq(stream_results[1], KERNEL_SUCCESS, "expected the bytes below the trigger level on the timeout: %zu", stream_results[1]);
+    cr_expect_eq(stream_lengths[2], 2, "expected the bytes below the trigger level: %zu", stream_lengths[2]);
+    cr_expect_geq(stream_ticks[0], TIMEOUT_TICKS, "expected to wait for the timeout: %zu ticks", stream_ticks[0]);
+    cr_expect_leq(stream_ticks[0], TIMEOUT_TICKS + 1, "expected to return on the timeout: %zu ticks", stream_ticks[0]);
+
+    cr_expect_neq(stream_results[2], KERNEL_SUCCESS, "expected a message larger than the read buffer to fail");
+    size_t lengths[3] = { 3, 7, 1 };
+    const char *messages[3] = { "abc", "defghij", "k" };
+    for (size_t message = 0; message < 3; message++) {
+        cr_expect_eq(stream_message_lengths[message], lengths[message], "expected message %zu of %zu bytes: %zu", message, lengths[message], stream_message_lengths[message]);
+        cr_expect_eq(memcmp(stream_messages[message], messages[message], lengths[message]), 0, "expected the content of message %zu", message);
+    }
+    cr_expect_neq(stream_results[3], KERNEL_SUCCESS, "expected a message larger than the ring to fail");
+
+    cr_expect_eq(stream_results[4], KERNEL_TIMEOUT, "expected the write into the full ring to time out: %zu", stream_results[4]);
+    cr_expect_eq(stream_full_written, 0, "expected no byte to be written: %zu", stream_full_written);
+    cr_expect_geq(stream_ticks[1], TIMEOUT_TICKS, "expected to wait for the timeout: %zu ticks", stream_ticks[1]);
+    cr_expect_leq(stream_ticks[1], TIMEOUT_TICKS + 1, "expected to return on the timeout: %zu ticks", stream_ticks[1]);
+
+    kernel_deinit();
+}
+
+#define BENCHMARK_STREAM_FRAMES         10000
+#define BENCHMARK_STREAM_FRAME_SIZE     32
+
+static size_t stream_benchmark_id = 0;
+static message_queue_identifier_t *stream_benchmark_queue = NULL;
+static uint64_t stream_buffer_cycles = 0;
+static uint64_t stream_queue_cycles = 0;
+static size_t stream_benchmark_status = KERNEL_SUCCESS;
+
+static size_t benchmark_stream(void) {
+    uint8_t frame[BENCHMARK_STREAM_FRAME_SIZE] = { 0 };
+    uint8_t received[BENCHMARK_STREAM_FRAME_SIZE];
+    size_t length = 0;
+
+    // a frame of bytes is copied by one call in at most two spans
+    for (size_t i = 0; i < BENCHMARK_STREAM_FRAMES; i++) {
+        uint64_t start = benchmark_get_cycles();
+        stream_benchmark_status |= kernel_stream_buffer_write(stream_benchmark_id, frame, BENCHMARK_STREAM_FRAME_SIZE, &length, 0);
+        stream_benchmark_status |= kernel_stream_buffer_read(stream_benchmark_id, received, BENCHMARK_STREAM_FRAME_SIZE, &length, 0);
+        stream_buffer_cycles += benchmark_get_cycles() - start;
+    }
+
+    // a message queue of bytes needs a critical section and a copy per byte
+    for (size_t i = 0; i < BENCHMARK_STREAM_FRAMES; i++) {
+        uint64_t start = benchmark_get_cycles();
+        for (size_t byte = 0; byte < BENCHMARK_STREAM_FRAME_SIZE; byte++) {
+            stream_benchmark_status |= kernel_message_queue_send(&stream_benchmark_queue, &frame[byte], 1, false);
+        }
+        for (size_t byte = 0; byte < BENCHMARK_STREAM_FRAME_SIZE; byte++) {
+            void *message = &received[byte];
+            stream_benchmark_status |= kernel_message_queue_receive(&stream_benchmark_queue, &message);
+        }
+        stream_queue_cycles += benchmark_get_cycles() - start;
+    }
+
+    return 0;
+}
+
+Test(benchmark, stream_buffer, .disabled = SKIP_TEST_BENCHMARK) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_stream_buffer_create(&stream_benchmark_id, 2 * BENCHMARK_STREAM_FRAME_SIZE, 1, false);
+    status |= kernel_message_queue_create(&stream_benchmark_queue, "bytes", BENCHMARK_STREAM_FRAME_SIZE, 1);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_stream_buffer_create), status);
+
+    status = kernel_add_task(benchmark_stream, 1, "stream", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(stream_benchmark_status, KERNEL_SUCCESS, "expected no error on the stream: %zu", stream_benchmark_status);
+
+    cr_log_info("transfer of a %d byte frame: stream buffer %8.2f cycles, message queue of bytes %8.2f cycles", BENCHMARK_STREAM_FRAME_SIZE,
+            (double) stream_buffer_cycles / BENCHMARK_STREAM_FRAMES, (double) stream_queue_cycles / BENCHMARK_STREAM_FRAMES);
+    cr_expect_lt(stream_buffer_cycles, stream_queue_cycles, "expected a frame to be cheaper than %d messages", BENCHMARK_STREAM_FRAME_SIZE);
+
+    kernel_deinit();
+}
+
+#define MEMPOOL_BLOCK_BYTES         20
+#define MEMPOOL_BLOCK_COUNT         2
+
+static size_t mempool_id = 0;
+static uint64_t mempool_storage[MEMPOOL_STORAGE_SIZE(MEMPOOL_BLOCK_BYTES, MEMPOOL_BLOCK_COUNT) / sizeof(uint64_t)];
+static void *mempool_blocks[3];
+static size_t mempool_results[4];
+static size_t mempool_ticks = 0;
+static bool mempool_isr_task_woken = false;
+static size_t mempool_status = KERNEL_SUCCESS;
+
+static void mempool_isr_free(void) {
+    // an interrupt never waits for a block
+    void *block = NULL;
+    bool higher_priority_task_woken = false;
+    mempool_results[2] = kernel_mempool_alloc_from_isr(mempool_id, &block);
+    mempool_status |= kernel_mempool_free_from_isr(mempool_id, mempool_blocks[0], &higher_priority_task_woken);
+    mempool_isr_task_woken = higher_priority_task_woken;
+    kernel_yield_from_isr(higher_priority_task_woken);
+}
+
+static size_t mempool_allocating_task(void) {
+    mempool_status |= kernel_mempool_alloc(mempool_id, &mempool_blocks[0], 0);
+    mempool_status |= kernel_mempool_alloc(mempool_id, &mempool_blocks[1], 0);
+
+    // an exhausted pool fails a poll and a wait up to the timeout
+    void *block = NULL;
+    mempool_results[0] = kernel_mempool_alloc(mempool_id, &block, 0);
+    size_t start = kernel_get_tick();
+    mempool_results[1] = kernel_mempool_alloc(mempool_id, &block, TIMEOUT_TICKS);
+    mempool_ticks = kernel_get_tick() - start;
+
+    // the block returned by the interrupt is handed out again
+    mempool_status |= kernel_mempool_alloc(mempool_id, &mempool_blocks[2], KERNEL_WAIT_FOREVER);
+
+    mempool_results[3] = kernel_mempool_free(mempool_id, (uint8_t *) mempool_blocks[1] + 1);
+    mempool_status |= kernel_mempool_free(mempool_id, mempool_blocks[1]);
+    mempool_status |= kernel_mempool_free(mempool_id, mempool_blocks[2]);
+
+    return 0;
+}
+
+static size_t mempool_freeing_task(void) {
+    kernel_delay(2 * TIMEOUT_TICKS);
+    kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, mempool_isr_free);
+
+    return 0;
+}
+
+Test(kernel, mempool, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_mempool_create(&mempool_id, MEMPOOL_BLOCK_BYTES, MEMPOOL_BLOCK_COUNT, mempool_storage);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mempool_create), status);
+
+    status = kernel_add_task(mempool_allocating_task, 1, "allocator", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(mempool_freeing_task, 2, "freeing", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(mempool_status, KERNEL_SUCCESS, "expected no error on the memory pool: %zu", mempool_status);
+
+    cr_expect_eq((uint8_t *) mempool_blocks[1] - (uint8_t *) mempool_blocks[0], MEMPOOL_BLOCK_SIZE(MEMPOOL_BLOCK_BYTES), "expected adjacent aligned blocks");
+    cr_expect_eq(mempool_results[0], KERNEL_TIMEOUT, "expected a poll of the exhausted pool to time out: %zu", mempool_results[0]);
+    cr_expect_eq(mempool_results[1], KERNEL_TIMEOUT, "expected the wait for a block to time out: %zu", mempool_results[1]);
+    cr_expect_geq(mempool_ticks, TIMEOUT_TICKS, "expected to wait for the timeout: %zu ticks", mempool_ticks);
+    cr_expect_leq(mempool_ticks, TIMEOUT_TICKS + 1, "expected to return on the timeout: %zu ticks", mempool_ticks);
+
+    cr_expect_eq(mempool_results[2], KERNEL_TIMEOUT, "expected the interrupt to get no block: %zu", mempool_results[2]);
+    cr_expect_eq(mempool_isr_task_woken, true, "expected the waiting allocator to be woken by the interrupt");
+    cr_expect_eq(mempool_blocks[2], mempool_blocks[0], "expected the returned block to be handed out again");
+    cr_expect_neq(mempool_results[3], KERNEL_SUCCESS, "expected a pointer into a block to be rejected");
+
+    kernel_mempool_statistics_t statistics = { 0 };
+    status = kernel_mempool_get_statistics(mempool_id, &statistics);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mempool_get_statistics), status);
+    cr_expect_eq(statistics.block_size, MEMPOOL_BLOCK_SIZE(MEMPOOL_BLOCK_BYTES), "expected the rounded block size: %zu", statistics.block_size);
+    cr_expect_eq(statistics.free_blocks, MEMPOOL_BLOCK_COUNT, "expected all blocks to be returned: %zu", statistics.free_blocks);
+    cr_expect_eq(statistics.high_water, MEMPOOL_BLOCK_COUNT, "expected the high water mark of all blocks: %zu", statistics.high_water);
+    cr_expect_eq(statistics.failures, 3, "expected the poll, the timeout and the interrupt to fail: %zu", statistics.failures);
+
+    status = kernel_mempool_delete(&mempool_id);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mempool_delete), status);
+
+    kernel_deinit();
+}
+
+Test(kernel, handle_reuse, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    // deleted objects free their slot, so far more objects than slots are created over time
+    size_t stale_semaphore = HANDLE_TABLE_INVALID_HANDLE;
+    size_t semaphore = 0;
+    size_t mutex = 0;
+    message_queue_identifier_t *message_queue = NULL;
+    for (size_t round = 0; round < 4 * KERNEL_MAX_SEMAPHORE; round++) {
+        status = kernel_semaphore_create(&semaphore, 1);
+        cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s in round %zu: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), round, status);
+        if (round == 0) {
+            stale_semaphore = semaphore;
+        }
+        status = kernel_semaphore_delete(&semaphore);
+        cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_delete), status);
+
+        status = kernel_mutex_create(&mutex);
+        status |= kernel_mutex_delete(&mutex);
+        cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on the mutex in round %zu: %zu", round, status);
+
+        status = kernel_message_queue_create(&message_queue, "reuse", 2, sizeof(size_t));
+        status |= kernel_message_queue_delete(&message_queue);
+        cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on the message queue in round %zu: %zu", round, status);
+    }
+
+    // the slot of the first semaphore is taken again, its old key must not reach the new semaphore
+    status = kernel_semaphore_create(&semaphore, 1);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+    cr_expect_eq(HANDLE_TABLE_INDEX(semaphore), HANDLE_TABLE_INDEX(stale_semaphore), "expected the slot to be reused");
+    cr_expect_neq(kernel_semaphore_acquire_non_blocking(stale_semaphore), KERNEL_SUCCESS, "expected the stale key to be rejected");
+    cr_expect_neq(kernel_semaphore_release(stale_semaphore), KERNEL_SUCCESS, "expected the stale key to be rejected");
+    cr_expect_eq(kernel_semaphore_is_available(semaphore), SEMAPHORE_SUCCESS, "expected the new semaphore untouched");
+
+    // all slots are usable at once
+    size_t semaphores[KERNEL_MAX_SEMAPHORE - 1];
+    for (size_t i = 0; i < KERNEL_MAX_SEMAPHORE - 1; i++) {
+        status = kernel_semaphore_create(&semaphores[i], 1);
+        cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), status);
+    }
+    status = kernel_semaphore_create(&stale_semaphore, 1);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected the semaphores to be exhausted");
+
+    kernel_deinit();
+}
+
+#define SPAWN_ROUNDS                (2 * KERNEL_MAX_TASK)
+#define SPAWNER_ID                  1
+#define SPAWN_WORKER_ID             10
+#define SPAWN_SLEEPER_ID            11
+#define SPAWN_READY_ID              12
+
+static size_t spawn_worker_runs = 0;
+static size_t spawn_preempted_rounds = 0;
+static bool spawn_sleeper_woken = false;
+static bool spawn_ready_run = false;
+static size_t spawn_results[4];
+static size_t spawn_status = KERNEL_SUCCESS;
+
+static size_t spawn_worker(void) {
+    spawn_worker_runs++;
+
+    return 0;
+}
+
+static size_t spawn_sleeper(void) {
+    kernel_delay(5 * TIMEOUT_TICKS);
+    spawn_sleeper_woken = true;
+
+    return 0;
+}
+
+static size_t spawn_ready(void) {
+    spawn_ready_run = true;
+
+    return 0;
+}
+
+static size_t spawner(void) {
+    // a higher priority worker runs at once, the terminated worker of the last round frees the id
+    for (size_t round = 0; round < SPAWN_ROUNDS; round++) {
+        spawn_status |= kernel_task_create(spawn_worker, SPAWN_WORKER_ID, "worker", 1, 1, 0, NULL, 0, TCB_TASK_STACK_SIZE, NULL);
+        if (spawn_worker_runs == round + 1) {
+            spawn_preempted_rounds++;
+        }
+    }
+    spawn_results[0] = kernel_task_create(spawn_worker, SPAWNER_ID, "duplicate", 3, 1, 0, NULL, 0, TCB_TASK_STACK_SIZE, NULL);
+
+    // a lower priority task waits for its turn and is deleted, while it is delayed
+    spawn_status |= kernel_task_create(spawn_sleeper, SPAWN_SLEEPER_ID, "sleeper", 3, 1, 0, NULL, 0, TCB_TASK_STACK_SIZE, NULL);
+    kernel_delay(TIMEOUT_TICKS);
+    spawn_status |= kernel_task_delete(SPAWN_SLEEPER_ID);
+
+    // a ready task is deleted before it ran
+    spawn_status |= kernel_task_create(spawn_ready, SPAWN_READY_ID, "ready", 3, 1, 0, NULL, 0, TCB_TASK_STACK_SIZE, NULL);
+    spawn_status |= kernel_task_delete(SPAWN_READY_ID);
+
+    // the idle loop reaps the terminated and the deleted tasks
+    kernel_delay(10 * TIMEOUT_TICKS);
+    task_t *task = NULL;
+    spawn_results[1] = kernel_task_get_handle(SPAWN_WORKER_ID, &task);
+    spawn_results[2] = kernel_task_get_handle(SPAWN_SLEEPER_ID, &task);
+    spawn_results[3] = kernel_task_delete(SPAWN_READY_ID);
+
+    return 0;
+}
+
+Test(kernel, task_create_delete, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(spawner, SPAWNER_ID, "spawner", 2, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(spawn_status, KERNEL_SUCCESS, "expected no error on creating and deleting tasks: %zu", spawn_status);
+
+    // more workers than pooled tasks were created, so every terminated worker was freed
+    cr_expect_eq(spawn_worker_runs, SPAWN_ROUNDS, "expected every worker to run: %zu", spawn_worker_runs);
+    cr_expect_eq(spawn_preempted_rounds, SPAWN_ROUNDS, "expected every worker to preempt its creator: %zu", spawn_preempted_rounds);
+    cr_expect_neq(spawn_results[0], KERNEL_SUCCESS, "expected a used id to be rejected");
+
+    cr_expect_eq(spawn_sleeper_woken, false, "expected the deleted task to never wake up");
+    cr_expect_eq(spawn_ready_run, false, "expected the deleted task to never run");
+    cr_expect_neq(spawn_results[1], KERNEL_SUCCESS, "expected the terminated worker to be reaped");
+    cr_expect_neq(spawn_results[2], KERNEL_SUCCESS, "expected the deleted task to be reaped");
+    cr_expect_neq(spawn_results[3], KERNEL_SUCCESS, "expected a reaped task to be unknown");
+
+    kernel_deinit();
+}
+
+#define FOREVER_DELETER_ID          1
+#define FOREVER_SEMAPHORE_ID        2
+#define FOREVER_RECEIVER_ID         3
+
+static size_t forever_semaphore = 0;
+static message_queue_identifier_t *forever_queue = NULL;
+static bool forever_returned = false;
+static size_t forever_results[4];
+static size_t forever_status = KERNEL_SUCCESS;
+
+static size_t forever_semaphore_waiter(void) {
+    forever_status |= kernel_semaphore_acquire(forever_semaphore);
+    kernel_semaphore_acquire(forever_semaphore);
+    forever_returned = true;
+
+    return 0;
+}
+
+static size_t forever_receiver(void) {
+    size_t message = 0;
+    void *destination = &message;
+    kernel_message_queue_receive(&forever_queue, &destination);
+    forever_returned = true;
+
+    return 0;
+}
+
+static size_t forever_deleter(void) {
+    // both tasks wait without a timeout and are only linked in the waiting list of their object
+    kernel_delay(1);
+    forever_results[0] = kernel_task_delete(FOREVER_SEMAPHORE_ID);
+    forever_results[1] = kernel_task_delete(FOREVER_RECEIVER_ID);
+
+    // the deleted tasks left the waiting lists and do not take the token or the message
+    size_t message = 1;
+    forever_status |= kernel_semaphore_release(forever_semaphore);
+    forever_status |= kernel_message_queue_send(&forever_queue, &message, sizeof(message), false);
+    kernel_delay(TIMEOUT_TICKS);
+    forever_results[2] = kernel_semaphore_acquire_timeout(forever_semaphore, 0);
+    void *destination = &message;
+    forever_results[3] = kernel_message_queue_receive_timeout(&forever_queue, &destination, 0);
+
+    return 0;
+}
+
+Test(kernel, delete_forever_waiting_task, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_semaphore_create(&forever_semaphore, 1);
+    status |= kernel_message_queue_create(&forever_queue, "forever", 1, sizeof(size_t));
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on creating the objects: %zu", status);
+
+    status = kernel_add_task(forever_deleter, FOREVER_DELETER_ID, "deleter", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(forever_semaphore_waiter, FOREVER_SEMAPHORE_ID, "semaphore", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(forever_receiver, FOREVER_RECEIVER_ID, "receiver", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(forever_status, KERNEL_SUCCESS, "expected no error on the objects: %zu", forever_status);
+
+    cr_expect_eq(forever_results[0], KERNEL_SUCCESS, "expected the semaphore waiter to be deleted: %zu", forever_results[0]);
+    cr_expect_eq(forever_results[1], KERNEL_SUCCESS, "expected the receiver to be deleted: %zu", forever_results[1]);
+    cr_expect_not(forever_returned, "expected the deleted tasks never to return from their wait");
+    cr_expect_eq(forever_results[2], KERNEL_SUCCESS, "expected the token to be left: %zu", forever_results[2]);
+    cr_expect_eq(forever_results[3], KERNEL_SUCCESS, "expected the message to be left: %zu", forever_results[3]);
+
+    kernel_deinit();
+}
+
+#define PENDING_DELETER_ID          1
+#define PENDING_PEER_IDS            2
+#define PENDING_DELAY               2
+#define PENDING_QUANTUM             8
+
+static uint8_t pending_deleted_id = 0;
+static uint8_t pending_priority = 0;
+static bool pending_runs[PENDING_PEER_IDS + 2] = {false};
+static size_t pending_order[2] = {0};
+static size_t pending_order_count = 0;
+static size_t pending_status = KERNEL_SUCCESS;
+
+static size_t pending_peer(void) {
+    kernel_delay(PENDING_DELAY);
+    pending_runs[g_running_task_current->task_data->u8TaskId] = true;
+    pending_order[pending_order_count++] = g_running_task_current->task_data->u8TaskId;
+
+    return 0;
+}
+
+static size_t pending_deleter(void) {
+    // both peers are released within the time quantum, one of them is preset to preempt the deleter
+    kernel_delay_blocking(PENDING_DELAY + 2);
+    pending_priority = g_running_task_next->task_data->u8TaskPrio;
+    pending_deleted_id = g_running_task_next->task_data->u8TaskId;
+    pending_status |= kernel_task_delete(pending_deleted_id);
+
+    // the other peer preempts the deleter at the end of its time quantum
+    kernel_delay_blocking(2 * PENDING_QUANTUM);
+    pending_order[pending_order_count++] = PENDING_DELETER_ID;
+
+    return 0;
+}
+
+Test(kernel, delete_pending_task, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(pending_deleter, PENDING_DELETER_ID, "deleter", 2, PENDING_QUANTUM, 0, NULL, 0);
+    for (uint8_t id = PENDING_DELETER_ID + 1; id <= PENDING_PEER_IDS + 1; id++) {
+        status |= kernel_add_task(pending_peer, id, "peer", 1, 1, 0, NULL, 0);
+    }
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(pending_status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_task_delete), pending_status);
+    cr_expect_eq(pending_priority, 1, "expected a peer to be preset as next task: %u", pending_priority);
+    cr_expect(!pending_runs[pending_deleted_id], "expected the deleted peer to never run");
+
+    // the remaining peer of the higher priority group runs before the deleter finished
+    cr_expect_eq(pending_order_count, 2, "expected the peer and the deleter to finish: %zu", pending_order_count);
+    cr_expect_neq(pending_order[0], PENDING_DELETER_ID, "expected the remaining peer to preempt the deleter");
+    cr_expect_eq(pending_order[1], PENDING_DELETER_ID, "expected the deleter to finish last: %zu", pending_order[1]);
+
+    kernel_deinit();
+}
+
+#define CPU_ROUNDS                  20
+#define CPU_BUSY_ID                 1
+#define CPU_LIGHT_ID                2
+#define CPU_BUSY_NS                 200000
+#define CPU_LIGHT_NS                50000
+#define CPU_ISR_NS                  20000
+
+static size_t cpu_status = KERNEL_SUCCESS;
+static bool cpu_done = false;
+static kernel_task_statistics_t cpu_task_statistics[2];
+static kernel_cpu_statistics_t cpu_statistics;
+
+static void cpu_spin(uint64_t nanoseconds) {
+    uint64_t start = benchmark_get_time_ns();
+    while (benchmark_get_time_ns() - start < nanoseconds);
+}
+
+static void cpu_interrupt(void) {
+    cpu_spin(CPU_ISR_NS);
+}
+
+static size_t cpu_light_task(void) {
+    while (!cpu_done) {
+        cpu_spin(CPU_LIGHT_NS);
+        cpu_status |= kernel_delay(KERNEL_CPU_LOAD_PERIOD);
+    }
+
+    return 0;
+}
+
+static size_t cpu_busy_task(void) {
+    // every round fills a sample period, so the sliding window is full afterwards
+    for (size_t round = 0; round < CPU_ROUNDS; round++) {
+        cpu_spin(CPU_BUSY_NS);
+        kernel_host_raise_interrupt(KERNEL_MAX_SYSCALL_PRIORITY, cpu_interrupt);
+        cpu_status |= kernel_delay(KERNEL_CPU_LOAD_PERIOD);
+    }
+
+    // the tasks are queried first, so the system has run at least as long afterwards
+    cpu_status |= kernel_task_get_statistics(CPU_BUSY_ID, &cpu_task_statistics[0]);
+    cpu_status |= kernel_task_get_statistics(CPU_LIGHT_ID, &cpu_task_statistics[1]);
+    cpu_status |= kernel_cpu_get_statistics(&cpu_statistics);
+    cpu_done = true;
+
+    return 0;
+}
+
+Test(kernel, cpu_statistics, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_add_task(cpu_busy_task, CPU_BUSY_ID, "busy", 1, 1, 0, NULL, 0);
+    status |= kernel_add_task(cpu_light_task, CPU_LIGHT_ID, "light", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    status = kernel_task_get_statistics(CPU_BUSY_ID, &cpu_task_statistics[0]);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_task_get_statistics), status);
+    cr_expect_eq(cpu_task_statistics[0].cycles, 0, "expected no cycles before the task ran");
+    status = kernel_task_get_statistics(KERNEL_MAX_TASK - 1, &cpu_task_statistics[0]);
+    cr_expect_neq(status, KERNEL_SUCCESS, "expected an unknown task to be rejected");
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(cpu_status, KERNEL_SUCCESS, "expected no error on the cpu statistics: %zu", cpu_status);
+
+    // the host counts nanoseconds as cycles
+    kernel_task_statistics_t *busy = &cpu_task_statistics[0];
+    kernel_task_statistics_t *light = &cpu_task_statistics[1];
+    cr_expect_geq(busy->cycles, (uint64_t) CPU_ROUNDS * CPU_BUSY_NS, "expected the busy task to be charged: %zu", (size_t) busy->cycles);
+    cr_expect_lt(light->cycles, busy->cycles, "expected the light task to run shorter: %zu", (size_t) light->cycles);
+    cr_expect_geq(busy->activations, CPU_ROUNDS, "expected a switch to the task every round: %zu", busy->activations);
+    cr_expect_gt(busy->load, light->load, "expected a higher share of the busy task: %zu %zu", busy->load, light->load);
+    cr_expect_leq(busy->load, 100, "expected a percentage: %zu", busy->load);
+
+    // every cycle belongs to exactly one account
+    cr_expect_geq(cpu_statistics.isr_cycles, (uint64_t) CPU_ROUNDS * CPU_ISR_NS, "expected the interrupts to be charged: %zu", (size_t) cpu_statistics.isr_cycles);
+    cr_expect_gt(cpu_statistics.idle_cycles, 0, "expected idle cycles while both tasks were delayed");
+    cr_expect_geq(cpu_statistics.total_cycles, busy->cycles + light->cycles + cpu_statistics.idle_cycles + cpu_statistics.isr_cycles,
+            "expected the total to cover all accounts: %zu", (size_t) cpu_statistics.total_cycles);
+    cr_expect_gt(cpu_statistics.load, 0, "expected a load of the busy tasks: %zu", cpu_statistics.load);
+    cr_expect_leq(cpu_statistics.load, 100, "expected a percentage: %zu", cpu_statistics.load);
+
+    kernel_deinit();
+}
+
+#define TLSF_TEST_HEAP_SIZE         4096
+
+static uint64_t tlsf_test_memory[TLSF_TEST_HEAP_SIZE / sizeof(uint64_t)];
+
+Test(tlsf, allocate_and_free, .disabled = SKIP_TEST_TLSF) {
+    tlsf_t storage;
+    tlsf_t *tlsf = NULL;
+    size_t status = tlsf_create_static(&tlsf, &storage, tlsf_test_memory, 16);
+    cr_expect_eq(status, TLSF_INVALID_SIZE, "expected a region without a block to be rejected: %zu", status);
+
+    status = tlsf_create_static(&tlsf, &storage, tlsf_test_memory, sizeof(tlsf_test_memory));
+    cr_assert_eq(status, TLSF_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(tlsf_create_static), status);
+
+    tlsf_statistics_t statistics;
+    tlsf_get_statistics(&tlsf, &statistics);
+    size_t heap_size = statistics.heap_size;
+    cr_expect_eq(statistics.free_blocks, 1, "expected a single free block: %zu", statistics.free_blocks);
+    cr_expect_eq(statistics.largest_free_block, heap_size, "expected the whole heap to be free: %zu", statistics.largest_free_block);
+
+    // blocks of different size classes are aligned and do not overlap
+    size_t sizes[6] = { 1, 24, 100, 129, 700, 1000 };
+    uint8_t *blocks[6];
+    for (size_t block = 0; block < 6; block++) {
+        blocks[block] = tlsf_allocate(&tlsf, sizes[block]);
+        cr_assert_not_null(blocks[block], "expected a block of %zu bytes", sizes[block]);
+        cr_expect_eq((uintptr_t) blocks[block] % TLSF_ALIGN_SIZE, 0, "expected block %zu to be aligned", block);
+        memset(blocks[block], (int) block, sizes[block]);
+    }
+    for (size_t block = 0; block < 6; block++) {
+        for (size_t byte = 0; byte < sizes[block]; byte++) {
+            cr_expect_eq(blocks[block][byte], block, "expected block %zu to keep its content", block);
+        }
+    }
+
+    status = tlsf_free(&tlsf, blocks[2] + 8);
+    cr_expect_eq(status, TLSF_INVALID_BLOCK, "expected a pointer into a block to be rejected: %zu", status);
+    status = tlsf_free(&tlsf, tlsf_test_memory);
+    cr_expect_eq(status, TLSF_INVALID_BLOCK, "expected a pointer in front of the heap to be rejected: %zu", status);
+
+    // free blocks in between stay apart until their neighbours are returned
+    status = tlsf_free(&tlsf, blocks[1]);
+    status |= tlsf_free(&tlsf, blocks[3]);
+    cr_expect_eq(status, TLSF_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(tlsf_free), status);
+    status = tlsf_free(&tlsf, blocks[3]);
+    cr_expect_eq(status, TLSF_INVALID_BLOCK, "expected a double free to be rejected: %zu", status);
+
+    tlsf_get_statistics(&tlsf, &statistics);
+    cr_expect_eq(statistics.free_blocks, 3, "expected the returned blocks and the rest of the heap: %zu", statistics.free_blocks);
+    cr_expect_gt(statistics.fragmentation, 0, "expected a fragmented heap");
+
+    // a request larger than every free block fails
+    cr_expect_null(tlsf_allocate(&tlsf, heap_size), "expected no block of the whole heap");
+    cr_expect_null(tlsf_allocate(&tlsf, (size_t) -1), "expected no block beyond the size classes");
+
+    status = TLSF_SUCCESS;
+    for (size_t block = 0; block < 6; block++) {
+        if (block != 1 && block != 3) {
+            status |= tlsf_free(&tlsf, blocks[block]);
+        }
+    }
+    cr_expect_eq(status, TLSF_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(tlsf_free), status);
+
+    // all neighbours are merged into the initial block again
+    tlsf_get_statistics(&tlsf, &statistics);
+    cr_expect_eq(statistics.free_blocks, 1, "expected the blocks to be merged: %zu", statistics.free_blocks);
+    cr_expect_eq(statistics.largest_free_block, heap_size, "expected the whole heap to be free: %zu", statistics.largest_free_block);
+    cr_expect_eq(statistics.fragmentation, 0, "expected no fragmentation: %zu", statistics.fragmentation);
+    cr_expect_eq(statistics.used_size, 0, "expected no used bytes: %zu", statistics.used_size);
+    cr_expect_eq(statistics.failures, 2, "expected both failed allocations to be counted: %zu", statistics.failures);
+
+    // a request is rounded up to the next size class, which is one second level step larger
+    uint8_t *large = tlsf_allocate(&tlsf, heap_size - heap_size / TLSF_SL_INDEX_COUNT);
+    cr_expect_not_null(large, "expected a block of most of the heap");
+    tlsf_free(&tlsf, large);
+}
+
+#define HEAP_TEST_SIZE              (64 * 1024)
+
+static uint64_t heap_memory[HEAP_TEST_SIZE / sizeof(uint64_t)];
+static message_queue_identifier_t *heap_queue = NULL;
+static size_t heap_status = KERNEL_SUCCESS;
+static size_t heap_received = 0;
+
+static size_t heap_sending_task(void) {
+    for (size_t message = 1; message <= 4; message++) {
+        heap_status |= kernel_message_queue_send(&heap_queue, &message, sizeof(message), false);
+    }
+
+    return 0;
+}
+
+static size_t heap_receiving_task(void) {
+    kernel_delay(1);
+    for (size_t message = 0; message < 4; message++) {
+        size_t value = 0;
+        void *destination = &value;
+        heap_status |= kernel_message_queue_receive(&heap_queue, &destination);
+        heap_received += value;
+    }
+
+    return 0;
+}
+
+Test(kernel, heap, .disabled = SKIP_TEST_KERNEL) {
+    size_t status = kernel_heap_create(heap_memory, sizeof(heap_memory));
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_heap_create), status);
+    status = kernel_heap_create(heap_memory, sizeof(heap_memory));
+    cr_expect_eq(status, KERNEL_NO_HEAP, "expected a single heap: %zu", status);
+
+    status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    status = kernel_message_queue_create(&heap_queue, "heap", 4, sizeof(size_t));
+    status |= kernel_add_task(heap_sending_task, 1, "sender", 2, 1, 0, NULL, 0);
+    status |= kernel_add_task(heap_receiving_task, 2, "receiver", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    // tasks, their stacks and the message queue are taken from the heap
+    tlsf_statistics_t statistics;
+    status = kernel_heap_get_statistics(&statistics);
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_heap_get_statistics), status);
+    cr_expect_gt(statistics.used_blocks, 0, "expected the kernel objects in the heap");
+
+    status = kernel_start();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+    cr_expect_eq(heap_status, KERNEL_SUCCESS, "expected no error on the message queue: %zu", heap_status);
+    cr_expect_eq(heap_received, 10, "expected all messages: %zu", heap_received);
+
+    kernel_deinit();
+
+    kernel_heap_get_statistics(&statistics);
+    cr_log_info("heap after kernel_deinit: %zu of %zu bytes used, at most %zu bytes, %zu free blocks, fragmentation %zu %%",
+            statistics.used_size, statistics.heap_size, statistics.used_size_max, statistics.free_blocks, statistics.fragmentation);
+    cr_expect_eq(statistics.failures, 0, "expected no failed allocation: %zu", statistics.failures);
+
+    status = kernel_heap_delete();
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected every block to be returned on %s: %zu", GET_FUNCTION_NAME(kernel_deinit), status);
+}
+
+#define BENCHMARK_HEAP_SIZE         (1024 * 1024)
+#define BENCHMARK_HEAP_SLOTS        512
+#define BENCHMARK_HEAP_OPERATIONS   200000
+#define BENCHMARK_HEAP_MAX_BLOCK    1024
+
+static uint64_t benchmark_heap_memory[BENCHMARK_HEAP_SIZE / sizeof(uint64_t)];
+
+static void *benchmark_malloc(void *context, size_t size) {
+    (void) context;
+    return malloc(size);
+}
+
+static void benchmark_free(void *context, void *block) {
+    (void) context;
+    free(block);
+}
+
+// the same random sequence of allocations and frees of random sizes is run against every heap
+static size_t benchmark_heap_stress(const allocator_t *allocator, double *average, uint64_t *worst) {
+    void *slots[BENCHMARK_HEAP_SLOTS] = { NULL };
+    uint64_t total = 0;
+    size_t failures = 0;
+    *worst = 0;
+
+    srand(7);
+    for (size_t operation = 0; operation < BENCHMARK_HEAP_OPERATIONS; operation++) {
+        size_t slot = (size_t) rand() % BENCHMARK_HEAP_SLOTS;
+        size_t size = 1 + (size_t) rand() % BENCHMARK_HEAP_MAX_BLOCK;
+
+        uint64_t start = benchmark_get_cycles();
+        if (slots[slot] != NULL) {
+            allocator->free(allocator->context, slots[slot]);
+            slots[slot] = NULL;
+        }
+        else {
+            slots[slot] = allocator->allocate(allocator->context, size);
+            failures += (slots[slot] == NULL);
+        }
+        uint64_t cycles = benchmark_get_cycles() - start;
+
+        total += cycles;
+        if (cycles > *worst) {
+            *worst = cycles;
+        }
+    }
+
+    for (size_t slot = 0; slot < BENCHMARK_HEAP_SLOTS; slot++) {
+        if (slots[slot] != NULL) {
+            allocator->free(allocator->context, slots[slot]);
+        }
+    }
+    *average = (double) total / BENCHMARK_HEAP_OPERATIONS;
+
+    return failures;
+}
+
+Test(benchmark, tlsf_stress, .disabled = SKIP_TEST_BENCHMARK) {
+    // page faults on the first touch of the region are no property of the heap
+    memset(benchmark_heap_memory, 0, sizeof(benchmark_heap_memory));
+
+    tlsf_t storage;
+    tlsf_t *tlsf = NULL;
+    size_t status = tlsf_create_static(&tlsf, &storage, benchmark_heap_memory, sizeof(benchmark_heap_memory));
+    cr_assert_eq(status, TLSF_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(tlsf_create_static), status);
+
+    allocator_t heaps[2] = {
+        { tlsf_allocator_allocate, tlsf_allocator_free, tlsf },
+        { benchmark_malloc, benchmark_free, NULL },
+    };
+    double average[2];
+    uint64_t worst[2];
+    size_t failures[2];
+    for (size_t heap = 0; heap < 2; heap++) {
+        // the first run warms up the caches and the pages of both heaps
+        benchmark_heap_stress(&heaps[heap], &average[heap], &worst[heap]);
+        failures[heap] = benchmark_heap_stress(&heaps[heap], &average[heap], &worst[heap]);
+    }
+
+    tlsf_statistics_t statistics;
+    tlsf_get_statistics(&tlsf, &statistics);
+    cr_log_info("%d random calls of up to %d bytes: tlsf average %8.2f cycles, worst %8llu cycles, peak %zu bytes",
+            BENCHMARK_HEAP_OPERATIONS, BENCHMARK_HEAP_MAX_BLOCK, average[0], (unsigned long long) worst[0], statistics.used_size_max);
+    cr_log_info("%d random calls of up to %d bytes: libc average %8.2f cycles, worst %8llu cycles",
+            BENCHMARK_HEAP_OPERATIONS, BENCHMARK_HEAP_MAX_BLOCK, average[1], (unsigned long long) worst[1]);
+
+    cr_expect_eq(failures[0], 0, "expected the heap to serve every allocation: %zu", failures[0]);
+    cr_expect_eq(failures[1], 0, "expected libc to serve every allocation: %zu", failures[1]);
+
+    // every block was returned and merged with its neighbours
+    cr_expect_eq(statistics.free_blocks, 1, "expected a single free block: %zu", statistics.free_blocks);
+    cr_expect_eq(statistics.used_size, 0, "expected no used bytes: %zu", statistics.used_size);
+}
@@ -0,0 +1,158 @@
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+#include "kernel/kernel.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+
+#define GET_FUNCTION_NAME(x) (#x)
+
+#define SKIP_TEST_STATIC_ALLOCATION     0
+
+#define STATIC_QUEUE_SIZE               4
+#define STATIC_MESSAGES                 8
+#define STATIC_TIMER_PERIOD             3
+#define STATIC_STACK_SIZE               256
+
+// every heap call of the library is counted, the test binary is linked with --wrap
+static size_t g_heap_calls = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+void __real_free(void *pointer);
+
+void *__wrap_malloc(size_t size) {
+    g_heap_calls++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    g_heap_calls++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+    g_heap_calls++;
+    return __real_realloc(pointer, size);
+}
+
+void __wrap_free(void *pointer) {
+    g_heap_calls++;
+    __real_free(pointer);
+}
+
+// caller supplied storage
+static message_queue_static_t g_queue_storage;
+static void *g_queue_data[STATIC_QUEUE_SIZE];
+static size_t g_queue_buffer[STATIC_QUEUE_SIZE];
+static task_static_t g_task_storage;
+static uint32_t g_task_stack[STATIC_STACK_SIZE] __attribute__((aligned(8)));
+static uint32_t g_unused_task_stack[STATIC_STACK_SIZE] __attribute__((aligned(8)));
+
+static message_queue_identifier_t *g_queue = NULL;
+static size_t g_mutex = 0;
+static size_t g_timer = 0;
+static size_t g_shared_counter = 0;
+static size_t g_received_sum = 0;
+static size_t g_timer_expirations = 0;
+static size_t g_runtime_semaphore_status = KERNEL_SUCCESS;
+static size_t g_heap_calls_after_start = 0;
+
+static void static_timer_callback(size_t id) {
+    (void) id;
+    g_timer_expirations++;
+}
+
+static size_t static_producer(void) {
+    kernel_timer_start(g_timer);
+
+    for (size_t message = 1; message <= STATIC_MESSAGES; message++) {
+        kernel_mutex_acquire(g_mutex);
+        g_shared_counter++;
+        kernel_mutex_release(g_mutex);
+
+        kernel_message_queue_send(&g_queue, &message, sizeof(message), false);
+        kernel_delay(2);
+    }
+
+    kernel_timer_stop(g_timer);
+
+    return 0;
+}
+
+static size_t static_consumer(void) {
+    // objects created at runtime are taken from the pools as well
+    size_t semaphore = 0;
+    g_runtime_semaphore_status = kernel_semaphore_create(&semaphore, 1);
+
+    for (size_t message = 0; message < STATIC_MESSAGES; message++) {
+        // messages are copied to the receivers buffer
+        size_t received = 0;
+        size_t *buffer = &received;
+        kernel_message_queue_receive(&g_queue, (void **) &buffer);
+        g_received_sum += received;
+
+        kernel_semaphore_acquire(semaphore);
+        kernel_mutex_acquire(g_mutex);
+        g_shared_counter++;
+        kernel_mutex_release(g_mutex);
+        kernel_semaphore_release(semaphore);
+    }
+
+    return 0;
+}
+
+Test(static_allocation, no_heap_after_kernel_start, .disabled = SKIP_TEST_STATIC_ALLOCATION) {
+    size_t status = kernel_init();
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_init), status);
+
+    // variable sized storage has no pool
+    message_queue_identifier_t *heap_queue = NULL;
+    status = kernel_message_queue_create(&heap_queue, "heap", STATIC_QUEUE_SIZE, sizeof(size_t));
+    cr_expect_neq(status, KERNEL_SUCCESS, "message queue buffers have to be supplied on %s: %zu", GET_FUNCTION_NAME(kernel_message_queue_create), status);
+
+    status = kernel_message_queue_create_static(&g_queue, "static", STATIC_QUEUE_SIZE, sizeof(size_t), &g_queue_storage, g_queue_data, g_queue_buffer);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_message_queue_create_static), status);
+
+    status = kernel_mutex_create(&g_mutex);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_mutex_create), status);
+
+    status = kernel_timer_create(&g_timer, static_timer_callback, STATIC_TIMER_PERIOD, true);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_timer_create), status);
+
+    status = kernel_add_task(static_producer, 1, "producer", 1, 1, 0, NULL, 0);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task), status);
+
+    // stacks of other sizes are not pooled
+    status = kernel_add_task_with_stack(static_consumer, 2, "consumer", 2, 1, 0, NULL, 0, STATIC_STACK_SIZE, NULL);
+    cr_expect_neq(status, KERNEL_SUCCESS, "stacks of other sizes have to be supplied on %s: %zu", GET_FUNCTION_NAME(kernel_add_task_with_stack), status);
+
+    status = kernel_add_task_with_stack(static_consumer, 2, "consumer", 2, 1, 0, NULL, 0, STATIC_STACK_SIZE, g_task_stack);
+    cr_assert_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_add_task_with_stack), status);
+
+    // a task in caller supplied storage does not touch the pools either
+    task_t *task = NULL;
+    status = task_create_static(&task, &g_task_storage, static_consumer, NULL, 3, "unused", 3, 1, 0, NULL, 0, STATIC_STACK_SIZE, g_unused_task_stack);
+    cr_expect_eq(status, TASK_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(task_create_static), status);
+    status = task_delete(&task);
+    cr_expect_eq(status, TASK_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(task_delete), status);
+
+    size_t heap_calls_before_start = g_heap_calls;
+    status = kernel_start();
+    g_heap_calls_after_start = g_heap_calls - heap_calls_before_start;
+    cr_expect_eq(status, KERNEL_SUCCESS, "expected no error on %s: %zu", GET_FUNCTION_NAME(kernel_start), status);
+
+    cr_expect_eq(g_heap_calls_after_start, 0, "expected no heap calls after %s: %zu", GET_FUNCTION_NAME(kernel_start), g_heap_calls_after_start);
+    cr_expect_eq(g_runtime_semaphore_status, KERNEL_SUCCESS, "expected no error on %s at runtime: %zu", GET_FUNCTION_NAME(kernel_semaphore_create), g_runtime_semaphore_status);
+    cr_expect_eq(g_received_sum, STATIC_MESSAGES * (STATIC_MESSAGES + 1) / 2, "expected every message to be received: %zu", g_received_sum);
+    cr_expect_eq(g_shared_counter, 2 * STATIC_MESSAGES, "expected every critical section to be entered: %zu", g_shared_counter);
+    cr_expect_gt(g_timer_expirations, 0, "expected the auto reload timer to expire");
+
+    heap_calls_before_start = g_heap_calls;
+    status = kernel_deinit();
+    size_t heap_calls_deinit = g_heap_calls - heap_calls_before_start;
+    cr_expect_eq(heap_calls_deinit, 0, "expected no heap calls on %s: %zu", GET_FUNCTION_NAME(kernel_deinit), heap_calls_deinit);
+
+    cr_log_info("tick %zu, %zu timer expirations, %zu heap calls in total", kernel_get_tick(), g_timer_expirations, g_heap_calls);
+}
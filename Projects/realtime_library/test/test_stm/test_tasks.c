@@ -43,6 +43,11 @@
 #define TASK_ID_PRIORITY            MAX_TASKS_PER_COMPONENT * 6
 #define TASK_ID_EXIT_TO_SCHEDULER   MAX_TASKS_PER_COMPONENT * 7
 #define TASK_ID_TERMINATE           MAX_TASKS_PER_COMPONENT * 8
+#define TASK_ID_TIMER               MAX_TASKS_PER_COMPONENT * 9
+#define TASK_ID_STACK               MAX_TASKS_PER_COMPONENT * 10
+
+#define SMALL_STACK_SIZE            64
+#define LARGE_STACK_SIZE            512
 
 #define DEFAULT_TASK_RUNTIME        1
 
@@ -58,6 +63,13 @@ size_t mutex_id = 0;
 int g_count_non_blocking_mutex = 0;
 size_t non_blocking_mutex_id = 1;
 
+size_t g_count_timer = 0;
+size_t periodic_timer_id = 0;
+size_t one_shot_timer_id = 0;
+
+// provided stacks have to be 8 byte aligned
+uint32_t g_small_stack[SMALL_STACK_SIZE] __attribute__((aligned(8)));
+
 message_queue_identifier_t *message_queue_identifier;
 message_queue_identifier_t *message_queue_identifier_blocked_sender = NULL;
 
@@ -81,13 +93,17 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
 
     if (GPIO_Pin == BUTTON_EXTI13_Pin
             && HAL_GPIO_ReadPin(BUTTON_EXTI13_GPIO_Port, BUTTON_EXTI13_Pin) == GPIO_PIN_RESET) {
-        kernel_event_send(TASK_ID_TERMINATE+1, 1 << 3);
+        bool higher_priority_task_woken = false;
+        kernel_event_send_from_isr(TASK_ID_TERMINATE+1, 1 << 3, &higher_priority_task_woken);
 
 #if TEST_TASKS_MESSAGE_QUEUE
         // can't send a message if message queues are missing
         uint32_t message = 42;
-        kernel_message_queue_send(&message_queue_identifier, &message, sizeof(uint32_t), true);
+        kernel_message_queue_send_from_isr(&message_queue_identifier, &message, sizeof(uint32_t), true, &higher_priority_task_woken);
 #endif
+
+        // a single context switch after the interrupt returned
+        kernel_yield_from_isr(higher_priority_task_woken);
     }
 }
 
@@ -434,6 +450,60 @@ size_t test_task_terminate_rtos(void) {
     return 0;
 }
 
+// -------------- timer testing --------------
+void test_timer_periodic(size_t id) {
+    g_count_timer++;
+    safe_print("Timer %d: %d\n", id, g_count_timer);
+}
+
+void test_timer_one_shot(size_t id) {
+    // ends the periodic timer after about 5 periods
+    kernel_timer_stop(periodic_timer_id);
+    safe_print("Timer %d stopped periodic timer at %d\n", id, g_count_timer);
+}
+
+size_t test_task_timer(void) {
+    while(1) {
+        // restarts the periodic timer and keeps postponing the one shot timer for a while
+        kernel_delay(2000);
+        kernel_timer_start(periodic_timer_id);
+        kernel_timer_reset(one_shot_timer_id);
+    }
+
+    return 0;
+}
+
+// -------------- stack testing --------------
+size_t test_task_small_stack(void) {
+    size_t count = 0;
+    while(1) {
+        // runs on the provided stack, which is only half the default size
+        count++;
+        safe_print("Small stack: %d\n", count);
+        kernel_delay(500);
+    }
+
+    return 0;
+}
+
+size_t test_task_large_stack(void) {
+    // uses more than the default stack size, which only fits into an individual stack
+    volatile uint32_t buffer[2 * TCB_TASK_STACK_SIZE];
+    size_t sum = 0;
+    while(1) {
+        for (size_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); i++) {
+            buffer[i] = i;
+        }
+        for (size_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); i++) {
+            sum += buffer[i];
+        }
+        safe_print("Large stack: %d\n", sum);
+        kernel_delay(500);
+    }
+
+    return 0;
+}
+
 // -------------- monitor task --------------
 #ifdef SEGGER
 size_t monitor_task(void) {
@@ -540,6 +610,21 @@ size_t test_tasks_init(void) {
     kernel_add_task(test_task_terminate_rtos, TASK_ID_TERMINATE+1, "WALL-E", 0, DEFAULT_TASK_RUNTIME, 1 << 3, notification_terminate_condition, 10);
 #endif
 
+#if TEST_TASKS_TIMER
+    // software timer testing, the callbacks share the stack of the timer daemon
+    kernel_timer_create(&periodic_timer_id, test_timer_periodic, 100, true);
+    kernel_timer_create(&one_shot_timer_id, test_timer_one_shot, 550, false);
+    kernel_timer_start(periodic_timer_id);
+    kernel_timer_start(one_shot_timer_id);
+    kernel_add_task(test_task_timer, TASK_ID_TIMER, STRINGIFY(test_task_timer), 0, DEFAULT_TASK_RUNTIME, 0, NULL, 0);
+#endif
+
+#if TEST_TASKS_STACK
+    // individual stacks, a provided one and a larger one allocated by the kernel
+    kernel_add_task_with_stack(test_task_small_stack, TASK_ID_STACK, STRINGIFY(test_task_small_stack), 0, DEFAULT_TASK_RUNTIME, 0, NULL, 0, SMALL_STACK_SIZE, g_small_stack);
+    kernel_add_task_with_stack(test_task_large_stack, TASK_ID_STACK+1, STRINGIFY(test_task_large_stack), 0, DEFAULT_TASK_RUNTIME, 0, NULL, 0, LARGE_STACK_SIZE, NULL);
+#endif
+
     // We attempted using a delay here to wait for SEGGER System View to recognize the start of the recording.
     // For some unknown reason, this causes a hard fault soon during kernel_start.
     // We recommend instead to set a breakpoint here at the call of kernel_start and start the
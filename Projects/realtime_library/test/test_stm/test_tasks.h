@@ -34,6 +34,8 @@
 #define TEST_TASKS_PRIORITY             0
 #define TEST_TASKS_EXIT_TO_SCHEDULER    0   // cannot run alone!
 #define TEST_TASKS_TERMINATE            0
+#define TEST_TASKS_TIMER                0
+#define TEST_TASKS_STACK                0
 
 
 size_t test_tasks_init(void);